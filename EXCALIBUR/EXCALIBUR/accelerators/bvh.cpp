@@ -1,7 +1,28 @@
 ﻿#include "bvh.h"
+#include "../parallel/Parallel.h"
+#include <chrono>
 
 RENDERING_BEGIN
 
+STAT_MEMORY_COUNTER("Memory/BVH tree", treeBytes);
+STAT_RATIO("BVH/Primitives per leaf node", totalPrimitives, totalLeafNodes);
+STAT_COUNTER("BVH/Interior nodes", interiorNodes);
+STAT_COUNTER("BVH/Leaf nodes", leafNodes);
+STAT_FLOAT_DISTRIBUTION("BVH/SAH build time (ms)", sahBuildTimeMS);
+STAT_FLOAT_DISTRIBUTION("BVH/HLBVH build time (ms)", hlbvhBuildTimeMS);
+STAT_FLOAT_DISTRIBUTION("BVH/Middle build time (ms)", middleBuildTimeMS);
+STAT_FLOAT_DISTRIBUTION("BVH/EqualCounts build time (ms)", equalCountsBuildTimeMS);
+
+static const char* splitMethodName(BVHAccel::SplitMethod splitMethod)
+{
+    switch (splitMethod) {
+    case BVHAccel::SplitMethod::HLBVH: return "HLBVH";
+    case BVHAccel::SplitMethod::Middle: return "Middle";
+    case BVHAccel::SplitMethod::EqualCounts: return "EqualCounts";
+    default: return "SAH";
+    }
+}
+
 // BVHAccel Utility Functions
 inline uint32_t LeftShift3(uint32_t x) 
 {
@@ -37,6 +58,8 @@ inline uint32_t EncodeMorton3(const Vector3f& v)
     return (LeftShift3(v.z) << 2) | (LeftShift3(v.y) << 1) | LeftShift3(v.x);
 }
 
+// 并行基数排序：每一趟将数组分块，各块并行统计桶计数，
+// 按(桶, 块)顺序做前缀和后再并行分发，结果与串行版本一致（稳定排序）
 static void RadixSort(std::vector<MortonPrimitive>* v) 
 {
     std::vector<MortonPrimitive> tempVector(v->size());
@@ -45,6 +68,16 @@ static void RadixSort(std::vector<MortonPrimitive>* v)
     static_assert((nBits % bitsPerPass) == 0,
         "Radix sort bitsPerPass must evenly divide nBits");
     CONSTEXPR int nPasses = nBits / bitsPerPass;
+    CONSTEXPR int nBuckets = 1 << bitsPerPass;
+    CONSTEXPR int bitMask = (1 << bitsPerPass) - 1;
+
+    // Split the array into chunks processed by independent tasks
+    CONSTEXPR int64_t minChunkSize = 4096;
+    int64_t size = v->size();
+    int64_t nChunks = std::max<int64_t>(1, std::min<int64_t>(
+        4 * maxThreadIndex(), (size + minChunkSize - 1) / minChunkSize));
+    int64_t chunkSize = (size + nChunks - 1) / nChunks;
+    std::vector<int> bucketCount(nChunks * nBuckets);
 
     for (int pass = 0; pass < nPasses; ++pass) {
         // Perform one pass of radix sort, sorting _bitsPerPass_ bits
@@ -55,27 +88,39 @@ static void RadixSort(std::vector<MortonPrimitive>* v)
         std::vector<MortonPrimitive>& out = (pass & 1) ? *v : tempVector;
 
         // Count number of zero bits in array for current radix sort bit
-        CONSTEXPR int nBuckets = 1 << bitsPerPass;
-        int bucketCount[nBuckets] = { 0 };
-        CONSTEXPR int bitMask = (1 << bitsPerPass) - 1;
-        for (const MortonPrimitive& mp : in) {
-            int bucket = (mp.mortonCode >> lowBit) & bitMask;
-            CHECK_GE(bucket, 0);
-            CHECK_LT(bucket, nBuckets);
-            ++bucketCount[bucket];
-        }
-
-        // Compute starting index in output array for each bucket
-        int outIndex[nBuckets];
-        outIndex[0] = 0;
-        for (int i = 1; i < nBuckets; ++i)
-            outIndex[i] = outIndex[i - 1] + bucketCount[i - 1];
+        parallelFor([&](int64_t chunk) {
+            int* count = &bucketCount[chunk * nBuckets];
+            std::fill(count, count + nBuckets, 0);
+            int64_t start = chunk * chunkSize;
+            int64_t end = std::min(start + chunkSize, size);
+            for (int64_t i = start; i < end; ++i) {
+                int bucket = (in[i].mortonCode >> lowBit) & bitMask;
+                CHECK_GE(bucket, 0);
+                CHECK_LT(bucket, nBuckets);
+                ++count[bucket];
+            }
+        }, nChunks);
 
-        // Store sorted values in output array
-        for (const MortonPrimitive& mp : in) {
-            int bucket = (mp.mortonCode >> lowBit) & bitMask;
-            out[outIndex[bucket]++] = mp;
+        // Compute starting index in output array for each (bucket, chunk)
+        int outIndex = 0;
+        for (int bucket = 0; bucket < nBuckets; ++bucket) {
+            for (int64_t chunk = 0; chunk < nChunks; ++chunk) {
+                int count = bucketCount[chunk * nBuckets + bucket];
+                bucketCount[chunk * nBuckets + bucket] = outIndex;
+                outIndex += count;
+            }
         }
+
+        // Store sorted values in output array
+        parallelFor([&](int64_t chunk) {
+            int* outOffset = &bucketCount[chunk * nBuckets];
+            int64_t start = chunk * chunkSize;
+            int64_t end = std::min(start + chunkSize, size);
+            for (int64_t i = start; i < end; ++i) {
+                int bucket = (in[i].mortonCode >> lowBit) & bitMask;
+                out[outOffset[bucket]++] = in[i];
+            }
+        }, nChunks);
     }
     // Copy final result from _tempVector_, if needed
     if (nPasses & 1) std::swap(*v, tempVector);
@@ -87,12 +132,14 @@ AABB3f BVHAccel::worldBound() const
 }
 
 BVHAccel::BVHAccel(std::vector<std::shared_ptr<Primitive>> p,
-    int maxPrimsInNode, SplitMethod splitMethod)
+    int maxPrimsInNode, SplitMethod splitMethod, bool compareBuild)
     : maxPrimsInNode(std::min(255, maxPrimsInNode)),
     splitMethod(splitMethod),
     primitives(std::move(p))
 {
+    TRY_PROFILE(Prof::AccelConstruction)
     if (primitives.empty()) return;
+    auto buildStart = std::chrono::steady_clock::now();
 
     // Initialize _primitiveInfo_ array for primitives
     std::vector<BVHPrimitiveInfo> primitiveInfo(primitives.size());
@@ -112,10 +159,34 @@ BVHAccel::BVHAccel(std::vector<std::shared_ptr<Primitive>> p,
     primitives.swap(orderedPrims);
     primitiveInfo.resize(0);
     
+    // 将二叉树展开为深度优先的线性数组
+    treeBytes += totalNodes * sizeof(LinearBVHNode) + sizeof(*this) +
+        primitives.size() * sizeof(primitives[0]);
     nodes = allocAligned<LinearBVHNode>(totalNodes);
     int offset = 0;
     flattenBVHTree(root, &offset);
     CHECK_EQ(totalNodes, offset);
+
+    double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - buildStart).count();
+    buildTimeMS = ms;
+    switch (splitMethod) {
+    case SplitMethod::HLBVH: ReportValue(hlbvhBuildTimeMS, ms); break;
+    case SplitMethod::Middle: ReportValue(middleBuildTimeMS, ms); break;
+    case SplitMethod::EqualCounts: ReportValue(equalCountsBuildTimeMS, ms); break;
+    default: ReportValue(sahBuildTimeMS, ms); break;
+    }
+    INFO("BVH build finished ({}): {} primitives, {} nodes, {:.2f} ms",
+        splitMethodName(splitMethod), primitives.size(), totalNodes, ms);
+
+    // 用同样的图元再建一棵SAH树作为对照，SAH构建本身则与HLBVH对照
+    if (compareBuild) {
+        SplitMethod reference = splitMethod == SplitMethod::SAH ? SplitMethod::HLBVH : SplitMethod::SAH;
+        BVHAccel referenceBVH(primitives, maxPrimsInNode, reference);
+        INFO("BVH build comparison: {} {:.2f} ms, {} {:.2f} ms, ratio {:.2f}",
+            splitMethodName(splitMethod), ms, splitMethodName(reference), referenceBVH.buildTimeMS,
+            ms / std::max(referenceBVH.buildTimeMS, 1e-3));
+    }
 }
 
 BVHAccel::~BVHAccel() { freeAligned(nodes); }
@@ -133,10 +204,9 @@ BVHBuildNode* BVHAccel::recursiveBuild(
     for (int i = start; i < end; i++)
         bounds = unionSet(bounds, primitiveInfo[i].bounds);
 
-    int numPrimitives = end - start;
-    if (numPrimitives == 1)
-    {
-        // 生成叶子节点
+    // 生成叶子节点
+    auto createLeaf = [&]() {
+        int numPrimitives = end - start;
         int firstPrimOffset = orderedPrims.size();
         for (int i = start; i < end; ++i)
         {
@@ -144,18 +214,151 @@ BVHBuildNode* BVHAccel::recursiveBuild(
             orderedPrims.push_back(primitives[primNum]);
         }
         node->InitLeaf(firstPrimOffset, numPrimitives, bounds);
+        ++leafNodes;
+        ++totalLeafNodes;
+        totalPrimitives += numPrimitives;
         return node;
+    };
+
+    int numPrimitives = end - start;
+    if (numPrimitives == 1)
+    {
+        return createLeaf();
     }
-    // 
-    else
+
+    // Compute bound of primitive centroids, choose split dimension _dim_
+    AABB3f centroidBounds;
+    for (int i = start; i < end; i++)
+        centroidBounds = unionSet(centroidBounds, primitiveInfo[i].centroid);
+    int dim = centroidBounds.maximumExtent();
+
+    // 所有质心重合，无法继续划分
+    if (centroidBounds.pMax[dim] == centroidBounds.pMin[dim])
     {
-        // Compute bound of primitive centroids, choose split dimension _dim_
-        AABB3f centroidBounds;
-        for (int i = start; i < end; i++)
-            centroidBounds = unionSet(centroidBounds, primitiveInfo[i].bounds);
-        int dim = centroidBounds.maximumExtent();
+        return createLeaf();
     }
 
+    // Partition primitives into two sets and build children
+    int mid = (start + end) / 2;
+    switch (splitMethod)
+    {
+    case SplitMethod::Middle:
+    {
+        // Partition primitives through node's midpoint
+        Float pmid = (centroidBounds.pMin[dim] + centroidBounds.pMax[dim]) / 2;
+        BVHPrimitiveInfo* midPtr = std::partition(
+            &primitiveInfo[start], &primitiveInfo[end - 1] + 1,
+            [dim, pmid](const BVHPrimitiveInfo& pi) {
+                return pi.centroid[dim] < pmid;
+            });
+        mid = midPtr - &primitiveInfo[0];
+        // 中点划分失败时退化为等数量划分
+        if (mid != start && mid != end) break;
+    }
+    case SplitMethod::EqualCounts:
+    {
+        // Partition primitives into equally-sized subsets
+        mid = (start + end) / 2;
+        std::nth_element(&primitiveInfo[start], &primitiveInfo[mid],
+            &primitiveInfo[end - 1] + 1,
+            [dim](const BVHPrimitiveInfo& a, const BVHPrimitiveInfo& b) {
+                return a.centroid[dim] < b.centroid[dim];
+            });
+        break;
+    }
+    case SplitMethod::SAH:
+    default:
+    {
+        // Partition primitives using approximate SAH
+        if (numPrimitives <= 2)
+        {
+            // Partition primitives into equally-sized subsets
+            mid = (start + end) / 2;
+            std::nth_element(&primitiveInfo[start], &primitiveInfo[mid],
+                &primitiveInfo[end - 1] + 1,
+                [dim](const BVHPrimitiveInfo& a, const BVHPrimitiveInfo& b) {
+                    return a.centroid[dim] < b.centroid[dim];
+                });
+            break;
+        }
+
+        // Allocate _BucketInfo_ for SAH partition buckets
+        CONSTEXPR int nBuckets = 12;
+        BucketInfo buckets[nBuckets];
+
+        // Initialize _BucketInfo_ for SAH partition buckets
+        for (int i = start; i < end; ++i)
+        {
+            int b = nBuckets *
+                centroidBounds.offset(primitiveInfo[i].centroid)[dim];
+            if (b == nBuckets) b = nBuckets - 1;
+            CHECK_GE(b, 0);
+            CHECK_LT(b, nBuckets);
+            buckets[b].count++;
+            buckets[b].bounds = unionSet(buckets[b].bounds, primitiveInfo[i].bounds);
+        }
+
+        // Compute costs for splitting after each bucket
+        // 遍历代价取1/8，求交代价取1
+        Float cost[nBuckets - 1];
+        for (int i = 0; i < nBuckets - 1; ++i)
+        {
+            AABB3f b0, b1;
+            int count0 = 0, count1 = 0;
+            for (int j = 0; j <= i; ++j)
+            {
+                b0 = unionSet(b0, buckets[j].bounds);
+                count0 += buckets[j].count;
+            }
+            for (int j = i + 1; j < nBuckets; ++j)
+            {
+                b1 = unionSet(b1, buckets[j].bounds);
+                count1 += buckets[j].count;
+            }
+            cost[i] = .125f +
+                (count0 * b0.surfaceArea() + count1 * b1.surfaceArea()) /
+                bounds.surfaceArea();
+        }
+
+        // Find bucket to split at that minimizes SAH metric
+        Float minCost = cost[0];
+        int minCostSplitBucket = 0;
+        for (int i = 1; i < nBuckets - 1; ++i)
+        {
+            if (cost[i] < minCost)
+            {
+                minCost = cost[i];
+                minCostSplitBucket = i;
+            }
+        }
+
+        // Either create leaf or split primitives at selected SAH bucket
+        Float leafCost = numPrimitives;
+        if (numPrimitives > maxPrimsInNode || minCost < leafCost)
+        {
+            BVHPrimitiveInfo* pmid = std::partition(
+                &primitiveInfo[start], &primitiveInfo[end - 1] + 1,
+                [=](const BVHPrimitiveInfo& pi) {
+                    int b = nBuckets * centroidBounds.offset(pi.centroid)[dim];
+                    if (b == nBuckets) b = nBuckets - 1;
+                    CHECK_GE(b, 0);
+                    CHECK_LT(b, nBuckets);
+                    return b <= minCostSplitBucket;
+                });
+            mid = pmid - &primitiveInfo[0];
+        }
+        else
+        {
+            return createLeaf();
+        }
+        break;
+    }
+    }
+
+    node->initInterior(dim,
+        recursiveBuild(arena, primitiveInfo, start, mid, totalNodes, orderedPrims),
+        recursiveBuild(arena, primitiveInfo, mid, end, totalNodes, orderedPrims));
+    ++interiorNodes;
     return node;
 }
 
@@ -164,7 +367,65 @@ BVHBuildNode* BVHAccel::HLBVHBuild(
     int* totalNodes,
     std::vector<std::shared_ptr<Primitive>>& orderedPrims) const
 {
-    return nullptr;
+    // Compute bounding box of all primitive centroids
+    AABB3f bounds;
+    for (const BVHPrimitiveInfo& pi : primitiveInfo)
+        bounds = unionSet(bounds, pi.centroid);
+
+    // Compute Morton indices of primitives
+    std::vector<MortonPrimitive> mortonPrims(primitiveInfo.size());
+    parallelFor([&](int64_t i) {
+        // 每个维度量化为10位，总共30位莫顿码
+        CONSTEXPR int mortonBits = 10;
+        CONSTEXPR int mortonScale = 1 << mortonBits;
+        mortonPrims[i].primitiveIndex = primitiveInfo[i].primitiveNumber;
+        Vector3f centroidOffset = bounds.offset(primitiveInfo[i].centroid);
+        mortonPrims[i].mortonCode = EncodeMorton3(centroidOffset * mortonScale);
+    }, primitiveInfo.size(), 512);
+
+    // Radix sort primitive Morton indices
+    RadixSort(&mortonPrims);
+
+    // Create LBVH treelets at bottom of BVH
+    // 高12位相同的图元划分到同一个treelet中
+    std::vector<LBVHTreelet> treeletsToBuild;
+    for (int start = 0, end = 1; end <= (int)mortonPrims.size(); ++end) {
+        uint32_t mask = 0x3ffc0000;
+        if (end == (int)mortonPrims.size() ||
+            ((mortonPrims[start].mortonCode & mask) !=
+             (mortonPrims[end].mortonCode & mask))) {
+            // Add entry to _treeletsToBuild_ for this treelet
+            int nPrimitives = end - start;
+            int maxBVHNodes = 2 * nPrimitives - 1;
+            BVHBuildNode* nodes = arena.alloc<BVHBuildNode>(maxBVHNodes, false);
+            treeletsToBuild.push_back({ start, nPrimitives, nodes });
+            start = end;
+        }
+    }
+
+    // Create LBVHs for treelets in parallel
+    std::atomic<int> atomicTotal(0), orderedPrimsOffset(0);
+    orderedPrims.resize(primitives.size());
+    parallelFor([&](int64_t i) {
+        // Generate _i_th LBVH treelet
+        int nodesCreated = 0;
+        const int firstBitIndex = 29 - 12;
+        LBVHTreelet& tr = treeletsToBuild[i];
+        tr.buildNodes =
+            emitLBVH(tr.buildNodes, primitiveInfo, &mortonPrims[tr.startIndex],
+                tr.nPrimitives, &nodesCreated, orderedPrims,
+                &orderedPrimsOffset, firstBitIndex);
+        atomicTotal += nodesCreated;
+    }, treeletsToBuild.size());
+    *totalNodes = atomicTotal;
+
+    // Create and return SAH BVH from LBVH treelets
+    std::vector<BVHBuildNode*> finishedTreelets;
+    finishedTreelets.reserve(treeletsToBuild.size());
+    for (LBVHTreelet& treelet : treeletsToBuild)
+        finishedTreelets.push_back(treelet.buildNodes);
+    return buildUpperSAH(arena, finishedTreelets, 0, finishedTreelets.size(),
+        totalNodes);
 }
 
 BVHBuildNode* BVHAccel::emitLBVH(
@@ -172,26 +433,294 @@ BVHBuildNode* BVHAccel::emitLBVH(
     const std::vector<BVHPrimitiveInfo>& primitiveInfo,
     MortonPrimitive* mortonPrims, int nPrimitives, int* totalNodes,
     std::vector<std::shared_ptr<Primitive>>& orderedPrims,
-    std::atomic<int>* orderedPrimsOffset, int bitIndex) const {
-    return nullptr;
+    std::atomic<int>* orderedPrimsOffset, int bitIndex) const 
+{
+    CHECK_GT(nPrimitives, 0);
+    if (bitIndex == -1 || nPrimitives < maxPrimsInNode) {
+        // Create and return leaf node of LBVH treelet
+        (*totalNodes)++;
+        BVHBuildNode* node = buildNodes++;
+        AABB3f bounds;
+        int firstPrimOffset = orderedPrimsOffset->fetch_add(nPrimitives);
+        for (int i = 0; i < nPrimitives; ++i) {
+            int primitiveIndex = mortonPrims[i].primitiveIndex;
+            orderedPrims[firstPrimOffset + i] = primitives[primitiveIndex];
+            bounds = unionSet(bounds, primitiveInfo[primitiveIndex].bounds);
+        }
+        node->InitLeaf(firstPrimOffset, nPrimitives, bounds);
+        ++leafNodes;
+        ++totalLeafNodes;
+        totalPrimitives += nPrimitives;
+        return node;
+    } else {
+        int mask = 1 << bitIndex;
+        // Advance to next subtree level if there's no LBVH split for this bit
+        if ((mortonPrims[0].mortonCode & mask) ==
+            (mortonPrims[nPrimitives - 1].mortonCode & mask))
+            return emitLBVH(buildNodes, primitiveInfo, mortonPrims, nPrimitives,
+                totalNodes, orderedPrims, orderedPrimsOffset,
+                bitIndex - 1);
+
+        // Find LBVH split point for this dimension
+        // 二分查找当前位由0变为1的位置
+        int searchStart = 0, searchEnd = nPrimitives - 1;
+        while (searchStart + 1 != searchEnd) {
+            CHECK_NE(searchStart, searchEnd);
+            int mid = (searchStart + searchEnd) / 2;
+            if ((mortonPrims[searchStart].mortonCode & mask) ==
+                (mortonPrims[mid].mortonCode & mask))
+                searchStart = mid;
+            else {
+                CHECK_EQ(mortonPrims[mid].mortonCode & mask,
+                    mortonPrims[searchEnd].mortonCode & mask);
+                searchEnd = mid;
+            }
+        }
+        int splitOffset = searchEnd;
+        CHECK_LE(splitOffset, nPrimitives - 1);
+        CHECK_NE(mortonPrims[splitOffset - 1].mortonCode & mask,
+            mortonPrims[splitOffset].mortonCode & mask);
+
+        // Create and return interior LBVH node
+        (*totalNodes)++;
+        BVHBuildNode* node = buildNodes++;
+        BVHBuildNode* lbvh[2] = {
+            emitLBVH(buildNodes, primitiveInfo, mortonPrims, splitOffset,
+                totalNodes, orderedPrims, orderedPrimsOffset,
+                bitIndex - 1),
+            emitLBVH(buildNodes, primitiveInfo, &mortonPrims[splitOffset],
+                nPrimitives - splitOffset, totalNodes, orderedPrims,
+                orderedPrimsOffset, bitIndex - 1) };
+        int axis = bitIndex % 3;
+        node->initInterior(axis, lbvh[0], lbvh[1]);
+        ++interiorNodes;
+        return node;
+    }
 }
 
 BVHBuildNode* BVHAccel::buildUpperSAH(MemoryArena& arena,
     std::vector<BVHBuildNode*>& treeletRoots,
-    int start, int end, int* totalNodes) const {
-    return nullptr;
+    int start, int end, int* totalNodes) const 
+{
+    CHECK_LT(start, end);
+    int nNodes = end - start;
+    if (nNodes == 1) return treeletRoots[start];
+    (*totalNodes)++;
+    BVHBuildNode* node = ARENA_ALLOC(arena, BVHBuildNode);
+
+    // Compute bounds of all nodes under this HLBVH node
+    AABB3f bounds;
+    for (int i = start; i < end; ++i)
+        bounds = unionSet(bounds, treeletRoots[i]->bounds);
+
+    // Compute bound of HLBVH node centroids, choose split dimension _dim_
+    AABB3f centroidBounds;
+    for (int i = start; i < end; ++i) {
+        Point3f centroid =
+            (treeletRoots[i]->bounds.pMin + treeletRoots[i]->bounds.pMax) *
+            0.5f;
+        centroidBounds = unionSet(centroidBounds, centroid);
+    }
+    int dim = centroidBounds.maximumExtent();
+    // 所有treelet质心重合时SAH无法划分，直接对半分
+    if (centroidBounds.pMax[dim] == centroidBounds.pMin[dim]) {
+        int mid = (start + end) / 2;
+        node->initInterior(
+            dim, this->buildUpperSAH(arena, treeletRoots, start, mid, totalNodes),
+            this->buildUpperSAH(arena, treeletRoots, mid, end, totalNodes));
+        ++interiorNodes;
+        return node;
+    }
+
+    // Allocate _BucketInfo_ for SAH partition buckets
+    CONSTEXPR int nBuckets = 12;
+    BucketInfo buckets[nBuckets];
+
+    // Initialize _BucketInfo_ for HLBVH SAH partition buckets
+    for (int i = start; i < end; ++i) {
+        Float centroid = (treeletRoots[i]->bounds.pMin[dim] +
+            treeletRoots[i]->bounds.pMax[dim]) *
+            0.5f;
+        int b = nBuckets * ((centroid - centroidBounds.pMin[dim]) /
+            (centroidBounds.pMax[dim] - centroidBounds.pMin[dim]));
+        if (b == nBuckets) b = nBuckets - 1;
+        CHECK_GE(b, 0);
+        CHECK_LT(b, nBuckets);
+        buckets[b].count++;
+        buckets[b].bounds = unionSet(buckets[b].bounds, treeletRoots[i]->bounds);
+    }
+
+    // Compute costs for splitting after each bucket
+    Float cost[nBuckets - 1];
+    for (int i = 0; i < nBuckets - 1; ++i) {
+        AABB3f b0, b1;
+        int count0 = 0, count1 = 0;
+        for (int j = 0; j <= i; ++j) {
+            b0 = unionSet(b0, buckets[j].bounds);
+            count0 += buckets[j].count;
+        }
+        for (int j = i + 1; j < nBuckets; ++j) {
+            b1 = unionSet(b1, buckets[j].bounds);
+            count1 += buckets[j].count;
+        }
+        cost[i] = .125f +
+            (count0 * b0.surfaceArea() + count1 * b1.surfaceArea()) /
+            bounds.surfaceArea();
+    }
+
+    // Find bucket to split at that minimizes SAH metric
+    Float minCost = cost[0];
+    int minCostSplitBucket = 0;
+    for (int i = 1; i < nBuckets - 1; ++i) {
+        if (cost[i] < minCost) {
+            minCost = cost[i];
+            minCostSplitBucket = i;
+        }
+    }
+
+    // Split nodes and create interior HLBVH SAH node
+    BVHBuildNode** pmid = std::partition(
+        &treeletRoots[start], &treeletRoots[end - 1] + 1,
+        [=](const BVHBuildNode* node) {
+            Float centroid =
+                (node->bounds.pMin[dim] + node->bounds.pMax[dim]) * 0.5f;
+            int b = nBuckets * ((centroid - centroidBounds.pMin[dim]) /
+                (centroidBounds.pMax[dim] - centroidBounds.pMin[dim]));
+            if (b == nBuckets) b = nBuckets - 1;
+            CHECK_GE(b, 0);
+            CHECK_LT(b, nBuckets);
+            return b <= minCostSplitBucket;
+        });
+    int mid = pmid - &treeletRoots[0];
+    CHECK_GT(mid, start);
+    CHECK_LT(mid, end);
+    node->initInterior(
+        dim, this->buildUpperSAH(arena, treeletRoots, start, mid, totalNodes),
+        this->buildUpperSAH(arena, treeletRoots, mid, end, totalNodes));
+    ++interiorNodes;
+    return node;
 }
 
-int BVHAccel::flattenBVHTree(BVHBuildNode* node, int* offset) {
-    return 1;
+int BVHAccel::flattenBVHTree(BVHBuildNode* node, int* offset) 
+{
+    LinearBVHNode* linearNode = &nodes[*offset];
+    linearNode->bounds = node->bounds;
+    int myOffset = (*offset)++;
+    if (node->nPrimitives > 0)
+    {
+        DCHECK(!node->children[0] && !node->children[1]);
+        CHECK_LT(node->nPrimitives, 65536);
+        linearNode->primitivesOffset = node->firstPrimOffset;
+        linearNode->nPrimitives = node->nPrimitives;
+    }
+    else
+    {
+        // 第一个子节点紧跟在父节点之后，只需记录第二个子节点的位置
+        linearNode->axis = node->splitAxis;
+        linearNode->nPrimitives = 0;
+        flattenBVHTree(node->children[0], offset);
+        linearNode->secondChildOffset = flattenBVHTree(node->children[1], offset);
+    }
+    return myOffset;
 }
 
-bool BVHAccel::intersect(const Ray& r, SurfaceInteraction*) const {
-    return false;
+bool BVHAccel::intersectHit(const Ray& ray, HitRecord* record) const 
+{
+    if (!nodes) return false;
+    TRY_PROFILE(Prof::AccelRayIntersect)
+    bool hit = false;
+    Vector3f invDir(1 / ray.dir.x, 1 / ray.dir.y, 1 / ray.dir.z);
+    int dirIsNeg[3] = { invDir.x < 0, invDir.y < 0, invDir.z < 0 };
+    // Follow ray through BVH nodes to find primitive intersections
+    int toVisitOffset = 0, currentNodeIndex = 0;
+    int nodesToVisit[64];
+    while (true)
+    {
+        const LinearBVHNode* node = &nodes[currentNodeIndex];
+        // Check ray against BVH node
+        if (node->bounds.intersectP(ray, invDir, dirIsNeg))
+        {
+            if (node->nPrimitives > 0)
+            {
+                // Intersect ray with primitives in leaf BVH node
+                for (int i = 0; i < node->nPrimitives; ++i)
+                    if (primitives[node->primitivesOffset + i]->intersectHit(ray, record))
+                        hit = true;
+                if (toVisitOffset == 0) break;
+                currentNodeIndex = nodesToVisit[--toVisitOffset];
+            }
+            else
+            {
+                // 沿光线方向先访问较近的子节点
+                if (dirIsNeg[node->axis])
+                {
+                    nodesToVisit[toVisitOffset++] = currentNodeIndex + 1;
+                    currentNodeIndex = node->secondChildOffset;
+                }
+                else
+                {
+                    nodesToVisit[toVisitOffset++] = node->secondChildOffset;
+                    currentNodeIndex = currentNodeIndex + 1;
+                }
+            }
+        }
+        else
+        {
+            if (toVisitOffset == 0) break;
+            currentNodeIndex = nodesToVisit[--toVisitOffset];
+        }
+    }
+    return hit;
 }
 
-bool BVHAccel::intersectP(const Ray& r) const {
+bool BVHAccel::intersectP(const Ray& ray) const 
+{
+    if (!nodes) return false;
+    TRY_PROFILE(Prof::AccelRayOccluded)
+    Vector3f invDir(1 / ray.dir.x, 1 / ray.dir.y, 1 / ray.dir.z);
+    int dirIsNeg[3] = { invDir.x < 0, invDir.y < 0, invDir.z < 0 };
+    int nodesToVisit[64];
+    int toVisitOffset = 0, currentNodeIndex = 0;
+    while (true)
+    {
+        const LinearBVHNode* node = &nodes[currentNodeIndex];
+        if (node->bounds.rayOccluded(ray, invDir, dirIsNeg))
+        {
+            // Process BVH node _node_ for traversal
+            if (node->nPrimitives > 0)
+            {
+                // 任意一个交点即可返回
+                for (int i = 0; i < node->nPrimitives; ++i)
+                {
+                    if (primitives[node->primitivesOffset + i]->intersectP(ray))
+                    {
+                        return true;
+                    }
+                }
+                if (toVisitOffset == 0) break;
+                currentNodeIndex = nodesToVisit[--toVisitOffset];
+            }
+            else
+            {
+                if (dirIsNeg[node->axis])
+                {
+                    nodesToVisit[toVisitOffset++] = currentNodeIndex + 1;
+                    currentNodeIndex = node->secondChildOffset;
+                }
+                else
+                {
+                    nodesToVisit[toVisitOffset++] = node->secondChildOffset;
+                    currentNodeIndex = currentNodeIndex + 1;
+                }
+            }
+        }
+        else
+        {
+            if (toVisitOffset == 0) break;
+            currentNodeIndex = nodesToVisit[--toVisitOffset];
+        }
+    }
     return false;
 }
 
-RENDERING_END
\ No newline at end of file
+RENDERING_END
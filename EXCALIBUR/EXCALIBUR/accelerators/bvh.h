@@ -74,12 +74,15 @@ class BVHAccel : public Aggregate {
 public:
     enum SplitMethod { SAH, HLBVH, Middle, EqualCounts };
 
+    // compareBuild: also build a SAH tree over the same primitives (an HLBVH one if this
+    // one is SAH) and log both build times, the extra build shows up in the stats as well
     BVHAccel(std::vector<std::shared_ptr<Primitive>> p,
         int maxPrimsInNode = 1,
-        SplitMethod splitMethod = SplitMethod::SAH);
+        SplitMethod splitMethod = SplitMethod::SAH,
+        bool compareBuild = false);
     ~BVHAccel();
     virtual AABB3f worldBound() const override;
-    virtual bool intersect(const Ray& r, SurfaceInteraction*) const override;
+    virtual bool intersectHit(const Ray& r, HitRecord* record) const override;
     virtual bool intersectP(const Ray& r) const override;
 private:
     // BVHAccel Private Methods
@@ -106,6 +109,7 @@ private:
     const SplitMethod splitMethod;
     std::vector<std::shared_ptr<Primitive>> primitives;
     LinearBVHNode* nodes = nullptr;
+    double buildTimeMS = 0;
 };
 
 RENDERING_END
\ No newline at end of file
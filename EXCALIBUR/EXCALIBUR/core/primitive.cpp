@@ -49,6 +49,40 @@ bool GeometricPrimitive::intersect(const Ray& r, SurfaceInteraction* isect) cons
     return true;
 }
 
+bool GeometricPrimitive::intersectHit(const Ray& r, HitRecord* record) const
+{
+    Float tHit;
+    if (!_shape->intersect(r, &tHit, nullptr)) {
+        return false;
+    }
+
+    r.tMax = tHit;
+    record->tHit = tHit;
+    record->primitive = this;
+    record->instanced = nullptr;
+    return true;
+}
+
+void GeometricPrimitive::fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+    SurfaceInteraction* isect) const
+{
+    // 用原始的tMax重新求交一次，得到的交点与遍历时记录的一致
+    Float tHit;
+    bool hit = _shape->intersect(r, &tHit, isect);
+    DCHECK(hit && tHit == record.tHit);
+    r.tMax = tHit;
+    isect->primitive = this;
+
+    if (_mediumInterface.isMediumTransition())
+    {
+        isect->mediumInterface = _mediumInterface;
+    }
+    else
+    {
+        isect->mediumInterface = MediumInterface(r.medium);
+    }
+}
+
 const AreaLight* GeometricPrimitive::getAreaLight() const
 {
     return _areaLight.get();
@@ -98,6 +132,49 @@ bool TransformedPrimitive::intersect(const Ray& r, SurfaceInteraction* isect) co
     return true;
 }
 
+bool TransformedPrimitive::intersectHit(const Ray& r, HitRecord* record) const
+{
+    Transform InterpolatedPrimToWorld = _primitiveToWorld.interpolate(r.time);
+    Ray ray = InterpolatedPrimToWorld.getInverse().exec(r);
+
+    HitRecord innerRecord;
+    if (!_primitive->intersectHit(ray, &innerRecord))
+    {
+        return false;
+    }
+    r.tMax = ray.tMax;
+    record->tHit = innerRecord.tHit;
+    record->primitive = this;
+    // 嵌套的实例只能记住一层，置空后填充时退回完整求交
+    record->instanced = innerRecord.instanced == nullptr ? innerRecord.primitive : nullptr;
+    return true;
+}
+
+void TransformedPrimitive::fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+    SurfaceInteraction* isect) const
+{
+    if (record.instanced == nullptr)
+    {
+        bool hit = intersect(r, isect);
+        DCHECK(hit);
+        return;
+    }
+
+    Transform InterpolatedPrimToWorld = _primitiveToWorld.interpolate(r.time);
+    Ray ray = InterpolatedPrimToWorld.getInverse().exec(r);
+
+    HitRecord innerRecord;
+    innerRecord.tHit = record.tHit;
+    innerRecord.primitive = record.instanced;
+    record.instanced->fillSurfaceInteraction(ray, innerRecord, isect);
+    r.tMax = ray.tMax;
+
+    if (!InterpolatedPrimToWorld.isIdentity()) {
+        *isect = InterpolatedPrimToWorld.exec(*isect);
+    }
+    CHECK_GE(dot(isect->normal, isect->shading.normal), 0);
+}
+
 bool TransformedPrimitive::intersectP(const Ray& r) const
 {
     Transform InterpolatedPrimToWorld = _primitiveToWorld.interpolate(r.time);
@@ -105,5 +182,23 @@ bool TransformedPrimitive::intersectP(const Ray& r) const
     return _primitive->intersectP(InterpolatedWorldToPrim.exec(r));
 }
 
+bool Aggregate::intersect(const Ray& r, SurfaceInteraction* isect) const
+{
+    // 保留原始的tMax用于填充
+    Ray ray = r;
+    HitRecord record;
+    if (!intersectHit(r, &record))
+    {
+        return false;
+    }
+    record.primitive->fillSurfaceInteraction(ray, record, isect);
+    return true;
+}
+
+void Aggregate::fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+    SurfaceInteraction* isect) const
+{
+    record.primitive->fillSurfaceInteraction(r, record, isect);
+}
 
 RENDERING_END
\ No newline at end of file
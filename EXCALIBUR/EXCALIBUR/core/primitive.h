@@ -8,12 +8,28 @@
 
 RENDERING_BEGIN
 
+class Primitive;
+
+// 最近交点的最小记录，遍历中只记录t与片元
+// 遍历结束后再由fillSurfaceInteraction为最终的交点计算一次SurfaceInteraction
+struct HitRecord {
+    Float tHit = Infinity;
+    const Primitive* primitive = nullptr;
+    // primitive为实例时，记录实例内部被击中的片元，填充时不必再遍历一次
+    const Primitive* instanced = nullptr;
+};
+
 // Primitive Declarations
 class Primitive {
 public:
     virtual ~Primitive() {}
     virtual AABB3f worldBound() const = 0;
     virtual bool intersect(const Ray& r, SurfaceInteraction*) const = 0;
+    // 只求最近交点，不计算SurfaceInteraction，与intersect一样会更新r.tMax
+    virtual bool intersectHit(const Ray& r, HitRecord* record) const = 0;
+    // r为求交之前的光线（tMax未被更新）
+    virtual void fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+        SurfaceInteraction* isect) const = 0;
     virtual bool intersectP(const Ray& r) const = 0;
     virtual const AreaLight* getAreaLight() const = 0;
     virtual const Material* getMaterial() const = 0;
@@ -33,6 +49,9 @@ public:
 
     virtual AABB3f worldBound() const;
     virtual bool intersect(const Ray& r, SurfaceInteraction* isect) const;
+    virtual bool intersectHit(const Ray& r, HitRecord* record) const;
+    virtual void fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+        SurfaceInteraction* isect) const;
     virtual bool intersectP(const Ray& r) const;
     virtual const AreaLight* getAreaLight() const;
     virtual const Material* getMaterial() const;
@@ -55,6 +74,12 @@ public:
 
     virtual bool intersect(const Ray& r, SurfaceInteraction* in) const;
 
+    virtual bool intersectHit(const Ray& r, HitRecord* record) const;
+
+    // 变换光线后直接填充实例内部记录的片元，再把交点变换回世界空间
+    virtual void fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+        SurfaceInteraction* isect) const;
+
     virtual bool intersectP(const Ray& r) const;
 
     virtual const AreaLight* getAreaLight() const {
@@ -73,7 +98,7 @@ public:
             "called";
     }
 
-    virtual AABB3f WorldBound() const {
+    virtual AABB3f worldBound() const {
         return _primitiveToWorld.motionAABB(_primitive->worldBound());
     }
 
@@ -84,6 +109,10 @@ private:
 
 class Aggregate : public Primitive {
 public:
+    // 遍历时只维护HitRecord，最后只为最近的交点填充一次SurfaceInteraction
+    virtual bool intersect(const Ray& r, SurfaceInteraction* isect) const;
+    virtual void fillSurfaceInteraction(const Ray& r, const HitRecord& record,
+        SurfaceInteraction* isect) const;
     virtual const AreaLight* getAreaLight() const {
         DCHECK(false);
         return nullptr;
@@ -62,6 +62,14 @@ bool Cone::intersect(const Rendering::Ray& r, Float* tHit, Rendering::SurfaceInt
         }
     }
 
+    // 只需要交点距离时跳过微分几何的计算，SurfaceInteraction由fillSurfaceInteraction补全
+    if (isect == nullptr) {
+        if (tHit) {
+            *tHit = (Float)tShapeHit;
+        }
+        return true;
+    }
+
     Float u = phi / _phiMax;
     Float v = pHit.z / _height;
 
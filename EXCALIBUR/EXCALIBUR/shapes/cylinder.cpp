@@ -73,6 +73,14 @@ bool Cylinder::intersect(const Ray& r, Float* tHit, SurfaceInteraction* isect, b
         }
     }
 
+    // 只需要交点距离时跳过微分几何的计算，SurfaceInteraction由fillSurfaceInteraction补全
+    if (isect == nullptr) {
+        if (tHit) {
+            *tHit = (Float)tShapeHit;
+        }
+        return true;
+    }
+
     // 计算微分几何信息
     Float u = phi / _phiMax;
     Float v = (pHit.z - _zMin) / (_zMax - _zMin);
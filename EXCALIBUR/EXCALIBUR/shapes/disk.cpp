@@ -59,6 +59,14 @@ bool Disk::intersect(const Rendering::Ray& r, Float* tHit, Rendering::SurfaceInt
         return false;
     }
 
+    // 只需要交点距离时跳过微分几何的计算，SurfaceInteraction由fillSurfaceInteraction补全
+    if (isect == nullptr) {
+        if (tHit) {
+            *tHit = (Float)tShapeHit;
+        }
+        return true;
+    }
+
     // 计算微分几何信息
     Float u = phi / _phiMax;
     Float rHit = sqrtf(dist2);
@@ -75,7 +83,7 @@ bool Disk::intersect(const Rendering::Ray& r, Float* tHit, Rendering::SurfaceInt
     *isect = objectToWorld->exec(SurfaceInteraction(pHit, pError, Point2f(u, v), ray.dir, dpdu, dpdv, dndu, dndv, ray.time, this));
 
     *tHit = (Float)tShapeHit;
-    return false;
+    return true;
 }
 
 Interaction Disk::sampleA(const Point2f& u, Float* pdf) const {
@@ -85,6 +85,14 @@ bool Sphere::intersect(const Ray& r, Float* tHit, SurfaceInteraction* isect, boo
 
     }
 
+    // 只需要交点距离时跳过微分几何的计算，SurfaceInteraction由fillSurfaceInteraction补全
+    if (isect == nullptr) {
+        if (tHit) {
+            *tHit = (Float)tShapeHit;
+        }
+        return true;
+    }
+
     // φ = u * φmax
     // θ = θmin + v * (θmax - θmin)
     Float u = phi / _phiMax;
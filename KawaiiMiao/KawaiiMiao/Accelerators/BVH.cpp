@@ -0,0 +1,944 @@
+#include "BVH.h"
+#include "../Tool/Memory.h"
+#include "../Tool/Parallel.h"
+#include "../Tool/Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <tbb/tbb/parallel_invoke.h>
+
+RENDER_BEGIN
+
+struct BVHPrimitiveInfo
+{
+	BVHPrimitiveInfo() = default;
+	BVHPrimitiveInfo(size_t primitiveNumber, const Bounds3f& bounds)
+		: m_primitiveNumber(primitiveNumber), m_bounds(bounds),
+		m_centroid(.5f * bounds.m_pMin + .5f * bounds.m_pMax) {}
+
+	size_t m_primitiveNumber;
+	Bounds3f m_bounds;
+	Vector3f m_centroid;
+};
+
+struct BVHBuildNode
+{
+	void initLeaf(int first, int n, const Bounds3f& b)
+	{
+		m_firstPrimOffset = first;
+		m_nPrimitives = n;
+		m_bounds = b;
+		m_children[0] = m_children[1] = nullptr;
+	}
+
+	void initInterior(int axis, BVHBuildNode* c0, BVHBuildNode* c1)
+	{
+		m_children[0] = c0;
+		m_children[1] = c1;
+		m_bounds = unionBounds(c0->m_bounds, c1->m_bounds);
+		m_splitAxis = axis;
+		m_nPrimitives = 0;
+	}
+
+	Bounds3f m_bounds;
+	BVHBuildNode* m_children[2];
+	int m_splitAxis, m_firstPrimOffset, m_nPrimitives;
+};
+
+// Note: 32 bytes per node so that a node never straddles a cache line
+struct alignas(32) LinearBVHNode
+{
+	Bounds3f m_bounds;
+	union
+	{
+		int m_primitivesOffset;  // Leaf
+		int m_secondChildOffset; // Interior
+	};
+	uint16_t m_nPrimitives; // 0 -> interior node
+	uint8_t m_axis;         // Interior node: xyz
+	uint8_t m_pad[1];
+};
+
+struct BucketInfo
+{
+	int m_count = 0;
+	Bounds3f m_bounds;
+};
+
+// Ranges larger than this are binned in parallel and their children are built as separate tasks
+static constexpr int parallelBuildThreshold = 4096;
+static constexpr int nBuckets = 12;
+
+static int numChunks(int nPrimitives)
+{
+	return nPrimitives > parallelBuildThreshold ?
+		(nPrimitives + parallelBuildThreshold - 1) / parallelBuildThreshold : 1;
+}
+
+template <typename Function>
+static void forEachChunk(int nChunks, const Function& func)
+{
+	if (nChunks == 1)
+		func(0);
+	else
+		parallelFor((size_t)0, (size_t)nChunks, func);
+}
+
+static void computeRangeBounds(const std::vector<BVHPrimitiveInfo>& primitiveInfo, int start, int end,
+	Bounds3f& bounds, Bounds3f& centroidBounds)
+{
+	// Reduce per-chunk bounds so that the top levels do not serialize the build
+	const int nChunks = numChunks(end - start);
+	std::vector<Bounds3f> chunkBounds(nChunks), chunkCentroidBounds(nChunks);
+	forEachChunk(nChunks, [&](size_t chunk)
+	{
+		int chunkStart = start + (int)chunk * parallelBuildThreshold;
+		int chunkEnd = glm::min(end, chunkStart + parallelBuildThreshold);
+		for (int i = chunkStart; i < chunkEnd; ++i)
+		{
+			chunkBounds[chunk] = unionBounds(chunkBounds[chunk], primitiveInfo[i].m_bounds);
+			chunkCentroidBounds[chunk] = unionBounds(chunkCentroidBounds[chunk], primitiveInfo[i].m_centroid);
+		}
+	});
+
+	for (int i = 0; i < nChunks; ++i)
+	{
+		bounds = unionBounds(bounds, chunkBounds[i]);
+		centroidBounds = unionBounds(centroidBounds, chunkCentroidBounds[i]);
+	}
+}
+
+// Triangles that can be packed, degenerate ones are left to the scalar test that rejects them
+static bool isPackable(const PrimitiveTable& table, const PrimitiveTable::Entry& entry)
+{
+	Vector3f p0, p1, p2;
+	return table.getTriangle(entry, p0, p1, p2) && lengthSquared(cross(p2 - p0, p1 - p0)) != 0;
+}
+
+static int nearestLane(uint32_t mask, const TrianglePacketHit& packetHit)
+{
+	int nearest = countTrailingZeros(mask);
+	for (uint32_t rest = mask & (mask - 1); rest != 0; rest &= rest - 1)
+	{
+		int lane = countTrailingZeros(rest);
+		if (packetHit.m_t[lane] < packetHit.m_t[nearest])
+			nearest = lane;
+	}
+	return nearest;
+}
+
+static int bucketIndex(const Bounds3f& centroidBounds, const Vector3f& centroid, int dim)
+{
+	int b = nBuckets * centroidBounds.offset(centroid)[dim];
+	if (b == nBuckets)
+		b = nBuckets - 1;
+	CHECK_GE(b, 0);
+	CHECK_LT(b, nBuckets);
+	return b;
+}
+
+BVHAccel::BVHAccel(const std::vector<Primitive::ptr>& primitives, int maxPrimsInNode, SplitMethod splitMethod, bool wide)
+	: m_maxPrimsInNode(glm::min(255, maxPrimsInNode)), m_splitMethod(splitMethod), m_table(primitives),
+	m_wideIntersector(wide ? getWideNodeIntersector() : nullptr)
+{
+	if (m_table.empty())
+		return;
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	// Initialize primitive info array for primitives
+	std::vector<BVHPrimitiveInfo> primitiveInfo(m_table.size());
+	parallelFor((size_t)0, m_table.size(), [&](size_t i)
+	{
+		primitiveInfo[i] = BVHPrimitiveInfo(i, m_table.worldBound(i));
+	});
+
+	// Triangles are tested a packet at a time, so let leaves fill up a whole packet
+	// and measure their SAH cost in packets instead of primitives
+	m_packetIntersector = getTrianglePacketIntersector();
+	std::vector<PrimitiveTable::Entry>& entries = m_table.getEntries();
+	if (m_packetIntersector != nullptr && std::any_of(entries.begin(), entries.end(),
+		[&](const PrimitiveTable::Entry& entry) { return isPackable(m_table, entry); }))
+	{
+		m_leafBlockSize = TrianglePacket::width;
+		m_maxPrimsInNode = glm::min(255, glm::max(m_maxPrimsInNode, TrianglePacket::width));
+	}
+
+	// Build BVH tree for primitives using primitiveInfo
+	// Note: a binary tree over N primitives has at most 2N-1 nodes, so the
+	//       nodes are preallocated and handed out by an atomic counter
+	std::vector<BVHBuildNode> buildNodes(2 * m_table.size() - 1);
+	std::atomic<int> totalNodes(0);
+	BVHBuildNode* root = recursiveBuild(primitiveInfo, 0, m_table.size(), buildNodes, totalNodes);
+	m_totalNodes = totalNodes;
+
+	// Leaves reference contiguous ranges of the partitioned primitive info
+	std::vector<PrimitiveTable::Entry> orderedEntries(entries.size());
+	parallelFor((size_t)0, entries.size(), [&](size_t i)
+	{
+		orderedEntries[i] = entries[primitiveInfo[i].m_primitiveNumber];
+	});
+	entries.swap(orderedEntries);
+
+	if (m_leafBlockSize > 1)
+		buildTrianglePackets(buildNodes, m_totalNodes);
+
+	m_bounds = root->m_bounds;
+	size_t nodeMemory = 0;
+	if (m_wideIntersector != nullptr)
+	{
+		// Collapse into 8-ary nodes for the SIMD traversal
+		std::vector<WideBVHNode> wideNodes;
+		wideNodes.reserve(m_totalNodes / 4 + 1);
+		collapseWideBVH(root, wideNodes);
+		m_totalWideNodes = wideNodes.size();
+		m_wideNodes = AllocAligned<WideBVHNode>(m_totalWideNodes);
+		memcpy(m_wideNodes, wideNodes.data(), m_totalWideNodes * sizeof(WideBVHNode));
+		nodeMemory = m_totalWideNodes * sizeof(WideBVHNode);
+	}
+	else
+	{
+		// Compute representation of depth-first traversal of BVH tree
+		m_nodes = AllocAligned<LinearBVHNode>(m_totalNodes);
+		int offset = 0;
+		flattenBVHTree(root, &offset);
+		CHECK_EQ(m_totalNodes, offset);
+		nodeMemory = m_totalNodes * sizeof(LinearBVHNode);
+	}
+
+	m_buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	m_nodeMemory = nodeMemory + m_totalPackets * sizeof(TrianglePacket);
+	size_t primitiveMemory = m_table.memoryBytes() + m_leafPackets.capacity() * sizeof(LeafPackets);
+	size_t totalMemory = m_nodeMemory + primitiveMemory;
+	K_INFO("[BVHAccel] Primitives: {0}, nodes: {1} ({2}), node memory: {3:.2f} KB, triangle packets: {4} ({5:.2f} KB), "
+		"primitive table: {6:.2f} KB, {7:.1f} bytes per primitive, build time: {8:.2f} ms",
+		m_table.size(), m_wideNodes ? m_totalWideNodes : m_totalNodes, m_wideNodes ? "8-wide" : "binary",
+		nodeMemory / 1024.0, m_totalPackets, m_totalPackets * sizeof(TrianglePacket) / 1024.0,
+		primitiveMemory / 1024.0, (double)totalMemory / m_table.size(), m_buildTime);
+}
+
+BVHAccel::~BVHAccel()
+{
+	FreeAligned(m_nodes);
+	FreeAligned(m_wideNodes);
+	FreeAligned(m_packets);
+}
+
+BVHAccel::SplitMethod BVHAccel::toSplitMethod(const std::string& name)
+{
+	if (name == "SAH")
+		return SplitMethod::SAH;
+	else if (name == "Middle")
+		return SplitMethod::Middle;
+	else if (name == "EqualCounts")
+		return SplitMethod::EqualCounts;
+
+	K_WARN("BVH split method \"{0}\" unknown. Using \"SAH\".", name);
+	return SplitMethod::SAH;
+}
+
+Bounds3f BVHAccel::worldBound() const
+{
+	return m_bounds;
+}
+
+BVHBuildNode* BVHAccel::recursiveBuild(std::vector<BVHPrimitiveInfo>& primitiveInfo, int start, int end,
+	std::vector<BVHBuildNode>& buildNodes, std::atomic<int>& totalNodes)
+{
+	CHECK_NE(start, end);
+	BVHBuildNode* node = &buildNodes[totalNodes.fetch_add(1)];
+
+	// Compute bounds of all primitives and their centroids in BVH node
+	Bounds3f bounds, centroidBounds;
+	computeRangeBounds(primitiveInfo, start, end, bounds, centroidBounds);
+
+	int nPrimitives = end - start;
+	int dim = centroidBounds.maximumExtent();
+
+	// Create leaf for a single primitive or when all centroids coincide
+	if (nPrimitives == 1 || centroidBounds.m_pMax[dim] == centroidBounds.m_pMin[dim])
+	{
+		node->initLeaf(start, nPrimitives, bounds);
+		return node;
+	}
+
+	// Partition primitives into two sets and build children
+	int mid = (start + end) / 2;
+	auto centroidLess = [dim](const BVHPrimitiveInfo& a, const BVHPrimitiveInfo& b)
+	{
+		return a.m_centroid[dim] < b.m_centroid[dim];
+	};
+
+	switch (m_splitMethod)
+	{
+	case SplitMethod::Middle:
+	{
+		// Partition primitives through node's midpoint
+		Float pmid = (centroidBounds.m_pMin[dim] + centroidBounds.m_pMax[dim]) / 2;
+		BVHPrimitiveInfo* midPtr = std::partition(&primitiveInfo[start], &primitiveInfo[end - 1] + 1,
+			[dim, pmid](const BVHPrimitiveInfo& pi) { return pi.m_centroid[dim] < pmid; });
+		mid = midPtr - &primitiveInfo[0];
+		if (mid != start && mid != end)
+			break;
+		// Note: for lots of prims with large overlapping bounding boxes, this
+		//       may fail to partition; in that case fall through to EqualCounts
+	}
+	case SplitMethod::EqualCounts:
+	{
+		// Partition primitives into equally-sized subsets
+		mid = (start + end) / 2;
+		std::nth_element(&primitiveInfo[start], &primitiveInfo[mid], &primitiveInfo[end - 1] + 1, centroidLess);
+		break;
+	}
+	case SplitMethod::SAH:
+	default:
+	{
+		if (nPrimitives <= 2)
+		{
+			// A packet tests both at once
+			if (m_leafBlockSize > 1)
+			{
+				node->initLeaf(start, nPrimitives, bounds);
+				return node;
+			}
+			mid = (start + end) / 2;
+			std::nth_element(&primitiveInfo[start], &primitiveInfo[mid], &primitiveInfo[end - 1] + 1, centroidLess);
+			break;
+		}
+
+		// Initialize buckets for SAH partition, one bucket array per chunk
+		const int nChunks = numChunks(nPrimitives);
+		std::vector<std::array<BucketInfo, nBuckets>> chunkBuckets(nChunks);
+		forEachChunk(nChunks, [&](size_t chunk)
+		{
+			int chunkStart = start + (int)chunk * parallelBuildThreshold;
+			int chunkEnd = glm::min(end, chunkStart + parallelBuildThreshold);
+			auto& buckets = chunkBuckets[chunk];
+			for (int i = chunkStart; i < chunkEnd; ++i)
+			{
+				int b = bucketIndex(centroidBounds, primitiveInfo[i].m_centroid, dim);
+				++buckets[b].m_count;
+				buckets[b].m_bounds = unionBounds(buckets[b].m_bounds, primitiveInfo[i].m_bounds);
+			}
+		});
+
+		BucketInfo buckets[nBuckets];
+		for (int c = 0; c < nChunks; ++c)
+		{
+			for (int b = 0; b < nBuckets; ++b)
+			{
+				buckets[b].m_count += chunkBuckets[c][b].m_count;
+				buckets[b].m_bounds = unionBounds(buckets[b].m_bounds, chunkBuckets[c][b].m_bounds);
+			}
+		}
+
+		// Compute costs for splitting after each bucket with a sweep from both sides
+		// Note: traversal cost is set to 1/8 of the primitive intersection cost
+		auto leafBlocks = [this](int count) { return (count + m_leafBlockSize - 1) / m_leafBlockSize; };
+		Float cost[nBuckets - 1];
+		{
+			Bounds3f b0;
+			int count0 = 0;
+			for (int i = 0; i < nBuckets - 1; ++i)
+			{
+				b0 = unionBounds(b0, buckets[i].m_bounds);
+				count0 += buckets[i].m_count;
+				cost[i] = leafBlocks(count0) * b0.surfaceArea();
+			}
+			Bounds3f b1;
+			int count1 = 0;
+			for (int i = nBuckets - 1; i >= 1; --i)
+			{
+				b1 = unionBounds(b1, buckets[i].m_bounds);
+				count1 += buckets[i].m_count;
+				cost[i - 1] += leafBlocks(count1) * b1.surfaceArea();
+			}
+		}
+
+		// Find bucket to split at that minimizes SAH metric
+		const Float invSA = 1 / bounds.surfaceArea();
+		Float minCost = Infinity;
+		int minCostSplitBucket = 0;
+		for (int i = 0; i < nBuckets - 1; ++i)
+		{
+			Float c = .125f + cost[i] * invSA;
+			if (c < minCost)
+			{
+				minCost = c;
+				minCostSplitBucket = i;
+			}
+		}
+
+		// Either create leaf or split primitives at selected SAH bucket
+		Float leafCost = leafBlocks(nPrimitives);
+		if (nPrimitives <= m_maxPrimsInNode && minCost >= leafCost)
+		{
+			node->initLeaf(start, nPrimitives, bounds);
+			return node;
+		}
+
+		BVHPrimitiveInfo* pmid = std::partition(&primitiveInfo[start], &primitiveInfo[end - 1] + 1,
+			[=](const BVHPrimitiveInfo& pi)
+			{
+				return bucketIndex(centroidBounds, pi.m_centroid, dim) <= minCostSplitBucket;
+			});
+		mid = pmid - &primitiveInfo[0];
+		break;
+	}
+	}
+
+	BVHBuildNode* children[2];
+	if (nPrimitives > parallelBuildThreshold)
+	{
+		// Both halves touch disjoint ranges of primitiveInfo, so they can be built concurrently
+		tbb::parallel_invoke(
+			[&]() { children[0] = recursiveBuild(primitiveInfo, start, mid, buildNodes, totalNodes); },
+			[&]() { children[1] = recursiveBuild(primitiveInfo, mid, end, buildNodes, totalNodes); });
+	}
+	else
+	{
+		children[0] = recursiveBuild(primitiveInfo, start, mid, buildNodes, totalNodes);
+		children[1] = recursiveBuild(primitiveInfo, mid, end, buildNodes, totalNodes);
+	}
+
+	node->initInterior(dim, children[0], children[1]);
+	return node;
+}
+
+int BVHAccel::flattenBVHTree(BVHBuildNode* node, int* offset)
+{
+	LinearBVHNode* linearNode = &m_nodes[*offset];
+	linearNode->m_bounds = node->m_bounds;
+	int myOffset = (*offset)++;
+	if (node->m_nPrimitives > 0)
+	{
+		CHECK_LT(node->m_nPrimitives, 65536);
+		linearNode->m_primitivesOffset = node->m_firstPrimOffset;
+		linearNode->m_nPrimitives = node->m_nPrimitives;
+	}
+	else
+	{
+		// Create interior flattened BVH node
+		linearNode->m_axis = node->m_splitAxis;
+		linearNode->m_nPrimitives = 0;
+		flattenBVHTree(node->m_children[0], offset);
+		linearNode->m_secondChildOffset = flattenBVHTree(node->m_children[1], offset);
+	}
+	return myOffset;
+}
+
+int BVHAccel::collapseWideBVH(BVHBuildNode* node, std::vector<WideBVHNode>& wideNodes)
+{
+	const int nodeIndex = wideNodes.size();
+	wideNodes.emplace_back();
+
+	BVHBuildNode* children[WideBVHNode::width];
+	int nChildren = 0;
+	if (node->m_nPrimitives > 0)
+	{
+		// Only happens for a root that is a leaf
+		children[nChildren++] = node;
+	}
+	else
+	{
+		children[nChildren++] = node->m_children[0];
+		children[nChildren++] = node->m_children[1];
+		while (nChildren < WideBVHNode::width)
+		{
+			int best = -1;
+			Float bestArea = -Infinity;
+			for (int i = 0; i < nChildren; ++i)
+			{
+				if (children[i]->m_nPrimitives == 0 && children[i]->m_bounds.surfaceArea() > bestArea)
+				{
+					best = i;
+					bestArea = children[i]->m_bounds.surfaceArea();
+				}
+			}
+			if (best == -1)
+				break;
+
+			BVHBuildNode* opened = children[best];
+			children[best] = opened->m_children[0];
+			children[nChildren++] = opened->m_children[1];
+		}
+	}
+
+	for (int lane = 0; lane < WideBVHNode::width; ++lane)
+	{
+		if (lane >= nChildren)
+		{
+			wideNodes[nodeIndex].setEmpty(lane);
+		}
+		else if (children[lane]->m_nPrimitives > 0)
+		{
+			wideNodes[nodeIndex].setChild(lane, children[lane]->m_bounds,
+				children[lane]->m_firstPrimOffset, children[lane]->m_nPrimitives);
+		}
+		else
+		{
+			// Note: _wideNodes_ may grow during the recursion, so index it again afterwards
+			int childIndex = collapseWideBVH(children[lane], wideNodes);
+			wideNodes[nodeIndex].setChild(lane, children[lane]->m_bounds, childIndex, 0);
+		}
+	}
+	return nodeIndex;
+}
+
+void BVHAccel::buildTrianglePackets(const std::vector<BVHBuildNode>& buildNodes, int totalNodes)
+{
+	std::vector<PrimitiveTable::Entry>& entries = m_table.getEntries();
+	m_leafPackets.resize(entries.size());
+	std::vector<TrianglePacket> packets;
+	for (int i = 0; i < totalNodes; ++i)
+	{
+		const BVHBuildNode& node = buildNodes[i];
+		if (node.m_nPrimitives == 0)
+			continue;
+
+		auto first = entries.begin() + node.m_firstPrimOffset;
+		auto last = first + node.m_nPrimitives;
+		auto triangleEnd = std::stable_partition(first, last,
+			[&](const PrimitiveTable::Entry& entry) { return isPackable(m_table, entry); });
+
+		LeafPackets& leaf = m_leafPackets[node.m_firstPrimOffset];
+		leaf.m_firstPacket = packets.size();
+		leaf.m_nTriangles = triangleEnd - first;
+		for (int j = 0; j < leaf.m_nTriangles; ++j)
+		{
+			const int lane = j % TrianglePacket::width;
+			if (lane == 0)
+			{
+				packets.emplace_back();
+				for (int k = 0; k < TrianglePacket::width; ++k)
+					packets.back().setEmpty(k);
+			}
+			Vector3f p0, p1, p2;
+			m_table.getTriangle(first[j], p0, p1, p2);
+			packets.back().setTriangle(lane, p0, p1, p2, node.m_firstPrimOffset + j);
+		}
+	}
+
+	m_totalPackets = packets.size();
+	m_packets = AllocAligned<TrianglePacket>(m_totalPackets);
+	memcpy(m_packets, packets.data(), m_totalPackets * sizeof(TrianglePacket));
+}
+
+template <typename LeafIntersector>
+bool BVHAccel::traverseBinary(const Ray& ray, bool anyHit, const LeafIntersector& intersectLeaf) const
+{
+	bool hit = false;
+	Vector3f invDir(1 / ray.m_dir.x, 1 / ray.m_dir.y, 1 / ray.m_dir.z);
+	int dirIsNeg[3] = { invDir.x < 0, invDir.y < 0, invDir.z < 0 };
+
+	// Follow ray through BVH nodes to find primitive intersections
+	int nodesToVisit[64];
+	int toVisitOffset = 0, currentNodeIndex = 0;
+	while (true)
+	{
+		const LinearBVHNode* node = &m_nodes[currentNodeIndex];
+		// Note: ray.m_tMax shrinks as closer hits are found, which culls farther nodes
+		if (node->m_bounds.hit(ray, invDir, dirIsNeg))
+		{
+			if (node->m_nPrimitives > 0)
+			{
+				// Intersect ray with primitives in leaf BVH node
+				if (intersectLeaf(node->m_primitivesOffset, node->m_nPrimitives))
+				{
+					hit = true;
+					if (anyHit)
+						return true;
+				}
+				if (toVisitOffset == 0)
+					break;
+				currentNodeIndex = nodesToVisit[--toVisitOffset];
+			}
+			else
+			{
+				// Put far BVH node on _nodesToVisit_ stack, advance to near node
+				if (dirIsNeg[node->m_axis])
+				{
+					nodesToVisit[toVisitOffset++] = currentNodeIndex + 1;
+					currentNodeIndex = node->m_secondChildOffset;
+				}
+				else
+				{
+					nodesToVisit[toVisitOffset++] = node->m_secondChildOffset;
+					currentNodeIndex = currentNodeIndex + 1;
+				}
+			}
+		}
+		else
+		{
+			if (toVisitOffset == 0)
+				break;
+			currentNodeIndex = nodesToVisit[--toVisitOffset];
+		}
+	}
+	return hit;
+}
+
+template <typename LeafIntersector>
+bool BVHAccel::traverseWide(const Ray& ray, bool anyHit, const LeafIntersector& intersectLeaf, int rootNode) const
+{
+	struct StackEntry
+	{
+		int m_child;
+		int m_nPrimitives;
+		float m_tNear;
+	};
+
+	bool hit = false;
+	const WideRay wideRay(ray);
+
+	constexpr int maxStackSize = 256;
+	StackEntry stack[maxStackSize];
+	int stackSize = 0;
+	stack[stackSize++] = { rootNode, 0, 0.0f };
+	while (stackSize > 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		// Skip children that lie behind a hit found after they were pushed
+		if (entry.m_tNear > ray.m_tMax)
+			continue;
+
+		if (entry.m_nPrimitives > 0)
+		{
+			if (intersectLeaf(entry.m_child, entry.m_nPrimitives))
+			{
+				hit = true;
+				if (anyHit)
+					return true;
+			}
+			continue;
+		}
+
+		// Test all children at once
+		const WideBVHNode& node = m_wideNodes[entry.m_child];
+		alignas(32) float tNear[WideBVHNode::width];
+		uint32_t mask = m_wideIntersector(node, wideRay, (float)ray.m_tMax, tNear);
+
+		// Sort the hit children by entry distance, farthest first
+		StackEntry hits[WideBVHNode::width];
+		int nHits = 0;
+		while (mask != 0)
+		{
+			int lane = countTrailingZeros(mask);
+			mask &= mask - 1;
+			StackEntry child = { node.m_child[lane], node.m_nPrimitives[lane], tNear[lane] };
+			int i = nHits++;
+			for (; i > 0 && hits[i - 1].m_tNear < child.m_tNear; --i)
+				hits[i] = hits[i - 1];
+			hits[i] = child;
+		}
+
+		// Note: only a degenerate tree fills the stack, the children are then
+		//       finished nearest first by a traversal with a fresh stack
+		if (stackSize + nHits > maxStackSize)
+		{
+			for (int i = nHits - 1; i >= 0; --i)
+			{
+				if (hits[i].m_tNear > ray.m_tMax)
+					continue;
+				bool childHit = hits[i].m_nPrimitives > 0 ? intersectLeaf(hits[i].m_child, hits[i].m_nPrimitives)
+					: traverseWide(ray, anyHit, intersectLeaf, hits[i].m_child);
+				if (childHit)
+				{
+					hit = true;
+					if (anyHit)
+						return true;
+				}
+			}
+			continue;
+		}
+
+		// Push them so that the nearest child is popped first
+		for (int i = 0; i < nHits; ++i)
+			stack[stackSize++] = hits[i];
+	}
+	return hit;
+}
+
+template <typename LeafIntersector>
+uint32_t BVHAccel::traverseWidePacket(const Ray* rays, int nRays, bool anyHit, const LeafIntersector& intersectLeaf) const
+{
+	// A node is visited once for all rays of the packet that overlap it, bit i of _m_rays_ stands for _rays[i]_
+	struct StackEntry
+	{
+		int m_child;
+		int m_nPrimitives;
+		float m_tNear;      // Nearest entry distance over the rays
+		uint32_t m_rays;
+	};
+
+	DCHECK(nRays > 0 && nRays <= packetSize);
+	WideRay wideRays[packetSize];
+	for (int i = 0; i < nRays; ++i)
+		wideRays[i] = WideRay(rays[i]);
+
+	uint32_t hitMask = 0, doneMask = 0;
+
+	constexpr int maxStackSize = 256;
+	StackEntry stack[maxStackSize];
+	int stackSize = 0;
+	stack[stackSize++] = { 0, 0, 0.0f, (nRays == 32) ? ~0u : (1u << nRays) - 1 };
+	while (stackSize > 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+
+		// Drop rays that are done or found a hit in front of the node since it was pushed
+		uint32_t active = entry.m_rays & ~doneMask;
+		for (uint32_t rest = active; rest != 0; rest &= rest - 1)
+		{
+			int i = countTrailingZeros(rest);
+			if (entry.m_tNear > rays[i].m_tMax)
+				active &= ~(1u << i);
+		}
+		if (active == 0)
+			continue;
+
+		if (entry.m_nPrimitives > 0)
+		{
+			for (uint32_t rest = active; rest != 0; rest &= rest - 1)
+			{
+				int i = countTrailingZeros(rest);
+				if (intersectLeaf(i, entry.m_child, entry.m_nPrimitives))
+				{
+					hitMask |= 1u << i;
+					if (anyHit)
+						doneMask |= 1u << i;
+				}
+			}
+			continue;
+		}
+
+		// Coherence broke down, the remaining rays finish the subtree alone
+		if (popCount(active) < minPacketRays)
+		{
+			for (uint32_t rest = active; rest != 0; rest &= rest - 1)
+			{
+				int i = countTrailingZeros(rest);
+				auto intersectRayLeaf = [&](int offset, int nPrimitives) { return intersectLeaf(i, offset, nPrimitives); };
+				if (traverseWide(rays[i], anyHit, intersectRayLeaf, entry.m_child))
+				{
+					hitMask |= 1u << i;
+					if (anyHit)
+						doneMask |= 1u << i;
+				}
+			}
+			continue;
+		}
+
+		// Test the children against every active ray, gathering the rays per child
+		const WideBVHNode& node = m_wideNodes[entry.m_child];
+		uint32_t childRays[WideBVHNode::width] = {};
+		float childTNear[WideBVHNode::width];
+		for (int lane = 0; lane < WideBVHNode::width; ++lane)
+			childTNear[lane] = std::numeric_limits<float>::infinity();
+		for (uint32_t rest = active; rest != 0; rest &= rest - 1)
+		{
+			int i = countTrailingZeros(rest);
+			alignas(32) float tNear[WideBVHNode::width];
+			uint32_t mask = m_wideIntersector(node, wideRays[i], (float)rays[i].m_tMax, tNear);
+			while (mask != 0)
+			{
+				int lane = countTrailingZeros(mask);
+				mask &= mask - 1;
+				childRays[lane] |= 1u << i;
+				childTNear[lane] = glm::min(childTNear[lane], tNear[lane]);
+			}
+		}
+
+		// Sort the hit children by their nearest entry distance, farthest first
+		StackEntry hits[WideBVHNode::width];
+		int nHits = 0;
+		for (int lane = 0; lane < WideBVHNode::width; ++lane)
+		{
+			if (childRays[lane] == 0)
+				continue;
+			StackEntry child = { node.m_child[lane], node.m_nPrimitives[lane], childTNear[lane], childRays[lane] };
+			int i = nHits++;
+			for (; i > 0 && hits[i - 1].m_tNear < child.m_tNear; --i)
+				hits[i] = hits[i - 1];
+			hits[i] = child;
+		}
+
+		// The stack is full, the rays finish the children alone as if the coherence broke down
+		if (stackSize + nHits > maxStackSize)
+		{
+			for (int h = nHits - 1; h >= 0; --h)
+			{
+				const StackEntry& child = hits[h];
+				for (uint32_t rest = child.m_rays & ~doneMask; rest != 0; rest &= rest - 1)
+				{
+					int i = countTrailingZeros(rest);
+					auto intersectRayLeaf = [&](int offset, int nPrimitives) { return intersectLeaf(i, offset, nPrimitives); };
+					bool childHit = child.m_nPrimitives > 0 ? intersectLeaf(i, child.m_child, child.m_nPrimitives)
+						: traverseWide(rays[i], anyHit, intersectRayLeaf, child.m_child);
+					if (childHit)
+					{
+						hitMask |= 1u << i;
+						if (anyHit)
+							doneMask |= 1u << i;
+					}
+				}
+			}
+			continue;
+		}
+
+		// Push them so that the nearest child is popped first
+		for (int i = 0; i < nHits; ++i)
+			stack[stackSize++] = hits[i];
+	}
+	return hitMask;
+}
+
+bool BVHAccel::occludedLeaf(const Ray& ray, const TrianglePacketRay& packetRay, int offset, int nPrimitives) const
+{
+	int first = 0;
+	if (m_packets)
+	{
+		const LeafPackets& leaf = m_leafPackets[offset];
+		for (int i = 0; i < leaf.m_nTriangles; i += TrianglePacket::width)
+		{
+			TrianglePacketHit packetHit;
+			const TrianglePacket& packet = m_packets[leaf.m_firstPacket + i / TrianglePacket::width];
+			if (m_packetIntersector(packet, packetRay, (float)ray.m_tMax, packetHit) != 0)
+				return true;
+		}
+		first = leaf.m_nTriangles;
+	}
+
+	for (int i = first; i < nPrimitives; ++i)
+	{
+		if (m_table.hit(offset + i, ray))
+			return true;
+	}
+	return false;
+}
+
+bool BVHAccel::closestLeaf(const Ray& ray, const TrianglePacketRay& packetRay, int offset, int nPrimitives,
+	HitRecord& record) const
+{
+	bool hit = false;
+	int first = 0;
+	if (m_packets)
+	{
+		const LeafPackets& leaf = m_leafPackets[offset];
+		for (int i = 0; i < leaf.m_nTriangles; i += TrianglePacket::width)
+		{
+			TrianglePacketHit packetHit;
+			const TrianglePacket& packet = m_packets[leaf.m_firstPacket + i / TrianglePacket::width];
+			uint32_t mask = m_packetIntersector(packet, packetRay, (float)ray.m_tMax, packetHit);
+			if (mask == 0)
+				continue;
+
+			// The lanes agree with the scalar test, so the record is taken from the packet directly
+			int nearest = nearestLane(mask, packetHit);
+			ray.m_tMax = packetHit.m_t[nearest];
+			record.m_t = packetHit.m_t[nearest];
+			record.m_primitive = m_table.getPrimitive(packet.m_primitive[nearest]);
+			record.m_triangle = m_table.getEntries()[packet.m_primitive[nearest]].m_triangle;
+			record.m_barycentric = Vector3f(packetHit.m_b0[nearest], packetHit.m_b1[nearest], packetHit.m_b2[nearest]);
+			hit = true;
+		}
+		first = leaf.m_nTriangles;
+	}
+
+	for (int i = first; i < nPrimitives; ++i)
+	{
+		if (m_table.hit(offset + i, ray, record))
+			hit = true;
+	}
+	return hit;
+}
+
+bool BVHAccel::hit(const Ray& ray) const
+{
+	// Any intersection is enough for shadow rays
+	const TrianglePacketRay packetRay(ray);
+	auto intersectLeaf = [&](int offset, int nPrimitives) -> bool
+	{
+		return occludedLeaf(ray, packetRay, offset, nPrimitives);
+	};
+
+	if (m_wideNodes)
+		return traverseWide(ray, true, intersectLeaf);
+	else if (m_nodes)
+		return traverseBinary(ray, true, intersectLeaf);
+	return false;
+}
+
+bool BVHAccel::hit(const Ray& ray, HitRecord& record) const
+{
+	const TrianglePacketRay packetRay(ray);
+	auto intersectLeaf = [&](int offset, int nPrimitives) -> bool
+	{
+		return closestLeaf(ray, packetRay, offset, nPrimitives, record);
+	};
+
+	if (m_wideNodes)
+		return traverseWide(ray, false, intersectLeaf);
+	else if (m_nodes)
+		return traverseBinary(ray, false, intersectLeaf);
+	return false;
+}
+
+void BVHAccel::hitN(const RayBatch& rays, HitBatch& hits) const
+{
+	// Packets only pay off with the wide nodes, the binary traversal takes the rays one by one
+	if (!m_wideNodes)
+	{
+		PrimitiveAggregate::hitN(rays, hits);
+		return;
+	}
+
+	hits.reset(rays.size());
+	for (int first = 0; first < rays.size(); first += packetSize)
+	{
+		const int nRays = glm::min(packetSize, rays.size() - first);
+		const Ray* packet = &rays.m_rays[first];
+		TrianglePacketRay packetRays[packetSize];
+		for (int i = 0; i < nRays; ++i)
+			packetRays[i] = TrianglePacketRay(packet[i]);
+
+		auto intersectLeaf = [&](int i, int offset, int nPrimitives) -> bool
+		{
+			return closestLeaf(packet[i], packetRays[i], offset, nPrimitives, hits.m_records[first + i]);
+		};
+		uint32_t hitMask = traverseWidePacket(packet, nRays, false, intersectLeaf);
+		for (int i = 0; i < nRays; ++i)
+			hits.m_found[first + i] = (hitMask >> i) & 1;
+	}
+}
+
+void BVHAccel::occludedN(const RayBatch& rays, HitBatch& hits) const
+{
+	if (!m_wideNodes)
+	{
+		PrimitiveAggregate::occludedN(rays, hits);
+		return;
+	}
+
+	hits.reset(rays.size());
+	for (int first = 0; first < rays.size(); first += packetSize)
+	{
+		const int nRays = glm::min(packetSize, rays.size() - first);
+		const Ray* packet = &rays.m_rays[first];
+		TrianglePacketRay packetRays[packetSize];
+		for (int i = 0; i < nRays; ++i)
+			packetRays[i] = TrianglePacketRay(packet[i]);
+
+		auto intersectLeaf = [&](int i, int offset, int nPrimitives) -> bool
+		{
+			return occludedLeaf(packet[i], packetRays[i], offset, nPrimitives);
+		};
+		uint32_t hitMask = traverseWidePacket(packet, nRays, true, intersectLeaf);
+		for (int i = 0; i < nRays; ++i)
+			hits.m_found[first + i] = (hitMask >> i) & 1;
+	}
+}
+
+RENDER_END
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+#include "../Math/KMathUtil.h"
+#include "../Core/Primitive.h"
+#include "WideBVH.h"
+#include "TrianglePacket.h"
+#include "PrimitiveTable.h"
+
+#include <atomic>
+
+RENDER_BEGIN
+
+struct BVHBuildNode;
+struct BVHPrimitiveInfo;
+struct LinearBVHNode;
+
+class BVHAccel : public PrimitiveAggregate
+{
+public:
+	typedef std::shared_ptr<BVHAccel> ptr;
+
+	enum class SplitMethod { SAH, Middle, EqualCounts };
+
+	BVHAccel(const std::vector<Primitive::ptr>& primitives, int maxPrimsInNode = 4,
+		SplitMethod splitMethod = SplitMethod::SAH, bool wide = true);
+	~BVHAccel();
+
+	virtual Bounds3f worldBound() const override;
+
+	using PrimitiveAggregate::hit;
+	virtual bool hit(const Ray& ray) const override;
+	virtual bool hit(const Ray& ray, HitRecord& record) const override;
+
+	// Packets of _packetSize_ rays share one traversal of the wide nodes
+	virtual void hitN(const RayBatch& rays, HitBatch& hits) const override;
+	virtual void occludedN(const RayBatch& rays, HitBatch& hits) const override;
+
+	virtual std::string toString() const override { return "BVHAccel[]"; }
+
+	// Build statistics, node memory includes the triangle packets of the leaves
+	double buildTime() const { return m_buildTime; }
+	size_t nodeMemory() const { return m_nodeMemory; }
+
+	static SplitMethod toSplitMethod(const std::string& name);
+
+private:
+
+	BVHBuildNode* recursiveBuild(std::vector<BVHPrimitiveInfo>& primitiveInfo, int start, int end,
+		std::vector<BVHBuildNode>& buildNodes, std::atomic<int>& totalNodes);
+
+	int flattenBVHTree(BVHBuildNode* node, int* offset);
+
+	// Collapse the binary build tree into 8-ary nodes by repeatedly opening the
+	// interior child with the largest surface area
+	int collapseWideBVH(BVHBuildNode* node, std::vector<WideBVHNode>& wideNodes);
+
+	// Move the triangles of every leaf to its front and gather their vertices into packets
+	void buildTrianglePackets(const std::vector<BVHBuildNode>& buildNodes, int totalNodes);
+
+	// Traversal shared by all queries, _intersectLeaf_(offset, count) returns whether a primitive was hit.
+	// With _anyHit_ the traversal stops at the first hit.
+	template <typename LeafIntersector>
+	bool traverseBinary(const Ray& ray, bool anyHit, const LeafIntersector& intersectLeaf) const;
+	template <typename LeafIntersector>
+	bool traverseWide(const Ray& ray, bool anyHit, const LeafIntersector& intersectLeaf, int rootNode = 0) const;
+
+	// Packet traversal with a shared stack, every entry carries the mask of the rays that overlap it.
+	// _intersectLeaf_(ray, offset, count) tests a single ray, the mask of the rays that hit is returned.
+	// Once fewer than _minPacketRays_ rays reach a node, they finish its subtree with traverseWide.
+	template <typename LeafIntersector>
+	uint32_t traverseWidePacket(const Ray* rays, int nRays, bool anyHit, const LeafIntersector& intersectLeaf) const;
+
+	// Leaf tests of a single ray, the closest one shortens _ray.m_tMax_ and fills _record_
+	bool occludedLeaf(const Ray& ray, const TrianglePacketRay& packetRay, int offset, int nPrimitives) const;
+	bool closestLeaf(const Ray& ray, const TrianglePacketRay& packetRay, int offset, int nPrimitives,
+		HitRecord& record) const;
+
+	static constexpr int packetSize = 16;
+	static constexpr int minPacketRays = 4;
+
+	int m_maxPrimsInNode;
+	const SplitMethod m_splitMethod;
+
+	// Number of primitives intersected at the cost of one, the SAH counts leaf cost in such blocks
+	int m_leafBlockSize = 1;
+
+	PrimitiveTable m_table;
+
+	// Compact depth-first node array, the first child of an interior node
+	// is always stored right after its parent
+	LinearBVHNode* m_nodes = nullptr;
+	int m_totalNodes = 0;
+
+	// Collapsed 8-ary nodes, used instead of _m_nodes_ when a SIMD kernel is available
+	WideBVHNode* m_wideNodes = nullptr;
+	int m_totalWideNodes = 0;
+	WideNodeIntersector m_wideIntersector = nullptr;
+
+	// Triangles of a leaf are tested packet-wise, the remaining primitives one by one
+	struct LeafPackets
+	{
+		int m_firstPacket = 0;
+		int m_nTriangles = 0;
+	};
+
+	TrianglePacket* m_packets = nullptr;
+	int m_totalPackets = 0;
+	std::vector<LeafPackets> m_leafPackets; // Indexed by the first primitive offset of a leaf
+	TrianglePacketIntersector m_packetIntersector = nullptr;
+
+	Bounds3f m_bounds;
+
+	double m_buildTime = 0;
+	size_t m_nodeMemory = 0;
+};
+
+RENDER_END
@@ -1,5 +1,11 @@
 #include "KDTree.h"
 #include "../Tool/Memory.h"
+#include "../Tool/Logger.h"
+#include "../Tool/Parallel.h"
+
+#include <chrono>
+#include <tbb/tbb/parallel_invoke.h>
+#include <tbb/tbb/parallel_sort.h>
 
 RENDER_BEGIN
 
@@ -29,6 +35,15 @@ public:
 	bool isLeaf() const { return (m_flags & 3) == 3; }
 	int aboveChild() const { return m_rightChildIndex >> 2; }
 
+	// Shift the stored indices when the subtree holding this node is spliced into a larger node array
+	void relocate(int nodeOffset, int indexOffset)
+	{
+		if (!isLeaf())
+			m_rightChildIndex += (nodeOffset << 2);
+		else if (numPrimitives() > 1)
+			m_PrimitiveIndicesOffset += indexOffset;
+	}
+
 	union
 	{
 		Float m_split; // Split position which is for interior nodes
@@ -60,6 +75,44 @@ public:
 	EdgeType m_type;
 };
 
+// Node and primitive index storage of a (sub)tree under construction.
+// Note: node indices inside a buffer are relative to its first node, so subtrees
+//       built concurrently can be spliced behind their parent afterwards
+struct KdBuildBuffer
+{
+	std::vector<KdTreeNode> m_nodes;
+	std::vector<int> m_primitiveIndices;
+
+	void splice(const KdBuildBuffer& subtree)
+	{
+		const int nodeOffset = m_nodes.size();
+		const int indexOffset = m_primitiveIndices.size();
+		m_nodes.insert(m_nodes.end(), subtree.m_nodes.begin(), subtree.m_nodes.end());
+		for (size_t i = nodeOffset; i < m_nodes.size(); ++i)
+		{
+			m_nodes[i].relocate(nodeOffset, indexOffset);
+		}
+		m_primitiveIndices.insert(m_primitiveIndices.end(),
+			subtree.m_primitiveIndices.begin(), subtree.m_primitiveIndices.end());
+	}
+};
+
+// Subtrees with more primitives than this are built as separate tasks
+// on top of edges that are sorted once at the root
+static constexpr int parallelBuildThreshold = 4096;
+
+static bool edgeLess(const BoundEdge& e0, const BoundEdge& e1)
+{
+	if (e0.m_t == e1.m_t)
+	{
+		return (int)e0.m_type < (int)e1.m_type;
+	}
+	else
+	{
+		return e0.m_t < e1.m_t;
+	}
+}
+
 void KdTreeNode::initLeafNode(int* PrimitiveIndices, int np, std::vector<int>* primitiveIndices)
 {
 	// Note: the low 2 bits of m_flags which holds the value 3 indicate that it's a leaf node
@@ -95,82 +148,259 @@ KdTree::KdTree(const std::vector<Primitive::ptr>& Primitives, int isectCost/* =
 	m_traversalCost(traversalCost),
 	m_maxPrimitives(maxPrimitives),
 	m_emptyBonus(emptyBonus),
-	m_Primitives(Primitives)
+	m_table(Primitives)
 {
-	m_nextFreeNode = m_nAllocedNodes = 0;
+	auto startTime = std::chrono::steady_clock::now();
 
 	// The tree cannot grow without bound in pathological cases. (8 + 1.3log(N))
 	if (maxDepth <= 0)
 	{
-		maxDepth = std::round(8 + 1.3f * glm::log2(float(int64_t(m_Primitives.size()))));
+		maxDepth = std::round(8 + 1.3f * glm::log2(float(int64_t(m_table.size()))));
 	}
 
 	// Compute bounds for kd-tree construction
 	std::vector<Bounds3f> PrimitiveBounds;
-	PrimitiveBounds.reserve(m_Primitives.size());
-	for (const Primitive::ptr& Primitive : m_Primitives)
+	PrimitiveBounds.reserve(m_table.size());
+	for (size_t i = 0; i < m_table.size(); ++i)
 	{
-		Bounds3f b = Primitive->worldBound();
+		Bounds3f b = m_table.worldBound(i);
 		m_bounds = unionBounds(m_bounds, b);
 		PrimitiveBounds.push_back(b);
 	}
 
-	// Allocate working memory for kd-tree construction
-	std::unique_ptr<BoundEdge[]> edges[3];
-	for (int i = 0; i < 3; ++i)
+	// Initialize _primNums_ for kd-tree construction
+	const int nPrimitives = m_table.size();
+	std::vector<int> PrimitiveIndices(nPrimitives);
+	for (int i = 0; i < nPrimitives; ++i)
 	{
-		edges[i].reset(new BoundEdge[2 * m_Primitives.size()]);
+		PrimitiveIndices[i] = i;
 	}
 
-	std::unique_ptr<int[]> leftNodeRoom(new int[m_Primitives.size()]);
-	std::unique_ptr<int[]> rightNodeRoom(new int[(maxDepth + 1) * m_Primitives.size()]);
-
-	// Initialize _primNums_ for kd-tree construction
-	std::unique_ptr<int[]> PrimitiveIndices(new int[m_Primitives.size()]);
-	for (size_t i = 0; i < m_Primitives.size(); ++i)
+	// Note: for large inputs the edges of all three axes are sorted only once here.
+	//       Children inherit them by a linear filtering pass which keeps them sorted,
+	//       so the upper levels cost O(N log N) in total instead of a sort per node
+	std::vector<BoundEdge> edges[3];
+	if (nPrimitives > parallelBuildThreshold)
 	{
-		PrimitiveIndices[i] = i;
+		parallelFor((size_t)0, (size_t)3, [&](size_t axis)
+		{
+			edges[axis].resize(2 * nPrimitives);
+			for (int i = 0; i < nPrimitives; ++i)
+			{
+				const Bounds3f& bounds = PrimitiveBounds[i];
+				edges[axis][2 * i] = BoundEdge(bounds.m_pMin[axis], i, true);
+				edges[axis][2 * i + 1] = BoundEdge(bounds.m_pMax[axis], i, false);
+			}
+			tbb::parallel_sort(edges[axis].begin(), edges[axis].end(), edgeLess);
+		});
 	}
 
 	// Start recursive construction of kd-tree
-	buildTree(0, m_bounds, PrimitiveBounds, PrimitiveIndices.get(), m_Primitives.size(),
-		maxDepth, edges, leftNodeRoom.get(), rightNodeRoom.get());
+	KdBuildBuffer buffer;
+	buildTreeParallel(buffer, m_bounds, PrimitiveBounds, PrimitiveIndices, edges, maxDepth, 0);
+
+	// Copy the spliced nodes into the final compact array
+	m_nNodes = buffer.m_nodes.size();
+	m_nodes = AllocAligned<KdTreeNode>(m_nNodes);
+	memcpy(m_nodes, buffer.m_nodes.data(), m_nNodes * sizeof(KdTreeNode));
+	m_PrimitiveIndices.swap(buffer.m_primitiveIndices);
+
+	m_buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	m_nodeMemory = m_nNodes * sizeof(KdTreeNode) + m_PrimitiveIndices.size() * sizeof(int);
+	K_INFO("[KdTree] Primitives: {0}, nodes: {1}, node memory: {2:.2f} KB, primitive table: {3:.2f} KB, "
+		"{4:.1f} bytes per primitive, build time: {5:.2f} ms",
+		m_table.size(), m_nNodes, m_nodeMemory / 1024.0, m_table.memoryBytes() / 1024.0,
+		(double)(m_nodeMemory + m_table.memoryBytes()) / m_table.size(), m_buildTime);
+}
+
+void KdTree::findBestSplit(const BoundEdge* edges, int nPrimitives, int axis, const Bounds3f& nodeBounds,
+	Float& bestCost, int& bestAxis, int& bestOffset) const
+{
+	// Current node surface area
+	const Float invTotalSA = 1 / nodeBounds.surfaceArea();
+	Vector3f diagonal = nodeBounds.m_pMax - nodeBounds.m_pMin;
+
+	// Compute cost of all splits for _axis_ to find best
+	int nBelow = 0, nAbove = nPrimitives;
+	for (int i = 0; i < 2 * nPrimitives; ++i)
+	{
+		if (edges[i].m_type == EdgeType::End)
+			--nAbove;
+		Float edgeT = edges[i].m_t;
+		if (edgeT > nodeBounds.m_pMin[axis] && edgeT < nodeBounds.m_pMax[axis])
+		{
+			// Compute cost for split at _i_th edge
+
+			// Compute child surface areas for split at _edgeT_
+			int otherAxis0 = (axis + 1) % 3, otherAxis1 = (axis + 2) % 3;
+			Float belowSA = 2 * (diagonal[otherAxis0] * diagonal[otherAxis1] + (edgeT - nodeBounds.m_pMin[axis]) *
+				(diagonal[otherAxis0] + diagonal[otherAxis1]));
+			Float aboveSA = 2 * (diagonal[otherAxis0] * diagonal[otherAxis1] + (nodeBounds.m_pMax[axis] - edgeT) *
+				(diagonal[otherAxis0] + diagonal[otherAxis1]));
+			Float pBelow = belowSA * invTotalSA;
+			Float pAbove = aboveSA * invTotalSA;
+			Float eb = (nAbove == 0 || nBelow == 0) ? m_emptyBonus : 0;
+			Float cost = m_traversalCost + m_isectCost * (1 - eb) * (pBelow * nBelow + pAbove * nAbove);
+
+			// Update best split if this is lowest cost so far
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestOffset = i;
+			}
+		}
+		if (edges[i].m_type == EdgeType::Start)
+			++nBelow;
+	}
+
+	DCHECK(nBelow == nPrimitives && nAbove == 0);
 }
 
-void KdTree::buildTree(int nodeIndex, 
+void KdTree::buildTreeParallel(KdBuildBuffer& buffer,
 	const Bounds3f& nodeBounds,
 	const std::vector<Bounds3f>& allPrimitiveBounds,
-	int* PrimitiveIndices, 
-	int nPrimitives,
+	std::vector<int>& PrimitiveIndices,
+	std::vector<BoundEdge> edges[3],
 	int depth,
-	const std::unique_ptr<BoundEdge[]> edges[3],
-	int* leftNodeRoom, 
-	int* rightNodeRoom, 
 	int badRefines)
 {
-	CHECK_EQ(nodeIndex, m_nextFreeNode);
+	const int nPrimitives = PrimitiveIndices.size();
+
+	// Hand small subtrees over to the serial builder with their own working memory
+	if (nPrimitives <= parallelBuildThreshold)
+	{
+		std::unique_ptr<BoundEdge[]> serialEdges[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			serialEdges[i].reset(new BoundEdge[2 * nPrimitives]);
+		}
+		std::unique_ptr<int[]> leftNodeRoom(new int[nPrimitives]);
+		std::unique_ptr<int[]> rightNodeRoom(new int[(depth + 1) * nPrimitives]);
+		buildTree(buffer, nodeBounds, allPrimitiveBounds, PrimitiveIndices.data(), nPrimitives,
+			depth, serialEdges, leftNodeRoom.get(), rightNodeRoom.get(), badRefines);
+		return;
+	}
+
+	const int nodeIndex = buffer.m_nodes.size();
+	buffer.m_nodes.emplace_back();
+
+	// Initialize leaf node if termination criteria met
+	if (nPrimitives <= m_maxPrimitives || depth == 0)
+	{
+		buffer.m_nodes[nodeIndex].initLeafNode(PrimitiveIndices.data(), nPrimitives, &buffer.m_primitiveIndices);
+		return;
+	}
+
+	// Choose split axis position for interior node, same criteria as the serial build
+	int bestAxis = -1, bestOffset = -1;
+	Float bestCost = Infinity;
+	Float oldCost = m_isectCost * Float(nPrimitives);
+	int axis = nodeBounds.maximumExtent();
+	for (int retries = 0; ; ++retries)
+	{
+		findBestSplit(edges[axis].data(), nPrimitives, axis, nodeBounds, bestCost, bestAxis, bestOffset);
+		if (bestAxis != -1 || retries == 2)
+			break;
+		axis = (axis + 1) % 3;
+	}
 
-	// Get next free node from _nodes_ array
-	if (m_nextFreeNode == m_nAllocedNodes)
+	// Create leaf if no good splits were found
+	if (bestCost > oldCost)
+		++badRefines;
+	if ((bestCost > 4 * oldCost && nPrimitives < 16) || bestAxis == -1 || badRefines == 3)
 	{
-		// Note: If all of the allocated nodes have been used up, node memory
-		//		 is reallocated with twice as many entries and the old values are copied.
-		int nNewAllocNodes = glm::max(2 * m_nAllocedNodes, 512);
-		KdTreeNode* n = AllocAligned<KdTreeNode>(nNewAllocNodes);
-		if (m_nAllocedNodes > 0)
+		buffer.m_nodes[nodeIndex].initLeafNode(PrimitiveIndices.data(), nPrimitives, &buffer.m_primitiveIndices);
+		return;
+	}
+
+	// Classify primitives with respect to split
+	// Note: edges refer to primitives by their position in _PrimitiveIndices_,
+	//       so the classification only needs node-local storage
+	const std::vector<BoundEdge>& splitEdges = edges[bestAxis];
+	const Float tSplit = splitEdges[bestOffset].m_t;
+	std::vector<uint8_t> sides(nPrimitives, 0);
+	for (int i = 0; i < bestOffset; ++i)
+	{
+		if (splitEdges[i].m_type == EdgeType::Start)
+			sides[splitEdges[i].m_PrimitiveIndex] |= 1;
+	}
+	for (int i = bestOffset + 1; i < 2 * nPrimitives; ++i)
+	{
+		if (splitEdges[i].m_type == EdgeType::End)
+			sides[splitEdges[i].m_PrimitiveIndex] |= 2;
+	}
+
+	std::vector<int> belowPrimitives, abovePrimitives;
+	std::vector<int> remap[2] = { std::vector<int>(nPrimitives), std::vector<int>(nPrimitives) };
+	for (int i = 0; i < nPrimitives; ++i)
+	{
+		if (sides[i] & 1)
+		{
+			remap[0][i] = belowPrimitives.size();
+			belowPrimitives.push_back(PrimitiveIndices[i]);
+		}
+		if (sides[i] & 2)
 		{
-			memcpy(n, m_nodes, m_nAllocedNodes * sizeof(KdTreeNode));
-			FreeAligned(m_nodes);
+			remap[1][i] = abovePrimitives.size();
+			abovePrimitives.push_back(PrimitiveIndices[i]);
 		}
-		m_nodes = n;
-		m_nAllocedNodes = nNewAllocNodes;
 	}
-	++m_nextFreeNode;
+
+	// Filter the sorted edges of every axis into the children, which keeps them sorted
+	std::vector<BoundEdge> belowEdges[3], aboveEdges[3];
+	parallelFor((size_t)0, (size_t)3, [&](size_t a)
+	{
+		belowEdges[a].reserve(2 * belowPrimitives.size());
+		aboveEdges[a].reserve(2 * abovePrimitives.size());
+		for (const BoundEdge& edge : edges[a])
+		{
+			int index = edge.m_PrimitiveIndex;
+			bool starting = edge.m_type == EdgeType::Start;
+			if (sides[index] & 1)
+				belowEdges[a].push_back(BoundEdge(edge.m_t, remap[0][index], starting));
+			if (sides[index] & 2)
+				aboveEdges[a].push_back(BoundEdge(edge.m_t, remap[1][index], starting));
+		}
+		std::vector<BoundEdge>().swap(edges[a]);
+	});
+	std::vector<int>().swap(PrimitiveIndices);
+
+	// Recursively initialize children nodes
+	Bounds3f bounds0 = nodeBounds, bounds1 = nodeBounds;
+	bounds0.m_pMax[bestAxis] = bounds1.m_pMin[bestAxis] = tSplit;
+
+	KdBuildBuffer below, above;
+	tbb::parallel_invoke(
+		[&]() { buildTreeParallel(below, bounds0, allPrimitiveBounds, belowPrimitives, belowEdges, depth - 1, badRefines); },
+		[&]() { buildTreeParallel(above, bounds1, allPrimitiveBounds, abovePrimitives, aboveEdges, depth - 1, badRefines); });
+
+	// Splice children behind this node, which reproduces the depth-first layout of the serial build
+	buffer.splice(below);
+	int aboveChildIndex = buffer.m_nodes.size();
+	buffer.splice(above);
+	buffer.m_nodes[nodeIndex].initInteriorNode(bestAxis, aboveChildIndex, tSplit);
+}
+
+void KdTree::buildTree(KdBuildBuffer& buffer,
+	const Bounds3f& nodeBounds,
+	const std::vector<Bounds3f>& allPrimitiveBounds,
+	int* PrimitiveIndices, 
+	int nPrimitives,
+	int depth,
+	const std::unique_ptr<BoundEdge[]> edges[3],
+	int* leftNodeRoom, 
+	int* rightNodeRoom, 
+	int badRefines)
+{
+	// Get next free node from the buffer
+	const int nodeIndex = buffer.m_nodes.size();
+	buffer.m_nodes.emplace_back();
 
 	// Initialize leaf node if termination criteria met
 	if (nPrimitives <= m_maxPrimitives || depth == 0)
 	{
-		m_nodes[nodeIndex].initLeafNode(PrimitiveIndices, nPrimitives, &m_PrimitiveIndices);
+		buffer.m_nodes[nodeIndex].initLeafNode(PrimitiveIndices, nPrimitives, &buffer.m_primitiveIndices);
 		return;
 	}
 
@@ -181,10 +411,6 @@ void KdTree::buildTree(int nodeIndex,
 	Float bestCost = Infinity;
 	Float oldCost = m_isectCost * Float(nPrimitives);
 
-	// Current node surface area
-	const Float invTotalSA = 1 / nodeBounds.surfaceArea();
-	Vector3f diagonal = nodeBounds.m_pMax - nodeBounds.m_pMin;
-
 	// Choose which axis to split along
 	int axis = nodeBounds.maximumExtent();
 	int retries = 0;
@@ -200,55 +426,10 @@ retrySplit:
 	}
 
 	// Sort _edges_ for _axis_
-	std::sort(&edges[axis][0], &edges[axis][2 * nPrimitives],
-		[](const BoundEdge& e0, const BoundEdge& e1) -> bool
-		{
-			if (e0.m_t == e1.m_t)
-			{
-				return (int)e0.m_type < (int)e1.m_type;
-			}
-			else
-			{
-				return e0.m_t < e1.m_t;
-			}
-		});
+	std::sort(&edges[axis][0], &edges[axis][2 * nPrimitives], edgeLess);
 
 	// Compute cost of all splits for _axis_ to find best
-	int nBelow = 0, nAbove = nPrimitives;
-	const auto& currentEdge = edges[axis];
-	for (int i = 0; i < 2 * nPrimitives; ++i)
-	{
-		if (currentEdge[i].m_type == EdgeType::End)
-			--nAbove;
-		Float edgeT = currentEdge[i].m_t;
-		if (edgeT > nodeBounds.m_pMin[axis] && edgeT < nodeBounds.m_pMax[axis])
-		{
-			// Compute cost for split at _i_th edge
-
-			// Compute child surface areas for split at _edgeT_
-			int otherAxis0 = (axis + 1) % 3, otherAxis1 = (axis + 2) % 3;
-			Float belowSA = 2 * (diagonal[otherAxis0] * diagonal[otherAxis1] + (edgeT - nodeBounds.m_pMin[axis]) *
-				(diagonal[otherAxis0] + diagonal[otherAxis1]));
-			Float aboveSA = 2 * (diagonal[otherAxis0] * diagonal[otherAxis1] + (nodeBounds.m_pMax[axis] - edgeT) *
-				(diagonal[otherAxis0] + diagonal[otherAxis1]));
-			Float pBelow = belowSA * invTotalSA;
-			Float pAbove = aboveSA * invTotalSA;
-			Float eb = (nAbove == 0 || nBelow == 0) ? m_emptyBonus : 0;
-			Float cost = m_traversalCost + m_isectCost * (1 - eb) * (pBelow * nBelow + pAbove * nAbove);
-
-			// Update best split if this is lowest cost so far
-			if (cost < bestCost)
-			{
-				bestCost = cost;
-				bestAxis = axis;
-				bestOffset = i;
-			}
-		}
-		if (currentEdge[i].m_type == EdgeType::Start)
-			++nBelow;
-	}
-
-	DCHECK(nBelow == nPrimitives && nAbove == 0);
+	findBestSplit(edges[axis].get(), nPrimitives, axis, nodeBounds, bestCost, bestAxis, bestOffset);
 
 	if (bestAxis == -1 && retries < 2)
 	{
@@ -262,7 +443,7 @@ retrySplit:
 		++badRefines;
 	if ((bestCost > 4 * oldCost && nPrimitives < 16) || bestAxis == -1 || badRefines == 3)
 	{
-		m_nodes[nodeIndex].initLeafNode(PrimitiveIndices, nPrimitives, &m_PrimitiveIndices);
+		buffer.m_nodes[nodeIndex].initLeafNode(PrimitiveIndices, nPrimitives, &buffer.m_primitiveIndices);
 		return;
 	}
 
@@ -285,14 +466,14 @@ retrySplit:
 	bounds0.m_pMax[bestAxis] = bounds1.m_pMin[bestAxis] = tSplit;
 
 	// below subtree node
-	buildTree(nodeIndex + 1, bounds0, allPrimitiveBounds, leftNodeRoom, lnPrimitives, depth - 1, edges,
+	buildTree(buffer, bounds0, allPrimitiveBounds, leftNodeRoom, lnPrimitives, depth - 1, edges,
 		leftNodeRoom, rightNodeRoom + nPrimitives, badRefines);
-	int aboveChildIndex = m_nextFreeNode;
+	int aboveChildIndex = buffer.m_nodes.size();
 
-	m_nodes[nodeIndex].initInteriorNode(bestAxis, aboveChildIndex, tSplit);
+	buffer.m_nodes[nodeIndex].initInteriorNode(bestAxis, aboveChildIndex, tSplit);
 
 	// above subtree node
-	buildTree(aboveChildIndex, bounds1, allPrimitiveBounds, rightNodeRoom, rnPrimitives, depth - 1, edges,
+	buildTree(buffer, bounds1, allPrimitiveBounds, rightNodeRoom, rnPrimitives, depth - 1, edges,
 		leftNodeRoom, rightNodeRoom + nPrimitives, badRefines);
 }
 
@@ -324,8 +505,7 @@ bool KdTree::hit(const Ray& ray) const
 			int nPrimitives = currNode->numPrimitives();
 			if (nPrimitives == 1)
 			{
-				const Primitive::ptr& p = m_Primitives[currNode->m_onePrimitive];
-				if (p->hit(ray))
+				if (m_table.hit(currNode->m_onePrimitive, ray))
 				{
 					return true;
 				}
@@ -335,8 +515,7 @@ bool KdTree::hit(const Ray& ray) const
 				for (int i = 0; i < nPrimitives; ++i)
 				{
 					int PrimitiveIndex = m_PrimitiveIndices[currNode->m_PrimitiveIndicesOffset + i];
-					const Primitive::ptr& p = m_Primitives[PrimitiveIndex];
-					if (p->hit(ray))
+					if (m_table.hit(PrimitiveIndex, ray))
 					{
 						return true;
 					}
@@ -402,7 +581,7 @@ bool KdTree::hit(const Ray& ray) const
 	return false;
 }
 
-bool KdTree::hit(const Ray& ray, SurfaceInteraction& isect) const
+bool KdTree::hit(const Ray& ray, HitRecord& record) const
 {
 	// Compute initial parametric range of ray inside kd-tree extent
 	Float tMin, tMax;
@@ -474,9 +653,8 @@ bool KdTree::hit(const Ray& ray, SurfaceInteraction& isect) const
 			int nPrimitives = currNode->numPrimitives();
 			if (nPrimitives == 1)
 			{
-				const Primitive::ptr& p = m_Primitives[currNode->m_onePrimitive];
 				// Check one Primitive inside leaf node
-				if (p->hit(ray, isect))
+				if (m_table.hit(currNode->m_onePrimitive, ray, record))
 					hit = true;
 			}
 			else
@@ -484,9 +662,8 @@ bool KdTree::hit(const Ray& ray, SurfaceInteraction& isect) const
 				for (int i = 0; i < nPrimitives; ++i)
 				{
 					int index = m_PrimitiveIndices[currNode->m_PrimitiveIndicesOffset + i];
-					const Primitive::ptr& p = m_Primitives[index];
 					// Check one Primitive inside leaf node
-					if (p->hit(ray, isect))
+					if (m_table.hit(index, ray, record))
 						hit = true;
 				}
 			}
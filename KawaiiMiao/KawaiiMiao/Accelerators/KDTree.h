@@ -3,11 +3,13 @@
 #include "../Core/Rendering.h"
 #include "../Math/KMathUtil.h"
 #include "../Core/Primitive.h"
+#include "PrimitiveTable.h"
 
 RENDER_BEGIN
 
 class KdTreeNode;
 class BoundEdge;
+struct KdBuildBuffer;
 
 class KdTree : public PrimitiveAggregate
 {
@@ -20,30 +22,47 @@ public:
 	virtual Bounds3f worldBound() const override { return m_bounds; }
 	~KdTree();
 
+	using PrimitiveAggregate::hit;
 	virtual bool hit(const Ray& ray) const override;
-	virtual bool hit(const Ray& ray, SurfaceInteraction& iset) const override;
+	virtual bool hit(const Ray& ray, HitRecord& record) const override;
 
 	virtual std::string toString() const override { return "KdTree[]"; }
 
+	// Build statistics, node memory includes the primitive index lists of the leaves
+	double buildTime() const { return m_buildTime; }
+	size_t nodeMemory() const { return m_nodeMemory; }
+
 private:
 
-	void buildTree(int nodeNum, const Bounds3f& bounds,
+	// Task-parallel build of the upper levels on presorted edges, hands small subtrees to buildTree
+	void buildTreeParallel(KdBuildBuffer& buffer, const Bounds3f& bounds,
+		const std::vector<Bounds3f>& primBounds, std::vector<int>& primNums,
+		std::vector<BoundEdge> edges[3], int depth, int badRefines);
+
+	void buildTree(KdBuildBuffer& buffer, const Bounds3f& bounds,
 		const std::vector<Bounds3f>& primBounds, int* primNums,
 		int nprims, int depth,
 		const std::unique_ptr<BoundEdge[]> edges[3], int* prims0,
 		int* prims1, int badRefines = 0);
 
+	// Sweep the sorted edges of _axis_ and keep the split with the lowest SAH cost
+	void findBestSplit(const BoundEdge* edges, int nprims, int axis, const Bounds3f& bounds,
+		Float& bestCost, int& bestAxis, int& bestOffset) const;
+
 	// SAH split measurement
 	const Float m_emptyBonus;
 	const int m_isectCost, m_traversalCost, m_maxPrimitives;
 
 	// Compact the node into an array
 	KdTreeNode* m_nodes;
-	int m_nAllocedNodes, m_nextFreeNode;
+	int m_nNodes;
 
 	Bounds3f m_bounds;
-	std::vector<Primitive::ptr> m_Primitives;
+	PrimitiveTable m_table;
 	std::vector<int> m_PrimitiveIndices;
+
+	double m_buildTime = 0;
+	size_t m_nodeMemory = 0;
 };
 
 struct KdToDo
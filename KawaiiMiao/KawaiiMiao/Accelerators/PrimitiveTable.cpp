@@ -0,0 +1,69 @@
+#include "PrimitiveTable.h"
+
+#include "../Shapes/TriangleShape.h"
+
+RENDER_BEGIN
+
+PrimitiveTable::PrimitiveTable(const std::vector<Primitive::ptr>& primitives)
+	: m_owned(primitives)
+{
+	size_t nEntries = 0;
+	for (const auto& primitive : primitives)
+	{
+		auto mesh = dynamic_cast<const MeshPrimitive*>(primitive.get());
+		m_primitives.push_back(primitive.get());
+		m_meshes.push_back(mesh);
+		nEntries += mesh != nullptr ? mesh->numTriangles() : 1;
+	}
+
+	m_entries.reserve(nEntries);
+	for (size_t i = 0; i < m_primitives.size(); ++i)
+	{
+		if (m_meshes[i] != nullptr)
+		{
+			for (int triangle = 0; triangle < m_meshes[i]->numTriangles(); ++triangle)
+				m_entries.push_back({ (int32_t)i, triangle });
+		}
+		else
+		{
+			m_entries.push_back({ (int32_t)i, -1 });
+		}
+	}
+}
+
+Bounds3f PrimitiveTable::worldBound(size_t i) const
+{
+	const Entry& entry = m_entries[i];
+	if (entry.m_triangle >= 0)
+		return m_meshes[entry.m_primitive]->getMesh()->triangleBound(entry.m_triangle);
+	return m_primitives[entry.m_primitive]->worldBound();
+}
+
+bool PrimitiveTable::getTriangle(const Entry& entry, Vector3f& p0, Vector3f& p1, Vector3f& p2) const
+{
+	if (entry.m_triangle >= 0)
+	{
+		const TriangleMesh* mesh = m_meshes[entry.m_primitive]->getMesh();
+		p0 = mesh->getTriangleVertex(entry.m_triangle, 0);
+		p1 = mesh->getTriangleVertex(entry.m_triangle, 1);
+		p2 = mesh->getTriangleVertex(entry.m_triangle, 2);
+		return true;
+	}
+
+	auto object = dynamic_cast<const PrimitiveObject*>(m_primitives[entry.m_primitive]);
+	auto triangle = object != nullptr ? dynamic_cast<const TriangleShape*>(object->getShape()) : nullptr;
+	if (triangle == nullptr)
+		return false;
+	p0 = triangle->getVertex(0);
+	p1 = triangle->getVertex(1);
+	p2 = triangle->getVertex(2);
+	return true;
+}
+
+size_t PrimitiveTable::memoryBytes() const
+{
+	return m_entries.capacity() * sizeof(Entry) + m_primitives.capacity() * sizeof(const Primitive*)
+		+ m_meshes.capacity() * sizeof(const MeshPrimitive*) + m_owned.capacity() * sizeof(Primitive::ptr);
+}
+
+RENDER_END
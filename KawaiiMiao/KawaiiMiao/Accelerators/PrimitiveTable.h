@@ -0,0 +1,64 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+#include "../Core/Primitive.h"
+
+#include <cstdint>
+
+RENDER_BEGIN
+
+// Flat list of what an aggregate is built over: one 8 byte entry per triangle of a MeshPrimitive
+// and one per any other primitive. The primitives themselves sit in a small side table, so the
+// traversal touches no reference counts and tests mesh triangles without a virtual call.
+class PrimitiveTable
+{
+public:
+	struct Entry
+	{
+		int32_t m_primitive;   // Index into the primitive table
+		int32_t m_triangle;    // Triangle of a MeshPrimitive, -1 for any other primitive
+	};
+
+	PrimitiveTable() = default;
+	explicit PrimitiveTable(const std::vector<Primitive::ptr>& primitives);
+
+	size_t size() const { return m_entries.size(); }
+	bool empty() const { return m_entries.empty(); }
+
+	// Aggregates reorder the entries during their build
+	std::vector<Entry>& getEntries() { return m_entries; }
+	const std::vector<Entry>& getEntries() const { return m_entries; }
+
+	const Primitive* getPrimitive(size_t i) const { return m_primitives[m_entries[i].m_primitive]; }
+	Bounds3f worldBound(size_t i) const;
+
+	// Vertices of _entry_ if it is a triangle, either of a mesh or a TriangleShape
+	bool getTriangle(const Entry& entry, Vector3f& p0, Vector3f& p1, Vector3f& p2) const;
+
+	bool hit(size_t i, const Ray& ray) const
+	{
+		const Entry& entry = m_entries[i];
+		if (entry.m_triangle >= 0)
+			return m_meshes[entry.m_primitive]->hitTriangle(entry.m_triangle, ray);
+		return m_primitives[entry.m_primitive]->hit(ray);
+	}
+
+	bool hit(size_t i, const Ray& ray, HitRecord& record) const
+	{
+		const Entry& entry = m_entries[i];
+		if (entry.m_triangle >= 0)
+			return m_meshes[entry.m_primitive]->hitTriangle(entry.m_triangle, ray, record);
+		return m_primitives[entry.m_primitive]->hit(ray, record);
+	}
+
+	// Bytes taken by the entries and the primitive table, not the primitives
+	size_t memoryBytes() const;
+
+private:
+	std::vector<Entry> m_entries;
+	std::vector<const Primitive*> m_primitives;
+	std::vector<const MeshPrimitive*> m_meshes;   // Parallel to _m_primitives_, nullptr for non-meshes
+	std::vector<Primitive::ptr> m_owned;
+};
+
+RENDER_END
@@ -0,0 +1,313 @@
+#include "TrianglePacket.h"
+
+#ifdef RENDER_HAVE_WIDE_BVH
+#include <immintrin.h>
+#endif
+
+RENDER_BEGIN
+
+void TrianglePacket::setEmpty(int lane)
+{
+	for (int vertex = 0; vertex < 3; ++vertex)
+	{
+		for (int axis = 0; axis < 3; ++axis)
+			m_p[vertex][axis][lane] = 0.0f;
+	}
+	m_primitive[lane] = -1;
+}
+
+void TrianglePacket::setTriangle(int lane, const Vector3f& p0, const Vector3f& p1, const Vector3f& p2, int primitive)
+{
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		m_p[0][axis][lane] = p0[axis];
+		m_p[1][axis][lane] = p1[axis];
+		m_p[2][axis][lane] = p2[axis];
+	}
+	m_primitive[lane] = primitive;
+}
+
+TrianglePacketRay::TrianglePacketRay(const Ray& ray)
+{
+	// Permute components of the ray direction as in TriangleShape::hit
+	m_kz = maxDimension(abs(ray.direction()));
+	m_kx = m_kz + 1;
+	if (m_kx == 3) m_kx = 0;
+	m_ky = m_kx + 1;
+	if (m_ky == 3) m_ky = 0;
+	Vector3f d = permute(ray.direction(), m_kx, m_ky, m_kz);
+
+	m_Sx = -d.x / d.z;
+	m_Sy = -d.y / d.z;
+	m_Sz = 1.f / d.z;
+	for (int axis = 0; axis < 3; ++axis)
+		m_org[axis] = ray.m_origin[axis];
+}
+
+#if defined(RENDER_HAVE_WIDE_BVH) && !defined(FLOAT_AS_DOUBLE)
+
+static const float gamma2 = (float)gamma(2);
+static const float gamma3 = (float)gamma(3);
+static const float gamma5 = (float)gamma(5);
+
+// Scalar test of a single lane, the exact sequence of TriangleShape::hit including
+// the double precision fallback at triangle edges
+static bool intersectLane(const TrianglePacket& packet, int lane, const TrianglePacketRay& ray,
+	float tMax, TrianglePacketHit& hit)
+{
+	// Translate, permute and shear the vertices
+	float px[3], py[3], pz[3];
+	for (int v = 0; v < 3; ++v)
+	{
+		px[v] = packet.m_p[v][ray.m_kx][lane] - ray.m_org[ray.m_kx];
+		py[v] = packet.m_p[v][ray.m_ky][lane] - ray.m_org[ray.m_ky];
+		pz[v] = packet.m_p[v][ray.m_kz][lane] - ray.m_org[ray.m_kz];
+		px[v] += ray.m_Sx * pz[v];
+		py[v] += ray.m_Sy * pz[v];
+	}
+
+	float e0 = px[1] * py[2] - py[1] * px[2];
+	float e1 = px[2] * py[0] - py[2] * px[0];
+	float e2 = px[0] * py[1] - py[0] * px[1];
+
+	// Fall back to double precision test at triangle edges
+	if (e0 == 0.0f || e1 == 0.0f || e2 == 0.0f)
+	{
+		e0 = (float)((double)py[2] * (double)px[1] - (double)px[2] * (double)py[1]);
+		e1 = (float)((double)py[0] * (double)px[2] - (double)px[0] * (double)py[2]);
+		e2 = (float)((double)py[1] * (double)px[0] - (double)px[1] * (double)py[0]);
+	}
+
+	if ((e0 < 0 || e1 < 0 || e2 < 0) && (e0 > 0 || e1 > 0 || e2 > 0))
+		return false;
+	float det = e0 + e1 + e2;
+	if (det == 0)
+		return false;
+
+	for (int v = 0; v < 3; ++v)
+		pz[v] *= ray.m_Sz;
+	float tScaled = e0 * pz[0] + e1 * pz[1] + e2 * pz[2];
+	if (det < 0 && (tScaled >= 0 || tScaled < tMax * det))
+		return false;
+	else if (det > 0 && (tScaled <= 0 || tScaled > tMax * det))
+		return false;
+
+	float invDet = 1 / det;
+	float t = tScaled * invDet;
+
+	// Ensure that computed triangle $t$ is conservatively greater than zero
+	float maxZt = glm::max(glm::abs(pz[0]), glm::max(glm::abs(pz[1]), glm::abs(pz[2])));
+	float deltaZ = gamma3 * maxZt;
+	float maxXt = glm::max(glm::abs(px[0]), glm::max(glm::abs(px[1]), glm::abs(px[2])));
+	float maxYt = glm::max(glm::abs(py[0]), glm::max(glm::abs(py[1]), glm::abs(py[2])));
+	float deltaX = gamma5 * (maxXt + maxZt);
+	float deltaY = gamma5 * (maxYt + maxZt);
+	float deltaE = 2 * (gamma2 * maxXt * maxYt + deltaY * maxXt + deltaX * maxYt);
+	float maxE = glm::max(glm::abs(e0), glm::max(glm::abs(e1), glm::abs(e2)));
+	float deltaT = 3 * (gamma3 * maxE * maxZt + deltaE * maxZt + deltaZ * maxE) * glm::abs(invDet);
+	if (t <= deltaT)
+		return false;
+
+	hit.m_t[lane] = t;
+	hit.m_b0[lane] = e0 * invDet;
+	hit.m_b1[lane] = e1 * invDet;
+	hit.m_b2[lane] = e2 * invDet;
+	return true;
+}
+
+// Note: both kernels evaluate the same operations in the same order as the scalar test,
+//       so the lanes agree bit for bit with TriangleShape::hit (no FMA contraction).
+static int intersectTrianglePacketSSE(const TrianglePacket& packet, const TrianglePacketRay& ray,
+	float tMax, TrianglePacketHit& hit)
+{
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 Sx = _mm_set1_ps(ray.m_Sx), Sy = _mm_set1_ps(ray.m_Sy), Sz = _mm_set1_ps(ray.m_Sz);
+
+	int mask = 0, edgeMask = 0;
+	for (int half = 0; half < TrianglePacket::width; half += 4)
+	{
+		// Translate vertices based on ray origin, then permute and shear them
+		__m128 px[3], py[3], pz[3];
+		for (int v = 0; v < 3; ++v)
+		{
+			__m128 x = _mm_sub_ps(_mm_load_ps(&packet.m_p[v][ray.m_kx][half]), _mm_set1_ps(ray.m_org[ray.m_kx]));
+			__m128 y = _mm_sub_ps(_mm_load_ps(&packet.m_p[v][ray.m_ky][half]), _mm_set1_ps(ray.m_org[ray.m_ky]));
+			pz[v] = _mm_sub_ps(_mm_load_ps(&packet.m_p[v][ray.m_kz][half]), _mm_set1_ps(ray.m_org[ray.m_kz]));
+			px[v] = _mm_add_ps(x, _mm_mul_ps(Sx, pz[v]));
+			py[v] = _mm_add_ps(y, _mm_mul_ps(Sy, pz[v]));
+		}
+
+		// Compute edge function coefficients
+		__m128 e0 = _mm_sub_ps(_mm_mul_ps(px[1], py[2]), _mm_mul_ps(py[1], px[2]));
+		__m128 e1 = _mm_sub_ps(_mm_mul_ps(px[2], py[0]), _mm_mul_ps(py[2], px[0]));
+		__m128 e2 = _mm_sub_ps(_mm_mul_ps(px[0], py[1]), _mm_mul_ps(py[0], px[1]));
+
+		const int valid = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(
+			_mm_load_si128((const __m128i*)&packet.m_primitive[half]), _mm_set1_epi32(-1))));
+		edgeMask |= (_mm_movemask_ps(_mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(e0, zero), _mm_cmpeq_ps(e1, zero)),
+			_mm_cmpeq_ps(e2, zero))) & valid) << half;
+
+		// Perform triangle edge and determinant tests
+		__m128 anyNeg = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(e0, zero), _mm_cmplt_ps(e1, zero)), _mm_cmplt_ps(e2, zero));
+		__m128 anyPos = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(e0, zero), _mm_cmpgt_ps(e1, zero)), _mm_cmpgt_ps(e2, zero));
+		__m128 det = _mm_add_ps(_mm_add_ps(e0, e1), e2);
+		__m128 accept = _mm_andnot_ps(_mm_and_ps(anyNeg, anyPos), _mm_cmpneq_ps(det, zero));
+
+		// Compute scaled hit distance and test against ray $t$ range
+		for (int v = 0; v < 3; ++v)
+			pz[v] = _mm_mul_ps(pz[v], Sz);
+		__m128 tScaled = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e0, pz[0]), _mm_mul_ps(e1, pz[1])), _mm_mul_ps(e2, pz[2]));
+		__m128 tMaxDet = _mm_mul_ps(_mm_set1_ps(tMax), det);
+		__m128 rejectNeg = _mm_and_ps(_mm_cmplt_ps(det, zero),
+			_mm_or_ps(_mm_cmpge_ps(tScaled, zero), _mm_cmplt_ps(tScaled, tMaxDet)));
+		__m128 rejectPos = _mm_and_ps(_mm_cmpgt_ps(det, zero),
+			_mm_or_ps(_mm_cmple_ps(tScaled, zero), _mm_cmpgt_ps(tScaled, tMaxDet)));
+		accept = _mm_andnot_ps(_mm_or_ps(rejectNeg, rejectPos), accept);
+
+		__m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		__m128 t = _mm_mul_ps(tScaled, invDet);
+
+		// Conservative $\delta_t$ bound
+		__m128 maxZt = _mm_max_ps(_mm_andnot_ps(signMask, pz[0]),
+			_mm_max_ps(_mm_andnot_ps(signMask, pz[1]), _mm_andnot_ps(signMask, pz[2])));
+		__m128 maxXt = _mm_max_ps(_mm_andnot_ps(signMask, px[0]),
+			_mm_max_ps(_mm_andnot_ps(signMask, px[1]), _mm_andnot_ps(signMask, px[2])));
+		__m128 maxYt = _mm_max_ps(_mm_andnot_ps(signMask, py[0]),
+			_mm_max_ps(_mm_andnot_ps(signMask, py[1]), _mm_andnot_ps(signMask, py[2])));
+		__m128 maxE = _mm_max_ps(_mm_andnot_ps(signMask, e0),
+			_mm_max_ps(_mm_andnot_ps(signMask, e1), _mm_andnot_ps(signMask, e2)));
+		__m128 deltaZ = _mm_mul_ps(_mm_set1_ps(gamma3), maxZt);
+		__m128 deltaX = _mm_mul_ps(_mm_set1_ps(gamma5), _mm_add_ps(maxXt, maxZt));
+		__m128 deltaY = _mm_mul_ps(_mm_set1_ps(gamma5), _mm_add_ps(maxYt, maxZt));
+		__m128 deltaE = _mm_mul_ps(_mm_set1_ps(2.0f), _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(gamma2), maxXt), maxYt), _mm_mul_ps(deltaY, maxXt)), _mm_mul_ps(deltaX, maxYt)));
+		__m128 deltaT = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(gamma3), maxE), maxZt), _mm_mul_ps(deltaE, maxZt)), _mm_mul_ps(deltaZ, maxE))),
+			_mm_andnot_ps(signMask, invDet));
+		accept = _mm_andnot_ps(_mm_cmple_ps(t, deltaT), accept);
+
+		_mm_store_ps(&hit.m_t[half], t);
+		_mm_store_ps(&hit.m_b0[half], _mm_mul_ps(e0, invDet));
+		_mm_store_ps(&hit.m_b1[half], _mm_mul_ps(e1, invDet));
+		_mm_store_ps(&hit.m_b2[half], _mm_mul_ps(e2, invDet));
+		mask |= (_mm_movemask_ps(accept) & valid) << half;
+	}
+
+	mask &= ~edgeMask;
+	while (edgeMask != 0)
+	{
+		int lane = countTrailingZeros(edgeMask);
+		edgeMask &= edgeMask - 1;
+		if (intersectLane(packet, lane, ray, tMax, hit))
+			mask |= 1 << lane;
+	}
+	return mask;
+}
+
+RENDER_TARGET_AVX2
+static int intersectTrianglePacketAVX2(const TrianglePacket& packet, const TrianglePacketRay& ray,
+	float tMax, TrianglePacketHit& hit)
+{
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+	const __m256 Sx = _mm256_set1_ps(ray.m_Sx), Sy = _mm256_set1_ps(ray.m_Sy), Sz = _mm256_set1_ps(ray.m_Sz);
+
+	// Translate vertices based on ray origin, then permute and shear them
+	__m256 px[3], py[3], pz[3];
+	for (int v = 0; v < 3; ++v)
+	{
+		__m256 x = _mm256_sub_ps(_mm256_load_ps(packet.m_p[v][ray.m_kx]), _mm256_set1_ps(ray.m_org[ray.m_kx]));
+		__m256 y = _mm256_sub_ps(_mm256_load_ps(packet.m_p[v][ray.m_ky]), _mm256_set1_ps(ray.m_org[ray.m_ky]));
+		pz[v] = _mm256_sub_ps(_mm256_load_ps(packet.m_p[v][ray.m_kz]), _mm256_set1_ps(ray.m_org[ray.m_kz]));
+		px[v] = _mm256_add_ps(x, _mm256_mul_ps(Sx, pz[v]));
+		py[v] = _mm256_add_ps(y, _mm256_mul_ps(Sy, pz[v]));
+	}
+
+	// Compute edge function coefficients
+	__m256 e0 = _mm256_sub_ps(_mm256_mul_ps(px[1], py[2]), _mm256_mul_ps(py[1], px[2]));
+	__m256 e1 = _mm256_sub_ps(_mm256_mul_ps(px[2], py[0]), _mm256_mul_ps(py[2], px[0]));
+	__m256 e2 = _mm256_sub_ps(_mm256_mul_ps(px[0], py[1]), _mm256_mul_ps(py[0], px[1]));
+
+	const int valid = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(
+		_mm256_load_si256((const __m256i*)packet.m_primitive), _mm256_set1_epi32(-1))));
+	int edgeMask = _mm256_movemask_ps(_mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(e0, zero, _CMP_EQ_OQ),
+		_mm256_cmp_ps(e1, zero, _CMP_EQ_OQ)), _mm256_cmp_ps(e2, zero, _CMP_EQ_OQ))) & valid;
+
+	// Perform triangle edge and determinant tests
+	__m256 anyNeg = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(e0, zero, _CMP_LT_OQ),
+		_mm256_cmp_ps(e1, zero, _CMP_LT_OQ)), _mm256_cmp_ps(e2, zero, _CMP_LT_OQ));
+	__m256 anyPos = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(e0, zero, _CMP_GT_OQ),
+		_mm256_cmp_ps(e1, zero, _CMP_GT_OQ)), _mm256_cmp_ps(e2, zero, _CMP_GT_OQ));
+	__m256 det = _mm256_add_ps(_mm256_add_ps(e0, e1), e2);
+	__m256 accept = _mm256_andnot_ps(_mm256_and_ps(anyNeg, anyPos), _mm256_cmp_ps(det, zero, _CMP_NEQ_UQ));
+
+	// Compute scaled hit distance and test against ray $t$ range
+	for (int v = 0; v < 3; ++v)
+		pz[v] = _mm256_mul_ps(pz[v], Sz);
+	__m256 tScaled = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e0, pz[0]), _mm256_mul_ps(e1, pz[1])),
+		_mm256_mul_ps(e2, pz[2]));
+	__m256 tMaxDet = _mm256_mul_ps(_mm256_set1_ps(tMax), det);
+	__m256 rejectNeg = _mm256_and_ps(_mm256_cmp_ps(det, zero, _CMP_LT_OQ),
+		_mm256_or_ps(_mm256_cmp_ps(tScaled, zero, _CMP_GE_OQ), _mm256_cmp_ps(tScaled, tMaxDet, _CMP_LT_OQ)));
+	__m256 rejectPos = _mm256_and_ps(_mm256_cmp_ps(det, zero, _CMP_GT_OQ),
+		_mm256_or_ps(_mm256_cmp_ps(tScaled, zero, _CMP_LE_OQ), _mm256_cmp_ps(tScaled, tMaxDet, _CMP_GT_OQ)));
+	accept = _mm256_andnot_ps(_mm256_or_ps(rejectNeg, rejectPos), accept);
+
+	__m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+	__m256 t = _mm256_mul_ps(tScaled, invDet);
+
+	// Conservative $\delta_t$ bound
+	__m256 maxZt = _mm256_max_ps(_mm256_andnot_ps(signMask, pz[0]),
+		_mm256_max_ps(_mm256_andnot_ps(signMask, pz[1]), _mm256_andnot_ps(signMask, pz[2])));
+	__m256 maxXt = _mm256_max_ps(_mm256_andnot_ps(signMask, px[0]),
+		_mm256_max_ps(_mm256_andnot_ps(signMask, px[1]), _mm256_andnot_ps(signMask, px[2])));
+	__m256 maxYt = _mm256_max_ps(_mm256_andnot_ps(signMask, py[0]),
+		_mm256_max_ps(_mm256_andnot_ps(signMask, py[1]), _mm256_andnot_ps(signMask, py[2])));
+	__m256 maxE = _mm256_max_ps(_mm256_andnot_ps(signMask, e0),
+		_mm256_max_ps(_mm256_andnot_ps(signMask, e1), _mm256_andnot_ps(signMask, e2)));
+	__m256 deltaZ = _mm256_mul_ps(_mm256_set1_ps(gamma3), maxZt);
+	__m256 deltaX = _mm256_mul_ps(_mm256_set1_ps(gamma5), _mm256_add_ps(maxXt, maxZt));
+	__m256 deltaY = _mm256_mul_ps(_mm256_set1_ps(gamma5), _mm256_add_ps(maxYt, maxZt));
+	__m256 deltaE = _mm256_mul_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(_mm256_add_ps(
+		_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(gamma2), maxXt), maxYt), _mm256_mul_ps(deltaY, maxXt)),
+		_mm256_mul_ps(deltaX, maxYt)));
+	__m256 deltaT = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(3.0f), _mm256_add_ps(_mm256_add_ps(
+		_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(gamma3), maxE), maxZt), _mm256_mul_ps(deltaE, maxZt)),
+		_mm256_mul_ps(deltaZ, maxE))), _mm256_andnot_ps(signMask, invDet));
+	accept = _mm256_andnot_ps(_mm256_cmp_ps(t, deltaT, _CMP_LE_OQ), accept);
+
+	_mm256_store_ps(hit.m_t, t);
+	_mm256_store_ps(hit.m_b0, _mm256_mul_ps(e0, invDet));
+	_mm256_store_ps(hit.m_b1, _mm256_mul_ps(e1, invDet));
+	_mm256_store_ps(hit.m_b2, _mm256_mul_ps(e2, invDet));
+
+	int mask = _mm256_movemask_ps(accept) & valid & ~edgeMask;
+	while (edgeMask != 0)
+	{
+		int lane = countTrailingZeros(edgeMask);
+		edgeMask &= edgeMask - 1;
+		if (intersectLane(packet, lane, ray, tMax, hit))
+			mask |= 1 << lane;
+	}
+	return mask;
+}
+
+TrianglePacketIntersector getTrianglePacketIntersector()
+{
+	// SSE2 is part of x86-64, AVX2 has to be checked at runtime
+	static const TrianglePacketIntersector intersector = cpuSupportsAVX2() ?
+		&intersectTrianglePacketAVX2 : &intersectTrianglePacketSSE;
+	return intersector;
+}
+
+#else
+
+TrianglePacketIntersector getTrianglePacketIntersector()
+{
+	return nullptr;
+}
+
+#endif
+
+RENDER_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+#include "../Math/KMathUtil.h"
+#include "WideBVH.h"
+
+RENDER_BEGIN
+
+// Up to 8 triangles of a BVH leaf with their world space vertices gathered in SoA lanes.
+// Note: the packet only stores positions, the triangles themselves are referenced by
+//       primitive index so that shading data stays where it is. Unused lanes hold -1.
+struct alignas(32) TrianglePacket
+{
+	static constexpr int width = 8;
+
+	void setEmpty(int lane);
+	void setTriangle(int lane, const Vector3f& p0, const Vector3f& p1, const Vector3f& p2, int primitive);
+
+	float m_p[3][3][width];          // [vertex][axis][lane]
+	int m_primitive[width];
+};
+
+// Per-ray data of the watertight test (permutation and shear), prepared once per ray
+struct TrianglePacketRay
+{
+	TrianglePacketRay() = default;
+	explicit TrianglePacketRay(const Ray& ray);
+
+	float m_org[3];
+	int m_kx, m_ky, m_kz;
+	float m_Sx, m_Sy, m_Sz;
+};
+
+struct alignas(32) TrianglePacketHit
+{
+	float m_t[TrianglePacket::width];
+	float m_b0[TrianglePacket::width];
+	float m_b1[TrianglePacket::width];
+	float m_b2[TrianglePacket::width];
+};
+
+// Vectorized form of the watertight test in TriangleShape::hit. Bit i of the returned mask is set
+// if the ray hits lane i in (0, tMax], its distance and barycentrics are written to _hit_.
+// Lanes with an edge function of exactly zero are redone with the double precision fallback.
+typedef int (*TrianglePacketIntersector)(const TrianglePacket& packet, const TrianglePacketRay& ray,
+	float tMax, TrianglePacketHit& hit);
+
+// Return the widest kernel the running CPU supports (AVX2 or SSE), or nullptr if
+// there is none or Float is double, in which case leaves keep their scalar test.
+TrianglePacketIntersector getTrianglePacketIntersector();
+
+RENDER_END
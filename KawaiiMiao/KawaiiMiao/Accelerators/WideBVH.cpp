@@ -0,0 +1,146 @@
+#include "WideBVH.h"
+
+#include <cmath>
+
+#ifdef RENDER_HAVE_WIDE_BVH
+#include <immintrin.h>
+#endif
+
+RENDER_BEGIN
+
+// Round outwards so that the float lanes always enclose the original bounds
+static float roundDown(Float v)
+{
+	float f = (float)v;
+	return (Float)f > v ? std::nextafter(f, -std::numeric_limits<float>::infinity()) : f;
+}
+
+static float roundUp(Float v)
+{
+	float f = (float)v;
+	return (Float)f < v ? std::nextafter(f, std::numeric_limits<float>::infinity()) : f;
+}
+
+void WideBVHNode::setEmpty(int lane)
+{
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		m_bounds[0][axis][lane] = std::numeric_limits<float>::infinity();
+		m_bounds[1][axis][lane] = -std::numeric_limits<float>::infinity();
+	}
+	m_child[lane] = -1;
+	m_nPrimitives[lane] = 0;
+}
+
+void WideBVHNode::setChild(int lane, const Bounds3f& bounds, int child, int nPrimitives)
+{
+	CHECK_LT(nPrimitives, 65536);
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		m_bounds[0][axis][lane] = roundDown(bounds.m_pMin[axis]);
+		m_bounds[1][axis][lane] = roundUp(bounds.m_pMax[axis]);
+	}
+	m_child[lane] = child;
+	m_nPrimitives[lane] = nPrimitives;
+}
+
+WideRay::WideRay(const Ray& ray)
+{
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		m_org[axis] = ray.m_origin[axis];
+		m_invDir[axis] = 1.0f / (float)ray.m_dir[axis];
+		m_dirIsNeg[axis] = m_invDir[axis] < 0;
+	}
+}
+
+#ifdef RENDER_HAVE_WIDE_BVH
+
+// Note: the far distances are scaled by 1 + 2 * gamma(3) as in Bounds3::hit, and the
+//       operand order of min/max makes NaN lanes (0 * inf) fall back to the ray interval.
+static const float farScale = 1 + 2 * ((3 * std::numeric_limits<float>::epsilon() * 0.5f) /
+	(1 - 3 * std::numeric_limits<float>::epsilon() * 0.5f));
+
+static int intersectWideNodeSSE(const WideBVHNode& node, const WideRay& ray, float tMax, float* tNear)
+{
+	int mask = 0;
+	for (int half = 0; half < WideBVHNode::width; half += 4)
+	{
+		__m128 t0 = _mm_setzero_ps();
+		__m128 t1 = _mm_set1_ps(tMax);
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			__m128 org = _mm_set1_ps(ray.m_org[axis]);
+			__m128 invDir = _mm_set1_ps(ray.m_invDir[axis]);
+			__m128 nearPlane = _mm_loadu_ps(&node.m_bounds[ray.m_dirIsNeg[axis]][axis][half]);
+			__m128 farPlane = _mm_loadu_ps(&node.m_bounds[1 - ray.m_dirIsNeg[axis]][axis][half]);
+			__m128 tNearAxis = _mm_mul_ps(_mm_sub_ps(nearPlane, org), invDir);
+			__m128 tFarAxis = _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(farPlane, org), invDir), _mm_set1_ps(farScale));
+			t0 = _mm_max_ps(tNearAxis, t0);
+			t1 = _mm_min_ps(tFarAxis, t1);
+		}
+		_mm_storeu_ps(tNear + half, t0);
+		mask |= _mm_movemask_ps(_mm_cmple_ps(t0, t1)) << half;
+	}
+	return mask;
+}
+
+RENDER_TARGET_AVX2
+static int intersectWideNodeAVX2(const WideBVHNode& node, const WideRay& ray, float tMax, float* tNear)
+{
+	__m256 t0 = _mm256_setzero_ps();
+	__m256 t1 = _mm256_set1_ps(tMax);
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		__m256 org = _mm256_set1_ps(ray.m_org[axis]);
+		__m256 invDir = _mm256_set1_ps(ray.m_invDir[axis]);
+		__m256 nearPlane = _mm256_load_ps(node.m_bounds[ray.m_dirIsNeg[axis]][axis]);
+		__m256 farPlane = _mm256_load_ps(node.m_bounds[1 - ray.m_dirIsNeg[axis]][axis]);
+		__m256 tNearAxis = _mm256_mul_ps(_mm256_sub_ps(nearPlane, org), invDir);
+		__m256 tFarAxis = _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(farPlane, org), invDir), _mm256_set1_ps(farScale));
+		t0 = _mm256_max_ps(tNearAxis, t0);
+		t1 = _mm256_min_ps(tFarAxis, t1);
+	}
+	_mm256_storeu_ps(tNear, t0);
+	return _mm256_movemask_ps(_mm256_cmp_ps(t0, t1, _CMP_LE_OQ));
+}
+
+bool cpuSupportsAVX2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+	// The OS has to save the YMM registers on context switches as well
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+WideNodeIntersector getWideNodeIntersector()
+{
+	// SSE2 is part of x86-64, AVX2 has to be checked at runtime
+	static const WideNodeIntersector intersector = cpuSupportsAVX2() ?
+		&intersectWideNodeAVX2 : &intersectWideNodeSSE;
+	return intersector;
+}
+
+#else
+
+WideNodeIntersector getWideNodeIntersector()
+{
+	return nullptr;
+}
+
+#endif
+
+RENDER_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+#include "../Math/KMathUtil.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define RENDER_HAVE_WIDE_BVH
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RENDER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RENDER_TARGET_AVX2
+#endif
+
+RENDER_BEGIN
+
+// Collapsed 8-ary BVH node.
+// Note: the bounds of all children are stored in SoA lanes, so one ray can be tested
+//       against every child with a single SIMD sequence. Unused lanes hold empty bounds.
+struct alignas(32) WideBVHNode
+{
+	static constexpr int width = 8;
+
+	void setEmpty(int lane);
+	void setChild(int lane, const Bounds3f& bounds, int child, int nPrimitives);
+
+	float m_bounds[2][3][width];     // [min/max][axis][lane]
+	int m_child[width];              // Interior: wide node index, Leaf: offset of first primitive
+	uint16_t m_nPrimitives[width];   // 0 -> interior child
+};
+
+// Per-ray data of the wide traversal, prepared once per ray
+struct WideRay
+{
+	WideRay() = default;
+	explicit WideRay(const Ray& ray);
+
+	float m_org[3];
+	float m_invDir[3];
+	int m_dirIsNeg[3];
+};
+
+// Test a ray against all children of a node. The entry distance of every lane is written
+// to _tNear_ and bit i of the returned mask is set if the ray overlaps child i in [0, tMax].
+typedef int (*WideNodeIntersector)(const WideBVHNode& node, const WideRay& ray, float tMax, float* tNear);
+
+// Return the widest kernel the running CPU supports (AVX2 or SSE),
+// or nullptr if there is none and the binary scalar traversal has to be used.
+WideNodeIntersector getWideNodeIntersector();
+
+#ifdef RENDER_HAVE_WIDE_BVH
+// Runtime check for AVX2 including OS support for the YMM registers
+bool cpuSupportsAVX2();
+#endif
+
+RENDER_END
@@ -2,15 +2,76 @@
 #include "../Core/Material.h"
 #include "../Core/Light.h"
 #include "../Core/Shape.h"
+#include "../Accelerators/BVH.h"
+#include "../Tool/Logger.h"
+
+#include <map>
 
 RENDER_BEGIN
 
+//Note: a transform is a sequence of actions, 0 = translate x y z, 1 = scale x y z, 2 = rotate angle x y z
+static Transform parseTransform(const APropertyTreeNode& node)
+{
+	Transform objectToWrold;
+	if (!node.hasProperty("Transform"))
+		return objectToWrold;
+
+	const auto& props = node.getPropertyList();
+	std::vector<Transform> transformStack;
+	std::vector<Float> sequence = props.getVectorNf("Transform");
+	size_t it = 0;
+	bool undefined = false;
+	while (it < sequence.size() && !undefined)
+	{
+		int token = static_cast<int>(sequence[it]);
+		switch (token)
+		{
+		case 0://translate
+		{
+			CHECK_LT(it + 3, sequence.size());
+			Vector3f _trans = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
+			transformStack.push_back(translate(_trans));
+			it += 4;
+			break;
+		}
+		case 1://scale
+		{
+			CHECK_LT(it + 3, sequence.size());
+			Vector3f _scale = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
+			transformStack.push_back(scale(_scale.x, _scale.y, _scale.z));
+			it += 4;
+			break;
+		}
+		case 2://rotate
+		{
+			CHECK_LT(it + 4, sequence.size());
+			Vector3f axis = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
+			transformStack.push_back(rotate(sequence[it + 4], axis));
+			it += 5;
+			break;
+		}
+		default:
+			undefined = true;
+			K_ERROR("Undefined transform action");
+			break;
+		}
+	}
+
+	//Note: calculate the transform matrix in a first-in-last-out manner
+	if (!undefined)
+	{
+		for (auto it = transformStack.rbegin(); it != transformStack.rend(); ++it)
+		{
+			objectToWrold = objectToWrold * (*it);
+		}
+	}
+	return objectToWrold;
+}
+
 RENDER_REGISTER_CLASS(Entity, "Entity");
 
 Entity::Entity(const APropertyTreeNode& node)
 {
-	const APropertyList& props = node.getPropertyList();
-
 	// Shape
 	const auto& shapeNode = node.getPropertyChild("Shape");
 	Shape::ptr shape = Shape::ptr(static_cast<Shape*>(AObjectFactory::createInstance(
@@ -18,54 +79,7 @@ Entity::Entity(const APropertyTreeNode& node)
 	shape->setTransform(&m_objectToWorld, &m_worldToObject);
 
 	// Transform
-	Transform objectToWrold;
-	const auto& shapeProps = shapeNode.getPropertyList();
-	if (shapeNode.hasProperty("Transform"))
-	{
-		std::vector<Transform> transformStack;
-		std::vector<Float> sequence = shapeProps.getVectorNf("Transform");
-		size_t it = 0;
-		bool undefined = false;
-		while (it < sequence.size() && !undefined)
-		{
-			int token = static_cast<int>(sequence[it]);
-			switch (token)
-			{
-			case 0://translate
-				CHECK_LT(it + 3, sequence.size());
-				Vector3f _trans = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(translate(_trans));
-				it += 4;
-				break;
-			case 1://scale
-				CHECK_LT(it + 3, sequence.size());
-				Vector3f _scale = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(scale(_scale.x, _scale.y, _scale.z));
-				it += 4;
-				break;
-			case 2://rotate
-				CHECK_LT(it + 4, sequence.size());
-				Vector3f axis = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(rotate(sequence[it + 4], axis));
-				it += 5;
-				break;
-			default:
-				undefined = true;
-				K_ERROR("Undefined transform action");
-				break;
-			}
-		}
-
-		//Note: calculate the transform matrix in a first-in-last-out manner
-		if (!undefined)
-		{
-			for (auto it = transformStack.rbegin(); it != transformStack.rend(); ++it)
-			{
-				objectToWrold = objectToWrold * (*it);
-			}
-		}
-	}
-	m_objectToWorld = objectToWrold;
+	m_objectToWorld = parseTransform(shapeNode);
 	m_worldToObject = inverse(m_objectToWorld);
 
 	// Material
@@ -96,54 +110,7 @@ MeshEntity::MeshEntity(const APropertyTreeNode& node)
 	const auto& shapeNode = node.getPropertyChild("Shape");
 
 	// Transform
-	Transform objectToWrold;
-	const auto& shapeProps = shapeNode.getPropertyList();
-	if (shapeNode.hasProperty("Transform"))
-	{
-		std::vector<Transform> transformStack;
-		std::vector<Float> sequence = shapeProps.getVectorNf("Transform");
-		size_t it = 0;
-		bool undefined = false;
-		while (it < sequence.size() && !undefined)
-		{
-			int token = static_cast<int>(sequence[it]);
-			switch (token)
-			{
-			case 0://translate
-				CHECK_LT(it + 3, sequence.size());
-				Vector3f _trans = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(translate(_trans));
-				it += 4;
-				break;
-			case 1://scale
-				CHECK_LT(it + 3, sequence.size());
-				Vector3f _scale = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(scale(_scale.x, _scale.y, _scale.z));
-				it += 4;
-				break;
-			case 2://rotate
-				CHECK_LT(it + 4, sequence.size());
-				Vector3f axis = Vector3f(sequence[it + 1], sequence[it + 2], sequence[it + 3]);
-				transformStack.push_back(rotate(sequence[it + 4], axis));
-				it += 5;
-				break;
-			default:
-				undefined = true;
-				K_ERROR("Undefined transform action");
-				break;
-			}
-		}
-
-		//Note: calculate the transform matrix in a first-in-last-out manner
-		if (!undefined)
-		{
-			for (auto it = transformStack.rbegin(); it != transformStack.rend(); ++it)
-			{
-				objectToWrold = objectToWrold * (*it);
-			}
-		}
-	}
-	m_objectToWorld = objectToWrold;
+	m_objectToWorld = parseTransform(shapeNode);
 	m_worldToObject = inverse(m_objectToWorld);
 
 	//Material
@@ -151,27 +118,83 @@ MeshEntity::MeshEntity(const APropertyTreeNode& node)
 	m_material = Material::ptr(static_cast<Material*>(AObjectFactory::createInstance(
 		materialNode.getTypeName(), materialNode)));
 
-	//Load each triangle of the mesh as a PrimitiveEntity
 	m_mesh = TriangleMesh::unique_ptr(new TriangleMesh(&m_objectToWorld, APropertyTreeNode::m_directory + filename));
-	const auto& meshIndices = m_mesh->getIndices();
-	for (size_t i = 0; i < meshIndices.size(); i += 3)
+	const int nTriangles = (int)m_mesh->numTriangles();
+	size_t bytes = m_mesh->memoryBytes();
+
+	//Without a light the mesh is a single primitive, its triangles are referenced by index
+	if (!node.hasPropertyChild("Light"))
+	{
+		m_Primitives.push_back(std::make_shared<MeshPrimitive>(m_mesh.get(), m_material.get()));
+		bytes += sizeof(MeshPrimitive);
+	}
+	else
 	{
-		std::array<int, 3> indices;
-		indices[0] = meshIndices[i + 0];
-		indices[1] = meshIndices[i + 1];
-		indices[2] = meshIndices[i + 2];
-		TriangleShape::ptr triangle = std::make_shared<TriangleShape>(&m_objectToWorld, &m_worldToObject, indices, m_mesh.get());
-
-		//Area light
-		AreaLight::ptr areaLight = nullptr;
-		if (node.hasPropertyChild("Light"))
+		//Every triangle of an emissive mesh is a light of its own
+		const auto& lightNode = node.getPropertyChild("Light");
+		for (int i = 0; i < nTriangles; ++i)
 		{
-			const auto& lightNode = node.getPropertyChild("Light");
-			areaLight = AreaLight::ptr(static_cast<AreaLight*>(AObjectFactory::createInstance(
+			TriangleShape::ptr triangle = std::make_shared<TriangleShape>(&m_objectToWorld, &m_worldToObject, i, m_mesh.get());
+			AreaLight::ptr areaLight = AreaLight::ptr(static_cast<AreaLight*>(AObjectFactory::createInstance(
 				lightNode.getTypeName(), lightNode)));
+			m_Primitives.push_back(std::make_shared<PrimitiveObject>(triangle, m_material.get(), areaLight));
 		}
-		m_Primitives.push_back(std::make_shared<PrimitiveObject>(triangle, m_material.get(), areaLight));
+		bytes += nTriangles * (sizeof(TriangleShape) + sizeof(PrimitiveObject) + sizeof(Primitive::ptr));
 	}
+
+	K_INFO("[MeshEntity] {0}: {1} triangles, {2:.1f} bytes per triangle", filename, nTriangles,
+		nTriangles > 0 ? (double)bytes / nTriangles : 0.0);
+}
+
+RENDER_REGISTER_CLASS(InstanceEntity, "Instance")
+
+struct InstanceEntity::SharedMesh
+{
+	Transform m_identity;
+	TriangleMesh::unique_ptr m_mesh;
+	PrimitiveAggregate::ptr m_aggregate;
+};
+
+std::shared_ptr<InstanceEntity::SharedMesh> InstanceEntity::getSharedMesh(const std::string& filename)
+{
+	//Note: entities are created one by one while parsing, so the cache needs no lock
+	static std::map<std::string, std::weak_ptr<SharedMesh>> cache;
+	if (std::shared_ptr<SharedMesh> sharedMesh = cache[filename].lock())
+		return sharedMesh;
+
+	//Keep the vertices in object space, the instances transform the rays instead
+	std::shared_ptr<SharedMesh> sharedMesh = std::make_shared<SharedMesh>();
+	sharedMesh->m_mesh = TriangleMesh::unique_ptr(new TriangleMesh(&sharedMesh->m_identity, filename));
+	std::vector<Primitive::ptr> primitives = { std::make_shared<MeshPrimitive>(sharedMesh->m_mesh.get(), nullptr) };
+	sharedMesh->m_aggregate = std::make_shared<BVHAccel>(primitives);
+
+	K_INFO("[InstanceEntity] Shared mesh {0}: {1} triangles", filename, sharedMesh->m_mesh->numTriangles());
+	cache[filename] = sharedMesh;
+	return sharedMesh;
+}
+
+InstanceEntity::InstanceEntity(const APropertyTreeNode& node)
+{
+	const APropertyList& props = node.getPropertyList();
+	const std::string filename = props.getString("Mesh");
+
+	// Transform
+	m_objectToWorld = parseTransform(node);
+	m_worldToObject = inverse(m_objectToWorld);
+
+	//Material
+	const auto& materialNode = node.getPropertyChild("Material");
+	m_material = Material::ptr(static_cast<Material*>(AObjectFactory::createInstance(
+		materialNode.getTypeName(), materialNode)));
+
+	if (node.hasPropertyChild("Light"))
+	{
+		K_WARN("Area lights are not supported on instances of {0}, use a MeshEntity instead", filename);
+	}
+
+	m_sharedMesh = getSharedMesh(APropertyTreeNode::m_directory + filename);
+	m_Primitives.push_back(std::make_shared<PrimitiveInstance>(m_sharedMesh->m_aggregate,
+		m_objectToWorld, m_material.get()));
 }
 
 RENDER_END
\ No newline at end of file
@@ -47,5 +47,28 @@ private:
 	TriangleMesh::unique_ptr m_mesh;
 };
 
+//! @brief A placement of a shared mesh.
+/**
+* Every distinct "Mesh" file is loaded once in object space and gets its own BVH. An instance only
+* adds a transform and a material on top of it, the scene aggregate is then built over the instances.
+*/
+class InstanceEntity : public Entity
+{
+public:
+	typedef std::shared_ptr<InstanceEntity> ptr;
+
+	InstanceEntity(const APropertyTreeNode& node);
+
+	virtual std::string toString() const override { return "InstanceEntity[]"; }
+
+private:
+	struct SharedMesh;
+
+	// Mesh of _filename_, loaded and built on first use and shared while any instance is alive
+	static std::shared_ptr<SharedMesh> getSharedMesh(const std::string& filename);
+
+	std::shared_ptr<SharedMesh> m_sharedMesh;
+};
+
 
 RENDER_END
\ No newline at end of file
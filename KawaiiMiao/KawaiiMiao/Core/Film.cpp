@@ -2,6 +2,13 @@
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "../extern/stb_image_write.h"
+#include "../Tool/ImageIO.h"
+
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
 
 RENDER_BEGIN
 
@@ -27,6 +34,17 @@ Film::Film(const APropertyTreeNode& node)
 	m_diagonal = props.getFloat("Diagonal", 35.f);
 	m_scale = props.getFloat("Scale", 1.0f);
 	m_maxSampleLuminance = props.getFloat("MaxLum", Infinity);
+	m_mergeMode = props.getString("MergeMode", "Striped") == "Locked" ? MergeMode::Locked : MergeMode::Striped;
+
+	//AOVs
+	if (node.hasPropertyChild("AOV"))
+	{
+		const auto& aovProps = node.getPropertyChild("AOV").getPropertyList();
+		m_aovAlbedo = aovProps.getBoolean("Albedo", false);
+		m_aovNormal = aovProps.getBoolean("Normal", false);
+		m_aovDepth = aovProps.getBoolean("Depth", false);
+		m_aovSamples = aovProps.getBoolean("Samples", false);
+	}
 
 	//Filter
 	{
@@ -55,27 +73,25 @@ Film::Film(const Vector2i& resolution, const Bounds2f& cropWindow, std::unique_p
 		" -> croppedPixelBounds ", m_croppedPixelBounds);
 
 	m_pixels = std::unique_ptr<APixel[]>(new APixel[m_croppedPixelBounds.area()]);
+	m_sampleCounts = std::unique_ptr<int[]>(new int[m_croppedPixelBounds.area()]());
 
-	//Precompute filter weight table
-	//Note: we assume that filtering function f(x,y)=f(|x|,|y|)
-	//      hence only store values for the positive quadrant of filter offsets.
-	int offset = 0;
-	for (int y = 0; y < filterTableWidth; ++y)
-	{
-		for (int x = 0; x < filterTableWidth; ++x, ++offset)
-		{
-			Vector2f p;
-			p.x = (x + 0.5f) * m_filter->m_radius.x / filterTableWidth;
-			p.y = (y + 0.5f) * m_filter->m_radius.y / filterTableWidth;
-			m_filterTable[offset] = m_filter->evaluate(p);
-		}
-	}
+	computeFilterTables();
 }
 
 void Film::initialize()
 {
 	m_pixels = std::unique_ptr<APixel[]>(new APixel[m_croppedPixelBounds.area()]);
+	m_sampleCounts = std::unique_ptr<int[]>(new int[m_croppedPixelBounds.area()]());
+	if (needsAOVSamples())
+	{
+		m_aovPixels = std::unique_ptr<FilmAOVPixel[]>(new FilmAOVPixel[m_croppedPixelBounds.area()]);
+	}
+
+	computeFilterTables();
+}
 
+void Film::computeFilterTables()
+{
 	//Precompute filter weight table
 	//Note: we assume that filtering function f(x,y)=f(|x|,|y|)
 	//      hence only store values for the positive quadrant of filter offsets.
@@ -90,6 +106,16 @@ void Film::initialize()
 			m_filterTable[offset] = m_filter->evaluate(p);
 		}
 	}
+
+	m_separableFilter = m_filter->isSeparable();
+	for (int i = 0; i < filterTableWidth; ++i)
+	{
+		m_filterTableX[i] = m_separableFilter ? m_filter->evaluate1D((i + 0.5f) * m_filter->m_radius.x / filterTableWidth, 0) : 0;
+		m_filterTableY[i] = m_separableFilter ? m_filter->evaluate1D((i + 0.5f) * m_filter->m_radius.y / filterTableWidth, 1) : 0;
+	}
+	// Note: only a box of exactly one pixel gives every sample its own pixel at full weight,
+	//       narrower boxes still drop the samples outside of their support
+	m_singlePixelFilter = m_filter->isConstant() && m_filter->m_radius.x == 0.5f && m_filter->m_radius.y == 0.5f;
 }
 
 Bounds2i Film::getSampleBounds() const
@@ -108,79 +134,438 @@ std::unique_ptr<FilmTile> Film::getFilmTile(const Bounds2i& sampleBounds)
 	Vector2i p0 = (Vector2i)ceil(floatBounds.m_pMin - halfPixel - m_filter->m_radius);
 	Vector2i p1 = (Vector2i)floor(floatBounds.m_pMax - halfPixel + m_filter->m_radius) + Vector2i(1, 1);
 	Bounds2i tilePixelBounds = intersect(Bounds2i(p0, p1), m_croppedPixelBounds);
-	return std::unique_ptr<FilmTile>(new FilmTile(tilePixelBounds, m_filter->m_radius,
+	std::unique_ptr<FilmTile> tile(new FilmTile(tilePixelBounds, m_filter->m_radius,
 		m_filterTable, filterTableWidth, m_maxSampleLuminance));
+	tile->m_filterTableX = m_filterTableX;
+	tile->m_filterTableY = m_filterTableY;
+	tile->m_separableFilter = m_separableFilter;
+	tile->m_singlePixelFilter = m_singlePixelFilter;
+	if (m_aovPixels)
+	{
+		tile->m_aovPixels.resize(glm::max(0, tilePixelBounds.area()));
+	}
+
+	// Sample bounds of tiles never overlap, so the pixels farther than the filter radius
+	// from the edge of _sampleBounds_ can only be reached by samples of this tile
+	//Note: built by hand, the two point constructor would reorder an empty interior
+	Bounds2i interior;
+	interior.m_pMin = max((Vector2i)floor(floatBounds.m_pMin - halfPixel + m_filter->m_radius) + Vector2i(1, 1),
+		tilePixelBounds.m_pMin);
+	interior.m_pMax = min((Vector2i)ceil(floatBounds.m_pMax - halfPixel - m_filter->m_radius), tilePixelBounds.m_pMax);
+	interior.m_pMax = max(interior.m_pMax, interior.m_pMin);
+	tile->m_interiorBounds = interior;
+	return tile;
+}
+
+template <typename Lock>
+static int64_t lockAndMeasure(Lock& lock)
+{
+	if (lock.try_lock())
+		return 0;
+
+	auto start = std::chrono::steady_clock::now();
+	lock.lock();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
 }
 
-void Film::mergeFilmTile(std::unique_ptr<FilmTile> tile)
+int64_t Film::mergeFilmTile(std::unique_ptr<FilmTile> tile)
 {
-	std::lock_guard<std::mutex> lock(m_mutex);
-	for (Vector2i pixel : tile->getPixelBounds())
+	const int width = m_croppedPixelBounds.m_pMax.x - m_croppedPixelBounds.m_pMin.x;
+	auto mergePixels = [&](int y, int x0, int x1)
 	{
-		// Merge _pixel_ into _Film::pixels_
-		const FilmTilePixel& tilePixel = tile->getPixel(pixel);
-		APixel& mergePixel = getPixel(pixel);
-		Float xyz[3];
-		tilePixel.contribSum.toXYZ(xyz);
-		for (int i = 0; i < 3; ++i)
+		for (int x = x0; x < x1; ++x)
 		{
-			mergePixel.m_xyz[i] += xyz[i];
+			// Merge _pixel_ into _Film::pixels_
+			const int tileIndex = tile->pixelIndex(Vector2i(x, y));
+			const FilmTilePixel& tilePixel = tile->m_pixels[tileIndex];
+			APixel& mergePixel = getPixel(Vector2i(x, y));
+			//Note: a pixel is sampled by exactly one tile, so only that tile has a count for it
+			const int index = (x - m_croppedPixelBounds.m_pMin.x) + (y - m_croppedPixelBounds.m_pMin.y) * width;
+			if (tilePixel.sampleCount != 0)
+			{
+				m_sampleCounts[index] += tilePixel.sampleCount;
+			}
+			if (tile->hasAOVs())
+			{
+				const FilmAOVPixel& tileAOV = tile->m_aovPixels[tileIndex];
+				if (tileAOV.count != 0)
+				{
+					FilmAOVPixel& aov = m_aovPixels[index];
+					aov.albedoSum += tileAOV.albedoSum;
+					aov.normalSum += tileAOV.normalSum;
+					aov.depthSum += tileAOV.depthSum;
+					aov.count += tileAOV.count;
+				}
+			}
+			Float xyz[3];
+			tile->getContribSum(tileIndex).toXYZ(xyz);
+			for (int i = 0; i < 3; ++i)
+			{
+				mergePixel.m_xyz[i] += xyz[i];
+			}
+			mergePixel.m_filterWeightSum += tile->getFilterWeightSum(tileIndex);
 		}
-		mergePixel.m_filterWeightSum += tilePixel.filterWeightSum;
+	};
+
+	const Bounds2i& bounds = tile->m_pixelBounds;
+	int64_t waitNS = 0;
+	if (m_mergeMode == MergeMode::Locked)
+	{
+		waitNS += lockAndMeasure(m_mutex);
+		std::lock_guard<std::mutex> lock(m_mutex, std::adopt_lock);
+		for (int y = bounds.m_pMin.y; y < bounds.m_pMax.y; ++y)
+		{
+			mergePixels(y, bounds.m_pMin.x, bounds.m_pMax.x);
+		}
+		return waitNS;
 	}
+
+	const Bounds2i& interior = tile->m_interiorBounds;
+	for (int y = bounds.m_pMin.y; y < bounds.m_pMax.y; ++y)
+	{
+		bool interiorRow = y >= interior.m_pMin.y && y < interior.m_pMax.y && interior.m_pMin.x < interior.m_pMax.x;
+		{
+			// Border pixels of the row, under the lock of its stripe
+			tbb::spin_mutex& stripe = m_mergeStripes[y % mergeStripes].m_mutex;
+			waitNS += lockAndMeasure(stripe);
+			if (interiorRow)
+			{
+				mergePixels(y, bounds.m_pMin.x, interior.m_pMin.x);
+				mergePixels(y, interior.m_pMax.x, bounds.m_pMax.x);
+			}
+			else
+			{
+				mergePixels(y, bounds.m_pMin.x, bounds.m_pMax.x);
+			}
+			stripe.unlock();
+		}
+
+		if (interiorRow)
+		{
+			mergePixels(y, interior.m_pMin.x, interior.m_pMax.x);
+		}
+	}
+	return waitNS;
+}
+
+// 8-bit sRGB encoding of a linear value, the same as rounding 255 * gammaCorrect(v).
+//Note: _thresholds_[k] is the smallest linear value that encodes to at least k,
+//      so a branchless binary search over the 256 entries replaces the pow per channel.
+static Byte toSRGBByte(Float v)
+{
+	static const std::vector<Float> thresholds = []()
+	{
+		std::vector<Float> table(256);
+		table[0] = -Infinity;
+		for (int k = 1; k < 256; ++k)
+		{
+			table[k] = inverseGammaCorrect((k - 0.5f) / 255.f);
+		}
+		return table;
+	}();
+
+	int index = 0;
+	for (int step = 128; step > 0; step >>= 1)
+	{
+		index += (v >= thresholds[index + step]) ? step : 0;
+	}
+	return (Byte)index;
 }
 
 void Film::writeImageToFile(Float splatScale)
 {
+	std::string extension = m_filename.substr(m_filename.find_last_of('.') + 1);
+	std::transform(extension.begin(), extension.end(), extension.begin(),
+		[](char c) { return (char)std::tolower((unsigned char)c); });
+	const bool floatOutput = extension == "exr" || extension == "pfm" || extension == "hdr";
+
 	std::cout << "Converting image to RGB and computing final weighted pixel values";
-	std::unique_ptr<Float[]> rgb(new Float[3 * m_croppedPixelBounds.area()]);
+	auto extent = m_croppedPixelBounds.diagonal();
+	std::vector<float> rgb(3 * (size_t)m_croppedPixelBounds.area());
 	std::unique_ptr<Byte[]>  dst(new Byte[3 * m_croppedPixelBounds.area()]);
-	int offset = 0;
-	for (Vector2i p : m_croppedPixelBounds)
-	{
-		// Convert pixel XYZ color to RGB
-		APixel& pixel = getPixel(p);
-		XYZToRGB(pixel.m_xyz, &rgb[3 * offset]);
 
-		// Normalize pixel with weight sum
-		Float filterWeightSum = pixel.m_filterWeightSum;
-		if (filterWeightSum != 0)
+	// Rows are resolved in parallel, pixels of a row are contiguous in _m_pixels_
+	parallelFor((size_t)0, (size_t)extent.y, [&](size_t y)
+	{
+		const size_t rowBegin = y * extent.x, rowEnd = rowBegin + extent.x;
+		for (size_t offset = rowBegin; offset < rowEnd; ++offset)
 		{
-			Float invWt = (Float)1 / filterWeightSum;
-			rgb[3 * offset + 0] = glm::max((Float)0, rgb[3 * offset + 0] * invWt);
-			rgb[3 * offset + 1] = glm::max((Float)0, rgb[3 * offset + 1] * invWt);
-			rgb[3 * offset + 2] = glm::max((Float)0, rgb[3 * offset + 2] * invWt);
+			// Convert pixel XYZ color to RGB
+			const APixel& pixel = m_pixels[offset];
+			Float pixelRGB[3];
+			XYZToRGB(pixel.m_xyz, pixelRGB);
+
+			// Normalize pixel with weight sum, pixels without weight are left as they are
+			Float filterWeightSum = pixel.m_filterWeightSum;
+			Float invWt = filterWeightSum != 0 ? (Float)1 / filterWeightSum : (Float)1;
+			Float minValue = filterWeightSum != 0 ? (Float)0 : -Infinity;
+
+			// Add splat value at pixel
+			Float splatRGB[3];
+			Float splatXYZ[3] = { pixel.m_splatXYZ[0], pixel.m_splatXYZ[1],  pixel.m_splatXYZ[2] };
+			XYZToRGB(splatXYZ, splatRGB);
+
+			// Scale pixel value by _scale_, the image is stored in single precision
+			for (int c = 0; c < 3; ++c)
+			{
+				rgb[3 * offset + c] = (float)((glm::max(minValue, pixelRGB[c] * invWt) + splatScale * splatRGB[c]) * m_scale);
+			}
 		}
 
-		// Add splat value at pixel
-		Float splatRGB[3];
-		Float splatXYZ[3] = { pixel.m_splatXYZ[0], pixel.m_splatXYZ[1],  pixel.m_splatXYZ[2] };
-		XYZToRGB(splatXYZ, splatRGB);
-		rgb[3 * offset + 0] += splatScale * splatRGB[0];
-		rgb[3 * offset + 1] += splatScale * splatRGB[1];
-		rgb[3 * offset + 2] += splatScale * splatRGB[2];
-
-		// Scale pixel value by _scale_
-		rgb[3 * offset + 0] *= m_scale;
-		rgb[3 * offset + 1] *= m_scale;
-		rgb[3 * offset + 2] *= m_scale;
+		if (floatOutput)
+			return;
 
-#define TO_BYTE(v) (uint8_t) clamp(255.f * gammaCorrect(v) + 0.5f, 0.f, 255.f)
-		dst[3 * offset + 0] = TO_BYTE(rgb[3 * offset + 0]);
-		dst[3 * offset + 1] = TO_BYTE(rgb[3 * offset + 1]);
-		dst[3 * offset + 2] = TO_BYTE(rgb[3 * offset + 2]);
+		for (size_t i = 3 * rowBegin; i < 3 * rowEnd; ++i)
+		{
+			dst[i] = toSRGBByte(rgb[i]);
+		}
+	});
 
-		++offset;
+	std::cout << "Writing image " << m_filename << " with bounds " << m_croppedPixelBounds;
+	if (floatOutput)
+	{
+		writeAOVs(extension, rgb);
+		return;
 	}
 
-	std::cout << "Writing image " << m_filename << " with bounds " << m_croppedPixelBounds;
-	auto extent = m_croppedPixelBounds.diagonal();
 	stbi_write_png(m_filename.c_str(),
 		extent.x,
 		extent.y,
 		3,
 		static_cast<void*>(dst.get()),
 		extent.x * 3);
+
+	if (m_aovPixels || m_aovSamples)
+	{
+		K_WARN("AOVs are only written with .exr, .pfm or .hdr output, not with {0}", m_filename);
+	}
+}
+
+void Film::writeAOVs(const std::string& extension, const std::vector<float>& rgb) const
+{
+	const Vector2i extent = m_croppedPixelBounds.diagonal();
+	const size_t nPixels = (size_t)m_croppedPixelBounds.area();
+
+	// Average the AOVs in parallel over rows, pixels no camera ray reached stay zero
+	std::vector<float> albedo(m_aovAlbedo ? 3 * nPixels : 0), normal(m_aovNormal ? 3 * nPixels : 0);
+	std::vector<float> depth(m_aovDepth ? nPixels : 0), samples(m_aovSamples ? nPixels : 0);
+	parallelFor((size_t)0, (size_t)extent.y, [&](size_t y)
+	{
+		for (size_t i = y * extent.x; i < (y + 1) * extent.x; ++i)
+		{
+			if (m_aovSamples)
+			{
+				samples[i] = (float)m_sampleCounts[i];
+			}
+			if (!m_aovPixels || m_aovPixels[i].count == 0)
+				continue;
+
+			const FilmAOVPixel& aov = m_aovPixels[i];
+			const Float invCount = (Float)1 / aov.count;
+			if (m_aovAlbedo)
+			{
+				Spectrum meanAlbedo = aov.albedoSum * invCount;
+				Float albedoRGB[3];
+				meanAlbedo.toRGB(albedoRGB);
+				albedo[3 * i + 0] = (float)albedoRGB[0];
+				albedo[3 * i + 1] = (float)albedoRGB[1];
+				albedo[3 * i + 2] = (float)albedoRGB[2];
+			}
+			if (m_aovNormal)
+			{
+				Vector3f n = aov.normalSum * invCount;
+				if (n != Vector3f(0.f))
+				{
+					n = normalize(n);
+				}
+				normal[3 * i + 0] = n.x;
+				normal[3 * i + 1] = n.y;
+				normal[3 * i + 2] = n.z;
+			}
+			if (m_aovDepth)
+			{
+				depth[i] = aov.depthSum * invCount;
+			}
+		}
+	});
+
+	if (extension == "exr")
+	{
+		// Interleaved RGB is split into planes, EXR stores each channel separately
+		std::vector<std::vector<float>> planes;
+		std::vector<ImageChannel> channels;
+		auto addChannels = [&](const std::vector<float>& data, const std::string& layer, const char* names, int nChannels)
+		{
+			for (int c = 0; c < nChannels; ++c)
+			{
+				std::vector<float> plane(nPixels);
+				parallelFor((size_t)0, (size_t)extent.y, [&](size_t y)
+				{
+					for (size_t i = y * extent.x; i < (y + 1) * extent.x; ++i)
+					{
+						plane[i] = data[nChannels * i + c];
+					}
+				});
+				planes.push_back(std::move(plane));
+			}
+			for (int c = 0; c < nChannels; ++c)
+			{
+				channels.push_back({ layer + names[c], planes[planes.size() - nChannels + c].data() });
+			}
+		};
+
+		planes.reserve(12);
+		addChannels(rgb, "", "RGB", 3);
+		if (m_aovAlbedo)
+			addChannels(albedo, "albedo.", "RGB", 3);
+		if (m_aovNormal)
+			addChannels(normal, "normal.", "XYZ", 3);
+		if (m_aovDepth)
+			addChannels(depth, "depth.", "Z", 1);
+		if (m_aovSamples)
+			addChannels(samples, "samples.", "Y", 1);
+		writeImageEXR(m_filename, channels, extent.x, extent.y);
+		return;
+	}
+
+	// One file per image for the formats without layers
+	auto write = [&](const std::string& filename, const std::vector<float>& data, int nChannels)
+	{
+		if (extension == "pfm")
+			writeImagePFM(filename, data.data(), extent.x, extent.y, nChannels);
+		else
+			writeImageHDR(filename, data.data(), extent.x, extent.y, nChannels);
+	};
+	auto aovFilename = [&](const std::string& aov)
+	{
+		return m_filename.substr(0, m_filename.find_last_of('.')) + "." + aov + "." + extension;
+	};
+
+	write(m_filename, rgb, 3);
+	if (m_aovAlbedo)
+		write(aovFilename("albedo"), albedo, 3);
+	if (m_aovNormal)
+		write(aovFilename("normal"), normal, 3);
+	if (m_aovDepth)
+		write(aovFilename("depth"), depth, 1);
+	if (m_aovSamples)
+		write(aovFilename("samples"), samples, 1);
+}
+
+//Note: checkpoint layout, all little endian as written by the machine
+//      char[4] magic, int32 sizeof(Float), int32 cropped bounds (min x, min y, max x, max y),
+//      int64 samples done, then xyz[3] and the filter weight sum of each pixel as Float
+static const char checkpointMagic[4] = { 'K', 'M', 'C', 'P' };
+
+bool Film::saveCheckpoint(const std::string& filename, int64_t samplesDone) const
+{
+	// Write to a temporary file first so that a crash never leaves a truncated checkpoint
+	const std::string tmpFilename = filename + ".tmp";
+	{
+		std::ofstream out(tmpFilename, std::ios::binary | std::ios::trunc);
+		if (!out)
+		{
+			K_ERROR("Could not open the checkpoint file: {0}", tmpFilename);
+			return false;
+		}
+
+		int32_t header[5] = { (int32_t)sizeof(Float),
+			m_croppedPixelBounds.m_pMin.x, m_croppedPixelBounds.m_pMin.y,
+			m_croppedPixelBounds.m_pMax.x, m_croppedPixelBounds.m_pMax.y };
+		out.write(checkpointMagic, sizeof(checkpointMagic));
+		out.write(reinterpret_cast<const char*>(header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(&samplesDone), sizeof(samplesDone));
+
+		int nPixels = m_croppedPixelBounds.area();
+		std::vector<Float> sums(4 * (size_t)nPixels);
+		for (int i = 0; i < nPixels; ++i)
+		{
+			const APixel& pixel = m_pixels[i];
+			sums[4 * i + 0] = pixel.m_xyz[0];
+			sums[4 * i + 1] = pixel.m_xyz[1];
+			sums[4 * i + 2] = pixel.m_xyz[2];
+			sums[4 * i + 3] = pixel.m_filterWeightSum;
+		}
+		out.write(reinterpret_cast<const char*>(sums.data()), sums.size() * sizeof(Float));
+		if (!out)
+		{
+			K_ERROR("Failed to write the checkpoint file: {0}", tmpFilename);
+			return false;
+		}
+	}
+
+	std::remove(filename.c_str());
+	if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)
+	{
+		K_ERROR("Could not replace the checkpoint file: {0}", filename);
+		return false;
+	}
+	return true;
+}
+
+bool Film::loadCheckpoint(const std::string& filename, int64_t& samplesDone)
+{
+	std::ifstream in(filename, std::ios::binary);
+	if (!in)
+		return false;
+
+	char magic[4];
+	int32_t header[5];
+	int64_t samples = 0;
+	in.read(magic, sizeof(magic));
+	in.read(reinterpret_cast<char*>(header), sizeof(header));
+	in.read(reinterpret_cast<char*>(&samples), sizeof(samples));
+	if (!in || !std::equal(magic, magic + 4, checkpointMagic) || header[0] != (int32_t)sizeof(Float) ||
+		header[1] != m_croppedPixelBounds.m_pMin.x || header[2] != m_croppedPixelBounds.m_pMin.y ||
+		header[3] != m_croppedPixelBounds.m_pMax.x || header[4] != m_croppedPixelBounds.m_pMax.y)
+	{
+		K_WARN("Checkpoint {0} does not match the film, ignoring it", filename);
+		return false;
+	}
+
+	int nPixels = m_croppedPixelBounds.area();
+	std::vector<Float> sums(4 * (size_t)nPixels);
+	in.read(reinterpret_cast<char*>(sums.data()), sums.size() * sizeof(Float));
+	if (!in)
+	{
+		K_WARN("Checkpoint {0} is truncated, ignoring it", filename);
+		return false;
+	}
+
+	for (int i = 0; i < nPixels; ++i)
+	{
+		APixel& pixel = m_pixels[i];
+		pixel.m_xyz[0] = sums[4 * i + 0];
+		pixel.m_xyz[1] = sums[4 * i + 1];
+		pixel.m_xyz[2] = sums[4 * i + 2];
+		pixel.m_filterWeightSum = sums[4 * i + 3];
+	}
+	samplesDone = samples;
+	return true;
+}
+
+void Film::writeSampleCountImage(const std::string& filename) const
+{
+	int nPixels = m_croppedPixelBounds.area();
+	int maxCount = 1;
+	for (int i = 0; i < nPixels; ++i)
+	{
+		maxCount = glm::max(maxCount, m_sampleCounts[i]);
+	}
+
+	std::unique_ptr<Byte[]> dst(new Byte[3 * nPixels]);
+	for (int i = 0; i < nPixels; ++i)
+	{
+		// Blue-cyan-yellow-red ramp
+		Float t = (Float)m_sampleCounts[i] / maxCount;
+		dst[3 * i + 0] = (Byte)(255.f * clamp(1.5f - std::abs(4.f * t - 3.f), 0.f, 1.f));
+		dst[3 * i + 1] = (Byte)(255.f * clamp(1.5f - std::abs(4.f * t - 2.f), 0.f, 1.f));
+		dst[3 * i + 2] = (Byte)(255.f * clamp(1.5f - std::abs(4.f * t - 1.f), 0.f, 1.f));
+	}
+
+	K_INFO("Writing sample count heatmap {0}, at most {1} spp", filename, maxCount);
+	auto extent = m_croppedPixelBounds.diagonal();
+	stbi_write_png(filename.c_str(), extent.x, extent.y, 3, static_cast<void*>(dst.get()), extent.x * 3);
 }
 
 void Film::setImage(const Spectrum* img) const
@@ -249,6 +634,10 @@ void Film::clear()
 		}
 		pixel.m_filterWeightSum = 0;
 	}
+	if (m_aovPixels)
+	{
+		std::fill(m_aovPixels.get(), m_aovPixels.get() + m_croppedPixelBounds.area(), FilmAOVPixel());
+	}
 }
 
 RENDER_END
\ No newline at end of file
@@ -12,10 +12,42 @@
 
 RENDER_BEGIN
 
+//Note: the filtered sums of a tile are kept in the planar arrays of FilmTile,
+//      this holds the per pixel statistics used by adaptive sampling
 struct FilmTilePixel
 {
-	Spectrum contribSum = 0.f;
-	Float filterWeightSum = 0.f;
+	//Note: running mean and squared deviation (Welford) of the luminance of the samples
+	//      taken inside this pixel, unaffected by the filter footprint of neighbouring samples
+	int sampleCount = 0;
+	Float lumMean = 0.f;
+	Float lumM2 = 0.f;
+
+	void addLuminance(Float y)
+	{
+		++sampleCount;
+		Float delta = y - lumMean;
+		lumMean += delta / sampleCount;
+		lumM2 += delta * (y - lumMean);
+	}
+
+	// Standard error of the mean luminance relative to the mean.
+	// Note: the small offset keeps dark pixels from asking for endless samples
+	Float relativeError() const
+	{
+		if (sampleCount < 2)
+			return Infinity;
+		Float variance = lumM2 / (sampleCount - 1);
+		return std::sqrt(variance / sampleCount) / (lumMean + 0.01f);
+	}
+};
+
+// Auxiliary outputs of the first visible surface, averaged over the samples of a pixel
+struct FilmAOVPixel
+{
+	Spectrum albedoSum = 0.f;
+	Vector3f normalSum = Vector3f(0.f);
+	Float depthSum = 0.f;
+	int count = 0;
 };
 
 class Film final : public AObject
@@ -32,10 +64,24 @@ public:
 	const Vector2i getResolution() const { return m_resolution; }
 
 	std::unique_ptr<FilmTile> getFilmTile(const Bounds2i& sampleBounds);
-	void mergeFilmTile(std::unique_ptr<FilmTile> tile);
+	// Return the time in nanoseconds spent waiting for locks
+	int64_t mergeFilmTile(std::unique_ptr<FilmTile> tile);
 
+	// The format follows the extension of the filename: .exr, .pfm and .hdr keep the float values,
+	// anything else is written as an 8-bit sRGB png
 	void writeImageToFile(Float splatScale = 1);
 
+	// Binary checkpoint of the XYZ and filter weight sums of every pixel. _samplesDone_ is stored
+	// alongside so that a progressive render can continue from it, splats are not saved.
+	bool saveCheckpoint(const std::string& filename, int64_t samplesDone) const;
+	bool loadCheckpoint(const std::string& filename, int64_t& samplesDone);
+
+	// Write the number of samples merged into each pixel as a heatmap, blue for few, red for the most
+	void writeSampleCountImage(const std::string& filename) const;
+
+	// Whether tiles should collect the albedo, normal or depth of the first hit
+	bool needsAOVSamples() const { return m_aovAlbedo || m_aovNormal || m_aovDepth; }
+
 	void setImage(const Spectrum* img) const;
 	void addSplat(const Vector2f& p, Spectrum v);
 
@@ -48,6 +94,10 @@ public:
 
 private:
 	void initialize();
+	void computeFilterTables();
+
+	// Write the enabled AOVs, as extra channels of an EXR or as "<name>.<aov>.<ext>" files otherwise
+	void writeAOVs(const std::string& extension, const std::vector<float>& rgb) const;
 
 private:
 	//Note: XYZ is a display independent representation of color,
@@ -68,6 +118,9 @@ private:
 	Vector2i m_resolution; //(width, height)
 	std::string m_filename;
 	std::unique_ptr<APixel[]> m_pixels;
+	std::unique_ptr<int[]> m_sampleCounts; //samples taken inside each pixel
+	std::unique_ptr<FilmAOVPixel[]> m_aovPixels; //only allocated when an albedo, normal or depth AOV is enabled
+	bool m_aovAlbedo = false, m_aovNormal = false, m_aovDepth = false, m_aovSamples = false;
 
 	Float m_diagonal;
 	Bounds2i m_croppedPixelBounds;	//actual rendering window
@@ -75,9 +128,25 @@ private:
 	std::unique_ptr<Filter> m_filter;
 	std::mutex m_mutex;
 
+	//Note: in the striped mode only the border of a tile, the pixels that other tiles
+	//      may touch too, is merged under the lock of its row, the interior is written directly.
+	//      The locked mode takes _m_mutex_ for the whole tile.
+	enum class MergeMode { Locked, Striped };
+	MergeMode m_mergeMode = MergeMode::Striped;
+	static constexpr int mergeStripes = 64;
+	struct alignas(64) MergeStripe
+	{
+		tbb::spin_mutex m_mutex;
+	};
+	MergeStripe m_mergeStripes[mergeStripes];
+
 	//Note: precomputed filter weights table
 	static constexpr int filterTableWidth = 16;
 	Float m_filterTable[filterTableWidth * filterTableWidth];
+	//Note: 1D tables of a separable filter, the 2D table is their outer product
+	Float m_filterTableX[filterTableWidth], m_filterTableY[filterTableWidth];
+	bool m_separableFilter = false;
+	bool m_singlePixelFilter = false; //box filter with a radius of at most half a pixel
 
 	Float m_scale;
 	Float m_maxSampleLuminance;
@@ -103,7 +172,26 @@ public:
 		m_filterTable(filterTable), m_filterTableSize(filterTableSize),
 		m_maxSampleLuminance(maxSampleLuminance)
 	{
-		m_pixels = std::vector<FilmTilePixel>(glm::max(0, pixelBounds.area()));
+		const size_t area = glm::max(0, pixelBounds.area());
+		m_pixels = std::vector<FilmTilePixel>(area);
+		m_contribSums = std::vector<Float>(Spectrum::nSamples * area, 0.f);
+		m_filterWeightSums = std::vector<Float>(area, 0.f);
+	}
+
+	bool hasAOVs() const { return !m_aovPixels.empty(); }
+
+	// Record the first surface hit by a camera ray, in the pixel the sample was taken in
+	void addAOVSample(const Vector2f& pFilm, const Spectrum& albedo, const Vector3f& normal, Float depth)
+	{
+		Vector2i pPixel = (Vector2i)floor(pFilm);
+		if (!insideExclusive(pPixel, m_pixelBounds))
+			return;
+
+		FilmAOVPixel& pixel = m_aovPixels[pixelIndex(pPixel)];
+		pixel.albedoSum += albedo;
+		pixel.normalSum += normal;
+		pixel.depthSum += depth;
+		++pixel.count;
 	}
 
 	void addSample(const Vector2f& pFilm, Spectrum L, Float sampleWeight = 1.f)
@@ -111,70 +199,156 @@ public:
 		if (L.y() > m_maxSampleLuminance)
 			L *= m_maxSampleLuminance / L.y();
 
+		// Track the luminance statistics of the pixel the sample was taken in
+		Vector2i pPixel = (Vector2i)floor(pFilm);
+		const bool insideTile = insideExclusive(pPixel, m_pixelBounds);
+		if (insideTile)
+		{
+			getPixel(pPixel).addLuminance(L.y() * sampleWeight);
+		}
+
+		// A box filter no wider than a pixel only reaches the pixel the sample is in
+		if (m_singlePixelFilter)
+		{
+			if (insideTile)
+			{
+				Float filterWeight = m_filterTable[0];
+				addWeighted(pixelIndex(pPixel), L * (sampleWeight * filterWeight), filterWeight);
+			}
+			return;
+		}
+
 		// Compute sample's raster bounds
 		Vector2f pFilmDiscrete = pFilm - Vector2f(0.5f, 0.5f);
 		Vector2i p0 = (Vector2i)ceil(pFilmDiscrete - m_filterRadius);
 		Vector2i p1 = (Vector2i)floor(pFilmDiscrete + m_filterRadius) + Vector2i(1, 1);
 		p0 = max(p0, m_pixelBounds.m_pMin);
 		p1 = min(p1, m_pixelBounds.m_pMax);
-
-		// Loop over filter support and add sample to pixel arrays
+		if (p0.x >= p1.x || p0.y >= p1.y)
+			return;
 
 		// Precompute $x$ and $y$ filter table offsets
 		int* ifx = ALLOCA(int, p1.x - p0.x);
 		for (int x = p0.x; x < p1.x; ++x)
 		{
 			Float fx = glm::abs((x - pFilmDiscrete.x) * m_invFilterRadius.x * m_filterTableSize);
-			ifx[x - p0.x] = glm::min((int)glm::floor(fx), m_filterTableSize - 1);
+			ifx[x - p0.x] = glm::min((int)fx, m_filterTableSize - 1);
 		}
 
 		int* ify = ALLOCA(int, p1.y - p0.y);
 		for (int y = p0.y; y < p1.y; ++y)
 		{
 			Float fy = std::abs((y - pFilmDiscrete.y) * m_invFilterRadius.y * m_filterTableSize);
-			ify[y - p0.y] = glm::min((int)std::floor(fy), m_filterTableSize - 1);
+			ify[y - p0.y] = glm::min((int)fy, m_filterTableSize - 1);
+		}
+
+		const int width = m_pixelBounds.m_pMax.x - m_pixelBounds.m_pMin.x;
+		const int nx = p1.x - p0.x;
+		const size_t planeSize = m_filterWeightSums.size();
+		Float weightedL[Spectrum::nSamples];
+		for (int c = 0; c < Spectrum::nSamples; ++c)
+		{
+			weightedL[c] = L[c] * sampleWeight;
+		}
+
+		// Per row weights, from the 1D tables of a separable filter or a row of the 2D table
+		Float* wx = ALLOCA(Float, nx);
+		if (m_separableFilter)
+		{
+			for (int i = 0; i < nx; ++i)
+			{
+				wx[i] = m_filterTableX[ifx[i]];
+			}
 		}
 
 		for (int y = p0.y; y < p1.y; ++y)
 		{
-			for (int x = p0.x; x < p1.x; ++x)
+			Float wy = 1.f;
+			if (m_separableFilter)
+			{
+				wy = m_filterTableY[ify[y - p0.y]];
+			}
+			else
+			{
+				const Float* tableRow = m_filterTable + ify[y - p0.y] * m_filterTableSize;
+				for (int i = 0; i < nx; ++i)
+				{
+					wx[i] = tableRow[ifx[i]];
+				}
+			}
+
+			// Contiguous runs of every channel, simple enough for the compiler to vectorize
+			const size_t rowOffset = (size_t)(y - m_pixelBounds.m_pMin.y) * width + (p0.x - m_pixelBounds.m_pMin.x);
+			Float* weightSums = &m_filterWeightSums[rowOffset];
+			for (int i = 0; i < nx; ++i)
+			{
+				weightSums[i] += wx[i] * wy;
+			}
+			for (int c = 0; c < Spectrum::nSamples; ++c)
 			{
-				// Evaluate filter value at $(x,y)$ pixel
-				int offset = ify[y - p0.y] * m_filterTableSize + ifx[x - p0.x];
-				Float filterWeight = m_filterTable[offset];
-
-				// Update pixel values with filtered sample contribution
-				FilmTilePixel& pixel = getPixel(Vector2i(x, y));
-				pixel.contribSum += L * sampleWeight * filterWeight;
-				pixel.filterWeightSum += filterWeight;
+				Float* contrib = &m_contribSums[c * planeSize + rowOffset];
+				const Float cy = weightedL[c] * wy;
+				for (int i = 0; i < nx; ++i)
+				{
+					contrib[i] += cy * wx[i];
+				}
 			}
 		}
 	}
 
-	FilmTilePixel& getPixel(const Vector2i& p)
+	// Filtered sums of the pixel with index _index_ in the tile
+	Spectrum getContribSum(int index) const
 	{
-		DCHECK(insideExclusive(p, m_pixelBounds));
-		int width = m_pixelBounds.m_pMax.x - m_pixelBounds.m_pMin.x;
-		int index = (p.x - m_pixelBounds.m_pMin.x) + (p.y - m_pixelBounds.m_pMin.y) * width;
-		return m_pixels[index];
+		Spectrum contrib;
+		for (int c = 0; c < Spectrum::nSamples; ++c)
+		{
+			contrib[c] = m_contribSums[c * m_filterWeightSums.size() + index];
+		}
+		return contrib;
 	}
 
-	const FilmTilePixel& getPixel(const Vector2i& p) const
+	Float getFilterWeightSum(int index) const { return m_filterWeightSums[index]; }
+
+	int pixelIndex(const Vector2i& p) const
 	{
 		DCHECK(insideExclusive(p, m_pixelBounds));
 		int width = m_pixelBounds.m_pMax.x - m_pixelBounds.m_pMin.x;
-		int index = (p.x - m_pixelBounds.m_pMin.x) + (p.y - m_pixelBounds.m_pMin.y) * width;
-		return m_pixels[index];
+		return (p.x - m_pixelBounds.m_pMin.x) + (p.y - m_pixelBounds.m_pMin.y) * width;
 	}
 
+	FilmTilePixel& getPixel(const Vector2i& p) { return m_pixels[pixelIndex(p)]; }
+	const FilmTilePixel& getPixel(const Vector2i& p) const { return m_pixels[pixelIndex(p)]; }
+
 	Bounds2i getPixelBounds() const { return m_pixelBounds; }
 
+private:
+	void addWeighted(int index, const Spectrum& contrib, Float filterWeight)
+	{
+		const size_t planeSize = m_filterWeightSums.size();
+		for (int c = 0; c < Spectrum::nSamples; ++c)
+		{
+			m_contribSums[c * planeSize + index] += contrib[c];
+		}
+		m_filterWeightSums[index] += filterWeight;
+	}
+
 private:
 	const Bounds2i m_pixelBounds;
+	// Pixels that no other tile can touch, see Film::getFilmTile
+	Bounds2i m_interiorBounds;
 	const Vector2f m_filterRadius, m_invFilterRadius;
 	const Float* m_filterTable;
 	const int m_filterTableSize;
 	std::vector<FilmTilePixel> m_pixels;
+	// Filtered sums in planar layout, channel c of pixel i at [c * area + i]
+	std::vector<Float> m_contribSums;
+	std::vector<Float> m_filterWeightSums;
+	// Set by Film::getFilmTile, see Film::m_filterTableX
+	const Float* m_filterTableX = nullptr;
+	const Float* m_filterTableY = nullptr;
+	bool m_separableFilter = false;
+	bool m_singlePixelFilter = false;
+	std::vector<FilmAOVPixel> m_aovPixels; //empty unless the film asks for AOVs
 	const Float m_maxSampleLuminance;
 
 	friend class Film;
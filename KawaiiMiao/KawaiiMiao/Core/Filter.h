@@ -17,6 +17,13 @@ public:
 
 	virtual Float evaluate(const Vector2f& p) const = 0;
 
+	// Separable filters, f(x, y) = f(x) * f(y), evaluate one axis (0 for x, 1 for y) at a time
+	virtual bool isSeparable() const { return false; }
+	virtual Float evaluate1D(Float d, int axis) const { return 0; }
+
+	// Whether the filter has the same weight everywhere inside its radius
+	virtual bool isConstant() const { return false; }
+
 	virtual ClassType getClassType() const override { return ClassType::RFilter; }
 public:
 	const Vector2f m_radius, m_invRadius;
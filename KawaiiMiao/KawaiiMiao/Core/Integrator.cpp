@@ -15,106 +15,314 @@ void SamplerIntegrator::render(const Scene& scene)
 	Vector2i resolution = m_camera->m_film->getResolution();
 
 	auto& sampler = m_sampler;
+	Film* film = m_camera->m_film.get();
 
-	// Compute number of tiles, _nTiles_, to use for parallel rendering
+	// Hand out tiles of the sample bounds to the persistent thread pool
 	Bounds2i sampleBounds = m_camera->m_film->getSampleBounds();
-	Vector2i sampleExtent = sampleBounds.diagonal();
-	constexpr int tileSize = 16;
-	Vector2i nTiles((sampleExtent.x + tileSize - 1) / tileSize, (sampleExtent.y + tileSize - 1) / tileSize);
+	TileScheduler scheduler(sampleBounds, m_tileSize, m_tileOrder, m_adaptiveTiles);
+
+	// Without the progressive mode all samples are taken in a single pass
+	const int64_t samplesPerPixel = m_adaptiveSampling ? glm::min(sampler->samplesPerPixel, (int64_t)m_maxSPP)
+		: sampler->samplesPerPixel;
+	std::atomic<int64_t> samplesTaken(0);
+	int64_t samplesDone = 0;
+	if (m_progressive && m_resume && film->loadCheckpoint(m_checkpointFile, samplesDone))
+	{
+		K_INFO("Resuming from checkpoint {0} at {1} spp", m_checkpointFile, samplesDone);
+	}
+	const int64_t samplesPerPass = m_progressive ? glm::clamp((int64_t)m_sppPerPass, (int64_t)1, samplesPerPixel)
+		: samplesPerPixel;
+	const int64_t nPasses = glm::max((int64_t)0, (samplesPerPixel - samplesDone + samplesPerPass - 1) / samplesPerPass);
 
-	Reporter reporter(nTiles.x * nTiles.y, "Rendering");
-	AParallelUtils::parallelFor((size_t)0, (size_t)(nTiles.x * nTiles.y), [&](const size_t& t)
+	auto secondsSince = [](const std::chrono::steady_clock::time_point& t)
 	{
+		return std::chrono::duration<Float>(std::chrono::steady_clock::now() - t).count();
+	};
+	const auto startTime = std::chrono::steady_clock::now();
+	auto lastCheckpoint = startTime;
+
+	// One arena per thread of the pool, kept over all tiles and passes so that
+	// its blocks are allocated once instead of for every tile
+	std::vector<std::unique_ptr<MemoryArena>> arenas(ThreadPool::instance().numThreads());
+	for (auto& arena : arenas)
+		arena.reset(new MemoryArena());
+
+	Reporter reporter(sampleBounds.area() * nPasses, "Rendering");
+	while (samplesDone < samplesPerPixel)
+	{
+		const int64_t firstSample = samplesDone;
+		const int64_t endSample = glm::min(samplesPerPixel, samplesDone + samplesPerPass);
 
-			Vector2i tile(t % nTiles.x, t / nTiles.x);
-			MemoryArena arena;
+		scheduler.run([&](const Bounds2i& tileBounds, int threadIndex)
+		{
+			MemoryArena& arena = *arenas[threadIndex];
 
 			// Get sampler instance for tile
-			int seed = t;
-			std::unique_ptr<Sampler> tileSampler = sampler->clone(seed);
-
-			// Compute sample bounds for tile
-			int x0 = sampleBounds.m_pMin.x + tile.x * tileSize;
-			int x1 = glm::min(x0 + tileSize, sampleBounds.m_pMax.x);
-			int y0 = sampleBounds.m_pMin.y + tile.y * tileSize;
-			int y1 = glm::min(y0 + tileSize, sampleBounds.m_pMax.y);
-			Bounds2i tileBounds(Vector2i(x0, y0), Vector2i(x1, y1));
+			// Note: tiles may be split at run time, so the samplers choose their random streams
+			//       per pixel and the seed only tells the passes apart
+			std::unique_ptr<Sampler> tileSampler = sampler->clone((int)firstSample);
 			//K_INFO("Starting image tile");
 
 			// Get _FilmTile_ for tile
 			std::unique_ptr<FilmTile> filmTile = m_camera->m_film->getFilmTile(tileBounds);
 
-			// Loop over pixels in tile to render them
-			for (Vector2i pixel : tileBounds)
+			int64_t tileSamples = renderTile(scene, tileBounds, *tileSampler, *filmTile, arena, firstSample, endSample);
+			arena.Reset();
+			samplesTaken += tileSamples;
+			//K_INFO("Finished image tile {0}", tileBounds.area());
+
+			reporter.addWaitTime(m_camera->m_film->mergeFilmTile(std::move(filmTile)));
+			reporter.update(tileBounds.area());
+
+		});
+		samplesDone = endSample;
+
+		if (!m_progressive || samplesDone >= samplesPerPixel)
+			break;
+
+		if (m_timeLimit > 0 && secondsSince(startTime) >= m_timeLimit)
+		{
+			K_INFO("Time limit of {0} s reached at {1} spp", m_timeLimit, samplesDone);
+			break;
+		}
+
+		if (m_checkpointInterval > 0 && secondsSince(lastCheckpoint) >= m_checkpointInterval)
+		{
+			film->writeImageToFile();
+			if (!m_checkpointFile.empty())
+				film->saveCheckpoint(m_checkpointFile, samplesDone);
+			lastCheckpoint = std::chrono::steady_clock::now();
+		}
+	}
+
+	reporter.done();
+
+	K_INFO("Rendering finished: {0} spp, {1} tiles, {2} split, {3:.2f} ms waiting for film locks",
+		samplesDone, scheduler.numTiles(), scheduler.numSplits(), reporter.waitMS());
+	size_t maxHighWater = 0, sumHighWater = 0, totalArena = 0;
+	for (size_t i = 0; i < arenas.size(); ++i)
+	{
+		K_TRACE("Thread {0}: arena high-water {1} bytes, {2} bytes allocated",
+			i, arenas[i]->HighWater(), arenas[i]->TotalAllocated());
+		maxHighWater = glm::max(maxHighWater, arenas[i]->HighWater());
+		sumHighWater += arenas[i]->HighWater();
+		totalArena += arenas[i]->TotalAllocated();
+	}
+	K_INFO("Memory arenas: {0} threads, high-water {1:.1f} KB max, {2:.1f} KB mean, {3:.1f} KB allocated",
+		arenas.size(), maxHighWater / 1024.0, sumHighWater / 1024.0 / arenas.size(), totalArena / 1024.0);
+	if (m_adaptiveSampling)
+	{
+		K_INFO("Adaptive sampling took {0:.2f} spp on average", (double)samplesTaken / sampleBounds.area());
+		if (!m_heatmapFile.empty())
+			film->writeSampleCountImage(m_heatmapFile);
+	}
+
+	if (m_progressive && !m_checkpointFile.empty())
+		film->saveCheckpoint(m_checkpointFile, samplesDone);
+	m_camera->m_film->writeImageToFile();
+
+}
+
+int64_t SamplerIntegrator::renderTile(const Scene& scene, const Bounds2i& tileBounds, Sampler& tileSampler,
+	FilmTile& filmTile, MemoryArena& arena, int64_t firstSample, int64_t endSample) const
+{
+	struct PrimarySample
+	{
+		CameraSample m_cameraSample;
+		Float m_rayWeight;
+		int64_t m_sampleNumber;
+		int m_ray; // Index in the ray batch, -1 if no ray was cast
+	};
+
+	PrimarySample samples[primaryPacketSize];
+	RayBatch rays;
+	HitBatch hits;
+
+	// Loop over pixels in tile to render them
+	int64_t tileSamples = 0;
+	for (Vector2i pixel : tileBounds)
+	{
+		tileSampler.startPixel(pixel);
+		tileSampler.setSampleNumber(firstSample);
+		bool converged = false, moreSamples = true;
+
+		while (!converged && moreSamples)
+		{
+			// Generate camera rays for the next packet of samples of the pixel
+			int nSamples = 0;
+			rays.clear();
+			do
 			{
-				tileSampler->startPixel(pixel);
+				PrimarySample& sample = samples[nSamples++];
+				sample.m_cameraSample = tileSampler.getCameraSample(pixel);
+				sample.m_sampleNumber = tileSampler.currentSampleNumber();
+
+				Ray ray;
+				sample.m_rayWeight = m_camera->castingRay(sample.m_cameraSample, ray);
+				sample.m_ray = -1;
+				if (sample.m_rayWeight > 0)
+				{
+					sample.m_ray = rays.size();
+					rays.push(ray);
+				}
+
+				moreSamples = tileSampler.startNextSample() && tileSampler.currentSampleNumber() < endSample;
+			} while (moreSamples && nSamples < primaryPacketSize);
+
+			// Trace the coherent camera rays together
+			scene.hitN(rays, hits);
+
+			for (int s = 0; s < nSamples && !converged; ++s)
+			{
+				const PrimarySample& sample = samples[s];
+
+				// Return to the sample and replay its camera dimensions, so Li draws the values it
+				// would have drawn right after the camera sample
+				tileSampler.setSampleNumber(sample.m_sampleNumber);
+				tileSampler.getCameraSample(pixel);
+
+				// Evaluate radiance along camera ray
+				Spectrum L(0.f);
+				if (sample.m_ray >= 0)
+				{
+					L = primaryLi(rays.m_rays[sample.m_ray], hits.m_records[sample.m_ray], scene, tileSampler, arena);
+				}
+
+				// Issue warning if unexpected radiance value returned
+				checkRadiance(L, pixel, sample.m_sampleNumber);
+
+				// Add camera ray's contribution to image
+				filmTile.addSample(sample.m_cameraSample.pFilm, L, sample.m_rayWeight);
+
+				// Record the first visible surface for the AOVs of the film
+				if (filmTile.hasAOVs() && sample.m_ray >= 0)
+				{
+					addAOVSample(rays.m_rays[sample.m_ray], hits.m_found[sample.m_ray], hits.m_records[sample.m_ray],
+						scene, tileSampler, arena, sample.m_cameraSample.pFilm, filmTile);
+				}
+
+				// Free _MemoryArena_ memory from computing image sample value
+				arena.Reset();
+				++tileSamples;
 
-				do
+				// Stop sampling the pixel once its estimate is precise enough,
+				// the rest of the packet is dropped
+				if (m_adaptiveSampling && sample.m_sampleNumber + 1 >= m_minSPP)
 				{
-					// Initialize _CameraSample_ for current sample
-					CameraSample cameraSample = tileSampler->getCameraSample(pixel);
-
-					// Generate camera ray for current sample
-					Ray ray;
-					Float rayWeight = m_camera->castingRay(cameraSample, ray);
-
-					// Evaluate radiance along camera ray
-					Spectrum L(0.f);
-					if (rayWeight > 0)
-					{
-						L = Li(ray, scene, *tileSampler, arena);
-					}
-
-					// Issue warning if unexpected radiance value returned
-					if (L.hasNaNs())
-					{
-						K_ERROR(stringPrintf(
-							"Not-a-number radiance value returned "
-							"for pixel (%d, %d), sample %d. Setting to black.",
-							pixel.x, pixel.y,
-							(int)tileSampler->currentSampleNumber()));
-						L = Spectrum(0.f);
-					}
-					else if (L.y() < -1e-5)
-					{
-						K_ERROR(stringPrintf(
-							"Negative luminance value, %f, returned "
-							"for pixel (%d, %d), sample %d. Setting to black.",
-							L.y(), pixel.x, pixel.y,
-							(int)tileSampler->currentSampleNumber()));
-						L = Spectrum(0.f);
-					}
-					else if (std::isinf(L.y()))
-					{
-						K_ERROR(stringPrintf(
-							"Infinite luminance value returned "
-							"for pixel (%d, %d), sample %d. Setting to black.",
-							pixel.x, pixel.y,
-							(int)tileSampler->currentSampleNumber()));
-						L = Spectrum(0.f);
-					}
-					//K_INFO("Camera Sample : {0} {1}", cameraSample.pFilm.x, cameraSample.pFilm.y);
-					// Add camera ray's contribution to image
-					filmTile->addSample(cameraSample.pFilm, L, rayWeight);
-
-					// Free _MemoryArena_ memory from computing image sample value
-					arena.Reset();
-
-				} while (tileSampler->startNextSample());
+					converged = !insideExclusive(pixel, filmTile.getPixelBounds()) ||
+						filmTile.getPixel(pixel).relativeError() < m_adaptiveThreshold;
+				}
 			}
-			//K_INFO("Finished image tile {0}", tileBounds.area());
 
-			m_camera->m_film->mergeFilmTile(std::move(filmTile));
-			reporter.update();
+			// Continue after the last sample of the packet
+			if (moreSamples)
+			{
+				tileSampler.setSampleNumber(samples[nSamples - 1].m_sampleNumber);
+				tileSampler.startNextSample();
+			}
+		}
+	}
+	return tileSamples;
+}
 
-		}, ExecutionPolicy::PARALLEL);
+Spectrum SamplerIntegrator::primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena) const
+{
+	return Li(ray, scene, sampler, arena);
+}
 
-	reporter.done();
+void SamplerIntegrator::checkRadiance(Spectrum& L, const Vector2i& pixel, int64_t sampleNumber)
+{
+	if (L.hasNaNs())
+	{
+		K_ERROR(stringPrintf(
+			"Not-a-number radiance value returned "
+			"for pixel (%d, %d), sample %d. Setting to black.",
+			pixel.x, pixel.y, (int)sampleNumber));
+		L = Spectrum(0.f);
+	}
+	else if (L.y() < -1e-5)
+	{
+		K_ERROR(stringPrintf(
+			"Negative luminance value, %f, returned "
+			"for pixel (%d, %d), sample %d. Setting to black.",
+			L.y(), pixel.x, pixel.y, (int)sampleNumber));
+		L = Spectrum(0.f);
+	}
+	else if (std::isinf(L.y()))
+	{
+		K_ERROR(stringPrintf(
+			"Infinite luminance value returned "
+			"for pixel (%d, %d), sample %d. Setting to black.",
+			pixel.x, pixel.y, (int)sampleNumber));
+		L = Spectrum(0.f);
+	}
+}
+
+void SamplerIntegrator::parseRenderSettings(const APropertyTreeNode& node)
+{
+	const APropertyList& props = node.getPropertyList();
+	m_tileSize = props.getInteger("TileSize", m_tileSize);
+	m_tileOrder = TileScheduler::toTileOrder(props.getString("TileOrder", "Hilbert"));
+	m_adaptiveTiles = props.getBoolean("AdaptiveTiles", m_adaptiveTiles);
 
-	K_INFO("Rendering finished");
+	if (node.hasPropertyChild("Progressive"))
+	{
+		const APropertyList& progressiveProps = node.getPropertyChild("Progressive").getPropertyList();
+		m_progressive = true;
+		m_sppPerPass = progressiveProps.getInteger("SPPPerPass", m_sppPerPass);
+		m_timeLimit = progressiveProps.getFloat("TimeLimit", m_timeLimit);
+		m_checkpointInterval = progressiveProps.getFloat("CheckpointInterval", m_checkpointInterval);
+		m_checkpointFile = progressiveProps.getString("Checkpoint", "");
+		if (!m_checkpointFile.empty())
+			m_checkpointFile = APropertyTreeNode::m_directory + m_checkpointFile;
+		m_resume = progressiveProps.getBoolean("Resume", m_resume);
+	}
 
-	m_camera->m_film->writeImageToFile();
+	if (node.hasPropertyChild("Adaptive"))
+	{
+		const APropertyList& adaptiveProps = node.getPropertyChild("Adaptive").getPropertyList();
+		m_adaptiveSampling = true;
+		m_adaptiveThreshold = adaptiveProps.getFloat("Threshold", m_adaptiveThreshold);
+		m_minSPP = glm::max(2, adaptiveProps.getInteger("MinSPP", m_minSPP));
+		m_maxSPP = adaptiveProps.getInteger("MaxSPP", m_maxSPP);
+		m_heatmapFile = adaptiveProps.getString("Heatmap", "");
+		if (!m_heatmapFile.empty())
+			m_heatmapFile = APropertyTreeNode::m_directory + m_heatmapFile;
+
+		if (m_progressive)
+		{
+			K_WARN("Adaptive sampling is not supported in the progressive mode, sampling uniformly");
+			m_adaptiveSampling = false;
+		}
+	}
+}
 
+void SamplerIntegrator::addAOVSample(const Ray& ray, bool found, const HitRecord& record, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena, const Vector2f& pFilm, FilmTile& filmTile) const
+{
+	if (!found)
+	{
+		filmTile.addAOVSample(pFilm, Spectrum(0.f), Vector3f(0.f), 0.f);
+		return;
+	}
+	SurfaceInteraction isect;
+	scene.fillSurfaceInteraction(ray, record, isect);
+
+	//Note: the albedo is a one sample estimate of the directional albedo, f * |cos| / pdf,
+	//      which averages to the reflectance over the samples of the pixel
+	Spectrum albedo(0.f);
+	isect.computeScatteringFunctions(ray, arena, true);
+	if (isect.bsdf != nullptr)
+	{
+		Vector3f wi;
+		Float pdf = 0;
+		BxDFType sampledType;
+		Spectrum f = isect.bsdf->sample_f(isect.wo, wi, sampler.get2D(), pdf, sampledType);
+		if (pdf > 0 && !f.isBlack())
+			albedo = f * absDot(wi, isect.normal) / pdf;
+	}
+	filmTile.addAOVSample(pFilm, albedo, isect.normal, record.m_t);
 }
 
 Spectrum SamplerIntegrator::specularReflect(const Ray& ray, const SurfaceInteraction& isect,
@@ -200,22 +408,32 @@ Spectrum uiformSampleAllLights(const Interaction& it, const Scene& scene,
 }
 
 Spectrum uniformSampleOneLight(const Interaction& it, const Scene& scene,
-	MemoryArena& arena, Sampler& sampler, const Distribution1D* lightDistrib)
+	MemoryArena& arena, Sampler& sampler, const LightDistribution* lightDistrib)
+{
+	DirectLightingQuery query;
+	Float lightPdf;
+	if (!sampleOneLight(it, scene, sampler, lightDistrib, query, lightPdf))
+		return Spectrum(0.f);
+
+	return resolveDirect(query, scene) / lightPdf;
+}
+
+bool sampleOneLight(const Interaction& it, const Scene& scene, Sampler& sampler,
+	const LightDistribution* lightDistrib, DirectLightingQuery& query, Float& lightPdf)
 {
 	// Randomly choose a single light to sample, _light_
 	int nLights = int(scene.m_lights.size());
 
 	if (nLights == 0)
-		return Spectrum(0.f);
+		return false;
 
 	int lightNum;
-	Float lightPdf;
 
 	if (lightDistrib != nullptr)
 	{
-		lightNum = lightDistrib->sampleDiscrete(sampler.get1D(), &lightPdf);
-		if (lightPdf == 0)
-			return Spectrum(0.f);
+		lightNum = lightDistrib->sample(it, sampler.get1D(), lightPdf);
+		if (lightNum < 0 || lightPdf == 0)
+			return false;
 	}
 	else
 	{
@@ -227,15 +445,24 @@ Spectrum uniformSampleOneLight(const Interaction& it, const Scene& scene,
 	Vector2f uLight = sampler.get2D();
 	Vector2f uScattering = sampler.get2D();
 
-	return estimateDirect(it, uScattering, *light, uLight, scene, sampler, arena) / lightPdf;
+	prepareDirect(it, uScattering, *light, uLight, query);
+	return true;
 }
 
 Spectrum estimateDirect(const Interaction& it, const Vector2f& uScattering, const Light& light,
 	const Vector2f& uLight, const Scene& scene, Sampler& sampler, MemoryArena& arena, bool specular)
+{
+	DirectLightingQuery query;
+	prepareDirect(it, uScattering, light, uLight, query, specular);
+	return resolveDirect(query, scene);
+}
+
+void prepareDirect(const Interaction& it, const Vector2f& uScattering, const Light& light,
+	const Vector2f& uLight, DirectLightingQuery& query, bool specular)
 {
 	BxDFType bsdfFlags = specular ? BSDF_ALL : BxDFType(BSDF_ALL & ~BSDF_SPECULAR);
+	query.m_light = &light;
 
-	Spectrum Ld(0.f);
 	// Sample light source with multiple importance sampling
 	Vector3f wi;
 	Float lightPdf = 0, scatteringPdf = 0;
@@ -252,26 +479,20 @@ Spectrum estimateDirect(const Interaction& it, const Vector2f& uScattering, cons
 
 		scatteringPdf = isect.bsdf->pdf(isect.wo, wi, bsdfFlags);
 
+		// Light's contribution to reflected radiance, if the shadow ray gets through
 		if (!f.isBlack())
 		{
-			// Compute effect of visibility for light source sample
-			if (!visibility.unoccluded(scene))
+			query.m_visibility = visibility;
+			query.m_testVisibility = true;
+			query.m_lightLi = Li;
+			if (isDeltaLight(light.flags))
 			{
-				Li = Spectrum(0.f);
+				query.m_lightF = f / lightPdf;
 			}
-
-			// Add light's contribution to reflected radiance
-			if (!Li.isBlack())
+			else
 			{
-				if (isDeltaLight(light.flags))
-				{
-					Ld += f * Li / lightPdf;
-				}
-				else
-				{
-					Float weight = powerHeuristic(1, lightPdf, 1, scatteringPdf);
-					Ld += f * Li * weight / lightPdf;
-				}
+				Float weight = powerHeuristic(1, lightPdf, 1, scatteringPdf);
+				query.m_lightF = f * weight / lightPdf;
 			}
 		}
 	}
@@ -295,32 +516,82 @@ Spectrum estimateDirect(const Interaction& it, const Vector2f& uScattering, cons
 			if (!sampledSpecular)
 			{
 				lightPdf = light.pdf_Li(it, wi);
-				if (lightPdf == 0) return Ld;
+				if (lightPdf == 0) return;
 				weight = powerHeuristic(1, scatteringPdf, 1, lightPdf);
 			}
 
-			// Find intersection and compute transmittance
+			query.m_bsdfF = f;
+			query.m_bsdfWeight = weight;
+			query.m_bsdfPdf = scatteringPdf;
+			query.m_bsdfRay = it.spawnRay(wi);
+			query.m_traceBsdfRay = true;
+		}
+	}
+}
+
+template <typename Conversion>
+typename Conversion::Radiance resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	const Conversion& conversion)
+{
+	bool unoccluded = query.m_testVisibility && query.m_visibility.unoccluded(scene);
+	HitRecord bsdfHit;
+	bool bsdfHitFound = query.m_traceBsdfRay && scene.hit(query.m_bsdfRay, bsdfHit);
+	return resolveDirect(query, scene, unoccluded, bsdfHitFound, bsdfHit, conversion);
+}
+
+// Radiance of the sampled light along the BSDF ray of _query_
+static Spectrum bsdfRayLi(const DirectLightingQuery& query, const Scene& scene,
+	bool bsdfHitFound, const HitRecord& bsdfHit)
+{
+	// Note: the surface is only completed if the sampled light itself was hit
+	Spectrum Li(0.f);
+	if (bsdfHitFound)
+	{
+		if (bsdfHit.m_primitive->getAreaLight() == query.m_light)
+		{
 			SurfaceInteraction lightIsect;
-			Ray ray = it.spawnRay(wi);
-			Spectrum Tr(1.f);
-			bool foundSurfaceInteraction = scene.hit(ray, lightIsect);
+			scene.fillSurfaceInteraction(query.m_bsdfRay, bsdfHit, lightIsect);
+			Li = lightIsect.Le(-query.m_bsdfRay.direction());
+		}
+	}
+	else
+	{
+		Li = query.m_light->Le(query.m_bsdfRay);
+	}
+	return Li;
+}
 
-			// Add light contribution from material sampling
-			Spectrum Li(0.f);
-			if (foundSurfaceInteraction)
-			{
-				if (lightIsect.primitive->getAreaLight() == &light)
-					Li = lightIsect.Le(-wi);
-			}
-			else
-			{
-				Li = light.Le(ray);
-			}
-			if (!Li.isBlack())
-				Ld += f * Li * Tr * weight / scatteringPdf;
+template <typename Conversion>
+typename Conversion::Radiance resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	bool unoccluded, bool bsdfHitFound, const HitRecord& bsdfHit, const Conversion& conversion)
+{
+	typename Conversion::Radiance Ld(0.f);
+	// Compute effect of visibility for light source sample
+	if (query.m_testVisibility && unoccluded)
+	{
+		Ld += conversion.reflectance(query.m_lightF) * conversion.illuminant(query.m_lightLi);
+	}
+
+	if (query.m_traceBsdfRay)
+	{
+		// Add light contribution from material sampling
+		Spectrum Li = bsdfRayLi(query, scene, bsdfHitFound, bsdfHit);
+		if (!Li.isBlack())
+		{
+			Ld += conversion.reflectance(query.m_bsdfF) * conversion.illuminant(Li)
+				* (query.m_bsdfWeight / query.m_bsdfPdf);
 		}
 	}
 	return Ld;
 }
 
+template Spectrum resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	const RGBConversion& conversion);
+template Spectrum resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	bool unoccluded, bool bsdfHitFound, const HitRecord& bsdfHit, const RGBConversion& conversion);
+template SampledSpectrum resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	const SpectralConversion& conversion);
+template SampledSpectrum resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	bool unoccluded, bool bsdfHitFound, const HitRecord& bsdfHit, const SpectralConversion& conversion);
+
 RENDER_END
\ No newline at end of file
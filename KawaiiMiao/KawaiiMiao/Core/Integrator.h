@@ -6,6 +6,7 @@
 #include "Camera.h"
 #include "Primitive.h"
 #include "Rtti.h"
+#include "../Tool/TileScheduler.h"
 
 RENDER_BEGIN
 
@@ -38,6 +39,11 @@ public:
 	virtual Spectrum Li(const Ray& ray, const Scene& scene,
 		Sampler& sampler, MemoryArena& arena, int depth = 0) const = 0;
 
+	// Li of a camera ray whose closest hit was already found in a batch with other camera rays,
+	// _primaryHit.m_primitive_ is nullptr if the ray escaped. Note: the default traces the ray again
+	virtual Spectrum primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena) const;
+
 	Spectrum specularReflect(const Ray& ray, const SurfaceInteraction& isect,
 		const Scene& scene, Sampler& sampler, MemoryArena& arena, int depth) const;
 
@@ -45,8 +51,53 @@ public:
 		const Scene& scene, Sampler& sampler, MemoryArena& arena, int depth) const;
 
 protected:
+	// Read the tile scheduler settings "TileSize", "TileOrder" and "AdaptiveTiles",
+	// and the "Progressive" and "Adaptive" children of the integrator
+	void parseRenderSettings(const APropertyTreeNode& node);
+
+	// Render the samples [_firstSample_, _endSample_) of the pixels of _tileBounds_ into _filmTile_,
+	// return the number of samples taken. Note: the default traces the camera rays of a pixel in packets
+	//       of _primaryPacketSize_ through Scene::hitN and shades them one at a time through primaryLi
+	virtual int64_t renderTile(const Scene& scene, const Bounds2i& tileBounds, Sampler& tileSampler,
+		FilmTile& filmTile, MemoryArena& arena, int64_t firstSample, int64_t endSample) const;
+
+	// Report and zero radiance values that are NaN, negative or infinite
+	static void checkRadiance(Spectrum& L, const Vector2i& pixel, int64_t sampleNumber);
+
+	// Albedo, shading normal and distance of the first surface _record_ along the camera ray _ray_,
+	// _found_ tells whether the ray hit anything
+	void addAOVSample(const Ray& ray, bool found, const HitRecord& record, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena, const Vector2f& pFilm, FilmTile& filmTile) const;
+
+	static constexpr int primaryPacketSize = 16;
+
 	Camera::ptr m_camera;
 	Sampler::ptr m_sampler;
+
+	int m_tileSize = 16;
+	TileOrder m_tileOrder = TileOrder::Hilbert;
+	bool m_adaptiveTiles = true;
+
+	// Progressive mode, renders the whole image "SPPPerPass" samples at a time until the sampler's
+	// SPP or "TimeLimit" seconds are reached. Every "CheckpointInterval" seconds the image is written
+	// and the film saved to "Checkpoint", which "Resume" continues from.
+	// Note: limits are checked between passes.
+	bool m_progressive = false;
+	int m_sppPerPass = 1;
+	Float m_timeLimit = 0;
+	Float m_checkpointInterval = 0;
+	std::string m_checkpointFile;
+	bool m_resume = false;
+
+	// Adaptive sampling, enabled by an "Adaptive" child of the integrator. A pixel stops after
+	// "MinSPP" samples once the relative error of its mean luminance is below "Threshold", and
+	// after "MaxSPP" in any case. "Heatmap" names an image of the samples taken per pixel.
+	// Note: the statistics live in the film tile, so this is not combined with the progressive mode.
+	bool m_adaptiveSampling = false;
+	Float m_adaptiveThreshold = 0.01f;
+	int m_minSPP = 16;
+	int m_maxSPP = std::numeric_limits<int>::max();
+	std::string m_heatmapFile;
 };
 
 
@@ -54,9 +105,74 @@ Spectrum uiformSampleAllLights(const Interaction& it, const Scene& scene,
 	MemoryArena& arena, Sampler& sampler, const std::vector<int>& nLightSamples);
 
 Spectrum uniformSampleOneLight(const Interaction& it, const Scene& scene,
-	MemoryArena& arena, Sampler& sampler, const Distribution1D* lightDistrib);
+	MemoryArena& arena, Sampler& sampler, const LightDistribution* lightDistrib);
 
 Spectrum estimateDirect(const Interaction& it, const Vector2f& uShading, const Light& light,
 	const Vector2f& uLight, const Scene& scene, Sampler& sampler, MemoryArena& arena, bool specular = false);
 
+// estimateDirect split at its ray queries: prepareDirect samples the light and the BSDF,
+// the shadow ray and the BSDF ray are traced, and resolveDirect adds up the terms that got through.
+// Lets a wavefront integrator trace the rays of many paths in bulk.
+struct DirectLightingQuery
+{
+	const Light* m_light = nullptr;
+
+	// Light sampling term m_lightF * m_lightLi, counts if the shadow ray is unoccluded
+	Spectrum m_lightF = 0.f, m_lightLi = 0.f;
+	VisibilityTester m_visibility;
+	bool m_testVisibility = false;
+
+	// BSDF sampling term, f * weight / pdf times the radiance of _m_light_ along _m_bsdfRay_
+	Spectrum m_bsdfF = 0.f;
+	Float m_bsdfWeight = 0, m_bsdfPdf = 0;
+	Ray m_bsdfRay;
+	bool m_traceBsdfRay = false;
+};
+
+// Conversion of the RGB values of BSDFs and lights into the radiance a path carries.
+// RGB paths take them as they are.
+struct RGBConversion
+{
+	typedef Spectrum Radiance;
+
+	Radiance reflectance(const Spectrum& rgb) const { return rgb; }
+	Radiance illuminant(const Spectrum& rgb) const { return rgb; }
+	Spectrum toRGB(const Radiance& L) const { return L; }
+};
+
+// Spectral paths convert them at the sampled wavelengths _m_lambda_
+struct SpectralConversion
+{
+	typedef SampledSpectrum Radiance;
+
+	SpectralConversion(const SampledWavelengths& lambda) : m_lambda(lambda) {}
+
+	Radiance reflectance(const Spectrum& rgb) const { return SampledSpectrum::fromRGB(rgb, m_lambda); }
+	Radiance illuminant(const Spectrum& rgb) const
+	{
+		return SampledSpectrum::fromRGB(rgb, m_lambda, SpectrumType::Illuminant);
+	}
+	Spectrum toRGB(const Radiance& L) const { return L.toRGBSpectrum(m_lambda); }
+
+	SampledWavelengths m_lambda;
+};
+
+void prepareDirect(const Interaction& it, const Vector2f& uShading, const Light& light,
+	const Vector2f& uLight, DirectLightingQuery& query, bool specular = false);
+
+// Trace the rays of _query_ and return the estimate of estimateDirect,
+// the BSDF and the light are converted by _conversion_ before they are multiplied
+template <typename Conversion = RGBConversion>
+typename Conversion::Radiance resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	const Conversion& conversion = Conversion());
+// Same with rays traced by the caller, _bsdfHit_ only matters if _bsdfHitFound_
+template <typename Conversion = RGBConversion>
+typename Conversion::Radiance resolveDirect(const DirectLightingQuery& query, const Scene& scene,
+	bool unoccluded, bool bsdfHitFound, const HitRecord& bsdfHit, const Conversion& conversion = Conversion());
+
+// Choose a light as uniformSampleOneLight does and prepare its query,
+// false if there is nothing to sample. The estimate is to be divided by _lightPdf_.
+bool sampleOneLight(const Interaction& it, const Scene& scene, Sampler& sampler,
+	const LightDistribution* lightDistrib, DirectLightingQuery& query, Float& lightPdf);
+
 RENDER_END
\ No newline at end of file
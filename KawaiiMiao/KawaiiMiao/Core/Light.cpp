@@ -22,6 +22,69 @@ Light::~Light() {}
 
 Spectrum Light::Le(const Ray& ray) const { return Spectrum(0.f); }
 
+// Light bounds
+Float LightBounds::importance(const Vector3f& p, const Vector3f& n) const
+{
+	// cos(a - b) and sin(a - b), clamped to zero angle
+	auto cosSubClamped = [](Float sinA, Float cosA, Float sinB, Float cosB) -> Float
+	{
+		return (cosA > cosB) ? 1 : cosA * cosB + sinA * sinB;
+	};
+	auto sinSubClamped = [](Float sinA, Float cosA, Float sinB, Float cosB) -> Float
+	{
+		return (cosA > cosB) ? 0 : sinA * cosB - cosA * sinB;
+	};
+	auto sinFromCos = [](Float cosTheta) { return glm::sqrt(glm::max(Float(0), 1 - cosTheta * cosTheta)); };
+
+	// Clamp the squared distance so that points inside the bounds do not blow up
+	Vector3f pc = centroid();
+	Float d2 = glm::max(distanceSquared(p, pc), length(m_bounds.diagonal()) / 2);
+	if (d2 == 0)
+		return m_phi;
+
+	// Smallest angle between an emitter normal and the direction to _p_,
+	// reduced by the angle the bounds subtend from _p_
+	Vector3f wi = normalize(p - pc);
+	Float cosThetaW = dot(m_w, wi);
+	if (m_twoSided)
+		cosThetaW = glm::abs(cosThetaW);
+	Float sinThetaW = sinFromCos(cosThetaW);
+
+	Float cosThetaB = boundSubtendedDirections(m_bounds, p).m_cosTheta;
+	Float sinThetaB = sinFromCos(cosThetaB);
+
+	Float sinThetaO = sinFromCos(m_cosThetaO);
+	Float cosThetaX = cosSubClamped(sinThetaW, cosThetaW, sinThetaO, m_cosThetaO);
+	Float sinThetaX = sinSubClamped(sinThetaW, cosThetaW, sinThetaO, m_cosThetaO);
+	Float cosThetaP = cosSubClamped(sinThetaX, cosThetaX, sinThetaB, cosThetaB);
+	if (cosThetaP <= m_cosThetaE)
+		return 0;
+
+	Float importance = m_phi * cosThetaP / d2;
+
+	// Same for the incident angle at _p_
+	if (n != Vector3f(0.f))
+	{
+		Float cosThetaI = absDot(wi, n);
+		Float sinThetaI = sinFromCos(cosThetaI);
+		importance *= cosSubClamped(sinThetaI, cosThetaI, sinThetaB, cosThetaB);
+	}
+
+	return glm::max(importance, Float(0));
+}
+
+LightBounds unionLightBounds(const LightBounds& a, const LightBounds& b)
+{
+	if (a.m_phi == 0)
+		return b;
+	if (b.m_phi == 0)
+		return a;
+
+	DirectionCone cone = unionCones(DirectionCone(a.m_w, a.m_cosThetaO), DirectionCone(b.m_w, b.m_cosThetaO));
+	return LightBounds(unionBounds(a.m_bounds, b.m_bounds), cone.m_w, a.m_phi + b.m_phi, cone.m_cosTheta,
+		glm::min(a.m_cosThetaE, b.m_cosThetaE), a.m_twoSided || b.m_twoSided);
+}
+
 // Visibility tester
 bool VisibilityTester::unoccluded(const Scene& scene) const
 {
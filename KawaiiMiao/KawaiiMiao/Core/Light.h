@@ -24,6 +24,33 @@ inline bool isDeltaLight(int flags)
 		|| flags & (int)LightFlags::LightDeltaDirection;
 }
 
+// Spatial and directional extent of the emission of a light or a group of lights,
+// bounds its contribution to any shading point
+struct LightBounds
+{
+	LightBounds() = default;
+	LightBounds(const Bounds3f& bounds, const Vector3f& w, Float phi, Float cosThetaO,
+		Float cosThetaE, bool twoSided)
+		: m_bounds(bounds), m_w(normalize(w)), m_phi(phi), m_cosThetaO(cosThetaO),
+		m_cosThetaE(cosThetaE), m_twoSided(twoSided) {}
+
+	Vector3f centroid() const { return (m_bounds.m_pMin + m_bounds.m_pMax) * Float(0.5); }
+
+	// Conservative estimate of the light arriving at _p_, on a surface with normal _n_ unless it is zero
+	Float importance(const Vector3f& p, const Vector3f& n) const;
+
+	Bounds3f m_bounds;
+	// Cone of the surface normals of the emitters
+	Vector3f m_w = Vector3f(0, 0, 1);
+	// Emitted power, zero for empty bounds
+	Float m_phi = 0;
+	// Spread of the normals around m_w, and of the emission around each normal
+	Float m_cosThetaO = 1, m_cosThetaE = 1;
+	bool m_twoSided = false;
+};
+
+LightBounds unionLightBounds(const LightBounds& a, const LightBounds& b);
+
 class Light : public AObject
 {
 public:
@@ -50,6 +77,9 @@ public:
 
 	virtual void pdf_Le(const Ray&, const Vector3f&, Float& pdfPos, Float& pdfDir) const = 0;
 
+	// Bounds of the emission for light BVHs, false for lights without finite bounds
+	virtual bool bounds(LightBounds& lb) const { return false; }
+
 	virtual ClassType getClassType() const override { return ClassType::RLight; }
 
 	// Light Public Data
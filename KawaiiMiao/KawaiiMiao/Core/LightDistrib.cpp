@@ -1,39 +1,141 @@
 #include "LightDistrib.h"
 #include "Scene.h"
+#include "Light.h"
+#include "Interaction.h"
+#include "LowDiscrepancy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
 
 RENDER_BEGIN
 
 std::unique_ptr<LightDistribution> createLightSampleDistribution(
 	const std::string& name, const Scene& scene)
 {
-	//if (name == "uniform" || scene.m_lights.size() == 1)
+	if (name == "uniform" || scene.m_lights.size() == 1)
 	{
 		return std::unique_ptr<LightDistribution>{
 			new UniformLightDistribution(scene)};
 	}
-	//else if (name == "power")
-	//{
-	//	return std::unique_ptr<ALightDistribution>{
-	//		new APowerLightDistribution(scene)};
-	//}
-	//else if (name == "spatial")
-	//{
-	//	return std::unique_ptr<ALightDistribution>{
-	//		new ASpatialLightDistribution(scene)};
-	//}
-	//else 
-	//{
-	//	Error(
-	//		"Light sample distribution type \"%s\" unknown. Using \"spatial\".",
-	//		name.c_str());
-	//	return std::unique_ptr<LightDistribution>{new SpatialLightDistribution(scene)};
-	//}
+	else if (name == "power")
+	{
+		return std::unique_ptr<LightDistribution>{
+			new PowerLightDistribution(scene)};
+	}
+	else if (name == "spatial")
+	{
+		return std::unique_ptr<LightDistribution>{
+			new SpatialLightDistribution(scene)};
+	}
+	else if (name == "bvh")
+	{
+		return std::unique_ptr<LightDistribution>{
+			new BVHLightDistribution(scene)};
+	}
+	else
+	{
+		K_ERROR("Light sample distribution type \"{0}\" unknown. Using \"bvh\".", name);
+		return std::unique_ptr<LightDistribution>{
+			new BVHLightDistribution(scene)};
+	}
+}
+
+int LightDistribution::sample(const Interaction& it, Float u, Float& pmf) const
+{
+	return lookup(it.p)->sampleDiscrete(u, &pmf);
+}
+
+Float LightDistribution::pmf(const Interaction& it, int lightIndex) const
+{
+	return lookup(it.p)->discretePDF(lightIndex);
+}
+
+//------------------------------------------AliasTable-------------------------------------
+
+AliasTable::AliasTable(const Float* f, int n) : func(f, f + n), bins(n)
+{
+	// Compute integral of step function and the probability of each bin,
+	// uniform if the function is zero everywhere
+	double sum = 0;
+	for (int i = 0; i < n; ++i)
+		sum += func[i];
+	funcInt = Float(sum / n);
+	for (int i = 0; i < n; ++i)
+		bins[i].p = (sum > 0) ? Float(func[i] / sum) : 0;
+
+	// Split the bins by their probability relative to the average 1/n.
+	// Work in double precision so that the excess pushed between bins
+	// does not accumulate round-off.
+	struct Outcome
+	{
+		double pHat;
+		int index;
+	};
+	std::vector<Outcome> under, over;
+	for (int i = 0; i < n; ++i)
+	{
+		double pHat = (sum > 0) ? func[i] / sum * n : 1;
+		if (pHat < 1)
+			under.push_back({ pHat, i });
+		else
+			over.push_back({ pHat, i });
+	}
+
+	// Fill every underfull bin up to 1/n with an overfull one
+	while (!under.empty() && !over.empty())
+	{
+		Outcome un = under.back(), ov = over.back();
+		under.pop_back();
+		over.pop_back();
+
+		bins[un.index].q = Float(un.pHat);
+		bins[un.index].alias = ov.index;
+
+		double pExcess = un.pHat + ov.pHat - 1;
+		if (pExcess < 1)
+			under.push_back({ pExcess, ov.index });
+		else
+			over.push_back({ pExcess, ov.index });
+	}
+
+	// The bins left over are full up to round-off
+	while (!over.empty())
+	{
+		bins[over.back().index].q = 1;
+		bins[over.back().index].alias = -1;
+		over.pop_back();
+	}
+	while (!under.empty())
+	{
+		bins[under.back().index].q = 1;
+		bins[under.back().index].alias = -1;
+		under.pop_back();
+	}
+}
+
+AliasTable2D::AliasTable2D(const Float* func, int nu, int nv)
+{
+	// Compute conditional sampling distribution for each row
+	pConditionalV.reserve(nv);
+	for (int v = 0; v < nv; ++v)
+		pConditionalV.emplace_back(new AliasTable(&func[v * nu], nu));
+
+	// Compute marginal sampling distribution over the rows
+	std::vector<Float> marginalFunc;
+	marginalFunc.reserve(nv);
+	for (int v = 0; v < nv; ++v)
+		marginalFunc.push_back(pConditionalV[v]->funcInt);
+	pMarginal.reset(new AliasTable(&marginalFunc[0], nv));
 }
 
+//------------------------------------------UniformLightDistribution-------------------------------------
+
 UniformLightDistribution::UniformLightDistribution(const Scene& scene)
 {
 	std::vector<Float> prob(scene.m_lights.size(), Float(1));
 	distrib.reset(new Distribution1D(&prob[0], int(prob.size())));
+	aliasTable.reset(new AliasTable(&prob[0], int(prob.size())));
 }
 
 const Distribution1D* UniformLightDistribution::lookup(const Vector3f& p) const
@@ -41,4 +143,495 @@ const Distribution1D* UniformLightDistribution::lookup(const Vector3f& p) const
 	return distrib.get();
 }
 
+int UniformLightDistribution::sample(const Interaction& it, Float u, Float& pmf) const
+{
+	return aliasTable->sampleDiscrete(u, &pmf);
+}
+
+Float UniformLightDistribution::pmf(const Interaction& it, int lightIndex) const
+{
+	return aliasTable->discretePDF(lightIndex);
+}
+
+//------------------------------------------PowerLightDistribution-------------------------------------
+
+PowerLightDistribution::PowerLightDistribution(const Scene& scene)
+{
+	if (scene.m_lights.empty())
+		return;
+	std::vector<Float> lightPower;
+	for (const auto& light : scene.m_lights)
+		lightPower.push_back(light->power().y());
+	distrib.reset(new Distribution1D(&lightPower[0], int(lightPower.size())));
+	aliasTable.reset(new AliasTable(&lightPower[0], int(lightPower.size())));
+}
+
+const Distribution1D* PowerLightDistribution::lookup(const Vector3f& p) const
+{
+	return distrib.get();
+}
+
+int PowerLightDistribution::sample(const Interaction& it, Float u, Float& pmf) const
+{
+	return aliasTable->sampleDiscrete(u, &pmf);
+}
+
+Float PowerLightDistribution::pmf(const Interaction& it, int lightIndex) const
+{
+	return aliasTable->discretePDF(lightIndex);
+}
+
+//------------------------------------------SpatialLightDistribution-------------------------------------
+
+// Voxel coordinates are packed into a uint64_t for hash table lookups;
+// 20 bits are allocated to each coordinate.  invalidPackedPos is an impossible
+// packed coordinate value, which we use to represent an unused hash table entry.
+static const uint64_t invalidPackedPos = 0xffffffffffffffff;
+
+SpatialLightDistribution::SpatialLightDistribution(const Scene& scene, int maxVoxels)
+	: scene(scene)
+{
+	// Compute the number of voxels so that the widest scene bounding box
+	// dimension has maxVoxels voxels and the other dimensions have a number
+	// of voxels so that voxels are roughly cube shaped.
+	Bounds3f b = scene.worldBound();
+	Vector3f diag = b.diagonal();
+	Float bmax = diag[b.maximumExtent()];
+	for (int i = 0; i < 3; ++i)
+	{
+		nVoxels[i] = glm::max(1, int(glm::round(diag[i] / bmax * maxVoxels)));
+		// In the Lookup() method, we require that 20 or fewer bits be
+		// sufficient to represent each coordinate value. It's fairly hard
+		// to imagine that this would ever be a problem.
+		CHECK_LT(nVoxels[i], 1 << 20);
+	}
+
+	hashTableSize = 4 * nVoxels[0] * nVoxels[1] * nVoxels[2];
+	hashTable.reset(new HashEntry[hashTableSize]);
+	for (size_t i = 0; i < hashTableSize; ++i)
+	{
+		hashTable[i].packedPos.store(invalidPackedPos);
+		hashTable[i].distribution.store(nullptr);
+	}
+
+	K_INFO("SpatialLightDistribution: voxel res ({0}, {1}, {2})", nVoxels[0], nVoxels[1], nVoxels[2]);
+}
+
+SpatialLightDistribution::~SpatialLightDistribution()
+{
+	// Gather statistics about how well the computed distributions are across
+	// the buckets.
+	size_t nEntries = 0;
+	for (size_t i = 0; i < hashTableSize; ++i)
+	{
+		HashEntry& entry = hashTable[i];
+		if (entry.distribution.load())
+		{
+			++nEntries;
+			delete entry.distribution.load();
+		}
+	}
+	K_INFO("SpatialLightDistribution: {0} of {1} voxels filled", nEntries, hashTableSize / 4);
+}
+
+const Distribution1D* SpatialLightDistribution::lookup(const Vector3f& p) const
+{
+	// First, compute integer voxel coordinates for the given point |p|
+	// with respect to the overall voxel grid.
+	Vector3f offset = scene.worldBound().offset(p);  // offset in [0,1].
+	Vector3i pi;
+	for (int i = 0; i < 3; ++i)
+		// The clamp should almost never be necessary, but is there to be
+		// robust to computed intersection points being slightly outside
+		// the scene bounds due to floating-point roundoff error.
+		pi[i] = glm::clamp(int(offset[i] * nVoxels[i]), 0, nVoxels[i] - 1);
+
+	// Pack the 3D integer voxel coordinates into a single 64-bit value.
+	uint64_t packedPos = (uint64_t(pi[0]) << 40) | (uint64_t(pi[1]) << 20) | pi[2];
+	CHECK_NE(packedPos, invalidPackedPos);
+
+	// Compute a hash value from the packed voxel coordinates.  We could
+	// just take packedPos mod the hash table size, but since packedPos
+	// isn't necessarily well distributed on its own, it's worthwhile to do
+	// a little work to make sure that its bits values are individually
+	// fairly random. For details of and motivation for the following, see:
+	// http://zimbry.blogspot.ch/2011/09/better-bit-mixing-improving-on.html
+	uint64_t hash = packedPos;
+	hash ^= (hash >> 31);
+	hash *= 0x7fb5d329728ea185;
+	hash ^= (hash >> 27);
+	hash *= 0x81dadef4bc2dd44d;
+	hash ^= (hash >> 33);
+	hash %= hashTableSize;
+
+	// Now, see if the hash table already has an entry for the voxel. We'll
+	// use quadratic probing when the hash table entry is already used for
+	// another value; step stores the square root of the probe step.
+	int step = 1;
+	while (true)
+	{
+		HashEntry& entry = hashTable[hash];
+		// Does the hash table entry at offset |hash| match the current point?
+		uint64_t entryPackedPos = entry.packedPos.load(std::memory_order_acquire);
+		if (entryPackedPos == packedPos)
+		{
+			// Yes! Most of the time, there should already by a light
+			// sampling distribution available.
+			Distribution1D* dist = entry.distribution.load(std::memory_order_acquire);
+			if (dist == nullptr)
+			{
+				// Rarely, another thread will have already done a lookup
+				// at this point, found that there isn't a sampling
+				// distribution, and will already be computing the
+				// distribution for the point.  In this case, we spin until
+				// the sampling distribution is ready.  We assume that this
+				// is a rare case, so don't do anything more sophisticated
+				// than spinning.
+				while ((dist = entry.distribution.load(std::memory_order_acquire)) == nullptr)
+					// spin :-(. If we were fancy, we'd have any threads
+					// that hit this instead help out with computing the
+					// distribution for the voxel...
+					;
+			}
+			// We have a valid sampling distribution.
+			return dist;
+		}
+		else if (entryPackedPos != invalidPackedPos)
+		{
+			// The hash table entry we're checking has already been
+			// allocated for another voxel. Advance to the next entry with
+			// quadratic probing.
+			hash += step * step;
+			if (hash >= hashTableSize)
+				hash %= hashTableSize;
+			++step;
+		}
+		else
+		{
+			// We have found an invalid entry. (Though this may have
+			// changed by the time we execute the code below.)
+			// Try to claim this entry for the current position.
+			uint64_t invalid = invalidPackedPos;
+			if (entry.packedPos.compare_exchange_weak(invalid, packedPos))
+			{
+				// Success; we've claimed this position for this voxel's
+				// distribution. Now compute the sampling distribution and
+				// add it to the hash table. As long as packedPos has been
+				// set but the entry's distribution pointer is nullptr, any
+				// other threads looking up the distribution for this voxel
+				// will spin wait until the distribution pointer is
+				// written.
+				Distribution1D* dist = computeDistribution(pi);
+				entry.distribution.store(dist, std::memory_order_release);
+				return dist;
+			}
+		}
+	}
+}
+
+Distribution1D* SpatialLightDistribution::computeDistribution(const Vector3i& pi) const
+{
+	// Compute the world-space bounding box of the voxel corresponding to
+	// |pi|.
+	Vector3f p0(Float(pi[0]) / Float(nVoxels[0]),
+		Float(pi[1]) / Float(nVoxels[1]),
+		Float(pi[2]) / Float(nVoxels[2]));
+	Vector3f p1(Float(pi[0] + 1) / Float(nVoxels[0]),
+		Float(pi[1] + 1) / Float(nVoxels[1]),
+		Float(pi[2] + 1) / Float(nVoxels[2]));
+	Bounds3f voxelBounds(scene.worldBound().lerp(p0), scene.worldBound().lerp(p1));
+
+	// Compute the sampling distribution. Sample a number of points inside
+	// voxelBounds using a 3D Halton sequence; at each one, sample each
+	// light source and compute a weight based on Li/pdf for the light's
+	// sample (ignoring visibility between the point in the voxel and the
+	// point on the light source) as an approximation to how much the light
+	// is likely to contribute to illumination in the voxel.
+	const int nSamples = 128;
+	std::vector<Float> lightContrib(scene.m_lights.size(), Float(0));
+	for (int i = 0; i < nSamples; ++i)
+	{
+		Vector3f po = voxelBounds.lerp(Vector3f(
+			radicalInverse(0, i), radicalInverse(1, i), radicalInverse(2, i)));
+		Interaction intr(po);
+
+		// Use the next two Halton dimensions to sample a point on the
+		// light source.
+		Vector2f u(radicalInverse(3, i), radicalInverse(4, i));
+		for (size_t j = 0; j < scene.m_lights.size(); ++j)
+		{
+			Float pdf;
+			Vector3f wi;
+			VisibilityTester vis;
+			Spectrum Li = scene.m_lights[j]->sample_Li(intr, u, wi, pdf, vis);
+			if (pdf > 0)
+			{
+				// Note: no shadow rays are traced here, a light behind a wall
+				//       gets the same weight as an unoccluded one
+				lightContrib[j] += Li.y() / pdf;
+			}
+		}
+	}
+
+	// We don't want to leave any lights with a zero probability; it's
+	// possible that a light contributes to points in the voxel even though
+	// we didn't find such a point when sampling above.  Therefore, compute
+	// a minimum (small) weight and ensure that all lights are given at
+	// least the corresponding probability.
+	Float sumContrib = std::accumulate(lightContrib.begin(), lightContrib.end(), Float(0));
+	Float avgContrib = sumContrib / (nSamples * lightContrib.size());
+	Float minContrib = (avgContrib > 0) ? .001 * avgContrib : 1;
+	for (size_t i = 0; i < lightContrib.size(); ++i)
+		lightContrib[i] = glm::max(lightContrib[i], minContrib);
+
+	// Compute a sampling distribution from the accumulated contributions.
+	return new Distribution1D(&lightContrib[0], int(lightContrib.size()));
+}
+
+//------------------------------------------BVHLightDistribution-------------------------------------
+
+// Split cost of the lights in _lb_: their power times the area of their bounds
+// times a measure of the solid angle they emit into, with the same
+// regularization for thin bounds as the SAH splits of BVHAccel
+static Float evaluateLightSplitCost(const LightBounds& lb, const Bounds3f& bounds, int dim)
+{
+	Float thetaO = glm::acos(glm::clamp(lb.m_cosThetaO, Float(-1), Float(1)));
+	Float thetaE = glm::acos(glm::clamp(lb.m_cosThetaE, Float(-1), Float(1)));
+	Float thetaW = glm::min(thetaO + thetaE, Float(Pi));
+	Float sinThetaO = glm::sqrt(glm::max(Float(0), 1 - lb.m_cosThetaO * lb.m_cosThetaO));
+	Float mOmega = 2 * Pi * (1 - lb.m_cosThetaO) + Pi / 2 * (2 * thetaW * sinThetaO
+		- glm::cos(thetaO - 2 * thetaW) - 2 * thetaO * sinThetaO + lb.m_cosThetaO);
+
+	Vector3f diag = bounds.diagonal();
+	Float kr = maxComponent(diag) / diag[dim];
+	return lb.m_phi * mOmega * kr * lb.m_bounds.surfaceArea();
+}
+
+BVHLightDistribution::BVHLightDistribution(const Scene& scene)
+	: m_lightToNode(scene.m_lights.size(), -1)
+{
+	auto startTime = std::chrono::steady_clock::now();
+
+	// Lights that emit nothing are left out, they can never be chosen
+	std::vector<std::pair<int, LightBounds>> bvhLights;
+	for (size_t i = 0; i < scene.m_lights.size(); ++i)
+	{
+		LightBounds lb;
+		if (!scene.m_lights[i]->bounds(lb))
+			m_infiniteLights.push_back(int(i));
+		else if (lb.m_phi > 0)
+			bvhLights.push_back(std::make_pair(int(i), lb));
+	}
+
+	if (!bvhLights.empty())
+	{
+		m_nodes.reserve(2 * bvhLights.size() - 1);
+		buildBVH(bvhLights, 0, int(bvhLights.size()), -1, 0);
+	}
+
+	double buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	K_INFO("[BVHLightDistribution] Lights: {0} bounded, {1} unbounded, nodes: {2}, build time: {3:.2f} ms",
+		bvhLights.size(), m_infiniteLights.size(), m_nodes.size(), buildTime);
+}
+
+int BVHLightDistribution::buildBVH(std::vector<std::pair<int, LightBounds>>& bvhLights, int start, int end,
+	int parent, int depth)
+{
+	DCHECK(start < end);
+
+	// Create leaf for a single light
+	if (end - start == 1)
+	{
+		int nodeIndex = int(m_nodes.size());
+		int lightIndex = bvhLights[start].first;
+		m_nodes.push_back({ bvhLights[start].second, lightIndex, parent, true });
+		m_lightToNode[lightIndex] = nodeIndex;
+		return nodeIndex;
+	}
+
+	Bounds3f bounds, centroidBounds;
+	for (int i = start; i < end; ++i)
+	{
+		const LightBounds& lb = bvhLights[i].second;
+		bounds = unionBounds(bounds, lb.m_bounds);
+		centroidBounds = unionBounds(centroidBounds, lb.centroid());
+	}
+
+	// Find the cheapest split between buckets of light centroids
+	constexpr int nBuckets = 12;
+	auto bucketOf = [&](const LightBounds& lb, int dim)
+	{
+		int b = int(nBuckets * centroidBounds.offset(lb.centroid())[dim]);
+		return glm::clamp(b, 0, nBuckets - 1);
+	};
+
+	// Note: lopsided splits can chain deep into the tree, below _maxSplitDepth_
+	//       the lights are halved by count so that the recursion stays bounded
+	constexpr int maxSplitDepth = 64;
+	Float minCost = Infinity;
+	int minCostSplitBucket = -1, minCostSplitDim = -1;
+	for (int dim = 0; depth < maxSplitDepth && dim < 3; ++dim)
+	{
+		if (centroidBounds.m_pMax[dim] == centroidBounds.m_pMin[dim])
+			continue;
+
+		LightBounds bucketLightBounds[nBuckets];
+		for (int i = start; i < end; ++i)
+		{
+			const LightBounds& lb = bvhLights[i].second;
+			int b = bucketOf(lb, dim);
+			bucketLightBounds[b] = unionLightBounds(bucketLightBounds[b], lb);
+		}
+
+		for (int i = 0; i < nBuckets - 1; ++i)
+		{
+			LightBounds b0, b1;
+			for (int j = 0; j <= i; ++j)
+				b0 = unionLightBounds(b0, bucketLightBounds[j]);
+			for (int j = i + 1; j < nBuckets; ++j)
+				b1 = unionLightBounds(b1, bucketLightBounds[j]);
+
+			Float cost = evaluateLightSplitCost(b0, bounds, dim) + evaluateLightSplitCost(b1, bounds, dim);
+			if (cost > 0 && cost < minCost)
+			{
+				minCost = cost;
+				minCostSplitBucket = i;
+				minCostSplitDim = dim;
+			}
+		}
+	}
+
+	// Partition the lights, halving the range if the split does not separate them
+	int mid = (start + end) / 2;
+	if (minCostSplitDim != -1)
+	{
+		auto midIter = std::partition(bvhLights.begin() + start, bvhLights.begin() + end,
+			[&](const std::pair<int, LightBounds>& light)
+			{
+				return bucketOf(light.second, minCostSplitDim) <= minCostSplitBucket;
+			});
+		int splitMid = int(midIter - bvhLights.begin());
+		if (splitMid != start && splitMid != end)
+			mid = splitMid;
+	}
+	else if (depth >= maxSplitDepth)
+	{
+		int dim = maxDimension(centroidBounds.diagonal());
+		std::nth_element(bvhLights.begin() + start, bvhLights.begin() + mid, bvhLights.begin() + end,
+			[dim](const std::pair<int, LightBounds>& a, const std::pair<int, LightBounds>& b)
+			{
+				return a.second.centroid()[dim] < b.second.centroid()[dim];
+			});
+	}
+
+	// The first child directly follows its parent
+	int nodeIndex = int(m_nodes.size());
+	m_nodes.push_back(LightBVHNode());
+	buildBVH(bvhLights, start, mid, nodeIndex, depth + 1);
+	int secondChild = buildBVH(bvhLights, mid, end, nodeIndex, depth + 1);
+
+	LightBVHNode& node = m_nodes[nodeIndex];
+	node.m_lightBounds = unionLightBounds(m_nodes[nodeIndex + 1].m_lightBounds, m_nodes[secondChild].m_lightBounds);
+	node.m_childOrLightIndex = secondChild;
+	node.m_parent = parent;
+	node.m_isLeaf = false;
+	return nodeIndex;
+}
+
+Float BVHLightDistribution::probInfinite() const
+{
+	if (m_infiniteLights.empty())
+		return 0;
+	return Float(m_infiniteLights.size()) / Float(m_infiniteLights.size() + (m_nodes.empty() ? 0 : 1));
+}
+
+int BVHLightDistribution::sample(const Interaction& it, Float u, Float& pmf) const
+{
+	// Choose between the unbounded lights and the tree
+	Float pInfinite = probInfinite();
+	if (u < pInfinite)
+	{
+		int count = int(m_infiniteLights.size());
+		int index = glm::min(int(u / pInfinite * count), count - 1);
+		pmf = pInfinite / count;
+		return m_infiniteLights[index];
+	}
+
+	pmf = 0;
+	if (m_nodes.empty())
+		return -1;
+
+	// Walk down the tree, reusing _u_ for every choice
+	u = glm::min((u - pInfinite) / (1 - pInfinite), aOneMinusEpsilon);
+	Float nodePmf = 1 - pInfinite;
+	int nodeIndex = 0;
+	while (true)
+	{
+		const LightBVHNode& node = m_nodes[nodeIndex];
+		if (node.m_isLeaf)
+		{
+			// Below the root both children had some importance, so only a lone light can miss _it_
+			if (nodeIndex > 0 || node.m_lightBounds.importance(it.p, it.normal) > 0)
+			{
+				pmf = nodePmf;
+				return node.m_childOrLightIndex;
+			}
+			return -1;
+		}
+
+		Float c0 = m_nodes[nodeIndex + 1].m_lightBounds.importance(it.p, it.normal);
+		Float c1 = m_nodes[node.m_childOrLightIndex].m_lightBounds.importance(it.p, it.normal);
+		if (c0 == 0 && c1 == 0)
+			return -1;
+
+		Float p0 = c0 / (c0 + c1);
+		if (u < p0)
+		{
+			u = glm::min(u / p0, aOneMinusEpsilon);
+			nodePmf *= p0;
+			nodeIndex = nodeIndex + 1;
+		}
+		else
+		{
+			u = glm::min((u - p0) / (1 - p0), aOneMinusEpsilon);
+			nodePmf *= 1 - p0;
+			nodeIndex = node.m_childOrLightIndex;
+		}
+	}
+}
+
+Float BVHLightDistribution::pmf(const Interaction& it, int lightIndex) const
+{
+	DCHECK(lightIndex >= 0 && lightIndex < (int)m_lightToNode.size());
+
+	// Unbounded lights, and lights that emit nothing
+	int nodeIndex = m_lightToNode[lightIndex];
+	if (nodeIndex < 0)
+	{
+		if (std::find(m_infiniteLights.begin(), m_infiniteLights.end(), lightIndex) == m_infiniteLights.end())
+			return 0;
+		return probInfinite() / m_infiniteLights.size();
+	}
+
+	// A lone light is not chosen where it cannot contribute
+	if (nodeIndex == 0 && m_nodes[0].m_lightBounds.importance(it.p, it.normal) == 0)
+		return 0;
+
+	// Walk up from the leaf, multiplying the probabilities of the choices made on the way down
+	Float pmf = 1 - probInfinite();
+	while (nodeIndex > 0)
+	{
+		int parentIndex = m_nodes[nodeIndex].m_parent;
+		const LightBVHNode& parent = m_nodes[parentIndex];
+		Float c0 = m_nodes[parentIndex + 1].m_lightBounds.importance(it.p, it.normal);
+		Float c1 = m_nodes[parent.m_childOrLightIndex].m_lightBounds.importance(it.p, it.normal);
+		if (c0 == 0 && c1 == 0)
+			return 0;
+
+		pmf *= (nodeIndex == parentIndex + 1 ? c0 : c1) / (c0 + c1);
+		nodeIndex = parentIndex;
+	}
+	return pmf;
+}
+
 RENDER_END
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "Rendering.h"
+#include "Light.h"
 #include "../Math/KMathUtil.h"
+#include "../Math/Rng.h"
+
+#include <atomic>
 
 RENDER_BEGIN
 
@@ -89,6 +93,109 @@ public:
 	Float funcInt;
 };
 
+// Same distribution as Distribution1D, sampled in constant time with
+// Walker's alias method instead of a binary search over the CDF: _u_
+// picks a bin, and the bin holds its own index or its alias. Unlike the
+// CDF inversion the mapping from _u_ is not monotonic, so stratification
+// of _u_ does not carry over to the sampled values.
+class AliasTable
+{
+public:
+	AliasTable(const Float* f, int n);
+
+	int count() const
+	{
+		return (int)func.size();
+	}
+
+	Float sampleContinuous(Float u, Float* pdf, int* off = nullptr) const
+	{
+		Float du;
+		int offset = sampleDiscrete(u, nullptr, &du);
+		if (off)
+			*off = offset;
+
+		// Compute PDF for sampled offset
+		if (pdf)
+			*pdf = (funcInt > 0) ? func[offset] / funcInt : 0;
+
+		return (offset + du) / count();
+	}
+
+	int sampleDiscrete(Float u, Float* pdf = nullptr, Float* uRemapped = nullptr) const
+	{
+		// Pick a bin uniformly, then the bin or its alias with the rest of _u_
+		int n = count();
+		int offset = glm::min(int(u * n), n - 1);
+		Float up = glm::min(u * n - offset, aOneMinusEpsilon);
+		const Bin& bin = bins[offset];
+
+		if (up < bin.q)
+		{
+			if (uRemapped)
+				*uRemapped = glm::min(up / bin.q, aOneMinusEpsilon);
+		}
+		else
+		{
+			if (uRemapped)
+				*uRemapped = glm::min((up - bin.q) / (1 - bin.q), aOneMinusEpsilon);
+			offset = bin.alias;
+		}
+
+		if (pdf)
+			*pdf = bins[offset].p;
+		return offset;
+	}
+
+	Float discretePDF(int index) const
+	{
+		DCHECK(index >= 0 && index < count());
+		return bins[index].p;
+	}
+
+	struct Bin
+	{
+		// Probability of keeping the bin, probability of the bin itself, and its alias
+		Float q, p;
+		int alias;
+	};
+
+	std::vector<Float> func;
+	std::vector<Bin> bins;
+	Float funcInt;
+};
+
+// Piecewise constant 2D distribution over [0,1]^2 with _nu_ x _nv_ cells
+// stored row by row: v is drawn from the marginal over the rows, u from the
+// conditional distribution of that row. Meant for importance sampling
+// image-based lights.
+class AliasTable2D
+{
+public:
+	AliasTable2D(const Float* func, int nu, int nv);
+
+	Vector2f sampleContinuous(const Vector2f& u, Float* pdf) const
+	{
+		Float pdfs[2];
+		int v;
+		Float d1 = pMarginal->sampleContinuous(u[1], &pdfs[1], &v);
+		Float d0 = pConditionalV[v]->sampleContinuous(u[0], &pdfs[0]);
+		*pdf = pdfs[0] * pdfs[1];
+		return Vector2f(d0, d1);
+	}
+
+	Float pdf(const Vector2f& p) const
+	{
+		int iu = glm::clamp(int(p[0] * pConditionalV[0]->count()), 0, pConditionalV[0]->count() - 1);
+		int iv = glm::clamp(int(p[1] * pMarginal->count()), 0, pMarginal->count() - 1);
+		return (pMarginal->funcInt > 0) ? pConditionalV[iv]->func[iu] / pMarginal->funcInt : 0;
+	}
+
+private:
+	std::vector<std::unique_ptr<AliasTable>> pConditionalV;
+	std::unique_ptr<AliasTable> pMarginal;
+};
+
 //LightDistribution defines a general interface for classes that provide
 // probability distributions for sampling light sources at a given point in
 // space.
@@ -99,7 +206,16 @@ public:
 
 	// Given a point |p| in space, this method returns a (hopefully
 	// effective) sampling distribution for light sources at that point.
+	// Distributions that only pick lights through sample() return nullptr.
 	virtual const Distribution1D* lookup(const Vector3f& p) const = 0;
+
+	// Choose a light for the shading point |it| with the sample |u|: returns
+	// its index in scene.m_lights and its probability in |pmf|, or -1 if no
+	// light can reach |it|. The default draws from lookup(it.p).
+	virtual int sample(const Interaction& it, Float u, Float& pmf) const;
+
+	// Probability that sample() chooses light |lightIndex| at |it|.
+	virtual Float pmf(const Interaction& it, int lightIndex) const;
 };
 
 // The simplest possible implementation of LightDistribution: this returns
@@ -117,8 +233,109 @@ public:
 
 	virtual const Distribution1D* lookup(const Vector3f& p) const override;
 
+	// Draw from the alias table of the same distribution
+	virtual int sample(const Interaction& it, Float u, Float& pmf) const override;
+	virtual Float pmf(const Interaction& it, int lightIndex) const override;
+
+private:
+	std::unique_ptr<Distribution1D> distrib;
+	std::unique_ptr<AliasTable> aliasTable;
+};
+
+// Samples lights with probability proportional to their emitted power, ignoring the point.
+class PowerLightDistribution : public LightDistribution
+{
+public:
+
+	PowerLightDistribution(const Scene& scene);
+
+	virtual const Distribution1D* lookup(const Vector3f& p) const override;
+
+	// Draw from the alias table of the same distribution
+	virtual int sample(const Interaction& it, Float u, Float& pmf) const override;
+	virtual Float pmf(const Interaction& it, int lightIndex) const override;
+
 private:
 	std::unique_ptr<Distribution1D> distrib;
+	std::unique_ptr<AliasTable> aliasTable;
+};
+
+// A spatially-varying light distribution that adjusts the probability of
+// sampling a light source based on an estimate of its contribution to a
+// region of space. A fixed voxel grid is imposed over the scene bounds
+// and a sampling distribution is computed as needed for each voxel.
+class SpatialLightDistribution : public LightDistribution
+{
+public:
+
+	SpatialLightDistribution(const Scene& scene, int maxVoxels = 64);
+	~SpatialLightDistribution();
+
+	virtual const Distribution1D* lookup(const Vector3f& p) const override;
+
+private:
+	// Compute the sampling distribution for the voxel with integer
+	// coordinates given by "pi".
+	Distribution1D* computeDistribution(const Vector3i& pi) const;
+
+	const Scene& scene;
+	int nVoxels[3];
+
+	// The hash table is a fixed number of HashEntry structs (where we
+	// allocate more than enough entries in the SpatialLightDistribution
+	// constructor). During rendering, the table is allocated without
+	// locks, using atomic operations. (See the Lookup() method
+	// implementation for details.)
+	struct HashEntry
+	{
+		std::atomic<uint64_t> packedPos;
+		std::atomic<Distribution1D*> distribution;
+	};
+	mutable std::unique_ptr<HashEntry[]> hashTable;
+	size_t hashTableSize;
+};
+
+// Bounding volume hierarchy over the bounded lights, each node stores the
+// power, bounds and normal cone of its lights. sample() walks down from the
+// root picking a child in proportion to its LightBounds::importance at the
+// shading point, so lights that cannot reach it are never chosen and a light
+// is found in O(log N). Lights without bounds are chosen uniformly, with the
+// same probability as the whole tree.
+class BVHLightDistribution : public LightDistribution
+{
+public:
+
+	BVHLightDistribution(const Scene& scene);
+
+	virtual const Distribution1D* lookup(const Vector3f& p) const override { return nullptr; }
+
+	virtual int sample(const Interaction& it, Float u, Float& pmf) const override;
+
+	virtual Float pmf(const Interaction& it, int lightIndex) const override;
+
+private:
+	struct LightBVHNode
+	{
+		LightBounds m_lightBounds;
+		// Second child of interior nodes, the first one directly follows
+		// the node, or index in scene.m_lights for leaves
+		int m_childOrLightIndex;
+		int m_parent;
+		bool m_isLeaf;
+	};
+
+	// Build the subtree over m_bvhLights[start, end) below _parent_ (-1 for the root).
+	// Returns the root node index of the subtree.
+	int buildBVH(std::vector<std::pair<int, LightBounds>>& bvhLights, int start, int end,
+		int parent, int depth);
+
+	// Probability of choosing between the bounded lights and the others
+	Float probInfinite() const;
+
+	std::vector<LightBVHNode> m_nodes;
+	std::vector<int> m_infiniteLights;
+	// Leaf node of each light, -1 for lights not in the tree
+	std::vector<int> m_lightToNode;
 };
 
 std::unique_ptr<LightDistribution> createLightSampleDistribution(
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Rendering.h"
+#include "../Math/KMathUtil.h"
+#include "../Math/Rng.h"
+
+#include <vector>
+
+RENDER_BEGIN
+
+// Prime bases of the Halton sequence, one per dimension
+static constexpr int PrimeTableSize = 1000;
+extern const int Primes[PrimeTableSize];
+// Sum of the first i primes, where the digit permutation of dimension i starts
+extern const int PrimeSums[PrimeTableSize];
+
+// Generator matrices of the Sobol sequence, _SobolMatrixSize_ column vectors per dimension
+static constexpr int NumSobolDimensions = 1024;
+static constexpr int SobolMatrixSize = 32;
+extern const uint32_t SobolMatrices32[NumSobolDimensions * SobolMatrixSize];
+
+// Mirror the digits of _a_ in base Primes[baseIndex] around the radix point
+Float radicalInverse(int baseIndex, uint64_t a);
+
+// Same as radicalInverse with every digit, including the infinite trailing zeros, mapped through _perm_
+Float scrambledRadicalInverse(int baseIndex, uint64_t a, const uint16_t* perm);
+
+// Random digit permutations of all prime bases, the one of base index i starts at PrimeSums[i]
+std::vector<uint16_t> computeRadicalInversePermutations(Rng& rng);
+
+// Index whose radical inverse has _inverse_ as its first _nDigits_ digits
+template <int base>
+inline uint64_t inverseRadicalInverse(uint64_t inverse, int nDigits)
+{
+	uint64_t index = 0;
+	for (int i = 0; i < nDigits; ++i)
+	{
+		uint64_t digit = inverse % base;
+		inverse /= base;
+		index = index * base + digit;
+	}
+	return index;
+}
+
+inline uint32_t reverseBits32(uint32_t n)
+{
+	n = (n << 16) | (n >> 16);
+	n = ((n & 0x00ff00ff) << 8) | ((n & 0xff00ff00) >> 8);
+	n = ((n & 0x0f0f0f0f) << 4) | ((n & 0xf0f0f0f0) >> 4);
+	n = ((n & 0x33333333) << 2) | ((n & 0xcccccccc) >> 2);
+	n = ((n & 0x55555555) << 1) | ((n & 0xaaaaaaaa) >> 1);
+	return n;
+}
+
+inline uint64_t reverseBits64(uint64_t n)
+{
+	uint64_t n0 = reverseBits32((uint32_t)n);
+	uint64_t n1 = reverseBits32((uint32_t)(n >> 32));
+	return (n0 << 32) | n1;
+}
+
+// Component _dimension_ of the Sobol point _a_, digitally shifted by xor with _scramble_
+inline Float sobolSample(int64_t a, int dimension, uint32_t scramble = 0)
+{
+	DCHECK(dimension < NumSobolDimensions);
+	uint32_t v = scramble;
+	for (int i = dimension * SobolMatrixSize; a != 0; a >>= 1, ++i)
+	{
+		if (a & 1)
+			v ^= SobolMatrices32[i];
+	}
+	return glm::min(v * Float(2.3283064365386963e-10), aOneMinusEpsilon);
+}
+
+// Shuffle _count_ groups of _nDimensions_ consecutive values
+template <typename T>
+void shuffle(T* samples, int count, int nDimensions, Rng& rng)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		int other = i + rng.uniformUInt32(count - i);
+		for (int j = 0; j < nDimensions; ++j)
+			std::swap(samples[nDimensions * i + j], samples[nDimensions * other + j]);
+	}
+}
+
+// Scrambled (0,2)-sequence points for _nPixelSamples_ pixel samples of _nSamplesPerPixelSample_ points each,
+// both counts must be powers of two
+void vanDerCorput(int nSamplesPerPixelSample, int nPixelSamples, Float* samples, Rng& rng);
+void sobol2D(int nSamplesPerPixelSample, int nPixelSamples, Vector2f* samples, Rng& rng);
+
+RENDER_END
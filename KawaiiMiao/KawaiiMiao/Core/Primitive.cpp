@@ -1,6 +1,7 @@
 #include "Primitive.h"
 
 #include "Interaction.h"
+#include "../Shapes/TriangleShape.h"
 
 RENDER_BEGIN
 
@@ -27,6 +28,25 @@ bool PrimitiveObject::hit(const Ray& ray, SurfaceInteraction& isect) const
 	return true;
 }
 
+bool PrimitiveObject::hit(const Ray& ray, HitRecord& record) const
+{
+	Float tHit;
+	if (!m_shape->hit(ray, tHit, record.m_barycentric))
+		return false;
+
+	ray.m_tMax = tHit;
+	record.m_t = tHit;
+	record.m_primitive = this;
+	record.m_triangle = -1;
+	return true;
+}
+
+void PrimitiveObject::fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const
+{
+	m_shape->fillSurfaceInteraction(ray, record.m_t, record.m_barycentric, isect);
+	isect.primitive = this;
+}
+
 void PrimitiveObject::computeScatteringFunctions(SurfaceInteraction& isect, MemoryArena& arena,
 	TransportMode mode, bool allowMultipleLobes) const
 {
@@ -44,7 +64,192 @@ const AreaLight* PrimitiveObject::getAreaLight() const { return m_areaLight.get(
 
 const Material* PrimitiveObject::getMaterial() const { return m_material; }
 
+// ------------------------ Mesh ---------------------------------
+MeshPrimitive::MeshPrimitive(const TriangleMesh* mesh, const Material* material)
+	: m_mesh(mesh), m_material(material)
+{
+	for (int i = 0; i < numTriangles(); ++i)
+		m_bounds = unionBounds(m_bounds, m_mesh->triangleBound(i));
+}
+
+int MeshPrimitive::numTriangles() const { return (int)m_mesh->numTriangles(); }
+
+bool MeshPrimitive::hitTriangle(int triangle, const Ray& ray) const
+{
+	return m_mesh->hitTriangle(triangle, ray);
+}
+
+bool MeshPrimitive::hitTriangle(int triangle, const Ray& ray, HitRecord& record) const
+{
+	Float tHit;
+	if (!m_mesh->hitTriangle(triangle, ray, tHit, record.m_barycentric))
+		return false;
+
+	ray.m_tMax = tHit;
+	record.m_t = tHit;
+	record.m_primitive = this;
+	record.m_triangle = triangle;
+	return true;
+}
+
+bool MeshPrimitive::hit(const Ray& ray) const
+{
+	for (int i = 0; i < numTriangles(); ++i)
+	{
+		if (hitTriangle(i, ray))
+			return true;
+	}
+	return false;
+}
+
+bool MeshPrimitive::hit(const Ray& ray, SurfaceInteraction& isect) const
+{
+	HitRecord record;
+	if (!hit(ray, record))
+		return false;
+
+	fillSurfaceInteraction(ray, record, isect);
+	return true;
+}
+
+bool MeshPrimitive::hit(const Ray& ray, HitRecord& record) const
+{
+	bool hit = false;
+	for (int i = 0; i < numTriangles(); ++i)
+	{
+		if (hitTriangle(i, ray, record))
+			hit = true;
+	}
+	return hit;
+}
+
+void MeshPrimitive::fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const
+{
+	m_mesh->fillTriangleInteraction(record.m_triangle, ray, record.m_barycentric, nullptr, isect);
+	isect.primitive = this;
+}
+
+void MeshPrimitive::computeScatteringFunctions(SurfaceInteraction& isect, MemoryArena& arena,
+	TransportMode mode, bool allowMultipleLobes) const
+{
+	if (m_material != nullptr)
+	{
+		m_material->computeScatteringFunctions(isect, arena, mode, allowMultipleLobes);
+	}
+}
+
+// ------------------------ Instance ---------------------------------
+PrimitiveInstance::PrimitiveInstance(const Primitive::ptr& object, const Transform& instanceToWorld,
+	const Material* material)
+	: m_object(object), m_instanceToWorld(instanceToWorld), m_worldToInstance(inverse(instanceToWorld)),
+	m_material(material) {}
+
+Bounds3f PrimitiveInstance::worldBound() const { return m_instanceToWorld(m_object->worldBound()); }
+
+Ray PrimitiveInstance::toObject(const Ray& ray, Float& tScale) const
+{
+	Vector3f dir = m_worldToInstance(ray.m_dir, 0.0f);
+	tScale = length(dir);
+	return Ray(m_worldToInstance(ray.m_origin, 1.0f), dir, ray.m_tMax * tScale, ray.m_time, ray.m_medium);
+}
+
+bool PrimitiveInstance::hit(const Ray& ray) const
+{
+	Float tScale;
+	return m_object->hit(toObject(ray, tScale));
+}
+
+bool PrimitiveInstance::hit(const Ray& ray, SurfaceInteraction& isect) const
+{
+	HitRecord record;
+	if (!hit(ray, record))
+		return false;
+
+	fillSurfaceInteraction(ray, record, isect);
+	return true;
+}
+
+bool PrimitiveInstance::hit(const Ray& ray, HitRecord& record) const
+{
+	Float tScale;
+	Ray objectRay = toObject(ray, tScale);
+	HitRecord objectRecord;
+	if (!m_object->hit(objectRay, objectRecord))
+		return false;
+
+	ray.m_tMax = objectRecord.m_t / tScale;
+	record.m_t = ray.m_tMax;
+	record.m_barycentric = objectRecord.m_barycentric;
+	record.m_primitive = this;
+	record.m_instanced = objectRecord.m_primitive;
+	record.m_triangle = objectRecord.m_triangle;
+	return true;
+}
+
+void PrimitiveInstance::fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const
+{
+	Float tScale;
+	Ray objectRay = toObject(ray, tScale);
+	HitRecord objectRecord = record;
+	objectRecord.m_t = record.m_t * tScale;
+	objectRecord.m_primitive = record.m_instanced;
+	objectRecord.m_instanced = nullptr;
+
+	SurfaceInteraction objectIsect;
+	record.m_instanced->fillSurfaceInteraction(objectRay, objectRecord, objectIsect);
+	isect = m_instanceToWorld(objectIsect);
+	isect.primitive = this;
+}
+
+const AreaLight* PrimitiveInstance::getAreaLight() const { return nullptr; }
+
+const Material* PrimitiveInstance::getMaterial() const { return m_material; }
+
+void PrimitiveInstance::computeScatteringFunctions(SurfaceInteraction& isect, MemoryArena& arena,
+	TransportMode mode, bool allowMultipleLobes) const
+{
+	if (m_material != nullptr)
+	{
+		m_material->computeScatteringFunctions(isect, arena, mode, allowMultipleLobes);
+	}
+}
+
 // ------------------------ Aggregate ---------------------------------
+bool PrimitiveAggregate::hit(const Ray& ray, SurfaceInteraction& isect) const
+{
+	HitRecord record;
+	if (!hit(ray, record))
+		return false;
+
+	fillSurfaceInteraction(ray, record, isect);
+	return true;
+}
+
+void HitBatch::reset(int n)
+{
+	m_records.assign(n, HitRecord());
+	m_found.assign(n, 0);
+}
+
+void PrimitiveAggregate::hitN(const RayBatch& rays, HitBatch& hits) const
+{
+	hits.reset(rays.size());
+	for (int i = 0; i < rays.size(); ++i)
+		hits.m_found[i] = hit(rays.m_rays[i], hits.m_records[i]);
+}
+
+void PrimitiveAggregate::occludedN(const RayBatch& rays, HitBatch& hits) const
+{
+	hits.reset(rays.size());
+	for (int i = 0; i < rays.size(); ++i)
+		hits.m_found[i] = hit(rays.m_rays[i]);
+}
+
+void PrimitiveAggregate::fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const
+{
+	record.m_primitive->fillSurfaceInteraction(ray, record, isect);
+}
+
 const AreaLight* PrimitiveAggregate::getAreaLight() const { return nullptr; }
 
 const Material* PrimitiveAggregate::getMaterial() const { return nullptr; }
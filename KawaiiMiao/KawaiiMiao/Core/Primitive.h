@@ -8,6 +8,44 @@
 
 RENDER_BEGIN
 
+class Primitive;
+class TriangleMesh;
+
+// Minimal result of a closest-hit query: distance, the hit primitive and the barycentrics of
+// a triangle hit. Differentials, normals and uv are left to fillSurfaceInteraction.
+struct HitRecord
+{
+	Float m_t = Infinity;
+	const Primitive* m_primitive = nullptr;
+	Vector3f m_barycentric;
+	// Primitive hit inside an instance, _m_primitive_ is then the instance itself
+	const Primitive* m_instanced = nullptr;
+	// Triangle hit on a MeshPrimitive
+	int m_triangle = -1;
+};
+
+// Rays traced together by PrimitiveAggregate::hitN and occludedN, e.g. the camera rays of a pixel.
+// Note: as with single rays, _m_tMax_ of every ray is shortened to its closest hit.
+struct RayBatch
+{
+	std::vector<Ray> m_rays;
+
+	int size() const { return (int)m_rays.size(); }
+	void clear() { m_rays.clear(); }
+	void push(const Ray& ray) { m_rays.push_back(ray); }
+};
+
+// Results of a RayBatch, one entry per ray. For hitN _m_found_ tells whether the closest hit
+// in _m_records_ exists, for occludedN whether the ray is occluded (the records stay untouched).
+struct HitBatch
+{
+	std::vector<HitRecord> m_records;
+	std::vector<uint8_t> m_found;
+
+	// Reset to _n_ entries without hits
+	void reset(int n);
+};
+
 // The abstract Primitive base class is the bridge between the geometry processing and shading subsystems
 class Primitive : public AObject
 {
@@ -20,6 +58,11 @@ public:
 	virtual bool hit(const Ray & ray) const = 0;
 	virtual bool hit(const Ray & ray, SurfaceInteraction & iset) const = 0;
 
+	// Closest-hit query that only fills in _record_, for callers that rarely need the surface
+	virtual bool hit(const Ray & ray, HitRecord & record) const = 0;
+	// Compute the SurfaceInteraction of a hit found by the query above
+	virtual void fillSurfaceInteraction(const Ray & ray, const HitRecord & record, SurfaceInteraction & isect) const = 0;
+
 	// Return a box that encloses the primitive geometry in world space.
 	virtual Bounds3f worldBound() const = 0;
 
@@ -42,6 +85,8 @@ public:
 	virtual Bounds3f worldBound() const;
 	virtual bool hit(const Ray& ray) const override;
 	virtual bool hit(const Ray& ray, SurfaceInteraction& iset) const override;
+	virtual bool hit(const Ray& ray, HitRecord& record) const override;
+	virtual void fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const override;
 
 	Shape* getShape() const;
 
@@ -60,9 +105,97 @@ private:
 	const Material* m_material;
 };
 
+// All triangles of a TriangleMesh with one material, instead of a TriangleShape and a PrimitiveObject
+// per triangle. Aggregates expand it into one PrimitiveTable entry per triangle and test those with
+// hitTriangle, a HitRecord on it names the triangle in _m_triangle_.
+// Note: emissive meshes keep their per triangle primitives, since every triangle is a light to sample.
+class MeshPrimitive : public Primitive
+{
+public:
+	typedef std::shared_ptr<MeshPrimitive> ptr;
+
+	MeshPrimitive(const TriangleMesh* mesh, const Material* material);
+
+	virtual Bounds3f worldBound() const override { return m_bounds; }
+
+	// Loop over all triangles, only used outside of an aggregate
+	virtual bool hit(const Ray& ray) const override;
+	virtual bool hit(const Ray& ray, SurfaceInteraction& isect) const override;
+	virtual bool hit(const Ray& ray, HitRecord& record) const override;
+	virtual void fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const override;
+
+	// Tests of a single triangle, the closest-hit one shortens _ray.m_tMax_ and fills _record_
+	bool hitTriangle(int triangle, const Ray& ray) const;
+	bool hitTriangle(int triangle, const Ray& ray, HitRecord& record) const;
+
+	const TriangleMesh* getMesh() const { return m_mesh; }
+	int numTriangles() const;
+
+	virtual const AreaLight* getAreaLight() const override { return nullptr; }
+	virtual const Material* getMaterial() const override { return m_material; }
+
+	virtual void computeScatteringFunctions(SurfaceInteraction& isect, MemoryArena& arena,
+		TransportMode mode, bool allowMultipleLobes) const override;
+
+	virtual std::string toString() const override { return "MeshPrimitive[]"; }
+
+private:
+	const TriangleMesh* m_mesh;
+	const Material* m_material;
+	Bounds3f m_bounds;
+};
+
+// A shared aggregate placed in the world by its own transform. Rays are moved into the
+// object space of the aggregate, so any number of instances reuse one acceleration structure.
+// Note: the material of the instance overrides the one of the instanced primitives,
+//       area lights are not supported since light sampling needs world space shapes.
+class PrimitiveInstance : public Primitive
+{
+public:
+	typedef std::shared_ptr<PrimitiveInstance> ptr;
+
+	PrimitiveInstance(const Primitive::ptr& object, const Transform& instanceToWorld, const Material* material);
+
+	virtual Bounds3f worldBound() const override;
+	virtual bool hit(const Ray& ray) const override;
+	virtual bool hit(const Ray& ray, SurfaceInteraction& isect) const override;
+	virtual bool hit(const Ray& ray, HitRecord& record) const override;
+	virtual void fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const override;
+
+	virtual const AreaLight* getAreaLight() const override;
+	virtual const Material* getMaterial() const override;
+
+	virtual void computeScatteringFunctions(SurfaceInteraction& isect, MemoryArena& arena,
+		TransportMode mode, bool allowMultipleLobes) const override;
+
+	virtual std::string toString() const override { return "PrimitiveInstance[]"; }
+
+private:
+	// Ray directions are kept normalized, so distances along _objectRay_ are the world ones times _tScale_
+	Ray toObject(const Ray& ray, Float& tScale) const;
+
+	Primitive::ptr m_object;
+	Transform m_instanceToWorld, m_worldToInstance;
+	const Material* m_material;
+};
+
 class PrimitiveAggregate : public Primitive
 {
 public:
+	typedef std::shared_ptr<PrimitiveAggregate> ptr;
+
+	// Aggregates only keep a HitRecord during traversal and complete
+	// the SurfaceInteraction once for the closest hit
+	using Primitive::hit;
+	virtual bool hit(const Ray& ray, SurfaceInteraction& isect) const override;
+
+	// Batched queries, the default traces the rays one by one
+	virtual void hitN(const RayBatch& rays, HitBatch& hits) const;
+	virtual void occludedN(const RayBatch& rays, HitBatch& hits) const;
+
+	// Forwarded to the primitive that was hit
+	virtual void fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const override;
+
 	virtual const AreaLight* getAreaLight() const override;
 	virtual const Material* getMaterial() const override;
 
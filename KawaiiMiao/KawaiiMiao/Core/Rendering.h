@@ -75,7 +75,10 @@ class Transform;
 class Integrator;
 class CameraSample;
 class RGBSpectrum;
+class SampledSpectrum;
+class SampledWavelengths;
 class Distribution1D;
+class LightDistribution;
 class VisibilityTester;
 class MemoryArena;
 class MediumInteraction;
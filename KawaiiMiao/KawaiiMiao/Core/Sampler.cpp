@@ -1,6 +1,7 @@
 #include "Sampler.h"
 
 #include "Camera.h"
+#include "../Math/Rng.h"
 
 RENDER_BEGIN
 
@@ -25,6 +26,11 @@ CameraSample Sampler::getCameraSample(const Vector2i& pRaster)
 	return cs;
 }
 
+uint64_t Sampler::pixelHash(const Vector2i& p)
+{
+	return mixBits(((uint64_t)(uint32_t)p.x << 32) | (uint32_t)p.y);
+}
+
 void Sampler::startPixel(const Vector2i& p)
 {
 	m_currentPixel = p;
@@ -80,5 +86,80 @@ const Vector2f* Sampler::get2DArray(int n)
 	return &m_sampleArray2D[m_array2DOffset++][m_currentPixelSampleIndex * n];
 }
 
+int64_t Sampler::roundUpSampleCount(int64_t samplesPerPixel, const std::string& name)
+{
+	if (isPowerOf2(samplesPerPixel))
+		return samplesPerPixel;
+	int64_t rounded = roundUpPow2(samplesPerPixel);
+	K_WARN("{0} needs a power of two sample count, rounding {1} up to {2}", name, samplesPerPixel, rounded);
+	return rounded;
+}
+
+//------------------------------------------GlobalSampler-------------------------------------
+
+void GlobalSampler::startPixel(const Vector2i& p)
+{
+	Sampler::startPixel(p);
+	m_dimension = 0;
+	m_intervalSampleIndex = getIndexForSample(0);
+	// Compute _m_arrayEndDim_ for dimensions used for array samples
+	m_arrayEndDim = arrayStartDim + (int)m_sampleArray1D.size() + 2 * (int)m_sampleArray2D.size();
+
+	// The i-th array entry of pixel sample s is the point of sample number s * n + i
+	for (size_t i = 0; i < m_samples1DArraySizes.size(); ++i)
+	{
+		int64_t nSamples = m_samples1DArraySizes[i] * samplesPerPixel;
+		for (int64_t j = 0; j < nSamples; ++j)
+		{
+			int64_t index = getIndexForSample(j);
+			m_sampleArray1D[i][j] = sampleDimension(index, arrayStartDim + (int)i);
+		}
+	}
+
+	int dim = arrayStartDim + (int)m_samples1DArraySizes.size();
+	for (size_t i = 0; i < m_samples2DArraySizes.size(); ++i)
+	{
+		int64_t nSamples = m_samples2DArraySizes[i] * samplesPerPixel;
+		for (int64_t j = 0; j < nSamples; ++j)
+		{
+			int64_t index = getIndexForSample(j);
+			m_sampleArray2D[i][j].x = sampleDimension(index, dim);
+			m_sampleArray2D[i][j].y = sampleDimension(index, dim + 1);
+		}
+		dim += 2;
+	}
+	CHECK_EQ(m_arrayEndDim, dim);
+}
+
+bool GlobalSampler::startNextSample()
+{
+	m_dimension = 0;
+	m_intervalSampleIndex = getIndexForSample(m_currentPixelSampleIndex + 1);
+	return Sampler::startNextSample();
+}
+
+bool GlobalSampler::setSampleNumber(int64_t sampleNum)
+{
+	m_dimension = 0;
+	m_intervalSampleIndex = getIndexForSample(sampleNum);
+	return Sampler::setSampleNumber(sampleNum);
+}
+
+Float GlobalSampler::get1D()
+{
+	if (m_dimension >= arrayStartDim && m_dimension < m_arrayEndDim)
+		m_dimension = m_arrayEndDim;
+	return sampleDimension(m_intervalSampleIndex, m_dimension++);
+}
+
+Vector2f GlobalSampler::get2D()
+{
+	if (m_dimension + 1 >= arrayStartDim && m_dimension < m_arrayEndDim)
+		m_dimension = m_arrayEndDim;
+	Vector2f p(sampleDimension(m_intervalSampleIndex, m_dimension),
+		sampleDimension(m_intervalSampleIndex, m_dimension + 1));
+	m_dimension += 2;
+	return p;
+}
 
 RENDER_END
\ No newline at end of file
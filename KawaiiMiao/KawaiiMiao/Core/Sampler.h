@@ -32,6 +32,8 @@ public:
 
 	virtual bool startNextSample();
 
+	// Copy for a thread, _seed_ tells the passes of a progressive render apart.
+	// Random streams are chosen per pixel in startPixel, so they don't depend on the tiles.
 	virtual std::unique_ptr<Sampler> clone(int seed) = 0;
 	virtual bool setSampleNumber(int64_t sampleNum);
 
@@ -44,6 +46,12 @@ public:
 	virtual ClassType getClassType() const override { return ClassType::RSampler; }
 
 protected:
+	// Round _samplesPerPixel_ up to a power of two for the samplers that need it
+	static int64_t roundUpSampleCount(int64_t samplesPerPixel, const std::string& name);
+
+	// Well mixed key of the pixel _p_
+	static uint64_t pixelHash(const Vector2i& p);
+
 	Vector2f m_currentPixel;
 	int64_t m_currentPixelSampleIndex;
 	std::vector<int> m_samples1DArraySizes, m_samples2DArraySizes;
@@ -54,5 +62,32 @@ private:
 	size_t m_array1DOffset, m_array2DOffset;
 };
 
+// Sampler whose points come from a single sequence, a pixel sample is a point of the sequence
+// and consecutive calls to get1D/get2D consume consecutive dimensions of it.
+// The sample arrays take the dimensions after the camera sample.
+class GlobalSampler : public Sampler
+{
+public:
+	GlobalSampler(int64_t samplesPerPixel) : Sampler(samplesPerPixel) {}
+
+	virtual void startPixel(const Vector2i& p) override;
+	virtual bool startNextSample() override;
+	virtual bool setSampleNumber(int64_t sampleNum) override;
+	virtual Float get1D() override;
+	virtual Vector2f get2D() override;
+
+	// Index in the sequence of the _sampleNum_-th sample of the current pixel
+	virtual int64_t getIndexForSample(int64_t sampleNum) = 0;
+
+	// Component _dimension_ of the point _index_, dimensions 0 and 1 are the offset in the current pixel
+	virtual Float sampleDimension(int64_t index, int dimension) const = 0;
+
+private:
+	int m_dimension;
+	int64_t m_intervalSampleIndex;
+	static const int arrayStartDim = 5;
+	int m_arrayEndDim;
+};
+
 
 RENDER_END
\ No newline at end of file
@@ -12,6 +12,26 @@ bool Scene::hit(const Ray& ray, SurfaceInteraction& isect) const
 	return m_aggreShape->hit(ray, isect);
 }
 
+bool Scene::hit(const Ray& ray, HitRecord& record) const
+{
+	return m_aggreShape->hit(ray, record);
+}
+
+void Scene::fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const
+{
+	m_aggreShape->fillSurfaceInteraction(ray, record, isect);
+}
+
+void Scene::hitN(const RayBatch& rays, HitBatch& hits) const
+{
+	m_aggreShape->hitN(rays, hits);
+}
+
+void Scene::occludedN(const RayBatch& rays, HitBatch& hits) const
+{
+	m_aggreShape->occludedN(rays, hits);
+}
+
 bool Scene::hitTr(Ray ray, Sampler& sampler, SurfaceInteraction& isect, Spectrum& Tr) const
 {
 	Tr = Spectrum(1.f);
@@ -31,6 +31,12 @@ public:
 
 	bool hit(const Ray& ray) const;
 	bool hit(const Ray& ray, SurfaceInteraction& isect) const;
+	// Closest hit without the surface, see fillSurfaceInteraction to complete it
+	bool hit(const Ray& ray, HitRecord& record) const;
+	void fillSurfaceInteraction(const Ray& ray, const HitRecord& record, SurfaceInteraction& isect) const;
+	// Batched forms of the closest hit and the any hit query, for coherent rays
+	void hitN(const RayBatch& rays, HitBatch& hits) const;
+	void occludedN(const RayBatch& rays, HitBatch& hits) const;
 	bool hitTr(Ray ray, Sampler& sampler, SurfaceInteraction& isect, Spectrum& transmittance) const;
 
 	std::vector<Light::ptr> m_lights;
@@ -10,6 +10,7 @@
 #include "Light.h"
 #include "Entity.h"
 #include "../Accelerators/KDTree.h"
+#include "../Accelerators/BVH.h"
 
 #include "../Tool/Logger.h"
 
@@ -160,8 +161,66 @@ void SceneParser::parser(const std::string& path, Scene::ptr& _scene, Integrator
 		}
 	}
 
-	KdTree::ptr _aggregate = std::make_shared<KdTree>(_Primitives);
-	//ALinearAggregate::ptr _aggregate = std::make_shared<ALinearAggregate>(_Primitives);
+	//Accelerator loading
+	PrimitiveAggregate::ptr _aggregate = nullptr;
+	{
+		// Note: BVH is the default aggregate when the scene file does not specify one
+		std::string acceleratorType = "BVH";
+		APropertyTreeNode acceleratorNode("Accelerator");
+		if (_scene_json.contains("Accelerator"))
+		{
+			acceleratorNode = build_property_tree_func("Accelerator", _scene_json["Accelerator"]);
+			acceleratorType = acceleratorNode.getPropertyList().getString("Type", acceleratorType);
+		}
+
+		const APropertyList& props = acceleratorNode.getPropertyList();
+		auto buildKdTree = [&]()
+		{
+			return std::make_shared<KdTree>(_Primitives,
+				props.getInteger("IsectCost", 80),
+				props.getInteger("TraversalCost", 1),
+				props.getFloat("EmptyBonus", 0.5f),
+				props.getInteger("MaxPrims", 1),
+				props.getInteger("MaxDepth", -1));
+		};
+		auto buildBVH = [&]()
+		{
+			return std::make_shared<BVHAccel>(_Primitives,
+				props.getInteger("MaxPrimsInNode", 4),
+				BVHAccel::toSplitMethod(props.getString("SplitMethod", "SAH")),
+				props.getBoolean("Wide", true));
+		};
+
+		KdTree::ptr kdTree = nullptr;
+		BVHAccel::ptr bvh = nullptr;
+		if (acceleratorType == "KdTree")
+		{
+			_aggregate = kdTree = buildKdTree();
+		}
+		else
+		{
+			if (acceleratorType != "BVH")
+			{
+				K_WARN("Accelerator \"{0}\" unknown. Using \"BVH\".", acceleratorType);
+			}
+			_aggregate = bvh = buildBVH();
+		}
+
+		// Note: the other aggregate is only built for the statistics and released right away
+		if (props.getBoolean("CompareBuild", false))
+		{
+			if (kdTree == nullptr)
+				kdTree = buildKdTree();
+			if (bvh == nullptr)
+				bvh = buildBVH();
+			K_INFO("[Accelerator] Build time: BVH {0:.2f} ms, kd-tree {1:.2f} ms ({2:.2f}x); "
+				"node memory: BVH {3:.2f} KB, kd-tree {4:.2f} KB ({5:.2f}x)",
+				bvh->buildTime(), kdTree->buildTime(), bvh->buildTime() / glm::max(kdTree->buildTime(), 1e-3),
+				bvh->nodeMemory() / 1024.0, kdTree->nodeMemory() / 1024.0,
+				(double)bvh->nodeMemory() / glm::max(kdTree->nodeMemory(), (size_t)1));
+		}
+	}
+
 	_scene = std::make_shared<Scene>(_entities, _aggregate, _lights);
 }
 
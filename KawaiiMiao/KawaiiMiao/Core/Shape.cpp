@@ -20,8 +20,18 @@ Shape::Shape(Transform* objectToWorld, Transform* worldToObject)
 bool Shape::hit(const Ray& ray) const
 {
 	Float tHit = ray.m_tMax;
-	SurfaceInteraction isect;
-	return hit(ray, tHit, isect);
+	Vector3f barycentric;
+	return hit(ray, tHit, barycentric);
+}
+
+bool Shape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const
+{
+	Vector3f barycentric;
+	if (!hit(ray, tHit, barycentric))
+		return false;
+
+	fillSurfaceInteraction(ray, tHit, barycentric, isect);
+	return true;
 }
 
 Bounds3f Shape::worldBound() const
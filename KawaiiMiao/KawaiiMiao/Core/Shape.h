@@ -33,7 +33,13 @@ public:
 	virtual bool hit(const Ray& ray) const;
 	// Intersection function, fill in SurfaceInteraction data
 	// Almost all calculations for the intersection of shape and ray are performed by converting ray into object space
-	virtual bool hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const = 0;
+	virtual bool hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const;
+
+	// Closest-hit test that only reports the hit distance and, for triangles, the barycentrics
+	virtual bool hit(const Ray& ray, Float& tHit, Vector3f& barycentric) const = 0;
+	// Complete a hit found by the test above, computing differentials, normals and uv
+	virtual void fillSurfaceInteraction(const Ray& ray, Float tHit, const Vector3f& barycentric,
+		SurfaceInteraction& isect) const = 0;
 
 	virtual Float area() const = 0;
 
@@ -54,6 +60,9 @@ public:
 	// used in this case.
 	virtual Float solidAngle(const Vector3f& p, int nSamples = 512) const;
 
+	// Directions of the surface normals that sample() may return
+	virtual DirectionCone normalBounds() const { return DirectionCone::entireSphere(); }
+
 	virtual ClassType getClassType() const override { return ClassType::RShape; }
 
 public:
@@ -0,0 +1,4106 @@
+#include "LowDiscrepancy.h"
+
+RENDER_BEGIN
+
+// Generator matrices of the first 1024 dimensions of the Sobol sequence, as column vectors of
+// 32 bit integers; derived from the direction numbers of Joe and Kuo, new-joe-kuo-6.21201
+const uint32_t SobolMatrices32[NumSobolDimensions * SobolMatrixSize] = {
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+	0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+	0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+	0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+	0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+	0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+	0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x5c000000, 0x8e000000, 0xc5000000,
+	0x68800000, 0x9cc00000, 0xee600000, 0x55900000, 0x80680000, 0xc09c0000, 0x60ee0000, 0x90550000,
+	0xe8808000, 0x5cc0c000, 0x8e606000, 0xc5909000, 0x6868e800, 0x9c9c5c00, 0xeeee8e00, 0x5555c500,
+	0x8000e880, 0xc0005cc0, 0x60008e60, 0x9000c590, 0xe8006868, 0x5c009c9c, 0x8e00eeee, 0xc5005555,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0x74000000, 0xa2000000, 0x93000000,
+	0xd8800000, 0x25400000, 0x59e00000, 0xe6d00000, 0x78080000, 0xb40c0000, 0x82020000, 0xc3050000,
+	0x208f8000, 0x51474000, 0xfbea2000, 0x75d93000, 0xa0858800, 0x914e5400, 0xdbe79e00, 0x25db6d00,
+	0x58800080, 0xe54000c0, 0x79e00020, 0xb6d00050, 0x800800f8, 0xc00c0074, 0x200200a2, 0x50050093,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xf8000000, 0xdc000000, 0x7a000000, 0x9d000000,
+	0x5a800000, 0x2fc00000, 0xa1600000, 0xf0b00000, 0xda880000, 0x6fc40000, 0x81620000, 0x40bb0000,
+	0x22878000, 0xb3c9c000, 0xfb65a000, 0xddb2d000, 0x78022800, 0x9c0b3c00, 0x5a0fb600, 0x2d0ddb00,
+	0xa2878080, 0xf3c9c040, 0xdb65a020, 0x6db2d0b0, 0x800228f8, 0x400b3cdc, 0x200fb67a, 0xb00ddb9d,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xc8000000, 0x24000000, 0x56000000, 0xfb000000,
+	0xe0800000, 0x70400000, 0xa8600000, 0x14300000, 0x9ec80000, 0xdf240000, 0xb6d60000, 0x8bbb0000,
+	0x48008000, 0x64004000, 0x36006000, 0xcb003000, 0x2880c800, 0x54402400, 0xfe605600, 0xef30fb00,
+	0x7e48e080, 0xaf647040, 0x1eb6a860, 0x9f8b1430, 0xd6c81ec8, 0xbb249f24, 0x80d6d6d6, 0x40bbbbbb,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x94000000, 0x3e000000, 0xe3000000,
+	0xbe800000, 0x23c00000, 0x1e200000, 0xf3100000, 0x46780000, 0x67840000, 0x78460000, 0x84670000,
+	0xc6788000, 0xa784c000, 0xd846a000, 0x5467d000, 0x9e78d800, 0x33845400, 0xe6469e00, 0xb7673300,
+	0x20f86680, 0x104477c0, 0xf8668020, 0x4477c010, 0x668020f8, 0x77c01044, 0x8020f866, 0xc0104477,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x88000000, 0x24000000, 0x12000000, 0x2d000000,
+	0x76800000, 0x9e400000, 0x08200000, 0x64100000, 0xb2280000, 0x7d140000, 0xfea20000, 0xba490000,
+	0x1a248000, 0x491b4000, 0xc4b5a000, 0xe3739000, 0xf6800800, 0xde400400, 0xa8200a00, 0x34100500,
+	0x3a280880, 0x59140240, 0xeca20120, 0x974902d0, 0x6ca48768, 0xd75b49e4, 0xcc95a082, 0x87639641,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x28000000, 0xd4000000, 0x6a000000, 0x71000000,
+	0x38800000, 0x58400000, 0xea200000, 0x31100000, 0x98a80000, 0x08540000, 0xc22a0000, 0xe5250000,
+	0xf2b28000, 0x79484000, 0xfaa42000, 0xbd731000, 0x18a80800, 0x48540400, 0x622a0a00, 0xb5250500,
+	0xdab28280, 0xad484d40, 0x90a426a0, 0xcc731710, 0x20280b88, 0x10140184, 0x880a04a2, 0x84350611,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x98000000, 0x94000000, 0x8a000000, 0x5b000000,
+	0x33800000, 0xd9c00000, 0x72200000, 0x3f100000, 0xc1b80000, 0xa6ec0000, 0x53860000, 0x29f50000,
+	0x0a3a8000, 0x1b2ac000, 0xd392e000, 0x69ff7000, 0xea380800, 0xab2c0400, 0x4ba60e00, 0xfde50b00,
+	0x60028980, 0xf006c940, 0x7834e8a0, 0x241a75b0, 0x123a8b38, 0xcf2ac99c, 0xb992e922, 0x82ff78f1,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x08000000, 0x6c000000, 0x9e000000, 0x23000000,
+	0x57800000, 0xadc00000, 0x7fa00000, 0x91d00000, 0x49880000, 0xced40000, 0x880a0000, 0x2c0f0000,
+	0x3e0d8000, 0x3317c000, 0x5fb06000, 0xc1f8b000, 0xe18d8800, 0xb2d7c400, 0x1e106a00, 0x6328b100,
+	0xf7858880, 0xbdc3c2c0, 0x77ba63e0, 0xfdf7b330, 0xd7800df8, 0xedc0081c, 0xdfa0041a, 0x81d00a2d,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x58000000, 0xac000000, 0x96000000, 0x2b000000,
+	0xd4800000, 0x09400000, 0xe2a00000, 0x52500000, 0x4e280000, 0xc71c0000, 0x629e0000, 0x12670000,
+	0x6e138000, 0xf731c000, 0x3a98a000, 0xbe449000, 0xf83b8800, 0xdc2dc400, 0xee06a200, 0xb7239300,
+	0x1aa80d80, 0x8e5c0ec0, 0xa03e0b60, 0x703701b0, 0x783b88c8, 0x9c2dca54, 0xce06a74a, 0x87239795,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xf8000000, 0x8c000000, 0xe2000000, 0x33000000,
+	0x0f800000, 0x21400000, 0x95a00000, 0x5e700000, 0xd8080000, 0x1c240000, 0xba160000, 0xef370000,
+	0x15868000, 0x9e6fc000, 0x781b6000, 0x4c349000, 0x420e8800, 0x630bcc00, 0xf7ad6a00, 0xad739500,
+	0x77800780, 0x6d4004c0, 0xd7a00420, 0x3d700630, 0x2f880f78, 0xb1640ad4, 0xcdb6077a, 0x824706d7,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x38000000, 0xc4000000, 0x42000000, 0xa3000000,
+	0xf1800000, 0xaa400000, 0xfce00000, 0x85100000, 0xe0080000, 0x500c0000, 0x58060000, 0x54090000,
+	0x7a038000, 0x670c4000, 0xb3842000, 0x094a3000, 0x0d6f1800, 0x2f5aa400, 0x1ce7ce00, 0xd5145100,
+	0xb8000080, 0x040000c0, 0x22000060, 0x33000090, 0xc9800038, 0x6e4000c4, 0xbee00042, 0x261000a3,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0x54000000, 0x9a000000, 0x9d000000,
+	0x1e800000, 0x5cc00000, 0x7d200000, 0x8d100000, 0x24880000, 0x71c40000, 0xeba20000, 0x75df0000,
+	0x6ba28000, 0x35d14000, 0x4ba3a000, 0xc5d2d000, 0xe3a16800, 0x91db8c00, 0x79aef200, 0x0cdf4100,
+	0x672a8080, 0x50154040, 0x1a01a020, 0xdd0dd0f0, 0x3e83e8a8, 0xaccacc54, 0xd52d529a, 0xd91d919d,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0xc4000000, 0x46000000, 0x85000000,
+	0xa5800000, 0x76c00000, 0xada00000, 0x6ab00000, 0x2da80000, 0xaabc0000, 0x0daa0000, 0x7ab10000,
+	0xd5a78000, 0xbebd4000, 0x93a3e000, 0x3bb51000, 0x3629b800, 0x4d727c00, 0x9b836200, 0x27c4d700,
+	0xb629b880, 0x8d727cc0, 0xbb836220, 0xf7c4d7d0, 0x6e29b858, 0x49727c04, 0xfd836266, 0x72c4d755,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0x14000000, 0xf6000000, 0x67000000,
+	0x8f800000, 0x50400000, 0x8aa00000, 0x0ff00000, 0x12a80000, 0xabf40000, 0xfcaa0000, 0x28fb0000,
+	0xbd298000, 0x0bba4000, 0x4e06e000, 0x330c3000, 0x59861800, 0xc74d3400, 0x3d2cb200, 0x4bb2cb00,
+	0x6e061880, 0xc30d3440, 0x618cb220, 0xd342cbf0, 0xcb2e18b8, 0x2cb93454, 0xe186b2d6, 0x9349cb97,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0x64000000, 0x36000000, 0x6d000000,
+	0x41800000, 0xe0400000, 0xd2e00000, 0x9bf00000, 0x0ce80000, 0x52fc0000, 0x5b6a0000, 0x2fb30000,
+	0xa00c8000, 0x30054000, 0x4807e000, 0x940f9000, 0x5e01f800, 0x090e9400, 0x778a5600, 0x8d416b00,
+	0x9369f880, 0x7bb294c0, 0xde005620, 0xc9026bf0, 0x578d78e8, 0x7d4bd4a4, 0xfb6db616, 0x1fbefb9d,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0xf4000000, 0xae000000, 0xbb000000,
+	0xe7800000, 0x95c00000, 0x1c200000, 0xd0300000, 0xdba80000, 0x55f40000, 0xff820000, 0x21c10000,
+	0x12238000, 0x3b3a4000, 0xa42b6000, 0x3430f000, 0x4da69800, 0x4af3ec00, 0x2e043a00, 0xfb0a1f00,
+	0x47851880, 0xc5c9ac40, 0x842f5aa0, 0x243aef50, 0x75a38018, 0xeefa40b4, 0x180b600e, 0xb400f0eb,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x3c000000, 0xce000000, 0x41000000,
+	0x21800000, 0x51c00000, 0x09600000, 0x85700000, 0xf2780000, 0x8e9c0000, 0x60020000, 0x70030000,
+	0x58038000, 0x8c02c000, 0x7602e000, 0x7d00f000, 0xef833800, 0x10c10400, 0x28e08600, 0xd4b14700,
+	0xfb182580, 0x0bee15c0, 0x9279c9e0, 0xfe9d3a70, 0x38000008, 0xfc00000c, 0x2e00000e, 0xf100000b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x68000000, 0x3c000000, 0x8a000000, 0x51000000,
+	0xa9800000, 0xddc00000, 0x5ba00000, 0x39d00000, 0x95f80000, 0x56d40000, 0x0a020000, 0x91030000,
+	0x49838000, 0x0dc34000, 0x33a1a000, 0x05d0f000, 0x1ffa2800, 0x07d54400, 0xa380a600, 0x4cc07700,
+	0x1222ee80, 0x3413a740, 0xa65bf7e0, 0x5305ab50, 0x15f80008, 0x96d4000c, 0xea02000e, 0x4103000d,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x38000000, 0x8c000000, 0x7e000000, 0x71000000,
+	0xc8800000, 0x04c00000, 0x1ba00000, 0xbb700000, 0x4a980000, 0xc3bc0000, 0xa6020000, 0x6d010000,
+	0xee818000, 0x29c34000, 0x9520e000, 0x42b23000, 0xe7b9f800, 0x0d0dc400, 0x3fb92200, 0x110d1300,
+	0x19bbee80, 0x3c0cadc0, 0x973a4a60, 0xc5cf7ef0, 0x3a180008, 0x0b7c0004, 0xa3a20006, 0x7771000d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x08000000, 0x64000000, 0x6a000000, 0x89000000,
+	0xa5800000, 0xcb400000, 0x18200000, 0xad900000, 0xaf880000, 0x72f40000, 0x25820000, 0x0b430000,
+	0xb8228000, 0x3d924000, 0xa7882000, 0x16f59000, 0x4f83a800, 0x82412400, 0x1da01600, 0xf6d16d00,
+	0xbfa84080, 0xbb672640, 0xe0091620, 0xf0b4efd0, 0x38228008, 0xfd92400c, 0x0788200a, 0x86f59009,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x48000000, 0x8c000000, 0xd6000000, 0x39000000,
+	0xd5800000, 0x32400000, 0xb2a00000, 0x72100000, 0x53d80000, 0x82cc0000, 0xcb820000, 0x47430000,
+	0x91208000, 0xa9534000, 0x7cf92000, 0x4e9e3000, 0xfcf95800, 0x8e9fe400, 0xdcf9d600, 0x5e9c8900,
+	0x94f96a80, 0xd29fb840, 0x42f9b760, 0xeb9c9f30, 0x97788008, 0xd9df400c, 0x25db2002, 0xabcd300d,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xd8000000, 0xf4000000, 0x3e000000, 0x95000000,
+	0x8f800000, 0x3d400000, 0xf3200000, 0x2ef00000, 0xadc80000, 0x0a0c0000, 0x8b220000, 0x4af30000,
+	0x6bc88000, 0x3b0d4000, 0xe2a16000, 0x16b0d000, 0x29687800, 0xbdbf1400, 0x33cb5e00, 0x0f0c2500,
+	0xfca1b480, 0xd3b0afc0, 0x7eeb6920, 0x74fe4d30, 0xfee87808, 0xb4ff140c, 0xdeeb5e02, 0xe4fc2505,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x98000000, 0xa4000000, 0x7a000000, 0xd5000000,
+	0x02800000, 0x60400000, 0x51e00000, 0x88700000, 0x8c280000, 0x47c40000, 0x0be20000, 0xad710000,
+	0xb6aa8000, 0x3386c000, 0xb8006000, 0x54039000, 0x42036800, 0xc1019400, 0xe0826a00, 0x11431100,
+	0x2960af80, 0x3d3175c0, 0xdf4a3aa0, 0xaff49e10, 0xd62b6808, 0x62c59404, 0x31606a0a, 0xd932110b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x18000000, 0x34000000, 0x8a000000, 0x9d000000,
+	0x67800000, 0x82400000, 0x40e00000, 0x60f00000, 0x91480000, 0x29440000, 0x2d620000, 0xbfb30000,
+	0x162a8000, 0xfbf4c000, 0xe4ca6000, 0xc207d000, 0x2002a800, 0xf001b400, 0xb8037e00, 0x04021900,
+	0x92034b80, 0xa90327c0, 0xed81f320, 0x1f40d810, 0x27602808, 0xe2b1740c, 0xd1ab1e0a, 0x49b6c903,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x08000000, 0x4c000000, 0x02000000, 0xb5000000,
+	0x36800000, 0xc2c00000, 0x14200000, 0x07500000, 0x1bf80000, 0x50340000, 0x48a20000, 0xac910000,
+	0xd35b8000, 0xbca74000, 0x7bfa2000, 0xc0343000, 0xa0a18800, 0x30909400, 0xd95b7a00, 0x45a57b00,
+	0x4f7a7880, 0xb7f6f940, 0x82013de0, 0xf502dfd0, 0xd6820808, 0x12c3d404, 0x1c235a0e, 0x4b504b0d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x68000000, 0x4c000000, 0x76000000, 0xf7000000,
+	0x36800000, 0xd7400000, 0x87e00000, 0xef300000, 0xa3a80000, 0xd5440000, 0x23aa0000, 0x15470000,
+	0xc3a98000, 0x45464000, 0xaba82000, 0x09477000, 0xdda9f800, 0xfe44ac00, 0xeb292200, 0x2907f100,
+	0x6ccb3d80, 0xc6344dc0, 0xcf61b320, 0x137318d0, 0xeccb3d88, 0x06344dcc, 0x2f61b32e, 0x437318d5,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0xc8000000, 0x74000000, 0x52000000, 0x03000000,
+	0xeb800000, 0x6f400000, 0x64600000, 0xdaf00000, 0x17980000, 0x297c0000, 0xa59a0000, 0xfa7d0000,
+	0xe61b8000, 0x713f4000, 0x1878a000, 0xdcce9000, 0xb661e800, 0x99f29c00, 0x9c184600, 0xd63e2100,
+	0x09fa5780, 0x548e0ac0, 0xa380a9e0, 0x5b413f30, 0x56625788, 0x49f20ac4, 0x341aa9e6, 0x323c3f39,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xb8000000, 0x04000000, 0x6e000000, 0x97000000,
+	0xf2800000, 0xedc00000, 0x13600000, 0x5c900000, 0xdb580000, 0x31e40000, 0x09da0000, 0xcc270000,
+	0x02b88000, 0x44b44000, 0x0fe26000, 0xe6505000, 0x9ab9d800, 0x50b50c00, 0x79e29200, 0xa552fb00,
+	0xbe38bf80, 0x2e77d940, 0xf6000ae0, 0x830112d0, 0x84803f88, 0xaec3994c, 0x37e26aea, 0x225142dd,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x68000000, 0xec000000, 0x22000000, 0x2b000000,
+	0x36800000, 0x9d400000, 0x6a200000, 0x16700000, 0x4de80000, 0x330c0000, 0x936a0000, 0x824f0000,
+	0x3b498000, 0x8f3fc000, 0x28202000, 0xcd707000, 0xf36aa800, 0x724fdc00, 0xb34bf200, 0x533e6900,
+	0x62207a80, 0x0a7140c0, 0xe7ea6520, 0xc40d90f0, 0xefe9fa88, 0xd80e80cc, 0x45ea452e, 0x2f0de0f3,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x28000000, 0xd4000000, 0x8a000000, 0xff000000,
+	0x84800000, 0x73c00000, 0x13200000, 0xc2b00000, 0xfb380000, 0x361c0000, 0x401a0000, 0xe0af0000,
+	0x11228000, 0x19b3c000, 0xfdb82000, 0x5edf9000, 0x75b88800, 0x7adfac00, 0xf7baba00, 0x61ddf300,
+	0xd1387e80, 0x391e55c0, 0xcc9ba860, 0x776cbeb0, 0xa000f688, 0xf001f9cc, 0x08011262, 0xe4014db3,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xb8000000, 0x84000000, 0x1a000000, 0xaf000000,
+	0xbd800000, 0xdfc00000, 0x14e00000, 0x43500000, 0xda380000, 0x4e1c0000, 0x4cda0000, 0x364d0000,
+	0x29608000, 0xdc904000, 0x6ed86000, 0x5d4f5000, 0x2ee08800, 0xfc51ac00, 0x7fb81e00, 0x45dc8300,
+	0xfa3a4580, 0x5e1d6240, 0x54dbd360, 0xe24ec930, 0x8b62cd88, 0xf790ce44, 0xc959cd6a, 0x2d8f4a35,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x08000000, 0xf4000000, 0xf6000000, 0x8b000000,
+	0xc9800000, 0x55400000, 0x67200000, 0xf3f00000, 0x34780000, 0x57440000, 0x1ada0000, 0xb1f50000,
+	0xa9818000, 0x6540c000, 0x8f23a000, 0x77f21000, 0xca7bf800, 0x2845fc00, 0x255afe00, 0x6fb67900,
+	0x07233a80, 0xc3f25ac0, 0xdc7aed60, 0xd34482d0, 0xe4d94288, 0xcef766c4, 0x9603b36e, 0xbb00ebd7,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x68000000, 0xf4000000, 0x62000000, 0xdf000000,
+	0x79800000, 0xdd400000, 0x76e00000, 0x2cf00000, 0xcfb80000, 0x51ec0000, 0xc8da0000, 0x845d0000,
+	0x9b818000, 0x42434000, 0xef622000, 0x61b19000, 0xd1582800, 0x891cac00, 0x65626e00, 0x0ab10900,
+	0x2adbbd80, 0x1b5d86c0, 0x02014560, 0x0f032470, 0xf1821588, 0xb9426ac4, 0x7ce10b6e, 0x07f3bd79,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x18000000, 0xdc000000, 0x42000000, 0x37000000,
+	0x20800000, 0xf1400000, 0x28600000, 0x94900000, 0x87880000, 0xa83c0000, 0x556a0000, 0xe6ef0000,
+	0xf8038000, 0x4c024000, 0x3a01e000, 0xbb023000, 0x7a816800, 0x1a43ac00, 0x4ae18a00, 0x52d31900,
+	0x8f682380, 0xcded9740, 0xfa80bfa0, 0xda43f2b0, 0x2ae2cb88, 0x02d07b4c, 0x976ad5a6, 0x11eddbb5,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xf8000000, 0x34000000, 0x62000000, 0xf5000000,
+	0xa8800000, 0xfcc00000, 0x8e200000, 0x53f00000, 0xc7780000, 0x95740000, 0xb8020000, 0xd4e50000,
+	0xb2808000, 0xfdc0c000, 0x64a02000, 0xaa30f000, 0x19d8f800, 0x0e443400, 0x935a6200, 0xe761f500,
+	0x657a2880, 0x40913cc0, 0xe0022e20, 0xd0e563f0, 0x08809f78, 0xccc09174, 0x56200202, 0x97f0e5e5,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xf8000000, 0xec000000, 0x7e000000, 0x61000000,
+	0x5c800000, 0xe6c00000, 0xdda00000, 0x2a700000, 0x93380000, 0x13cc0000, 0xd3ce0000, 0x73790000,
+	0x83a08000, 0x7b70c000, 0x97b8a000, 0xe90cf000, 0x886ef800, 0xd409ec00, 0x3218fe00, 0xef7ca100,
+	0xc556fc80, 0x56c516c0, 0x4556a5a0, 0x96c50670, 0xe556cd38, 0x66c542cc, 0x1d56574e, 0x8ac549b9,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x58000000, 0x2c000000, 0x9a000000, 0xf9000000,
+	0x3c800000, 0xb2c00000, 0xad200000, 0x3a300000, 0x89980000, 0x448c0000, 0x2eea0000, 0x6f810000,
+	0xef208000, 0x2f30c000, 0x0f182000, 0xbf4cb000, 0xe74a5800, 0xcb712c00, 0x51981a00, 0xa88c3900,
+	0x94ea1c80, 0x268102c0, 0x8ba07520, 0xb1f0d630, 0x38383398, 0x7c7c0d8c, 0x52524a6a, 0x3d3df141,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xd8000000, 0xac000000, 0x8e000000, 0x09000000,
+	0x9e800000, 0xa1c00000, 0xcaa00000, 0x33700000, 0x95780000, 0x085c0000, 0x24b60000, 0x6a350000,
+	0x43788000, 0x6d5cc000, 0x14362000, 0x72f5b000, 0xcf585800, 0x53ec6c00, 0xc5eeae00, 0x40d9b900,
+	0xe016c680, 0x9045cdc0, 0x6880e4a0, 0x74c04a70, 0x2220f3f8, 0x87b0b59c, 0x9758b816, 0x3fecfc45,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xa8000000, 0x2c000000, 0xa2000000, 0x2d000000,
+	0xda800000, 0xf9400000, 0xec600000, 0x02b00000, 0x3d480000, 0x825c0000, 0x7d4a0000, 0x62610000,
+	0x8dc88000, 0xca1c4000, 0xa1aae000, 0x6891f000, 0x8c602800, 0xb2b06c00, 0x75484200, 0x5e5cdd00,
+	0x774a7280, 0x6361d540, 0xf548ce60, 0x1e5c6fb0, 0x974a07c8, 0x93618b1c, 0x5d48b92a, 0x325c0cd1,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0x7c000000, 0x82000000, 0x4f000000,
+	0xbe800000, 0xedc00000, 0x21600000, 0xab700000, 0x78680000, 0x746c0000, 0x1e9a0000, 0xfdcb0000,
+	0x39088000, 0x2f1cc000, 0x4ef2e000, 0xc5a73000, 0x6d924800, 0xe1d7bc00, 0x4b7ae200, 0x487bbf00,
+	0xbc801680, 0x62c061c0, 0x7fe08b60, 0x76b0a870, 0x91088ce8, 0xa31caaac, 0xe4f2037a, 0xc6a7f47b,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x98000000, 0x2c000000, 0x06000000, 0xcd000000,
+	0x8a800000, 0x1bc00000, 0xffa00000, 0xad500000, 0x7af80000, 0xb3dc0000, 0x5b2e0000, 0x1f290000,
+	0x9d588000, 0xf28cc000, 0x07d62000, 0x71f51000, 0xd4f61800, 0xda65ec00, 0x632ea600, 0xe3291d00,
+	0x2358b280, 0x038ce7c0, 0x135641a0, 0x8b355c50, 0xa7d6ee78, 0xa1f5891c, 0x6cf6880e, 0xe665b4b9,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x98000000, 0x54000000, 0x3a000000, 0x9d000000,
+	0x7e800000, 0x7f400000, 0x17200000, 0xab500000, 0x6df80000, 0x96a40000, 0x83d20000, 0x71e10000,
+	0xc0d88000, 0xe0f44000, 0x30aaa000, 0x08059000, 0xcc2a1800, 0x6e451400, 0xa78a1a00, 0xe3554d00,
+	0x01d2c680, 0x68e1fb40, 0xbc589520, 0xc6b4b250, 0xfb0a1178, 0x1515b0e4, 0xf272c872, 0xb1f12cf1,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x08000000, 0x84000000, 0xb2000000, 0xb9000000,
+	0xbe800000, 0x4fc00000, 0x55600000, 0xf8f00000, 0xac280000, 0x66d40000, 0xb30a0000, 0x8bb50000,
+	0xc7c88000, 0x11e4c000, 0xaa42e000, 0xa591b000, 0xd0ea8800, 0x78854400, 0x6c80d200, 0x86c0c900,
+	0x03e05680, 0x83307bc0, 0x4348ef60, 0xa324c5f0, 0x13a2a0a8, 0x1ba19014, 0x9f22d8ea, 0x2d61fc85,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x78000000, 0x24000000, 0x9e000000, 0x47000000,
+	0x67800000, 0xf7400000, 0xdf200000, 0xb3100000, 0x71680000, 0x8c4c0000, 0x32520000, 0xe5d50000,
+	0xaa528000, 0x31d5c000, 0x2c52e000, 0x62d5f000, 0xadd29800, 0xf695d400, 0x8b720600, 0xf5c59300,
+	0x42ba6180, 0x3dd96440, 0xdea0bea0, 0xe750d750, 0x37c84fc8, 0xbf1c9b1c, 0x839a1d9a, 0x09c94ec9,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x78000000, 0x9c000000, 0xee000000, 0x1b000000,
+	0xcb800000, 0xc3400000, 0xc7a00000, 0x05100000, 0x88680000, 0xc4740000, 0x225a0000, 0x3da10000,
+	0x345a8000, 0x7aa1c000, 0xf1da6000, 0x12e17000, 0x85fa1800, 0x48b1ec00, 0x2432f600, 0x92d5f700,
+	0x45803d80, 0xa8403440, 0x94207a20, 0xea50f150, 0xd9c81248, 0x46648524, 0x8fb24812, 0x21952485,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x58000000, 0x7c000000, 0xc2000000, 0xe1000000,
+	0x0d800000, 0xd7c00000, 0x2aa00000, 0xf5300000, 0x9ba80000, 0xc0f40000, 0x20c60000, 0x702f0000,
+	0x48668000, 0x241f4000, 0xbe4ee000, 0x232b5000, 0xec28b800, 0xda342c00, 0xfde6fa00, 0xdfdf8d00,
+	0x6eee1780, 0x5b1b0ac0, 0xe0000520, 0x500093f0, 0x38008488, 0x6c008e04, 0x9a000bce, 0x9d00d8eb,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xb8000000, 0xac000000, 0x72000000, 0xb1000000,
+	0x03800000, 0xd2c00000, 0xc1600000, 0x9b900000, 0x4e480000, 0x0b740000, 0x864e0000, 0x3f0b0000,
+	0x68068000, 0x447f4000, 0x7648a000, 0xe7747000, 0xd44e9800, 0xbe0b9c00, 0xd3864a00, 0x3abf5d00,
+	0xc528d180, 0xcde413c0, 0x99865ae0, 0x67bfd550, 0x94a8c528, 0x9e24cde4, 0xe3669986, 0x82ef67bf,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x88000000, 0x44000000, 0x4a000000, 0x47000000,
+	0xdd800000, 0x42400000, 0xc3200000, 0x77100000, 0x75b80000, 0x966c0000, 0x715e0000, 0xfc950000,
+	0xa6e68000, 0xd9f9c000, 0x28386000, 0x142cb000, 0x527e6800, 0xfb853400, 0x5b5e4200, 0x0b95c300,
+	0x1366f780, 0xafb9b540, 0x2918f6a0, 0x603cc150, 0xb0469498, 0x68a9927c, 0x34a09b66, 0xc250ebb9,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xd8000000, 0xfc000000, 0xf6000000, 0xd5000000,
+	0xbf800000, 0x2c400000, 0xeee00000, 0x09700000, 0x19080000, 0x21640000, 0xad6a0000, 0xd3130000,
+	0x22828000, 0x9707c000, 0x98e0a000, 0x1c709000, 0x8688f800, 0x5d24ac00, 0x9b8a2e00, 0x26632900,
+	0xcd8ac980, 0x63633940, 0x8a0af160, 0xe323b530, 0x4aea8fe8, 0xc3534414, 0x1a623a62, 0x1b774b77,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x58000000, 0xac000000, 0x6a000000, 0x85000000,
+	0xfb800000, 0xa8c00000, 0x84200000, 0xae300000, 0x4b080000, 0xe0740000, 0x10860000, 0x388f0000,
+	0xfc2e8000, 0x320b4000, 0x2980e000, 0x91c01000, 0x2da03800, 0x7ff0fc00, 0x06a83200, 0xcf842900,
+	0x4e2e9180, 0x5b0b2dc0, 0xd800ffa0, 0xec0046f0, 0x0a00af28, 0xd5001e44, 0xa380038e, 0x04c074fb,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xe8000000, 0x44000000, 0x5e000000, 0xad000000,
+	0xef800000, 0x68400000, 0x84600000, 0xfe500000, 0xfd280000, 0x07f40000, 0x2c620000, 0xda4f0000,
+	0x53068000, 0x12dfc000, 0x6f802000, 0xa8403000, 0x24602800, 0xae501400, 0x15283a00, 0x43f41100,
+	0x72621780, 0x774f2b40, 0xbc86bbe0, 0x7a9fda10, 0xebe00118, 0x56100f94, 0xd948174a, 0xa9a415fd,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x18000000, 0x04000000, 0xda000000, 0x09000000,
+	0x22800000, 0xe8400000, 0xbc600000, 0x0e300000, 0x7b580000, 0x378c0000, 0x14c20000, 0x874d0000,
+	0x99d48000, 0xbfb94000, 0x18802000, 0x91403000, 0xe6e01800, 0x52702c00, 0x05380600, 0x34bc0100,
+	0x971a3680, 0x51810240, 0x13f688a0, 0xde847a10, 0x466c8f18, 0x1745738c, 0x91fa26d6, 0x73f111e3,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x88000000, 0x9c000000, 0x2e000000, 0x05000000,
+	0xab800000, 0x1c400000, 0x6e200000, 0x25100000, 0xfba80000, 0x94040000, 0xf26e0000, 0x0b070000,
+	0xfeaa8000, 0x3fd1c000, 0xee202000, 0x65101000, 0xdba80800, 0xc4041400, 0x7a6e2200, 0x97072700,
+	0xd0aa8b80, 0x3ad1c140, 0x45a00ae0, 0x79501710, 0xb5881388, 0xe1141d44, 0x81c61cea, 0x03030201,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xc8000000, 0x3c000000, 0x3e000000, 0x67000000,
+	0xf9800000, 0xcc400000, 0x66600000, 0xb3100000, 0xaba80000, 0x5d240000, 0xc4fe0000, 0xb8cf0000,
+	0x66bb8000, 0x71a8c000, 0x10602000, 0x28103000, 0x4c280800, 0xa6641400, 0x931e3200, 0xfb9f0f00,
+	0x95738f80, 0xf89cd9c0, 0x86b61e60, 0x01bb0310, 0x880d9198, 0xdc13f8c4, 0x4e6db8ea, 0xff03e849,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x58000000, 0x44000000, 0x7e000000, 0x69000000,
+	0x5b800000, 0xdc400000, 0x5a200000, 0x87100000, 0xdad80000, 0x9bec0000, 0xbc420000, 0xca0f0000,
+	0x6f7c8000, 0xc6d9c000, 0xa1a02000, 0xab501000, 0xf8f80800, 0xe8fc2c00, 0x409a1600, 0x7ce31100,
+	0xf6be9f80, 0xb996da40, 0xcf7cb6e0, 0x36d9e710, 0xd9a03e88, 0x5f501dc4, 0xdef828b6, 0xc5fc1bfb,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x48000000, 0x74000000, 0xc2000000, 0xe7000000,
+	0xb5800000, 0xba400000, 0x9b200000, 0xa3d00000, 0x2f180000, 0x81840000, 0xd82a0000, 0xcc190000,
+	0x5e078000, 0xe138c000, 0xd8982000, 0x9cc41000, 0x568a2800, 0x65892c00, 0xa23f9200, 0xb76cdd00,
+	0xedaa1080, 0x365929c0, 0x65278560, 0xf2e8c290, 0xbf8014c8, 0x694025f4, 0x4ca01346, 0x4e9035a1,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x98000000, 0xb4000000, 0x52000000, 0x07000000,
+	0xbf800000, 0x5a400000, 0x3b200000, 0x91d00000, 0xd3380000, 0xfdec0000, 0x954a0000, 0x58f10000,
+	0xb5df8000, 0x091dc000, 0x86b82000, 0xa4ac1000, 0x7bea2800, 0xd0613c00, 0x2847a600, 0x8c61ed00,
+	0x166a3480, 0xcd2111c0, 0x0ce787e0, 0xb7f1ea90, 0x667208c8, 0x151d1974, 0x1895884e, 0x15ecc2bb,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xf8000000, 0x4c000000, 0xa6000000, 0x89000000,
+	0x6e800000, 0x1a400000, 0x17600000, 0x4bf00000, 0xa2f80000, 0x7c5c0000, 0x7e360000, 0x551b0000,
+	0x40808000, 0x272d4000, 0x93982000, 0x7eac3000, 0x524e3800, 0x43071c00, 0xd1d6be00, 0x75c65300,
+	0xd7e08980, 0xacdd5240, 0xd16003a0, 0x72f02a90, 0xd47803d8, 0x5a1c1dfc, 0x37563f3e, 0xdbeb2e57,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xb8000000, 0x3c000000, 0xde000000, 0xdf000000,
+	0x29800000, 0x32400000, 0xe9200000, 0x62900000, 0x71d80000, 0x5e3c0000, 0x9f2e0000, 0x09e70000,
+	0x026b8000, 0x5176c000, 0x5ef82000, 0xafac1000, 0x81760800, 0xb69b0c00, 0x3be5ae00, 0xeb41cf00,
+	0x33eb9780, 0x2f36e7c0, 0xf1d82260, 0x1e3c1090, 0xbf2e1c48, 0x39e71ba4, 0xba6b85f6, 0x6d76ef4f,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xf8000000, 0x3c000000, 0x6e000000, 0x19000000,
+	0x50800000, 0xca400000, 0x7b200000, 0xafd00000, 0x97a80000, 0x4b9c0000, 0x55ae0000, 0x64ef0000,
+	0xf0288000, 0x68524000, 0x64082000, 0x820c1000, 0x8f262800, 0x75a33400, 0xf4aebe00, 0xa8614f00,
+	0x842ebb80, 0xf2215640, 0xa70e9c20, 0xb1f15690, 0xa6a6a8c8, 0xdf6d40f4, 0xcd88886a, 0x68c27fa7,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xc8000000, 0xbc000000, 0x4e000000, 0x57000000,
+	0x80800000, 0x0a400000, 0xfd200000, 0x8db00000, 0xffa80000, 0xa6840000, 0x110e0000, 0x4bdf0000,
+	0x74d78000, 0xb8724000, 0x84082000, 0x8a741000, 0xbd061800, 0xedab3400, 0x2fd1b200, 0x6ed96f00,
+	0xad59b380, 0x05ed45c0, 0x23ff9820, 0x38b66690, 0x8e263548, 0x771b286c, 0x30f9866a, 0x121d6761,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xa8000000, 0xd4000000, 0xfa000000, 0xf9000000,
+	0x92800000, 0x19400000, 0x42a00000, 0x21500000, 0x8ef80000, 0xa7040000, 0x59920000, 0x36f90000,
+	0x2b2e8000, 0xffd04000, 0x51922000, 0x12f91000, 0x592e8800, 0x62d06c00, 0x91120a00, 0x26b92500,
+	0x730eb680, 0xa3c05240, 0xcfca2ea0, 0xb9ad2350, 0xe6c4a628, 0x136d5a14, 0x338e8d1e, 0xd7804a91,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x58000000, 0x1c000000, 0x72000000, 0x4f000000,
+	0xa1800000, 0x77400000, 0x4da00000, 0xbd300000, 0xaef80000, 0x369c0000, 0x8ab60000, 0xa8850000,
+	0x0fe18000, 0xea0dc000, 0xf3362000, 0x83c51000, 0xd041b800, 0xa83dec00, 0xa44e3600, 0xde191700,
+	0x6557a480, 0xf288ffc0, 0xa4d79e60, 0x75c8cad0, 0x517797e8, 0x64f8c08c, 0xd58f8dde, 0x0164eb77,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x88000000, 0x34000000, 0xa2000000, 0x03000000,
+	0x41800000, 0xf7400000, 0x03a00000, 0x04100000, 0x9a080000, 0x4f140000, 0x0fb20000, 0xea550000,
+	0xd73b8000, 0x13a1c000, 0x2c122000, 0xfe451000, 0x6533a800, 0x38b5d400, 0x09a00200, 0x23101d00,
+	0x51880080, 0xdf5414c0, 0x67923260, 0x2e0530d0, 0xad13a868, 0xace5c1c4, 0xfb8816e2, 0xa8543e15,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xb8000000, 0x1c000000, 0x82000000, 0xfb000000,
+	0xed800000, 0x87400000, 0xffa00000, 0x24300000, 0xde480000, 0x992c0000, 0xc6e60000, 0xd2dd0000,
+	0x64938000, 0x59a7c000, 0x01462000, 0xaaed1000, 0xd8dbb800, 0xeb8bf400, 0x92200e00, 0xe3701700,
+	0xc1e81880, 0x6d1c0ac0, 0xa0ae1560, 0x57f126d0, 0x20759f68, 0x707af7cc, 0x8855acf2, 0x740ad79b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x48000000, 0xac000000, 0x06000000, 0x95000000,
+	0x05800000, 0xc9400000, 0x3be00000, 0x08100000, 0xcc680000, 0xb6740000, 0xcd5e0000, 0xe1a70000,
+	0x635c8000, 0xa8e1c000, 0x98be2000, 0x00b73000, 0x44b4a800, 0xfed5c400, 0x25803200, 0x19401b00,
+	0xd3e02980, 0xb4102140, 0x82681360, 0x8f741950, 0xcede0f78, 0xbde72744, 0x5d3cb27a, 0x69b1dfcd,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xf8000000, 0x34000000, 0x1a000000, 0xff000000,
+	0xf3800000, 0x93400000, 0x2da00000, 0x3e700000, 0x3d480000, 0x88cc0000, 0x52b20000, 0x8d910000,
+	0xce358000, 0x750cc000, 0x94922000, 0x84a11000, 0x5cdd9800, 0xd8b0f400, 0xeae81e00, 0xd9bc1d00,
+	0x047a1e80, 0x721d0bc0, 0x532782e0, 0x0dede9d0, 0x8e6fade8, 0x1521e05c, 0x44dd8bb2, 0x7cb0e2e3,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x28000000, 0xfc000000, 0xb2000000, 0x5b000000,
+	0x3f800000, 0x7f400000, 0x89e00000, 0x22700000, 0xb3680000, 0xa3a40000, 0xdd360000, 0xfaad0000,
+	0xe1a38000, 0x7e6ec000, 0x71562000, 0xc09d3000, 0x36ab9800, 0xcbfac400, 0x81682a00, 0x38a40f00,
+	0x82b63480, 0x95ed12c0, 0x404385e0, 0xa01ee0d0, 0x703e2ef8, 0x38392e5c, 0xd41dbb3a, 0x4e17f339,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x08000000, 0x4c000000, 0xf6000000, 0x7f000000,
+	0x76800000, 0x19400000, 0x11a00000, 0x7bf00000, 0x8af80000, 0xa7540000, 0x42ae0000, 0xcb170000,
+	0xe4a58000, 0x8c124000, 0xd6562000, 0x2f431000, 0x4e8b9800, 0x5d454c00, 0xabd3a200, 0xf2e14300,
+	0x83058580, 0xc8e243c0, 0x4a2e27a0, 0xa1570950, 0x1585a3e8, 0xa1a25e3c, 0x338e209e, 0xa6a73345,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xb8000000, 0x7c000000, 0x4a000000, 0xf3000000,
+	0x90800000, 0x81400000, 0x5fa00000, 0xfb900000, 0x5dd80000, 0x8cec0000, 0x5b360000, 0xc4b10000,
+	0xdf338000, 0x52974000, 0x166e2000, 0x891d1000, 0x7ba5a800, 0x1db65c00, 0x2c858e00, 0x2b664f00,
+	0x7cfd9a80, 0xa31a70c0, 0x18938220, 0xe5077350, 0x19b62368, 0xfaf11124, 0x4213a7d6, 0xd7477cab,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x88000000, 0xd4000000, 0xea000000, 0xb7000000,
+	0xf5800000, 0xa5400000, 0xfea00000, 0x7e900000, 0x3eb80000, 0x9ef40000, 0x2e820000, 0xa6d90000,
+	0x729d8000, 0x98c9c000, 0x2fba2000, 0xda6d1000, 0x7f3fa800, 0x81c0ec00, 0xff3f8200, 0xc1c0e500,
+	0x5f3fb280, 0x71c0d1c0, 0xd73f9760, 0xa5c0e050, 0x3d3faf28, 0x12c0fb64, 0xc8bfa24e, 0xb780ea2d,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x08000000, 0x34000000, 0x1a000000, 0xd1000000,
+	0xac800000, 0x57400000, 0x43a00000, 0x18d00000, 0x0d480000, 0xb2b40000, 0xe4620000, 0x52010000,
+	0xc5668000, 0xe6e94000, 0x8e0a2000, 0xdb251000, 0x55ec8800, 0x9f8c5400, 0x06c6a200, 0xbe395d00,
+	0xa3422e80, 0x39913040, 0xb98ea120, 0xf98d4cd0, 0xd9a03468, 0x89d02f74, 0x81c826f2, 0xb5f4193d,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x08000000, 0xe4000000, 0xe6000000, 0x07000000,
+	0x10800000, 0x7d400000, 0x5da00000, 0x08f00000, 0x21180000, 0x37940000, 0xfdfa0000, 0xd8ef0000,
+	0xb9258000, 0x2be14000, 0xf7c22000, 0xddcb1000, 0x48e79800, 0x412a7c00, 0xc7a5a200, 0xf5a16900,
+	0x3ce20180, 0x5f7b2dc0, 0x2cdf9e20, 0xe70e5a50, 0xa0e78ce8, 0x152a6afc, 0x49a58de6, 0xe6a17f75,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x38000000, 0xac000000, 0xa2000000, 0xcf000000,
+	0x57800000, 0x2fc00000, 0x63a00000, 0x51b00000, 0x16e80000, 0xd5740000, 0xf4e20000, 0xfa130000,
+	0x33448000, 0x5dc74000, 0xc4c4a000, 0x02077000, 0xbf64a800, 0x4fb75c00, 0x338ca600, 0xf9c37700,
+	0x32ee8e80, 0xe31044c0, 0x358a1b60, 0xc0a70f30, 0x8406a388, 0x46646b5c, 0xd9680e32, 0x26b40201,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x78000000, 0x6c000000, 0x7e000000, 0xff000000,
+	0x18800000, 0xc0c00000, 0x7ca00000, 0x5ab00000, 0xd9b80000, 0xc7040000, 0x94f20000, 0x8eed0000,
+	0xebe28000, 0x5676c000, 0x0b62a000, 0x3ab6f000, 0x29c2a800, 0x8f06f400, 0x90fab600, 0xe4c2ef00,
+	0x06a8a980, 0xcf9fd0c0, 0x2c722fa0, 0x9e2d20f0, 0xcf429088, 0x70c6c65c, 0xd4da8ee6, 0x6eb2c39d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xd8000000, 0xf4000000, 0xd2000000, 0xab000000,
+	0x98800000, 0x90c00000, 0xeca00000, 0x82f00000, 0xe7e80000, 0x2a040000, 0xaf3e0000, 0x32b70000,
+	0xfff28000, 0x7e46c000, 0x4d72a000, 0x4186f000, 0x93528800, 0x3cb6fc00, 0x0a9abe00, 0x5b82c100,
+	0xe46c8a80, 0xfa01ebc0, 0x27682ca0, 0x8ec40ff0, 0x319e3788, 0x2b471f4c, 0x589aa672, 0x3082d9cd,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x08000000, 0x0c000000, 0x72000000, 0xf9000000,
+	0x4a800000, 0x86c00000, 0x14e00000, 0x7db00000, 0x0f280000, 0x8dec0000, 0xe70a0000, 0x11830000,
+	0xad578000, 0xecdec000, 0x99b7a000, 0xe16ed000, 0x3e9f8800, 0x5082dc00, 0xa3958a00, 0xb401df00,
+	0x36421680, 0x271f2140, 0xf195a420, 0x3d01d0f0, 0xd4c22918, 0x9ddf139c, 0x9f75a0d2, 0xb5b1efe7,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x28000000, 0xe4000000, 0x1e000000, 0x0d000000,
+	0x4f800000, 0x03c00000, 0xb9e00000, 0xcad00000, 0xd8780000, 0xbc2c0000, 0xe27e0000, 0x8f410000,
+	0x90ef8000, 0xbb1c4000, 0xe68fa000, 0x320c5000, 0xe717b800, 0x14f04400, 0xf511b200, 0xc39d7d00,
+	0x99803580, 0xfac03e40, 0xa0600660, 0x70102eb0, 0x18183018, 0x9c3c0804, 0xd2660c06, 0xf77d1e0f,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x38000000, 0x2c000000, 0xd2000000, 0x8d000000,
+	0x70800000, 0x14c00000, 0xb2e00000, 0x51f00000, 0xf6280000, 0x0b740000, 0x23c20000, 0x8b7b0000,
+	0x63858000, 0xab51c000, 0xd3e5a000, 0x9361d000, 0xffada800, 0x4125fc00, 0x72a7a600, 0x31daf700,
+	0x66481280, 0x83441440, 0x378a2ea0, 0x753f0170, 0x3c8f8a18, 0x56aef90c, 0xb78a1992, 0x353f20d1,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xd8000000, 0xec000000, 0xf2000000, 0x65000000,
+	0x87800000, 0x05c00000, 0x48a00000, 0xcb100000, 0x58f80000, 0xb3340000, 0x84d20000, 0xc9130000,
+	0xd5f58000, 0x50944000, 0x470da000, 0xfaa07000, 0x0e5fb800, 0xef736400, 0x3e8a0e00, 0xf8371f00,
+	0x1c5f9280, 0x1a737640, 0x010a0b60, 0x41f71330, 0x7eff9748, 0x58637ef4, 0x2c7233f6, 0x92031479,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x58000000, 0xc4000000, 0x66000000, 0x3b000000,
+	0x39800000, 0xd7c00000, 0x10a00000, 0xbb700000, 0xf9f80000, 0x77f40000, 0x80a60000, 0xe30d0000,
+	0x3db48000, 0x11c64000, 0xbbcca000, 0xdaf27000, 0xea4a8800, 0x014f5400, 0x00a61e00, 0x230d2500,
+	0x9db4a780, 0x81c65bc0, 0xe3cca1e0, 0x1ef27a30, 0x8c4a9bc8, 0x3a4f41ec, 0x39262a36, 0xf4cd23d1,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xb8000000, 0xb4000000, 0xfa000000, 0x47000000,
+	0xd1800000, 0x1fc00000, 0xe2e00000, 0x94100000, 0x4a580000, 0x0f240000, 0xcd8e0000, 0xe9bb0000,
+	0xebe48000, 0xf8a64000, 0xc35ca000, 0x23925000, 0xa48a9800, 0xd50d5400, 0x3ae03600, 0x70103900,
+	0xe8582880, 0xec2438c0, 0x5e0e24e0, 0x057b3b30, 0x2284b258, 0x34767334, 0xba64be4e, 0xa766713d,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xb8000000, 0x14000000, 0xd2000000, 0x6d000000,
+	0x25800000, 0x73c00000, 0x54e00000, 0x38500000, 0x54380000, 0xb2440000, 0x3d7e0000, 0x9dbf0000,
+	0x67958000, 0x86ad4000, 0x554da000, 0x71b95000, 0xc18bb800, 0x69824400, 0xa5801600, 0x33c00100,
+	0x34e00280, 0x68500a40, 0xec3813e0, 0xa64402b0, 0xef7e28d8, 0xf0bf09a4, 0x42158956, 0xf56d7e75,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x38000000, 0x2c000000, 0x86000000, 0x79000000,
+	0xe2800000, 0xd8c00000, 0xafe00000, 0xc0100000, 0xa0280000, 0x10140000, 0xc8720000, 0x14490000,
+	0xaa698000, 0xff0ec000, 0x9ba1a000, 0x3a0ad000, 0x777b9800, 0x6f97ec00, 0x60001600, 0xb0002700,
+	0xd8001780, 0xdc002940, 0xbe001720, 0x55002370, 0x648032d8, 0xa1c01874, 0x4d603b52, 0x18d00231,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0x34000000, 0x3e000000, 0x1b000000,
+	0xe0800000, 0xe2c00000, 0xd3a00000, 0xc6500000, 0xa7080000, 0x0acc0000, 0xf7e60000, 0x60010000,
+	0xf0188000, 0xa80ac000, 0x0430a000, 0x7656f000, 0x2f7e9800, 0xdecbfc00, 0xf9880a00, 0x330c3100,
+	0x24c62580, 0x749107c0, 0xccb0a5a0, 0x5096f370, 0x6adea348, 0x079bffe4, 0xc8003d0a, 0xf4003797,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x98000000, 0x9c000000, 0x4e000000, 0x59000000,
+	0x07800000, 0xddc00000, 0xdea00000, 0x1a300000, 0x23080000, 0x34a40000, 0xa13a0000, 0x8bc50000,
+	0xdb958000, 0x73d04000, 0x57bda000, 0x75847000, 0xfaafa800, 0x38154c00, 0xac280e00, 0xf6542b00,
+	0x35123d80, 0xd1910d40, 0x1887b460, 0x97414630, 0x9eba05c8, 0xfa0517bc, 0xf335b68a, 0x5ce040d5,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x84000000, 0x92000000, 0x91000000,
+	0xbd800000, 0x8cc00000, 0x61600000, 0xc5b00000, 0x30d80000, 0x6f6c0000, 0x4af60000, 0x0a530000,
+	0x5d2d8000, 0x8bc04000, 0x9fdba000, 0x45935000, 0x70f62800, 0x4f531400, 0x5aad8a00, 0x02006500,
+	0xd93b8680, 0x19e35540, 0x0ece23e0, 0xf84f1370, 0xfc63bd38, 0x2e4f775c, 0x9f5812ee, 0x32ac3ff7,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x78000000, 0xac000000, 0x3a000000, 0x0d000000,
+	0xf1800000, 0x6cc00000, 0xf5200000, 0x9df00000, 0x76a80000, 0x08640000, 0x141a0000, 0xb6230000,
+	0xc75f8000, 0x84944000, 0x3145a000, 0xa3b77000, 0x659a2800, 0x1ae30c00, 0x127f9600, 0xe9645700,
+	0x3fedb080, 0x07d35840, 0x4b801ae0, 0xa1c01470, 0x24a01728, 0x01302b4c, 0xfb883062, 0x39940d25,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x98000000, 0x6c000000, 0xaa000000, 0x83000000,
+	0xd7800000, 0xc0c00000, 0xa1600000, 0x30d00000, 0x99280000, 0x8cf40000, 0x9b4a0000, 0xfbdb0000,
+	0x8ae88000, 0x12644000, 0x7f42a000, 0x35af5000, 0x87e21800, 0x28ef1c00, 0xb5429e00, 0xc6af5700,
+	0x28622c80, 0xb42f2bc0, 0x2622a760, 0x197f5cf0, 0xccca1bb8, 0x7b1b3704, 0xcb889c92, 0x12b443c9,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x28000000, 0x8c000000, 0x2e000000, 0xc3000000,
+	0xae800000, 0x79c00000, 0x9d200000, 0xe5d00000, 0x0b680000, 0xd2ec0000, 0x1fa20000, 0xe2690000,
+	0x4d328000, 0x3dd8c000, 0xcf30a000, 0x40a1f000, 0xdaca3800, 0x03853c00, 0xb4109200, 0x1a71ef00,
+	0x19222180, 0xd7a923c0, 0x9e12b820, 0x2b08e2b0, 0x42d8a6e8, 0x678df404, 0x76481612, 0xc73c010f,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x48000000, 0x6c000000, 0x4e000000, 0x3b000000,
+	0x94800000, 0xc1c00000, 0xbe200000, 0xb3500000, 0x98880000, 0xffdc0000, 0xcd320000, 0x4bc10000,
+	0x17728000, 0x7aabc000, 0xeac8a000, 0x12b6f000, 0x56883800, 0x04dc2c00, 0x39b20a00, 0xfa010700,
+	0xe1528180, 0xa5fbd5c0, 0x3c4096a0, 0xd66aceb0, 0x0f3a32a8, 0x8edd30a4, 0x90e083aa, 0x33fad423,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x58000000, 0x44000000, 0x1a000000, 0xf1000000,
+	0x4e800000, 0xf5c00000, 0x32600000, 0x3d100000, 0x28f80000, 0xcaa40000, 0xcfee0000, 0x337f0000,
+	0xbbad8000, 0xc14bc000, 0xa6bba000, 0x1990d000, 0xa4783800, 0xca643400, 0xc90e0e00, 0x9aaf3500,
+	0xb7b59080, 0x873fed40, 0x69cdb520, 0x2c5bd130, 0xb643a738, 0x0734c634, 0x299628a6, 0x4c1b18ed,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xc8000000, 0xe4000000, 0x42000000, 0xbd000000,
+	0x6a800000, 0x05c00000, 0x2a200000, 0x89100000, 0xf0880000, 0x64dc0000, 0x2eb60000, 0x97830000,
+	0x4f578000, 0x3fe7c000, 0x9b69a000, 0x55b8f000, 0x32081800, 0xb51c0c00, 0x6e960a00, 0xb7930500,
+	0x5f5fa280, 0x07fbd640, 0xb77faa20, 0xf3ebde30, 0xcd778828, 0x62f7ef34, 0x01e19caa, 0x9864ce73,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x48000000, 0xdc000000, 0x92000000, 0x53000000,
+	0x6c800000, 0x85c00000, 0x36600000, 0xe5500000, 0xc9f80000, 0xac6c0000, 0x8a6a0000, 0x27570000,
+	0x32e88000, 0x0cfbc000, 0xd5faa000, 0x9e00d000, 0x29181800, 0x13fc1400, 0x23722a00, 0x74ab3300,
+	0xf19ab680, 0x6850e3c0, 0x6c601fa0, 0x2a5025b0, 0xd7782eb8, 0x6aac1c24, 0x988a2de6, 0x9bc7254f,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x98000000, 0x6c000000, 0x2e000000, 0x71000000,
+	0x7c800000, 0xebc00000, 0xd2200000, 0x67500000, 0xd1d80000, 0xf1640000, 0xbc9a0000, 0x8bd10000,
+	0x02678000, 0xff1ac000, 0xbda5a000, 0xdf6ff000, 0xcdf83800, 0xf7340400, 0xe9c23e00, 0x2d752f00,
+	0xdaddad80, 0x0e9bc740, 0x3c9a34a0, 0x4bd116b0, 0x6267b3a8, 0x2f1ad724, 0x25a586fe, 0xb36fce8d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xb8000000, 0xac000000, 0x06000000, 0xfd000000,
+	0xef800000, 0xf8c00000, 0x8c200000, 0xf6300000, 0xe5480000, 0x73c40000, 0x46ca0000, 0xdd750000,
+	0x1fcd8000, 0xe0814000, 0x106fa000, 0x48007000, 0xb4200800, 0x9a303c00, 0x43480600, 0xbec42700,
+	0x114a2f80, 0x89b51440, 0x95edba60, 0xebb14170, 0x1aa7b8e8, 0xc30473bc, 0x7eca125a, 0xb1751d7d,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x58000000, 0x14000000, 0x5a000000, 0x75000000,
+	0x6c800000, 0x87c00000, 0xdc600000, 0xf6700000, 0xcb780000, 0x4b840000, 0xd2660000, 0x79070000,
+	0x82c78000, 0xf8e4c000, 0x9db9a000, 0x0917d000, 0xcae00800, 0x14b00400, 0x83983e00, 0x7e341100,
+	0xc77e0080, 0xa5f31840, 0xad598da0, 0x38a7fcb0, 0x7df80c38, 0xf9440c6c, 0xc2862dc6, 0x58b73b7d,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xe8000000, 0x94000000, 0x42000000, 0x7b000000,
+	0x49800000, 0x3cc00000, 0x90200000, 0x58500000, 0x1c080000, 0xa64c0000, 0xd13e0000, 0xa6eb0000,
+	0x375c8000, 0xd7f94000, 0x81caa000, 0x78ce7000, 0x2a003800, 0x2f002c00, 0x6b802200, 0x37c03900,
+	0x31a02a80, 0xf0903bc0, 0xce2802e0, 0x851c11f0, 0x84b63668, 0x3c671924, 0x7642a30a, 0x29427f87,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x28000000, 0x14000000, 0x4a000000, 0xe3000000,
+	0x6f800000, 0x72c00000, 0x70200000, 0xe8300000, 0x34080000, 0xba3c0000, 0xcb0a0000, 0x7b850000,
+	0x38d28000, 0x9318c000, 0x87abe000, 0x46d4b000, 0xca000800, 0x23000c00, 0x4f800200, 0x82c00f00,
+	0x58200280, 0xfc300140, 0x7e0804a0, 0x593c0e30, 0xa48a06f8, 0x0945072c, 0x48f28702, 0x7b28ce83,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x28000000, 0x9c000000, 0x7e000000, 0xff000000,
+	0x43800000, 0x79c00000, 0xb8200000, 0x14100000, 0x52380000, 0xf9140000, 0x088a0000, 0xd8670000,
+	0x40ff8000, 0x108fc000, 0x7c78e000, 0x6ad27000, 0x5d800800, 0x96c00400, 0x33a00e00, 0xa1d00500,
+	0xbc180280, 0x8e0409c0, 0x673207e0, 0xa7b30ff0, 0xb3d58438, 0xa538c79c, 0xd69f6b82, 0x9759b141,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x48000000, 0x1c000000, 0xae000000, 0xf9000000,
+	0x6c800000, 0x95c00000, 0x7c200000, 0x3e300000, 0xe1080000, 0x489c0000, 0x6fd20000, 0x37270000,
+	0x059b8000, 0xe1764000, 0xcde72000, 0xb8277000, 0x94200800, 0x92300c00, 0x27080200, 0xdd9c0700,
+	0xe5520480, 0x47e701c0, 0xbb3b8ae0, 0xb3864f90, 0x3c4f26c8, 0x5b4b795c, 0x66da0fc2, 0xd3bb0fe3,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x48000000, 0xbc000000, 0x0e000000, 0xe1000000,
+	0xb5800000, 0x3dc00000, 0x8c200000, 0xd6100000, 0x75180000, 0xd7b40000, 0x9ad20000, 0x648f0000,
+	0x50538000, 0x25c04000, 0x38296000, 0x04157000, 0x4a200800, 0xcb100400, 0xae980600, 0xdb740d00,
+	0xeb720480, 0x335f0bc0, 0xa76b80e0, 0xc5644e10, 0x62636b58, 0x8aee73dc, 0x0c8180c2, 0x5c4f4961,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x98000000, 0x34000000, 0x12000000, 0x43000000,
+	0x04800000, 0xb8400000, 0x46200000, 0x41300000, 0x3fb80000, 0x58f40000, 0x74460000, 0x701d0000,
+	0x680c8000, 0x9c1cc000, 0x6e132000, 0xfd051000, 0x61980800, 0xedc40c00, 0xb9fe0e00, 0xbbe90d00,
+	0x80ca8980, 0x6041c340, 0x523fa120, 0x6329d430, 0x34b32848, 0xf0751784, 0xea000262, 0x67000513,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x98000000, 0xec000000, 0x0e000000, 0x29000000,
+	0x9f800000, 0xa9400000, 0x52200000, 0x8f300000, 0x32a80000, 0x1cd40000, 0xa8460000, 0x89ab0000,
+	0xac5b8000, 0x63964000, 0x5f65e000, 0x673f5000, 0xd6880800, 0xc6e40c00, 0x336e0a00, 0xa93f0500,
+	0x5fbd8980, 0x094d4ec0, 0x023660e0, 0x170d1290, 0xdea3e1f8, 0x12d45694, 0x81738722, 0x160241f3,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xf8000000, 0xfc000000, 0x1e000000, 0x2b000000,
+	0x67800000, 0xc5400000, 0xab200000, 0x27900000, 0x65680000, 0x9b2c0000, 0xdfae0000, 0x99570000,
+	0x852b8000, 0xf4a4c000, 0xfecee000, 0x405ad000, 0x5fae0800, 0xd9570400, 0x252b8a00, 0xc4a4c300,
+	0x06ceef80, 0xbc5adfc0, 0x41ae09e0, 0xf25706b0, 0x42ab8c78, 0x01e4cf54, 0xadeee532, 0x9bcaddb9,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x68000000, 0x9c000000, 0x06000000, 0x2f000000,
+	0xf8800000, 0x2a400000, 0x7f200000, 0x30900000, 0xc6780000, 0x81040000, 0xeb8a0000, 0xa4df0000,
+	0x82458000, 0x4321c000, 0x46b12000, 0x11571000, 0x8d8a0800, 0x5bdf0400, 0xf2c58e00, 0x6561c900,
+	0x57912680, 0x92c719c0, 0xb5720860, 0xdf9b06f0, 0x9eef8188, 0xdb6ecba4, 0x6c8ca172, 0x6072dac9,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xa8000000, 0x44000000, 0xc2000000, 0x13000000,
+	0xcf800000, 0xe2400000, 0x71200000, 0x6cb00000, 0xa5c80000, 0xa77c0000, 0x77ba0000, 0x9e690000,
+	0x0f048000, 0x2182c000, 0x5740e000, 0x1fa51000, 0xfa720800, 0xbd150c00, 0x9abe8200, 0xdcebc700,
+	0x3fc46a80, 0x9867d440, 0x1e12e420, 0xdd001d30, 0x0a8486f8, 0x24c2c524, 0xa3e0ef92, 0xb655158b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x18000000, 0x7c000000, 0x8e000000, 0x6f000000,
+	0x52800000, 0x1fc00000, 0x59200000, 0x71b00000, 0x2b780000, 0x5de40000, 0x90160000, 0xd8170000,
+	0x9c1f8000, 0x9e19c000, 0x770da000, 0x2ebb7000, 0x91ee0800, 0x36330c00, 0x23298e00, 0x34bec100,
+	0x04ea2180, 0xe186b7c0, 0xf355a0e0, 0xc1ef7af0, 0x0e000328, 0xaf000cfc, 0xb2800a12, 0x0fc001db,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x08000000, 0xf4000000, 0xa6000000, 0x77000000,
+	0x65800000, 0xd3c00000, 0x45200000, 0xe4900000, 0xd9680000, 0xbf4c0000, 0x28720000, 0x5de50000,
+	0x361d8000, 0x8f0bc000, 0x39a26000, 0x31ce7000, 0x9c3a0800, 0x02390400, 0xc9078a00, 0x5ea2cb00,
+	0xec4de080, 0xb3e0bf40, 0x1525e260, 0xfcacb370, 0x9557e458, 0xe549b23c, 0x0d4a66d2, 0xe9427e09,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x48000000, 0xf4000000, 0x26000000, 0x61000000,
+	0x17800000, 0x08c00000, 0xbb200000, 0x04b00000, 0xe8580000, 0x5d540000, 0x1cc20000, 0x8d350000,
+	0x4d958000, 0xdbe64000, 0x3bbee000, 0x32d4b000, 0xb83a0800, 0xcc110c00, 0x2a2f8600, 0x2b374d00,
+	0xecb16480, 0xac53ff40, 0xe3536a60, 0xc1d6fa10, 0x489eef78, 0x0264b18c, 0x16620132, 0x20450e0b,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x78000000, 0x74000000, 0x7e000000, 0x5f000000,
+	0xd0800000, 0x75400000, 0x7d200000, 0x2d900000, 0x18f80000, 0x85fc0000, 0xd86e0000, 0xb8950000,
+	0x496b8000, 0xef0dc000, 0x08bb2000, 0x9179d000, 0x0b360800, 0x7eb90400, 0xc25d8e00, 0xd1b4c700,
+	0x2ae6a780, 0x30cd1740, 0x59d0afe0, 0x3a7411f0, 0xe58d2b08, 0xb4c0d454, 0x1feb8652, 0xf14dc699,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xc8000000, 0x24000000, 0x8e000000, 0x39000000,
+	0x6a800000, 0x60400000, 0x5aa00000, 0xf8700000, 0x96a80000, 0xc2540000, 0xe99a0000, 0xb5dd0000,
+	0x6d798000, 0xb6334000, 0xa5332000, 0xb8b35000, 0xab798800, 0x6b334c00, 0x61b32200, 0x71f35900,
+	0x53598480, 0xd7034e40, 0x23bb2ae0, 0x72d75a90, 0x46eb8228, 0xc0ca4844, 0xfdf8af4a, 0x89491517,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xf8000000, 0xbc000000, 0xca000000, 0x39000000,
+	0x13800000, 0x55400000, 0xbba00000, 0xd1700000, 0x6d880000, 0xf2440000, 0xbf360000, 0x08ab0000,
+	0x9be48000, 0x5b754000, 0x34986000, 0x91ec1000, 0xc2648800, 0xf7354c00, 0x3cb86a00, 0xc5dc1d00,
+	0xec4c8780, 0x680147c0, 0x240666a0, 0x06331e90, 0xdb1e06b8, 0x6e9f0294, 0x30da8d1a, 0x1dda4387,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xf8000000, 0xe4000000, 0xfa000000, 0xad000000,
+	0xb6800000, 0x89c00000, 0x92a00000, 0x53d00000, 0x6fb80000, 0x2d5c0000, 0xfa460000, 0xa1c50000,
+	0xfea88000, 0xd5d64000, 0xec992000, 0x34d23000, 0x8c088800, 0xf6064400, 0x1b212600, 0xcd8e3300,
+	0x744e8780, 0x1ec34a40, 0xa909a9a0, 0x3c9879d0, 0xbcf7ace8, 0xf00172dc, 0xd819288a, 0xb41238ed,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x68000000, 0xe4000000, 0x86000000, 0x9d000000,
+	0xe1800000, 0xb0c00000, 0xeda00000, 0x12f00000, 0x16980000, 0x7e740000, 0x2fc20000, 0xc72d0000,
+	0x56b38000, 0x5e624000, 0xdfe7e000, 0xbf387000, 0xda938800, 0x3c524c00, 0xc4dfee00, 0xc3bc7100,
+	0x8bc98e80, 0x610b4240, 0x3bae6660, 0xc7f338d0, 0xe31de098, 0x3091794c, 0xd37a00ba, 0x566905ff,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xa8000000, 0x34000000, 0xd2000000, 0x59000000,
+	0xd6800000, 0xf1400000, 0x9aa00000, 0x8f500000, 0xada80000, 0x96cc0000, 0xa9420000, 0x46a10000,
+	0x49468000, 0x56af4000, 0xb1672000, 0xbaa51000, 0xff668800, 0x05bf4400, 0xa2ef2200, 0x7b791700,
+	0x1fac8280, 0x9fc24740, 0xa7e3af20, 0x2beb5290, 0x35e72fe8, 0x52e51854, 0x93468e8a, 0x0baf4e65,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x88000000, 0xcc000000, 0x5a000000, 0x77000000,
+	0x4e800000, 0x23400000, 0xd4a00000, 0xb4500000, 0xaa080000, 0x8f340000, 0x3a8a0000, 0xad570000,
+	0xbd948000, 0x1bfec000, 0xeacd2000, 0x41411000, 0x379c8800, 0x44cac400, 0xf8472a00, 0xb0161900,
+	0x58080080, 0xe43408c0, 0x060a0fa0, 0xa5170e70, 0xf5b48c68, 0x37eecef4, 0x80e528ea, 0x2e651c35,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x68000000, 0xb4000000, 0xb6000000, 0x09000000,
+	0x40800000, 0xb9400000, 0x3ea00000, 0x54700000, 0x30180000, 0x482c0000, 0x24220000, 0xae310000,
+	0xd5378000, 0x42af4000, 0x067da000, 0x770c1000, 0xadaf8800, 0xb7c34c00, 0x22ffae00, 0x404d1700,
+	0xd6000e80, 0xb9000740, 0xc8800560, 0x7d400790, 0xe0a00288, 0xe97000d4, 0xc698088a, 0xf86c05d7,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xb8000000, 0xe4000000, 0x86000000, 0x8d000000,
+	0x4b800000, 0x8ec00000, 0x79a00000, 0x1df00000, 0xab180000, 0xf6b40000, 0x8d560000, 0xbb5d0000,
+	0xbe5f8000, 0x59f24000, 0x1d1f6000, 0x33a2f000, 0x8ae78800, 0xefb64c00, 0x28d16e00, 0x048bf100,
+	0xfe4e0380, 0x79e90240, 0xed098660, 0x9baf49d0, 0xd6c0ef38, 0x8d90b6ac, 0x23d8e7fa, 0xc224b50f,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x88000000, 0xbc000000, 0xba000000, 0x6b000000,
+	0xbb800000, 0x27400000, 0x30a00000, 0x6cd00000, 0xfff80000, 0x505c0000, 0xa10a0000, 0x788b0000,
+	0xf0f88000, 0x95dbc000, 0x037d6000, 0x2eba9000, 0x59f28800, 0x1150c400, 0x2985e600, 0x60615b00,
+	0x690fe080, 0xa4aa5fc0, 0xfad765a0, 0x76e199b0, 0x04f20d38, 0xb3d706b4, 0x0272862a, 0xc610c0bd,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x58000000, 0x54000000, 0x56000000, 0x33000000,
+	0x54800000, 0xe4c00000, 0x17a00000, 0x18700000, 0xcf780000, 0x05c40000, 0xbe1e0000, 0xaf290000,
+	0x6e8f8000, 0x85dbc000, 0x7e23a000, 0xcf057000, 0x3e918800, 0xddf2cc00, 0x2a2c2600, 0x991eb500,
+	0x0d922d80, 0x8947b940, 0xcee5ab60, 0x8e987a30, 0x15f80ec8, 0x4604020c, 0xcb3e079a, 0x309902f7,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x78000000, 0xdc000000, 0xca000000, 0x43000000,
+	0xe3800000, 0x9c400000, 0xb8a00000, 0x73d00000, 0x06c80000, 0x1c7c0000, 0xf8860000, 0xd3c30000,
+	0x36e88000, 0x6445c000, 0x24bb6000, 0x19c65000, 0x75ee8800, 0x87c6c400, 0xb8f3ea00, 0xa1539300,
+	0x061def80, 0x813c99c0, 0xa4bb6ea0, 0x59c65330, 0xd5ee8bb8, 0xb7c6c304, 0xc0f3eaaa, 0x7d539dcd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x08000000, 0x5c000000, 0x3a000000, 0x2f000000,
+	0xac800000, 0x94c00000, 0x5fa00000, 0xc2700000, 0x44480000, 0xa1740000, 0x1afa0000, 0xe68b0000,
+	0x43f08000, 0x9732c000, 0xa8a4a000, 0x5add7000, 0x86aa8800, 0x73c9cc00, 0x0f1c2a00, 0xfc9bb900,
+	0x3cf42880, 0x939fb9c0, 0xf04621a0, 0x3760b7f0, 0x37cca848, 0xa119798c, 0x15b884da, 0x1546ce17,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x28000000, 0xc4000000, 0x3a000000, 0x9b000000,
+	0xa1800000, 0x93400000, 0xa0a00000, 0xf9f00000, 0x2a580000, 0x560c0000, 0xa5020000, 0xe0950000,
+	0xd9d88000, 0xba7dc000, 0x0e07e000, 0x49049000, 0x1e828800, 0x78e4cc00, 0x80dd6e00, 0x3cec5700,
+	0x7addea80, 0x47dd9040, 0xab7805a0, 0xfcbc02b0, 0xcffa0698, 0x3f690274, 0x7e828b2a, 0xc8e4ca6f,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x28000000, 0xa4000000, 0xfe000000, 0x3d000000,
+	0x82800000, 0xb3400000, 0x05a00000, 0x42f00000, 0x41780000, 0xa28c0000, 0x63620000, 0x3d8d0000,
+	0xbed98000, 0x33544000, 0xc5ba2000, 0x22fe1000, 0x31638800, 0x8aa54c00, 0xc779a600, 0xc3ab5700,
+	0x83e22a80, 0xb1c21640, 0x76d981e0, 0x275448d0, 0x73ba2ca8, 0xcbfe1674, 0x65e3853a, 0xa0e541bf,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x88000000, 0x5c000000, 0xea000000, 0x43000000,
+	0x40800000, 0xfc400000, 0x9da00000, 0x19f00000, 0x90580000, 0xdf8c0000, 0x96ea0000, 0xc2d30000,
+	0xb4d48000, 0xfdcdc000, 0x8e49a000, 0xba835000, 0x87468800, 0xe922cc00, 0x238f2e00, 0x2ce19700,
+	0x99e9a080, 0x507359c0, 0x3f9e88a0, 0xe6eecf30, 0x4ac52288, 0xe8c29d04, 0x17e527fa, 0xcd729c6f,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x58000000, 0x9c000000, 0x2a000000, 0xcf000000,
+	0x3d800000, 0x4c400000, 0x0ca00000, 0x70d00000, 0xb4780000, 0x60840000, 0xb2de0000, 0x6f6b0000,
+	0xb3188000, 0x878ac000, 0xbb4ee000, 0x7d285000, 0x4e9e8800, 0xebf5c400, 0x07d06600, 0x85dd9d00,
+	0x3eceed80, 0x3d685dc0, 0x503e8ca0, 0x1825c5f0, 0xfc286058, 0xfa199004, 0x9730efea, 0xa193563d,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0xe8000000, 0x0c000000, 0xbe000000, 0x2f000000,
+	0x73800000, 0x12400000, 0x3a600000, 0x16700000, 0x58680000, 0x0f4c0000, 0x98f60000, 0x38b50000,
+	0x93fa8000, 0xd9014000, 0xe0b5a000, 0xc7dd3000, 0x7335a800, 0x059d3400, 0xc155ae00, 0x8fed3d00,
+	0xcf3da080, 0xa3a13dc0, 0x9a4bab60, 0xa6543f30, 0x40512c58, 0x7b657e14, 0xc2ec8ffe, 0xa5844f73,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x08000000, 0x74000000, 0xea000000, 0x15000000,
+	0xdc800000, 0x40c00000, 0xe8e00000, 0xccd00000, 0x0ed80000, 0xfffc0000, 0xc17e0000, 0xe0a30000,
+	0x3ef98000, 0xa7ecc000, 0x9d63e000, 0xee9fd000, 0xc9e3e800, 0x1a5fdc00, 0xeb03ea00, 0x538fd500,
+	0x315bea80, 0x98b3d240, 0xf2c5e420, 0xa1c0d310, 0x1e6469e8, 0xb910171c, 0xaa998766, 0x7bfccbd1,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xa8000000, 0x9c000000, 0xfa000000, 0xd3000000,
+	0xdb800000, 0xb4c00000, 0x88e00000, 0x62d00000, 0x39d80000, 0xae6c0000, 0x48860000, 0x8f410000,
+	0xcc2f8000, 0x92034000, 0x6f39a000, 0xf1829000, 0xcfd9a800, 0xcf529c00, 0x2c01aa00, 0x623e9100,
+	0x1707a080, 0xc5bf98c0, 0xa9c82f20, 0xe66cd5f0, 0x24a98298, 0x0d424ebc, 0x2b162216, 0x2f81d491,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x88000000, 0xfc000000, 0xe6000000, 0x59000000,
+	0x18800000, 0xc1400000, 0x95600000, 0x1f700000, 0xf8480000, 0xfdc40000, 0xb6260000, 0xa1390000,
+	0x8c908000, 0xeb7ec000, 0xa254e000, 0xa2d6b000, 0xc7b4e800, 0xf0e6b400, 0x249ce600, 0x8752b700,
+	0x1c72ee80, 0xbfefb8c0, 0x4d2460e0, 0x72987d50, 0x16480168, 0x18c40144, 0xa8a6003e, 0x097904b3,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x58000000, 0x84000000, 0xca000000, 0x6b000000,
+	0x1f800000, 0x12400000, 0x98600000, 0xd3500000, 0xfce80000, 0x669c0000, 0x22ea0000, 0xbf9b0000,
+	0xe2418000, 0xf0474000, 0xdf6aa000, 0xead53000, 0x4382a800, 0x9c493c00, 0xd968a600, 0x77d23100,
+	0xa9292380, 0x68957940, 0xa3c38f20, 0xfb004ff0, 0x67a126d8, 0xa65972d4, 0xda41895e, 0x64474ee1,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x68000000, 0xe4000000, 0x7e000000, 0x87000000,
+	0xda800000, 0x2c400000, 0x62600000, 0x3d700000, 0x9bd80000, 0x158c0000, 0x02f60000, 0xf83f0000,
+	0x6c388000, 0x6a354000, 0xc125e000, 0xd199f000, 0x6cfde800, 0xb715f400, 0x028be200, 0x506af100,
+	0xc0536480, 0x486fbf40, 0x5c4e8360, 0x1a4a4730, 0x117d66c8, 0x51dcb1f4, 0x848002ee, 0xbb400323,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xd8000000, 0xfc000000, 0xba000000, 0x2f000000,
+	0xd0800000, 0x78c00000, 0xaae00000, 0x81f00000, 0x07680000, 0x42b40000, 0x33e20000, 0x5c6d0000,
+	0x1c0b8000, 0x8a244000, 0x972a6000, 0x5ca55000, 0x1ac26800, 0x79d15400, 0xeb406e00, 0x508c5300,
+	0x38c3e380, 0xcaec1cc0, 0xf1e38820, 0xdf504e30, 0xbea86d28, 0x89f85dbc, 0x7341e986, 0xccb116a3,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xb8000000, 0x74000000, 0x02000000, 0xbf000000,
+	0x18800000, 0x05c00000, 0x5be00000, 0x6af00000, 0xdb680000, 0x6b2c0000, 0x2aa20000, 0x72ef0000,
+	0x9f578000, 0xa12c4000, 0x49bc6000, 0xa4741000, 0x53b46800, 0x5f681400, 0x811e6e00, 0x399b1500,
+	0x0c63e580, 0x9f845240, 0x294205a0, 0x3c1f09b0, 0x9e3f8c28, 0x11004dec, 0xc19e6f96, 0x185b1a43,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xc8000000, 0xdc000000, 0x12000000, 0x65000000,
+	0x6d800000, 0x97c00000, 0xc1e00000, 0x72f00000, 0xec680000, 0x85140000, 0xdd860000, 0x3fe10000,
+	0xeddd8000, 0xa8e8c000, 0x5559a000, 0xfab75000, 0x2f51a800, 0x93935400, 0x08dfae00, 0x85565b00,
+	0xa28c2280, 0xcb7b96c0, 0x958603a0, 0xa3e10090, 0x9fdd8d78, 0x3de8cdec, 0xf0d9a766, 0xb17755c3,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x38000000, 0x4c000000, 0x66000000, 0xfb000000,
+	0xc4800000, 0x4cc00000, 0x47e00000, 0x7b500000, 0x5b980000, 0x0a640000, 0xb23a0000, 0x61310000,
+	0x418c8000, 0x4f684000, 0x91b86000, 0xc77fd000, 0xc5826800, 0x9d4edc00, 0x608eea00, 0xeee69b00,
+	0x8ed68980, 0x1ec94fc0, 0x76cce7e0, 0x72e39c70, 0x60f801a8, 0xb1f403bc, 0xe8420c56, 0x9b050bc9,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xc8000000, 0xdc000000, 0x22000000, 0x4b000000,
+	0xa8800000, 0x00c00000, 0xbfe00000, 0x19500000, 0xd8880000, 0x68e40000, 0x33c60000, 0xc3590000,
+	0x87858000, 0x3e494000, 0x5a366000, 0x9f01d000, 0x36906800, 0x59c8dc00, 0x947dee00, 0x6d359f00,
+	0x45858280, 0x854942c0, 0x5ab668a0, 0x73c1da70, 0x63706c28, 0xd798d57c, 0xc675ed56, 0x4e119a29,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xc8000000, 0x44000000, 0x82000000, 0x2d000000,
+	0xef800000, 0x67400000, 0x48600000, 0xcaf00000, 0x62380000, 0x9d2c0000, 0xd78e0000, 0x3b570000,
+	0x46638000, 0x21cac000, 0x22a82000, 0x38c57000, 0x171e2800, 0xdebe7400, 0xa6f3aa00, 0x1423b900,
+	0x0a380680, 0x492c0d40, 0xbd8e06a0, 0x82570b90, 0xe3e38a58, 0x2f8ac0e4, 0x0748225e, 0xb875780b,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xd8000000, 0xc4000000, 0xc6000000, 0xa1000000,
+	0x6a800000, 0xb5c00000, 0xcae00000, 0x65700000, 0xec080000, 0x9a340000, 0x43120000, 0x7d9b0000,
+	0xa6768000, 0xd188c000, 0xdc536000, 0xe2879000, 0x79c96800, 0x80e89400, 0x6e4de600, 0xfd8b5300,
+	0xe6600b80, 0x31b00f40, 0xac680fe0, 0x3a840150, 0xbdfa0748, 0x46df0d0c, 0xcf6c8666, 0x9727c71b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xb8000000, 0x14000000, 0x56000000, 0x29000000,
+	0x7d800000, 0xd6400000, 0xe1600000, 0x69d00000, 0x88380000, 0x7c1c0000, 0x5a020000, 0x7b2f0000,
+	0xbabe8000, 0x96dac000, 0x1ca0a000, 0x77d0b000, 0x7d1aa800, 0x4ba3bc00, 0x4f462200, 0x34c67d00,
+	0x13800980, 0x2b400c40, 0x6ae004e0, 0x869002d0, 0xacd80938, 0xd78c0eb4, 0x655a0cae, 0x47e30969,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x58000000, 0xf4000000, 0x4e000000, 0x57000000,
+	0xbf800000, 0xd0c00000, 0xf5e00000, 0x4f500000, 0xf5080000, 0xf2b40000, 0x66520000, 0xe5970000,
+	0x79c88000, 0x25434000, 0xa425a000, 0xc6301000, 0xeb1fa800, 0x2d831c00, 0x65ed2e00, 0xa7735b00,
+	0x393a0b80, 0x38b30440, 0x27728760, 0xf9304d30, 0x58b72a98, 0x5750573c, 0xa1208846, 0xaca74089,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x68000000, 0x1c000000, 0x3a000000, 0x07000000,
+	0xfc800000, 0xe6c00000, 0xd2600000, 0xf8b00000, 0xe8c80000, 0x93440000, 0xc9160000, 0x9d950000,
+	0x476d8000, 0x3f094000, 0x58b3e000, 0x38d71000, 0x6b5e6800, 0x4d1e5400, 0xd38d8e00, 0x66794b00,
+	0xfe9be080, 0x45e31ec0, 0xf0e06d20, 0xa77f55b0, 0x8f3e0268, 0x50a1051c, 0xd4d3826e, 0x39684f27,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0x7c000000, 0x5e000000, 0x9d000000,
+	0xde800000, 0x7d400000, 0xfbe00000, 0x02900000, 0x13480000, 0xbedc0000, 0x981e0000, 0x641d0000,
+	0xfa348000, 0x873ec000, 0x4985e000, 0x1ce07000, 0x9b316800, 0xc79ebc00, 0x49d48600, 0x29aecd00,
+	0xcccdec80, 0x533c76c0, 0xabaf6f60, 0x3fc3b210, 0xc8800e08, 0x4c400304, 0xb3600ed6, 0x8ed0013d,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x08000000, 0xac000000, 0x12000000, 0x93000000,
+	0x39800000, 0x97400000, 0x82e00000, 0x47b00000, 0x36480000, 0x38640000, 0x916e0000, 0x87c10000,
+	0x431b8000, 0x61b64000, 0x2347a000, 0x44fa3000, 0x62bc2800, 0x22fc7400, 0x17b38e00, 0x2e624300,
+	0xec61a680, 0x275f3dc0, 0xaac9a9a0, 0xfb8b37f0, 0x5c6facb8, 0x0f6e3344, 0x16fa2536, 0x91a974cf,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x28000000, 0x04000000, 0xee000000, 0xd3000000,
+	0xe3800000, 0xfa400000, 0x65e00000, 0x9d900000, 0xa1680000, 0x324c0000, 0x71ee0000, 0x3b830000,
+	0xa6668000, 0x17c94000, 0x5ca32000, 0x53def000, 0x12a5a800, 0x30c7bc00, 0x090e8e00, 0xe6854100,
+	0x86cd2480, 0x461dfd40, 0x17232460, 0x6d9ef170, 0xf945aed8, 0xae57b394, 0x63e684e6, 0x2a89473d,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x68000000, 0x4c000000, 0x06000000, 0xf3000000,
+	0x25800000, 0xd2c00000, 0x51600000, 0x00b00000, 0x2c480000, 0x8a2c0000, 0xd51e0000, 0xe6910000,
+	0xcf468000, 0xa7874000, 0x1bf6a000, 0xd9c45000, 0x70f82800, 0xa86f1400, 0xb0108e00, 0x783a4100,
+	0x442e2080, 0x1a1211c0, 0x9d280ee0, 0x9a9c0ff0, 0xf1560438, 0x70bd071c, 0x745881ce, 0xfe1649e7,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x08000000, 0x4c000000, 0xb6000000, 0xf9000000,
+	0xb2800000, 0x93400000, 0x87e00000, 0x55900000, 0xc4c80000, 0x88040000, 0x8c2e0000, 0x56290000,
+	0x89228000, 0xba91c000, 0xdf41e000, 0x31c5f000, 0xacab6800, 0x76503c00, 0x1b448600, 0x0bfccb00,
+	0x03ad6e80, 0x4ded33c0, 0x328003e0, 0x53400750, 0x67e00e48, 0x259001a4, 0xccc803d6, 0xc40408ad,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x08000000, 0x64000000, 0xda000000, 0xc5000000,
+	0x8b800000, 0x66c00000, 0x9f600000, 0x88b00000, 0x6e580000, 0xb10c0000, 0x19b60000, 0xe7d30000,
+	0x5eeb8000, 0x2375c000, 0x1eb2a000, 0x8571d000, 0x2d812800, 0x55c81400, 0x4fe58a00, 0xeadacd00,
+	0xd1572280, 0x2fab1f40, 0xdcd60520, 0xea630e10, 0x9b338718, 0x64b9c33c, 0x9064a1ce, 0x8e12d8a7,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xb8000000, 0xe4000000, 0x76000000, 0x87000000,
+	0x5f800000, 0x12c00000, 0xf3600000, 0xfa900000, 0xe4780000, 0x0d140000, 0x7aa20000, 0x245f0000,
+	0x2d388000, 0x8aa24000, 0x9c472000, 0xc912d000, 0xfc87a800, 0x1b649c00, 0x96828a00, 0xee794300,
+	0xe825a980, 0x6c3b9140, 0x0a3a04e0, 0xe51b0a30, 0x16828098, 0x2e79465c, 0xc825a14e, 0x9c3b90c5,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xe8000000, 0x54000000, 0x4e000000, 0xfd000000,
+	0xbf800000, 0x57400000, 0x32e00000, 0x36b00000, 0x16f80000, 0xd0b40000, 0x1fd60000, 0xd1270000,
+	0x5daa8000, 0x087ec000, 0x7259a000, 0xd163b000, 0x2beb2800, 0x8f197400, 0x189c8200, 0xfbe9cb00,
+	0xd70b2480, 0x04a97a40, 0x11e48260, 0x8c1dce90, 0x123d2518, 0xb73e75a4, 0x14b60e56, 0xa9d7075f,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x98000000, 0xb4000000, 0x7a000000, 0x97000000,
+	0x63800000, 0xf5400000, 0x70e00000, 0xd4900000, 0x66e80000, 0x2dac0000, 0xd8420000, 0xe4730000,
+	0x12778000, 0x7b554000, 0x3dcc2000, 0x10013000, 0x3833a800, 0x84287c00, 0xb2358e00, 0xbb264900,
+	0xadbbaf80, 0x18547e40, 0x847f8620, 0x42694e30, 0xe3662798, 0x89de3324, 0x6a0620b6, 0xaf0e355d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x48000000, 0xf4000000, 0xd6000000, 0x8d000000,
+	0x46800000, 0x00400000, 0x3be00000, 0x25100000, 0x02980000, 0xee5c0000, 0xdac60000, 0x09bf0000,
+	0xadd08000, 0xc82ac000, 0x3424e000, 0x7616b000, 0x5d326800, 0x0e837c00, 0xf4460200, 0xedff0100,
+	0xa8308e80, 0x443ac240, 0xee3ce9e0, 0xe10ab790, 0x2c946108, 0xaf6c74d4, 0x266e85d6, 0xeed9c355,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xd8000000, 0x64000000, 0xaa000000, 0x69000000,
+	0x9a800000, 0xf4c00000, 0x9f600000, 0x75100000, 0x24b80000, 0xcfe40000, 0xb8fa0000, 0x697f0000,
+	0x422b8000, 0x1524c000, 0x74aee000, 0x87d89000, 0xb4ff6800, 0x7f435c00, 0xe51a0a00, 0x4caf0700,
+	0x73f38f80, 0x76d0cd40, 0xaa6ce720, 0xb18390d0, 0x7b4eeb08, 0x1f0895dc, 0x6da76a5e, 0xe5775f1d,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x98000000, 0x1c000000, 0xe6000000, 0xdf000000,
+	0xae800000, 0x0ac00000, 0x7f600000, 0xe1100000, 0xcda80000, 0x92740000, 0x82aa0000, 0xb4d10000,
+	0xdc468000, 0x19b24000, 0x80526000, 0x5fba1000, 0x8f5ee800, 0xd9095c00, 0x01820e00, 0x5c650700,
+	0xd98c8f80, 0xe0734ac0, 0xefbce7e0, 0x177c5c30, 0xc5268c88, 0xe7a2415c, 0x837a6b1e, 0x770e15bd,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xa8000000, 0x9c000000, 0xf6000000, 0x15000000,
+	0x89800000, 0xe7c00000, 0x75600000, 0x9a300000, 0x9b280000, 0x489c0000, 0x944e0000, 0xd9ad0000,
+	0xefca8000, 0x9960c000, 0x54332000, 0xba199000, 0xab1fa800, 0x90885400, 0x30480600, 0x1bac0d00,
+	0x90e60480, 0xf3f100c0, 0x2f6485e0, 0xa13dc890, 0xa3b1a7f8, 0xe4d55f2c, 0x79ca87ce, 0x5c60c3df,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x78000000, 0xa4000000, 0x5e000000, 0xf3000000,
+	0x97800000, 0x6d400000, 0x4be00000, 0x18300000, 0x34280000, 0xc60c0000, 0x872a0000, 0xb1b70000,
+	0x3a7e8000, 0x824b4000, 0x86692000, 0xe876b000, 0xb375a800, 0xf8f6f400, 0x6f800600, 0x89400900,
+	0xf5e00980, 0x3b300740, 0xdba80260, 0x0f4c0570, 0x92ca0c98, 0x5a8709e4, 0x99d68dc6, 0x29074757,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x38000000, 0x0c000000, 0x1e000000, 0x63000000,
+	0xcc800000, 0xb3c00000, 0xc6600000, 0xb0300000, 0x58180000, 0x5c140000, 0x56120000, 0x570d0000,
+	0xde848000, 0xcedf4000, 0x69cbe000, 0xcf6fd000, 0x2da56800, 0x2a599400, 0xbe000a00, 0x53000300,
+	0xd4800180, 0xcfc007c0, 0xe0600260, 0xdf3006f0, 0x8a980d28, 0x8cd40d0c, 0x5cf200ae, 0x54fd003f,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xd8000000, 0xc4000000, 0xe2000000, 0x7b000000,
+	0x38800000, 0x10c00000, 0x3aa00000, 0xe0100000, 0x30180000, 0xb80c0000, 0x341e0000, 0x3a1b0000,
+	0xbf188000, 0xda9c4000, 0x6bcf6000, 0x02271000, 0xf0d21800, 0x0abf5400, 0x58000200, 0x04000300,
+	0x82000180, 0x8b0003c0, 0xe0800360, 0xd4c00310, 0xd8a00388, 0x9b1001ec, 0x089800e2, 0xa8cc0043,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x18000000, 0x5c000000, 0xae000000, 0xa9000000,
+	0x3b800000, 0x78c00000, 0x18e00000, 0xb8100000, 0xcc180000, 0xe61c0000, 0x5d160000, 0xd1830000,
+	0x23cb8000, 0x2475c000, 0x52452000, 0x97bf7000, 0x3e231800, 0x31fd1c00, 0x43800200, 0x54c00300,
+	0x4ee00380, 0xfd1002c0, 0x41980060, 0x6bdc0170, 0xd07602b8, 0xb85302a4, 0xccb380ee, 0x02b9c1e3,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x38000000, 0x44000000, 0xda000000, 0xe5000000,
+	0x59800000, 0x35400000, 0x5ca00000, 0x74100000, 0x02080000, 0xf1140000, 0x4b9e0000, 0xac470000,
+	0x9b288000, 0x7e4b4000, 0xe234a000, 0xe9cf3000, 0x2070a800, 0x75e89400, 0xa6a00200, 0x21100100,
+	0xc3880280, 0x705403c0, 0xf53e00e0, 0x79570110, 0x1aa08368, 0x5f1f4394, 0xac8aa166, 0x04d830d5,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x58000000, 0x44000000, 0x32000000, 0x87000000,
+	0xc9800000, 0x8b400000, 0xb3200000, 0xb4100000, 0xfa080000, 0x3b140000, 0x6f9a0000, 0x664b0000,
+	0xb9a88000, 0xc4d64000, 0x4578e000, 0xf5bd3000, 0xaad36800, 0x14616400, 0x59200200, 0x37100100,
+	0xa1880280, 0xe7540340, 0x4d3a0160, 0x1d1b0110, 0xc28080c8, 0xccd2421c, 0x196ae326, 0x23a2322d,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x08000000, 0xf4000000, 0x86000000, 0xd7000000,
+	0x5e800000, 0xec400000, 0x9b600000, 0xe6100000, 0x27180000, 0x66840000, 0x00420000, 0xe1610000,
+	0x430e8000, 0x2888c000, 0x035ee000, 0x29e9d000, 0x704c8800, 0x1975ec00, 0x8f180200, 0x42840300,
+	0xae420080, 0xd2610040, 0x938e8020, 0xe7c8c3d0, 0x40bee218, 0xf4b9d35c, 0x92b4897a, 0x75a1efb1,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x88000000, 0x84000000, 0x12000000, 0xdd000000,
+	0xd6800000, 0x36400000, 0xd1e00000, 0x56100000, 0x6f080000, 0x3b9c0000, 0xb8da0000, 0xebb10000,
+	0x11e08000, 0xf61a4000, 0x5f0fa000, 0x639cd000, 0xb4cdc800, 0x7dbbbc00, 0xdee80200, 0xfd8c0100,
+	0xbfd20380, 0x842d0340, 0x333a8220, 0x44ab4210, 0x8a6f2048, 0x7ec69374, 0xeca26b5a, 0x7e776cd9,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xd8000000, 0x0c000000, 0x1e000000, 0x5d000000,
+	0x2e800000, 0xd8400000, 0x83200000, 0xf2100000, 0xb3080000, 0xcb8c0000, 0x4ad60000, 0x9d7b0000,
+	0x20318000, 0x719bc000, 0xfdcfa000, 0x2cffd000, 0xfde60800, 0x8d72e400, 0x68280200, 0x759c0100,
+	0x87de0180, 0xbbf702c0, 0x9c678360, 0x38a0c030, 0x40de2078, 0xf2741174, 0x9da1a8ba, 0xb2413761,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xc8000000, 0xa4000000, 0xf2000000, 0x23000000,
+	0xba800000, 0x5ec00000, 0xc1600000, 0x1e100000, 0xb5180000, 0x8b9c0000, 0xb74e0000, 0xed390000,
+	0x25a48000, 0x98764000, 0x03906000, 0x335d5000, 0x8f20d800, 0xbeabac00, 0x4ef80200, 0x0b4c0300,
+	0x23360380, 0x08b501c0, 0xeff28320, 0x5ad34290, 0x637ae3c8, 0x6512108c, 0x13943aea, 0x4b40bd7b,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x58000000, 0x8c000000, 0x5a000000, 0xcd000000,
+	0x78800000, 0x02400000, 0x07600000, 0x5e100000, 0xe3180000, 0x938c0000, 0x25d20000, 0x64ab0000,
+	0xf5a18000, 0x2f234000, 0x9c7da000, 0x71991000, 0x34cd4800, 0x7e246c00, 0x26f80200, 0x52dc0300,
+	0x812a0180, 0xb7770240, 0x360b8160, 0xc7144230, 0x8d962168, 0x66dd5334, 0x072369e2, 0x18653c09,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x18000000, 0xcc000000, 0x0e000000, 0xb1000000,
+	0x1a800000, 0xf3c00000, 0x0b200000, 0x61100000, 0xb2980000, 0x07c40000, 0xb92e0000, 0xc6130000,
+	0xd5018000, 0xe085c000, 0xf0d82000, 0xb6a05000, 0xf557f800, 0x5ef8a400, 0x2f2e0200, 0x7b130300,
+	0xe1818080, 0xd245c1c0, 0xf9782060, 0xe8705330, 0x42eff838, 0x892ca6c4, 0x3e18026a, 0x490400cf,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xd8000000, 0x04000000, 0xe2000000, 0xe7000000,
+	0x95800000, 0xbdc00000, 0x6ba00000, 0xdf100000, 0x81880000, 0xe7cc0000, 0xd8aa0000, 0x708b0000,
+	0xdf488000, 0xfbf04000, 0x5d66e000, 0x0f31b000, 0x5a433800, 0xc97f3400, 0x152a0200, 0x894b0100,
+	0x36e88180, 0x93e04140, 0x916ee360, 0x513db010, 0x0b493b88, 0x81e4379c, 0xde6a8056, 0x28b743f7,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xc8000000, 0x74000000, 0x0a000000, 0xff000000,
+	0x45800000, 0xdec00000, 0xfde00000, 0xe7100000, 0xa9980000, 0xf8cc0000, 0x44fe0000, 0xeb890000,
+	0xb3d68000, 0x6b6d4000, 0x3a51e000, 0xc3a9b000, 0x26a95800, 0x6428fc00, 0x237e0200, 0x8e490300,
+	0xa9b68180, 0x29bd43c0, 0xe9a9e320, 0x89b5b1d0, 0x79af5828, 0xb1bdfffc, 0xc5ae8316, 0xcfb1407b,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x68000000, 0x24000000, 0xda000000, 0xc1000000,
+	0xd1800000, 0x17c00000, 0x02200000, 0x75100000, 0xa3980000, 0xd2c40000, 0x19a20000, 0xcbdd0000,
+	0x543c8000, 0x6a0f4000, 0x79022000, 0xbd933000, 0xf9c47800, 0x71360400, 0x41820200, 0xbfcd0300,
+	0x06248080, 0xbf0b4040, 0x0a8021a0, 0x275e3090, 0xd460fb68, 0x08fd4704, 0xf0a22146, 0xde43335f,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x18000000, 0x1c000000, 0x3a000000, 0x29000000,
+	0x43800000, 0xd1c00000, 0x6c600000, 0xad100000, 0x25880000, 0x22dc0000, 0x96f20000, 0x27530000,
+	0x842b8000, 0xd9ab4000, 0x376f2000, 0x638f7000, 0xe1dfb800, 0x0467cc00, 0x39120200, 0x1b830100,
+	0x2dc38380, 0xc6674240, 0x9c152060, 0x7a007070, 0xc90638e8, 0xd39f8ca4, 0xc9d6a30e, 0x70673247,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xc8000000, 0xc4000000, 0xf6000000, 0xd9000000,
+	0x38800000, 0xe3400000, 0x1ae00000, 0x9f100000, 0x19880000, 0xa7dc0000, 0x93b20000, 0xa6e90000,
+	0x55008000, 0x4a8ac000, 0x2c552000, 0x6b6c1000, 0x8ccde800, 0x242d1c00, 0xd43a0200, 0xcc350100,
+	0x20328380, 0x8223c240, 0x6535a320, 0x40b6d310, 0x6d70cbd8, 0x4dcd0f64, 0xf0adeae2, 0x957d1e8d,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xb8000000, 0x3c000000, 0x56000000, 0x85000000,
+	0x6c800000, 0x51c00000, 0x70a00000, 0xeb100000, 0x95880000, 0x8b5c0000, 0x94660000, 0x4f270000,
+	0x135f8000, 0x387ec000, 0x713aa000, 0x22449000, 0x86eeb800, 0xcfe95400, 0xed6e0200, 0xd5bb0100,
+	0x17998380, 0xac49c0c0, 0x4fed22e0, 0xad6650f0, 0x35b21958, 0x278ac614, 0x145f3bb2, 0x73ec9447,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x68000000, 0xd4000000, 0x7e000000, 0x7b000000,
+	0xee800000, 0xb1c00000, 0xad600000, 0x51100000, 0xab880000, 0x444c0000, 0xc2260000, 0x25bd0000,
+	0x83e28000, 0xc0dbc000, 0x56ed6000, 0x4d4ad000, 0xd5afb800, 0xcbf1ec00, 0x44ce0200, 0x70e10100,
+	0x8a4c8180, 0x912ac0c0, 0x7f29e1a0, 0x7c2c1350, 0x7ea059f8, 0x3d60fdec, 0x290cd9ba, 0x479a3fc7,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x38000000, 0x74000000, 0x96000000, 0x77000000,
+	0x5a800000, 0xef400000, 0x1ee00000, 0x35100000, 0x6b880000, 0x6acc0000, 0x173e0000, 0x1eb70000,
+	0xd5768000, 0x8fc6c000, 0xd4b4e000, 0xc86e5000, 0x18526800, 0x047c9c00, 0xba560200, 0x856b0100,
+	0x67c08180, 0x08bdc3c0, 0xe27c60e0, 0xb55f91d0, 0xcbf00a58, 0xee840ddc, 0x59588b6a, 0xf9e5cebd,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xd8000000, 0x64000000, 0xda000000, 0x97000000,
+	0x85800000, 0x18c00000, 0xb6a00000, 0x59100000, 0x70880000, 0xfe440000, 0x99f60000, 0xdc6b0000,
+	0xa4b48000, 0x82074000, 0xb308e000, 0x7f99b000, 0x3fc29800, 0xeb3a1400, 0x25de0200, 0x1c3f0100,
+	0x304a8080, 0x6ce842c0, 0x3aea6360, 0x8be5f190, 0x0776fb68, 0x6720e65c, 0x03c27816, 0x1527a563,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x28000000, 0x14000000, 0x6a000000, 0x91000000,
+	0x05800000, 0xb5400000, 0xbba00000, 0xa7100000, 0xda980000, 0x83dc0000, 0x7e7e0000, 0xee750000,
+	0xf66a8000, 0x2a794000, 0xa4782000, 0x776fb000, 0xf7fb2800, 0x2d37b400, 0xb2c60200, 0xabf90300,
+	0x632c8380, 0x81c043c0, 0xdb74a0a0, 0x91fff050, 0x0a3789a8, 0xa8444644, 0xc8378a16, 0xed4445d5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x48000000, 0xac000000, 0x8e000000, 0xe5000000,
+	0x4e800000, 0x97c00000, 0xe5600000, 0x3e900000, 0x0fd80000, 0xe17c0000, 0x0c920000, 0x2cd10000,
+	0xe6e98000, 0x5bc3c000, 0xbb6da000, 0x73905000, 0xfd593800, 0xb0b50c00, 0xa0e98200, 0xd2c3c300,
+	0x9beda380, 0x11505040, 0x1eb93920, 0xb5e50eb0, 0xc4518038, 0xe82fc094, 0xd627a2ba, 0x4b3d521f,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xc8000000, 0x04000000, 0x0a000000, 0x1b000000,
+	0xeb800000, 0x57400000, 0x0fe00000, 0x63900000, 0xf3580000, 0xb5ec0000, 0x608a0000, 0xd4c10000,
+	0xecac8000, 0x7e6b4000, 0x47d26000, 0xa329f000, 0x932da800, 0x4b299c00, 0xe72c8200, 0x392b4300,
+	0xe0326180, 0x14b9f340, 0xa275ab20, 0xe1c59c10, 0x66268228, 0xa1aa436c, 0xe8fee22e, 0x5e02b21d,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xb8000000, 0x94000000, 0x12000000, 0xdd000000,
+	0x86800000, 0xe0400000, 0xd2a00000, 0xb2900000, 0xa2480000, 0x97a40000, 0xb0120000, 0xe81f0000,
+	0x0c168000, 0x96004000, 0x770ca000, 0xcf825000, 0x74de4800, 0xefe1f400, 0xe6b68200, 0xf0904100,
+	0xe744a080, 0x95265040, 0xfa4c4ae0, 0x73bef650, 0x2a000248, 0x09000274, 0xb480029a, 0x2d4003c1,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xf8000000, 0x74000000, 0x66000000, 0x13000000,
+	0x9b800000, 0x8a400000, 0xf6200000, 0x5f900000, 0x54480000, 0xf12c0000, 0x92160000, 0x35170000,
+	0xe8828000, 0x21cac000, 0x847d6000, 0xddadf000, 0x6dc58800, 0xb678a400, 0xf8a28200, 0x2d5ac100,
+	0x2bb56180, 0x96c1f0c0, 0xf1f38be0, 0xa8ffa5d0, 0x22680398, 0xeebc014c, 0xa65e03ee, 0xf43b02e9,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x28000000, 0xdc000000, 0x22000000, 0x27000000,
+	0xed800000, 0xa7c00000, 0xbf200000, 0x09900000, 0x51d80000, 0xd63c0000, 0x991a0000, 0xc89d0000,
+	0xdd478000, 0x8d6e4000, 0xe571e000, 0x196e3000, 0x8b64b800, 0xd46d0400, 0xcde78200, 0x943e4300,
+	0x2e09e380, 0xed023140, 0xf686b8a0, 0x385c0770, 0x17e20288, 0x8731039c, 0xdd858036, 0x1fcf43df,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x08000000, 0x8c000000, 0x5e000000, 0x1b000000,
+	0xda800000, 0x62c00000, 0xcc600000, 0x2e900000, 0xe8c80000, 0xed7c0000, 0x2d120000, 0x1d890000,
+	0x0e4d8000, 0x29a9c000, 0x6e726000, 0x3392d000, 0x4d539800, 0x9724ec00, 0xcead8200, 0xb2f9c100,
+	0x2e5a6380, 0x99bed040, 0x96699820, 0xa781ee30, 0x975a0378, 0x5e35016c, 0x513f80ea, 0x11b0c1cb,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x68000000, 0x5c000000, 0x56000000, 0x87000000,
+	0xa3800000, 0x22c00000, 0x30a00000, 0x95900000, 0xd5c80000, 0x1b3c0000, 0xdb560000, 0xdb650000,
+	0x55a78000, 0xfb14c000, 0x6589e000, 0x1dc5f000, 0x97259800, 0xd5407400, 0x686f8200, 0xfc28c100,
+	0x08dfe380, 0x71a0f0c0, 0x090219a0, 0x5094b570, 0x6b466358, 0xf37d331c, 0xe9b2790e, 0x9d1c844b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0x64000000, 0xb6000000, 0x19000000,
+	0xd6800000, 0x36c00000, 0x40200000, 0xd0900000, 0xa7d80000, 0x12bc0000, 0x60560000, 0xb6f10000,
+	0x70a08000, 0x4758c000, 0xfd6e2000, 0x16fc5000, 0x60b71800, 0xdf5aa400, 0xe1788200, 0x8ce4c300,
+	0xabb82380, 0xa6cd50c0, 0x18379920, 0x2c926590, 0x0dcea0d8, 0x91a49364, 0x7dd938da, 0xf9a6f41b,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x68000000, 0x74000000, 0xee000000, 0xc9000000,
+	0x8a800000, 0x27400000, 0xff600000, 0x8c900000, 0xda480000, 0xfbec0000, 0x32da0000, 0xc7a50000,
+	0x24328000, 0xf9efc000, 0x79c02000, 0x4631d000, 0xe2e22800, 0x90574c00, 0xf4fa8200, 0x6543c100,
+	0xd47a2180, 0x5d04d140, 0x7498a9a0, 0xe6548dd0, 0x51e0a1b8, 0x2dd71224, 0x982a8baa, 0x13fc5ddd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xe8000000, 0xe4000000, 0x1a000000, 0x11000000,
+	0x53800000, 0xb8c00000, 0x80e00000, 0xd1900000, 0xc5d80000, 0xbd740000, 0xba560000, 0x0ba50000,
+	0x79b88000, 0x4cad4000, 0xa5232000, 0x3cecf000, 0x07935800, 0x8ad9bc00, 0xd5e08200, 0xa8194300,
+	0x84152280, 0x8a19f0c0, 0xc913dba0, 0x5f90ff90, 0x46cda268, 0x8be4b344, 0x9308fbce, 0x2e980e23,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xe8000000, 0x54000000, 0xbe000000, 0x1b000000,
+	0x7f800000, 0xa9c00000, 0xbf600000, 0x3d900000, 0xf8d80000, 0x55ec0000, 0x48da0000, 0x2de50000,
+	0x94d68000, 0x97e5c000, 0xd9c26000, 0xa7777000, 0xb183f800, 0xaacc0c00, 0x4cee8200, 0xc659c300,
+	0x5ea06180, 0xe6ee7140, 0xc3577ba0, 0x0a20cd50, 0x88a060f8, 0x69ee736c, 0x62d7787e, 0xe8e0cfe7,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x48000000, 0x14000000, 0x2a000000, 0x47000000,
+	0x1e800000, 0xf0400000, 0x96200000, 0x08900000, 0xb9580000, 0x4dbc0000, 0x454e0000, 0xa3b10000,
+	0x704e8000, 0x56234000, 0xe88de000, 0x49475000, 0x05ae4800, 0x5156a400, 0x89b68200, 0x374f4300,
+	0x48bbe380, 0x18da53c0, 0xdf76c920, 0x0d38e450, 0xe81be2a8, 0xc40a521c, 0x720ecbfa, 0xeb14e401,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x78000000, 0xe4000000, 0x42000000, 0x5d000000,
+	0xe5800000, 0xd8c00000, 0x1be00000, 0x0b900000, 0xebd80000, 0x0d740000, 0x65ca0000, 0x4e770000,
+	0xdb588000, 0xbc2a4000, 0xd8e0a000, 0x75123000, 0xb9905800, 0xdeda5c00, 0xd4e08200, 0xcb0e4300,
+	0x3292a280, 0x8c413340, 0x28bad9e0, 0x4ba31f90, 0xe52aa308, 0xcf653274, 0xf8c8d916, 0x0bf01c23,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0xac000000, 0xfe000000, 0xbf000000,
+	0x21800000, 0x2c400000, 0x86200000, 0x5e900000, 0x6dc80000, 0x7a640000, 0xa0ae0000, 0x17490000,
+	0x45b98000, 0x9bd5c000, 0x2970e000, 0x5f34b000, 0x7409c800, 0x6a05e400, 0x45178200, 0x3c9cc100,
+	0xc4c96080, 0x98e173c0, 0x2b792a20, 0x263156b0, 0xee9e49f8, 0xc5d927fc, 0x267ee206, 0xd6adb271,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xb8000000, 0x1c000000, 0x2a000000, 0xc7000000,
+	0x25800000, 0x49400000, 0xc9600000, 0xf2900000, 0x44c80000, 0xf4240000, 0x45ee0000, 0xff4f0000,
+	0x646f8000, 0x300f4000, 0xd819e000, 0xcc143000, 0x6211e800, 0x63138c00, 0x13818200, 0xa4404100,
+	0x2bf66080, 0x9e5b73c0, 0xc4e80ae0, 0xcfd7bc70, 0xf3b86aa8, 0x4fa7ce1c, 0xd5b1e216, 0x8aa033e5,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x78000000, 0x9c000000, 0x2a000000, 0x95000000,
+	0x20800000, 0xb9400000, 0x27e00000, 0xb9900000, 0xebd80000, 0xa7bc0000, 0x3cea0000, 0x9a070000,
+	0xfd178000, 0x24834000, 0xdf47a000, 0xe0f89000, 0x9011e800, 0x580b1c00, 0xac1d8200, 0x82144300,
+	0x71082380, 0x9687d340, 0x065c49e0, 0x92648e70, 0x2043eaa8, 0x75601d54, 0x39d80102, 0x6ebc02a5,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x34000000, 0xca000000, 0x59000000,
+	0x8a800000, 0x81c00000, 0x58e00000, 0x37900000, 0x09580000, 0xec3c0000, 0xabe60000, 0x941f0000,
+	0x5a028000, 0xb1134000, 0xb68a2000, 0xc7c0d000, 0xffeff800, 0x2e097c00, 0x5b048200, 0xbf9c4300,
+	0x4550a380, 0xf22f92c0, 0x88e3dae0, 0xff86acd0, 0x6551f928, 0xa22a7e64, 0x80e003aa, 0x739003c7,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x98000000, 0x6c000000, 0xaa000000, 0xcb000000,
+	0xdc800000, 0x18400000, 0xece00000, 0x93900000, 0x5ad80000, 0x19bc0000, 0x32ee0000, 0x5e9b0000,
+	0x07498000, 0xe6774000, 0x82c46000, 0x55bd1000, 0x88f7c800, 0xfd87bc00, 0x2fc78200, 0x383c4300,
+	0x0f35e380, 0xd1a653c0, 0x16e5aa60, 0x108dadb0, 0x624fc8a8, 0xafebbc2c, 0x4b1182f2, 0x1c8b40a1,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xe8000000, 0x64000000, 0x2a000000, 0x9b000000,
+	0x05800000, 0x2fc00000, 0x18a00000, 0xd4900000, 0x61580000, 0xcae40000, 0x5ff60000, 0x0b750000,
+	0xaa208000, 0x40cf4000, 0x2f346000, 0xcc433000, 0x026f3800, 0x68b0b400, 0xdc8e8200, 0x155e4300,
+	0x38e2e080, 0x48f970c0, 0x40fbdba0, 0x34fcc590, 0xc6f5daa8, 0xd1fdc56c, 0x9a7b5a96, 0x04a3877f,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xd8000000, 0x2c000000, 0xa2000000, 0x65000000,
+	0xe4800000, 0xa8c00000, 0xd2e00000, 0x2b900000, 0x9d480000, 0xf0bc0000, 0xc6ba0000, 0x3da30000,
+	0x26218000, 0x737a4000, 0x97d9a000, 0x8f7c1000, 0xadd9d800, 0x267e3c00, 0xbb538200, 0x33a54100,
+	0xa1222380, 0x12f55140, 0x8b89fb60, 0x2d546cb0, 0x78a1f888, 0x32b86c94, 0xb3b3fa12, 0xe1376ee3,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xc8000000, 0x14000000, 0x82000000, 0xc1000000,
+	0x14800000, 0x8dc00000, 0x61a00000, 0xe3900000, 0x4a580000, 0xd1e40000, 0x5f7a0000, 0x0fb10000,
+	0xcc8e8000, 0xb1c64000, 0x87af2000, 0x38831000, 0x43c27800, 0xdea2d400, 0xf00c8200, 0x58034300,
+	0xfc03a080, 0xc6105140, 0x8b19db20, 0xc1968450, 0x1b4f5808, 0x2d74c404, 0x96ba7ad2, 0x2416d477,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x58000000, 0x3c000000, 0xe2000000, 0x4d000000,
+	0xcd800000, 0xadc00000, 0x8ae00000, 0x66900000, 0x43580000, 0x6da40000, 0xf53a0000, 0x49630000,
+	0xfc4b8000, 0x552a4000, 0xd97ca000, 0x84573000, 0x39397800, 0x637d3c00, 0xf5498200, 0x16bd4300,
+	0x83b52080, 0xb22a7140, 0xddec5960, 0x4a074cf0, 0xb91dd988, 0x6b8e0e34, 0x6ecaf9b6, 0xb0637cf7,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x58000000, 0xd4000000, 0xee000000, 0xab000000,
+	0x1b800000, 0x4a400000, 0x3fa00000, 0xca500000, 0x7fa80000, 0xaa5c0000, 0xefba0000, 0xf2570000,
+	0x3ba08000, 0x1c4ac000, 0x90b5e000, 0x07c9b000, 0xdafca800, 0x386e4400, 0x10b5e200, 0x47c9b100,
+	0xbafca980, 0xa86e4640, 0x48b5e360, 0x93c9b250, 0x54fcaa38, 0x036e44ec, 0x5335e30e, 0xd989b379,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x58000000, 0x9c000000, 0xe2000000, 0x8b000000,
+	0x52800000, 0x56c00000, 0x4a600000, 0xb6d00000, 0x3a680000, 0xded40000, 0xee6a0000, 0xf8df0000,
+	0x1b798000, 0xc3434000, 0x9428e000, 0x8d691000, 0x3e523800, 0x4bb85c00, 0x6c28e200, 0x41691100,
+	0xa4523880, 0x4cb85c40, 0x84a8e360, 0x00a91370, 0x5eb23b08, 0x27a85e6c, 0xa620e22a, 0x3e6d122b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x48000000, 0x44000000, 0xca000000, 0x0d000000,
+	0x28800000, 0x51400000, 0xd8a00000, 0x59500000, 0xbcb80000, 0xc34c0000, 0x49ae0000, 0xe7c50000,
+	0x96e68000, 0xf87c4000, 0xea372000, 0x3d015000, 0xa0910800, 0xf5444400, 0xa2b72200, 0x1c415300,
+	0xd0310b80, 0x581446c0, 0x9c0f2320, 0x960d5210, 0x7b1f08a8, 0xe39146f4, 0xfac9a382, 0x66611355,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0xac000000, 0xe6000000, 0x09000000,
+	0x38800000, 0xe2c00000, 0x50a00000, 0xead00000, 0x2cb80000, 0x84d40000, 0x99ba0000, 0xf2410000,
+	0xde6f8000, 0x7c7dc000, 0xdf7ea000, 0x38e2d000, 0x53a6f800, 0xdd4ac400, 0xcffea200, 0xb622d300,
+	0xc506f880, 0x2e9ac440, 0x73c6a0a0, 0x7c36d1b0, 0xea1cfb18, 0x3f0bc464, 0xb9912042, 0x665f123b,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x48000000, 0x64000000, 0xea000000, 0xc5000000,
+	0x4f800000, 0x75c00000, 0x3b600000, 0xa1d00000, 0xd9680000, 0xe0cc0000, 0x4cee0000, 0x18050000,
+	0x5c028000, 0x26084000, 0x7b122000, 0x289db000, 0x9b5a9800, 0xeb33dc00, 0x2a722200, 0x0c4db100,
+	0xedb29b80, 0x4e3fdcc0, 0x15fc2320, 0xd198b090, 0x82d81828, 0x4dfb9fd4, 0x6d80021e, 0x94c00147,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x58000000, 0x54000000, 0x72000000, 0xcf000000,
+	0xf2800000, 0x99400000, 0xcfa00000, 0xfb500000, 0x98b80000, 0x7dd40000, 0xe3ea0000, 0x257f0000,
+	0xbe308000, 0x56894000, 0xc35d6000, 0xbcad1000, 0xe7c94800, 0xb0f06400, 0xa9e56200, 0xce791300,
+	0xd6a34880, 0x9ccf6640, 0x8075e360, 0x37a05250, 0xff462948, 0x92b6757c, 0x76d6a8aa, 0x3b6f3435,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xd8000000, 0xdc000000, 0x62000000, 0xdf000000,
+	0x2c800000, 0x15400000, 0xbe600000, 0x2b500000, 0x43680000, 0x38cc0000, 0x0aa60000, 0x4bf70000,
+	0x438d8000, 0x41c34000, 0xe7326000, 0x5f2cd000, 0xb321c800, 0xe9219c00, 0x9a3a6200, 0x0cb0d100,
+	0x1aefcb80, 0xea1a9dc0, 0x0b11e160, 0xda849270, 0xdc502a08, 0x2bf50ebc, 0x738249d2, 0x79c9de25,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x98000000, 0xa4000000, 0x5a000000, 0x33000000,
+	0xdf800000, 0x4ac00000, 0xa9600000, 0xa4d00000, 0x28680000, 0xd4440000, 0x732e0000, 0xc6f70000,
+	0x360a8000, 0x85044000, 0x1a80e000, 0xf045b000, 0x6928b800, 0x55e11c00, 0xd988e200, 0x57d1b100,
+	0x17eeba80, 0x0e921cc0, 0x724c6060, 0x5e32f390, 0xe06cdbe8, 0x3847ec0c, 0x85223b1e, 0xa3e55ebb,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x08000000, 0x84000000, 0xea000000, 0x8f000000,
+	0x9c800000, 0x2ec00000, 0x86200000, 0x18d00000, 0xaf380000, 0x45540000, 0xa8620000, 0xf6350000,
+	0x00c28000, 0x03204000, 0xfb4f6000, 0xc56dd000, 0x61b1b800, 0x589c9400, 0x24d76200, 0xf929d300,
+	0x5c4bb880, 0x0ded9740, 0xad6fe220, 0xd5b89110, 0x4a9c5b28, 0xf7c1057c, 0x03b1b852, 0x939c95ab,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x28000000, 0x2c000000, 0x82000000, 0x61000000,
+	0xbc800000, 0x5e400000, 0xbba00000, 0x88500000, 0x8ca80000, 0x43cc0000, 0xf9660000, 0xfda90000,
+	0xe7538000, 0x43214000, 0x980ba000, 0xa404d000, 0x3e1b6800, 0xbb1b2400, 0xd983a200, 0x4cd8d100,
+	0x06f56b80, 0xee6e25c0, 0xe63e22a0, 0x2a8c91b0, 0x89434988, 0x003eb444, 0xd5936852, 0x1ec724c9,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0x8c000000, 0xbe000000, 0x41000000,
+	0x31800000, 0x05c00000, 0x9ae00000, 0xe4d00000, 0x7b780000, 0x69140000, 0x7d9a0000, 0x9bd10000,
+	0xcbf38000, 0x7d52c000, 0xf2a1a000, 0x4de5f000, 0xd8429800, 0xd13c6c00, 0xa73ba200, 0x9a34f300,
+	0x8db11880, 0xfd6eac40, 0xcc1a00a0, 0x5e110130, 0x71138278, 0x8982c144, 0x21d9a266, 0xa8f1f227,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x18000000, 0x94000000, 0xbe000000, 0xa7000000,
+	0x39800000, 0x6a400000, 0x6c600000, 0x55500000, 0x81e80000, 0x21040000, 0xda9a0000, 0x55d70000,
+	0xa5208000, 0xa6a4c000, 0x8dfe6000, 0x4b1cf000, 0x6397a800, 0x5b4fbc00, 0xeee46200, 0x348bf100,
+	0x0ad72a80, 0x38bb7e40, 0xfaf20260, 0xca930350, 0x0dda8078, 0x9123c0dc, 0x88b6e086, 0x32fc33f9,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x08000000, 0x94000000, 0x36000000, 0xbd000000,
+	0x28800000, 0xa9c00000, 0x60a00000, 0x2cd00000, 0xc4380000, 0x4f1c0000, 0x6b820000, 0xc84d0000,
+	0x07e88000, 0x50b7c000, 0x34cd2000, 0x3837d000, 0x3d049800, 0xe88a0400, 0xc9cf2200, 0xb0bad300,
+	0x24cc1980, 0x502dc740, 0x791a0220, 0xd6810150, 0xe0d28158, 0xae26c1b4, 0x3007a082, 0x181d10f7,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x08000000, 0xf4000000, 0xc6000000, 0xe9000000,
+	0xd6800000, 0xf2400000, 0x06200000, 0x4f500000, 0x86a80000, 0x8c1c0000, 0x1a1e0000, 0x0b0d0000,
+	0x41888000, 0x31d9c000, 0x10e3a000, 0x94321000, 0xf05b6800, 0x613e1400, 0xe4dda200, 0xd46f1100,
+	0x997be980, 0x71fbd6c0, 0xf6a00220, 0xa41002d0, 0x3e080298, 0x750c0164, 0x5496037a, 0xd5410019,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xc8000000, 0xfc000000, 0xc6000000, 0xa5000000,
+	0x7a800000, 0xc6400000, 0x8ee00000, 0x2f500000, 0x9a680000, 0xe0140000, 0x10060000, 0x981d0000,
+	0x44118000, 0xf201c000, 0x9f0b2000, 0x19979000, 0x19cc6800, 0x323e8c00, 0x67ed2200, 0x3bda9100,
+	0x5535e880, 0x6a6b4dc0, 0x68000120, 0xcc0002f0, 0x2e000398, 0x29000354, 0x748002ca, 0x9f4000e9,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x58000000, 0xac000000, 0x6e000000, 0x41000000,
+	0x23800000, 0x46c00000, 0x22200000, 0x33d00000, 0x23a80000, 0x4a040000, 0x8b1e0000, 0xe89f0000,
+	0x0e438000, 0x9c66c000, 0xf7ada000, 0x7811b000, 0x5c1cf800, 0x96023400, 0x5d13a200, 0x159eb100,
+	0xabd77a80, 0x6fb0f6c0, 0x34080360, 0x221403b0, 0x3f160338, 0x8a8b03c4, 0x915581ee, 0xa6edc3ab,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x48000000, 0x0c000000, 0xca000000, 0xfb000000,
+	0xb1800000, 0x5ec00000, 0xc9600000, 0xc1d00000, 0xaee80000, 0x46040000, 0x71020000, 0xea9d0000,
+	0xbf4b8000, 0xdfb04000, 0x04aee000, 0xa5377000, 0x13f8b800, 0x86891c00, 0xc54ce200, 0x9cba7100,
+	0xa13b3a80, 0x75ed5d40, 0xe7880320, 0xc7d40130, 0x7fea01a8, 0xfc9902ac, 0x864983e6, 0x392d414b,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0xfc000000, 0xaa000000, 0x63000000,
+	0x18800000, 0xbb400000, 0xa6e00000, 0x7a500000, 0x91680000, 0xfb940000, 0xe3d60000, 0x3db10000,
+	0x2cb18000, 0x43384000, 0x96efe000, 0xb2545000, 0xbd7c0800, 0x09974c00, 0xd4d1e200, 0x73315100,
+	0x5efb8880, 0x9e4e0fc0, 0x4f6780a0, 0x3e8942f0, 0x9a5e6228, 0x016c124c, 0x8393eac2, 0x47c31d1d,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xd8000000, 0x24000000, 0xf2000000, 0x2b000000,
+	0x7f800000, 0xb2c00000, 0x24200000, 0x03d00000, 0xbca80000, 0xb0840000, 0xdf520000, 0xcdef0000,
+	0x506e8000, 0xf1bd4000, 0xfe0de000, 0xb517b000, 0xfa863800, 0xe04ef400, 0xe877e200, 0xe5bcb100,
+	0xa41aba80, 0xb20cb740, 0x8b1c8160, 0xaf824190, 0x6acb6148, 0x002ef3ec, 0xf1d9da9e, 0x97b6465b,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xd8000000, 0x4c000000, 0x22000000, 0xdf000000,
+	0x26800000, 0x8ec00000, 0xb0e00000, 0xefd00000, 0x73780000, 0xf4940000, 0x19d20000, 0x227f0000,
+	0x5f138000, 0xe6874000, 0xaed66000, 0xe0ea9000, 0x37c13800, 0x3f634c00, 0xd69c6200, 0xc6d19300,
+	0x04f8b880, 0xd1cf0d40, 0x566b8160, 0x41134230, 0x93846008, 0xc355923c, 0x26b2bbfa, 0xf4f40f0b,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x68000000, 0xec000000, 0xfa000000, 0xfb000000,
+	0x61800000, 0x89c00000, 0xd9200000, 0x34d00000, 0x01a80000, 0x33840000, 0x7ece0000, 0xd2b90000,
+	0x1e0b8000, 0x3d1a4000, 0x9896e000, 0xa7557000, 0x4f635800, 0x893a9400, 0x8cd0e200, 0x15b87100,
+	0x7d8eda80, 0xfbddd4c0, 0x5e2383a0, 0xf75e42b0, 0xf778e168, 0x9d3c732c, 0xc2c0d826, 0x90a4d597,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x68000000, 0x6c000000, 0x62000000, 0x69000000,
+	0xc2800000, 0xf2c00000, 0x5e600000, 0x7dd00000, 0x3bf80000, 0x269c0000, 0xccc60000, 0x5d610000,
+	0x4a438000, 0x01b94000, 0x8f3ca000, 0x4fe21000, 0x809a7800, 0xcbd41c00, 0x64e2a200, 0x7b0f1300,
+	0x0387f980, 0x3c405fc0, 0x3ea383a0, 0x22a942b0, 0xe8a4a008, 0x8dae1264, 0xdd247aaa, 0x2ee91e7b,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xb8000000, 0xac000000, 0x46000000, 0x6b000000,
+	0xdf800000, 0xbec00000, 0x1fa00000, 0x37d00000, 0x99380000, 0x87840000, 0x82c60000, 0xb1a30000,
+	0xb8db8000, 0x14a7c000, 0xb85ce000, 0x6ff53000, 0x8c29b800, 0x5f1b8400, 0x0582e200, 0x8bc23300,
+	0xf72c3a80, 0xa88b47c0, 0xff5b80e0, 0x3667c1b0, 0xf9fce398, 0x6f25326c, 0x3491b99e, 0xa15f844b,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xa8000000, 0x0c000000, 0x22000000, 0x27000000,
+	0xf8800000, 0x65c00000, 0x4c600000, 0xdd500000, 0x49b80000, 0x81240000, 0x8cfe0000, 0x6c890000,
+	0x23db8000, 0xe5734000, 0x90d66000, 0x5bf7d000, 0x5c099800, 0x5a183c00, 0x930de200, 0xce849300,
+	0xc4dffa80, 0xbdefeec0, 0x450478a0, 0xbf9caf30, 0x8d521808, 0x31ab7d5c, 0x353b81c2, 0xbae34067,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x78000000, 0x7c000000, 0xe2000000, 0x11000000,
+	0x0b800000, 0x7ec00000, 0xf9600000, 0x25500000, 0xbfa80000, 0x402c0000, 0xa8e20000, 0x968b0000,
+	0x9f418000, 0xa2b54000, 0xe1a8a000, 0x1325b000, 0x827a3800, 0x4bde3c00, 0x1ce92200, 0xe090f100,
+	0x88529b80, 0xf63b8f40, 0x1ff31be0, 0xf21eccf0, 0xc913ba08, 0x47877e04, 0x34c3804e, 0xec6e424b,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x18000000, 0x3c000000, 0x3e000000, 0x99000000,
+	0xd3800000, 0x13c00000, 0x3ee00000, 0x58500000, 0x51280000, 0xb8ac0000, 0x60660000, 0x22070000,
+	0xf70d8000, 0x4286c000, 0x1449a000, 0x37393000, 0xfda11800, 0x7df14c00, 0xb0c42200, 0x267ff100,
+	0x3708bb80, 0xe2987fc0, 0x044d3a60, 0xdf22bdf0, 0xd9aa9978, 0x7fe08ca4, 0x17c802ae, 0x6cfc027f,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x98000000, 0x64000000, 0x2e000000, 0xab000000,
+	0xfc800000, 0xe6c00000, 0xf8a00000, 0x26500000, 0xf4680000, 0x2bec0000, 0x8daa0000, 0x39d70000,
+	0xf22a8000, 0xef88c000, 0x4e50e000, 0xd879d000, 0x19e2f800, 0xfcbb2400, 0xd85a6200, 0x27611100,
+	0x237a1b80, 0xdd7ef640, 0x0e7a9860, 0x06e13490, 0x5620f938, 0x618025ec, 0x955ae012, 0x2cfed14b,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xa8000000, 0x6c000000, 0xf2000000, 0xdf000000,
+	0x42800000, 0x15c00000, 0x57200000, 0x63500000, 0x04e80000, 0xed640000, 0x5c2a0000, 0x57d90000,
+	0xf0238000, 0x45dd4000, 0x1f396000, 0x3f4a9000, 0xcef09800, 0xf6761400, 0x80bae200, 0x6f07d100,
+	0x3a81fa80, 0x71c88640, 0x592878a0, 0xe65cc4b0, 0xf57a9b48, 0x483f143c, 0xc1d1632a, 0x212e92a7,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x48000000, 0x4c000000, 0xd6000000, 0x63000000,
+	0x9f800000, 0xbf400000, 0xb6a00000, 0x76d00000, 0x2ae80000, 0xffe40000, 0xb3720000, 0x2ba50000,
+	0x764f8000, 0x6425c000, 0xc102e000, 0x3e8bb000, 0x31d5c800, 0x3f700400, 0x1da56200, 0xe54a7100,
+	0xe3a52a80, 0x7a5eb540, 0x123f2b20, 0xf21fb430, 0xe902abd8, 0xc29f75cc, 0x5fcfcbde, 0x0871078d,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x98000000, 0x64000000, 0x06000000, 0x65000000,
+	0x55800000, 0xb6400000, 0x17600000, 0x15d00000, 0x7c280000, 0x633c0000, 0x71be0000, 0x91670000,
+	0x30de8000, 0x49b1c000, 0xe5692000, 0xfecbf000, 0xe0a12800, 0x4af2bc00, 0x4f9fa200, 0xc1463100,
+	0xd9f60980, 0xc71e4cc0, 0x16800860, 0xd6d54c90, 0x5ca88b98, 0x48ef8c54, 0x1c8928b6, 0x69cebe89,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x68000000, 0x5c000000, 0xaa000000, 0x5d000000,
+	0x91800000, 0x34400000, 0x04a00000, 0xf7d00000, 0x19e80000, 0xf4fc0000, 0x3d7a0000, 0x4d390000,
+	0xc79d8000, 0xf35e4000, 0xd0232000, 0x7613f000, 0xb716e800, 0xac8bc400, 0xb5d6a200, 0x58f1b100,
+	0xaf6fc980, 0x44313440, 0xb015cba0, 0x58083470, 0x44084928, 0x8e167434, 0xc30b6866, 0x3a9584e1,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xc8000000, 0x64000000, 0x9a000000, 0xfd000000,
+	0xa6800000, 0xecc00000, 0x86200000, 0x08500000, 0xabe80000, 0xcef40000, 0x74660000, 0x8ea50000,
+	0xfb8e8000, 0xfa584000, 0x82f02000, 0x1a7c1000, 0xf1bcf800, 0xfc187400, 0x8616a200, 0xeb105100,
+	0x558ad880, 0xe55167c0, 0x556cd920, 0x5e346490, 0x344258e8, 0x4dfc2534, 0xf5fa7b3a, 0x19e434e3,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x88000000, 0x74000000, 0x6e000000, 0x2f000000,
+	0x7f800000, 0x4c400000, 0xfea00000, 0xc9d00000, 0x23e80000, 0x8ffc0000, 0x3dea0000, 0xf8e50000,
+	0xde688000, 0x3ebac000, 0xe9dc6000, 0xd3ebb000, 0x97f02800, 0xc1ed8400, 0xe2fce200, 0x9f7d7100,
+	0x6e2e4980, 0xda1f3640, 0x610e4820, 0xa08f34d0, 0x2bc64a38, 0x4ee337fc, 0x2d64485e, 0xab2a37a1,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0xfc000000, 0x12000000, 0x67000000,
+	0xf4800000, 0xeac00000, 0xbe600000, 0x40500000, 0xf9b80000, 0x89bc0000, 0x31ba0000, 0x45b90000,
+	0x3ba98000, 0xa6a94000, 0xc9386000, 0xc5685000, 0xf6c77800, 0xfc637c00, 0xaf49e200, 0x612d1300,
+	0x997d1980, 0x14ce2e40, 0xe37d19a0, 0x4fce2cf0, 0x65fd1bc8, 0x520e2cdc, 0xc71d1bf2, 0x049e2d1b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x38000000, 0x7c000000, 0xb2000000, 0xaf000000,
+	0xb8800000, 0x54c00000, 0x4a600000, 0x8a500000, 0x77b80000, 0xc1ac0000, 0x80b60000, 0x35330000,
+	0xbe658000, 0x5c5b4000, 0x06a76000, 0xac3bd000, 0x87f7b800, 0x5d017c00, 0x379ae200, 0xfc5c9300,
+	0xd6bedb80, 0x8435afc0, 0x33e6dae0, 0xab09aef0, 0x5688db48, 0x59c6ae7c, 0x95e35b82, 0x2202ec63,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xc8000000, 0x14000000, 0x8e000000, 0xcf000000,
+	0x7d800000, 0x5bc00000, 0x53200000, 0x49500000, 0x85780000, 0xb9ac0000, 0x93120000, 0x279d0000,
+	0xfac48000, 0x31b2c000, 0xa7126000, 0x9984f000, 0x2ddf5800, 0x90263400, 0x66c4e200, 0x8bab3300,
+	0xd609bb80, 0x33100740, 0xd789d920, 0x02c9f750, 0x3db203b8, 0xf50d037c, 0xcc9c8156, 0x114ec27f,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xa8000000, 0x64000000, 0x96000000, 0x23000000,
+	0x0f800000, 0x50400000, 0xc8600000, 0x0cd00000, 0x9fb80000, 0xa0fc0000, 0x550e0000, 0xdc810000,
+	0x97c68000, 0xcc21c000, 0xfaade000, 0xd477b000, 0xa6d8a800, 0x86ae9c00, 0x4e656200, 0x17d77300,
+	0x0c33c980, 0x9ab8ecc0, 0xe47028a0, 0x0ede5e90, 0xe2b601d8, 0xd87d034c, 0x34c8831e, 0x03a0c011,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x58000000, 0x04000000, 0x82000000, 0x05000000,
+	0x05800000, 0x52400000, 0x42e00000, 0xcad00000, 0x71280000, 0xe8740000, 0x340a0000, 0x0a070000,
+	0x79168000, 0x13894000, 0x8d4b2000, 0x46707000, 0x1f0aa800, 0x64804c00, 0x65d7a200, 0xddbe3100,
+	0xd1b70880, 0x6fa97e40, 0x5cbe2b60, 0x163a0d10, 0x18e00088, 0x8bd00354, 0xd6a801f6, 0x2f340319,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x98000000, 0x34000000, 0x22000000, 0x2b000000,
+	0xbd800000, 0x79400000, 0x2fe00000, 0x57d00000, 0xaf280000, 0x1b640000, 0xf81e0000, 0xe40f0000,
+	0x2a148000, 0xb7114000, 0x3390e000, 0x44557000, 0x9b6e0800, 0xb8072c00, 0x441a6200, 0x1a0b3100,
+	0x2f0a6a80, 0x07931cc0, 0x664c8860, 0xb07d6dd0, 0x05800008, 0x3d40016c, 0x35e00216, 0x78d001f5,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x68000000, 0x24000000, 0xaa000000, 0x93000000,
+	0xf4800000, 0xc4c00000, 0x8da00000, 0xb7500000, 0xcff80000, 0x51240000, 0x37920000, 0x98410000,
+	0xcd6a8000, 0x40f24000, 0x83b3e000, 0x4e535000, 0x0869b800, 0xb16e4400, 0x16eb6200, 0x86b01300,
+	0x1fc8da80, 0x4d2b5740, 0x11833ba0, 0x255c0790, 0xd0f88228, 0x8bb3420c, 0x1a5960f2, 0x1a6110c3,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x28000000, 0xcc000000, 0x4a000000, 0x81000000,
+	0x61800000, 0x4a400000, 0xdee00000, 0x2ed00000, 0x83380000, 0x69740000, 0x678a0000, 0x41590000,
+	0x1e7f8000, 0x151e4000, 0x3f94a000, 0x5558f000, 0x80722800, 0x2a12cc00, 0x71012200, 0x798fb300,
+	0xbe410880, 0x70f07c40, 0x29d5aaa0, 0x29a88c30, 0xc3a783a8, 0x92ba4144, 0xfb26a1a6, 0x6d75f259,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x98000000, 0xe4000000, 0x76000000, 0xb5000000,
+	0xe3800000, 0xae400000, 0xfe200000, 0x94d00000, 0x09e80000, 0x1bbc0000, 0x57860000, 0x90570000,
+	0xa72e8000, 0x8d53c000, 0x18b12000, 0x21123000, 0x4d9ba800, 0x9f4a1400, 0x9bb9a200, 0x1786f100,
+	0xf04c0980, 0x5727e7c0, 0x155d2860, 0xfca5d690, 0x570e8258, 0xf883c014, 0x7cd9206e, 0x35ee32e9,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xd8000000, 0x24000000, 0x82000000, 0x91000000,
+	0xa2800000, 0x2f400000, 0x19200000, 0x0ed00000, 0x1df80000, 0x5e2c0000, 0xb74a0000, 0x1d3f0000,
+	0x7cca8000, 0x44f14000, 0x00a1a000, 0x3e0a9000, 0x17188800, 0x419fd400, 0xd4d92200, 0x68e8d300,
+	0x9eb9ab80, 0x191b0440, 0x7e8a8960, 0x795cd790, 0xc221a388, 0xc14a9104, 0x36388a6a, 0x7b4fd46d,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xf8000000, 0x5c000000, 0x26000000, 0x05000000,
+	0xf2800000, 0x91400000, 0x43600000, 0x08d00000, 0x61b80000, 0x82740000, 0x90560000, 0xfbe30000,
+	0x62818000, 0x795dc000, 0x37702000, 0x7adf1000, 0xe6b14800, 0x0fe91c00, 0xd09fa200, 0xde55d300,
+	0x4af6e880, 0xc218cfc0, 0x9f0749e0, 0x019a1e70, 0x6ec62218, 0x84ac10d4, 0xa0e8c8aa, 0x0910dcf5,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x58000000, 0x3c000000, 0x82000000, 0x53000000,
+	0x5c800000, 0xd3c00000, 0x67e00000, 0xb6500000, 0x4fa80000, 0x58ec0000, 0x70c20000, 0x137f0000,
+	0x31918000, 0x1e494000, 0x5bbae000, 0x8ef65000, 0x15d35800, 0xfafe8c00, 0x53c16200, 0x27ec1100,
+	0x565a3b80, 0x9fae9f40, 0x00f15b60, 0x4cd18df0, 0x9178e388, 0x6289530c, 0x42c2db92, 0x8877ccff,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x38000000, 0xdc000000, 0x92000000, 0x0f000000,
+	0x97800000, 0x7fc00000, 0xee200000, 0x49500000, 0x8b780000, 0xa8240000, 0x50460000, 0x8deb0000,
+	0x95718000, 0xbd334000, 0x8cc16000, 0x5bb93000, 0xa1915800, 0x5ec45400, 0x34aee200, 0xe6157300,
+	0x691fba80, 0x3e8125c0, 0xe1495ae0, 0x7f705470, 0x0e30e2c8, 0x594a72fc, 0x6370383e, 0x3c2d674f,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0x54000000, 0x5a000000, 0x0f000000,
+	0xc6800000, 0x60400000, 0x4aa00000, 0x17d00000, 0xd1780000, 0x38a40000, 0xb4da0000, 0xb9eb0000,
+	0x9dfc8000, 0x0ff64000, 0x5cf06000, 0x3c771000, 0x652fa800, 0xe813e400, 0x0c0ee200, 0x3e1e5300,
+	0xfd014a80, 0xa59db640, 0xa8d7aae0, 0x7ff7e650, 0x94f4e1e8, 0x6065517c, 0xc325c97a, 0xd11ff691,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xb8000000, 0x34000000, 0x92000000, 0xdd000000,
+	0xff800000, 0xdcc00000, 0x9e200000, 0xee300000, 0x76280000, 0x92340000, 0x88320000, 0xd9250000,
+	0x80a38000, 0x1371c000, 0xafca6000, 0x62a59000, 0x56760800, 0xb441cc00, 0xa4760a00, 0x9941cf00,
+	0x03f60980, 0x4181cfc0, 0xb7d60b60, 0x46b1cf10, 0xac7e0928, 0xd545cc64, 0x45ec0ad6, 0x3e90cf17,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x08000000, 0xcc000000, 0x92000000, 0xb9000000,
+	0x10800000, 0xf3c00000, 0xb4200000, 0xe4300000, 0x1c380000, 0xb8340000, 0x56220000, 0x75230000,
+	0x10ba8000, 0x61e8c000, 0x9f1fe000, 0xdf8df000, 0xd45b8800, 0xc4610c00, 0xce5b8a00, 0xf1610d00,
+	0x2cdb8b80, 0x0ba10fc0, 0x807b8ba0, 0xd0510cf0, 0xba6389e8, 0x35550e14, 0xe0f989aa, 0x0b820ddb,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0xec000000, 0x2a000000, 0x27000000,
+	0xa9800000, 0x09400000, 0x11e00000, 0x99f00000, 0x2de80000, 0x8be40000, 0x16f60000, 0x00650000,
+	0x4cb88000, 0x7e1dc000, 0xd1092000, 0xcc841000, 0x63c93800, 0xef390400, 0x60493a00, 0x01790700,
+	0xb8293b80, 0x01c90540, 0x1c2139e0, 0xffdd06f0, 0x0d3f3948, 0x535c066c, 0xfef1bbee, 0x2464c649,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xf8000000, 0x84000000, 0x26000000, 0xa7000000,
+	0x3a800000, 0x9ec00000, 0x4fe00000, 0x87f00000, 0x4bf80000, 0xe1e40000, 0x0ce60000, 0xcb790000,
+	0x6a298000, 0x008d4000, 0xcbc9a000, 0xec66f000, 0x10b92800, 0x7e5ad400, 0x94392a00, 0x939ad500,
+	0xdf592980, 0xb9aad540, 0x3fc12a60, 0x627ed750, 0x2bbf2af8, 0xf6d3d5cc, 0x73e8aa12, 0xc5f397b7,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x28000000, 0x34000000, 0x76000000, 0x53000000,
+	0xb1800000, 0x57400000, 0xf5e00000, 0x4bf00000, 0x7cf80000, 0x837c0000, 0xab3a0000, 0x855f0000,
+	0x88e98000, 0x957f4000, 0xe8392000, 0x2ccd1000, 0xc3b4f800, 0x2291c400, 0x86ccfa00, 0xb2adc500,
+	0xa616fa80, 0x2b02c5c0, 0xbd877a20, 0x0d418510, 0xcce45bf8, 0xeb63945c, 0xbf21213e, 0xc3411101,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x98000000, 0x0c000000, 0x6a000000, 0x85000000,
+	0x30800000, 0xd7c00000, 0x7ae00000, 0x9cf00000, 0x33f80000, 0xa67c0000, 0x11360000, 0x24050000,
+	0xce148000, 0x0b11c000, 0x1b856000, 0x9c497000, 0x7ea08800, 0xee5e5400, 0xb7b88a00, 0x94d25500,
+	0xb5768a80, 0x46ab5440, 0xf25408e0, 0x65bf9470, 0x4dc5e948, 0x77e72664, 0x1860018a, 0xd230013b,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x48000000, 0xa4000000, 0xb6000000, 0x69000000,
+	0x56800000, 0x18400000, 0x4e200000, 0xcc300000, 0xbb280000, 0xd0ac0000, 0xb0760000, 0x631f0000,
+	0xa59b8000, 0x15d54000, 0x0ffc6000, 0xeddcb000, 0xd3feb800, 0x47cffc00, 0x30f6ba00, 0x2253ff00,
+	0x0528ba80, 0xfda0fc40, 0xa0e53ba0, 0x8a5abed0, 0x512ad978, 0xd3bf4f74, 0x25fe0022, 0xcec30315,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x38000000, 0xc4000000, 0xe6000000, 0x85000000,
+	0x23800000, 0x39c00000, 0x84e00000, 0x5ef00000, 0x19f80000, 0xc96c0000, 0x5e2a0000, 0x3c8d0000,
+	0xfd458000, 0x5db14000, 0x7545e000, 0xe1bf9000, 0xf753a800, 0xb2b1b400, 0x69cbaa00, 0x6cedb500,
+	0x32f9a880, 0x33fcb5c0, 0x566e2860, 0xdaacf6d0, 0x45c44bf8, 0xe6ef24c4, 0x9df78376, 0x8f604023,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x88000000, 0xac000000, 0x5e000000, 0x2d000000,
+	0xf8800000, 0x88c00000, 0x5ea00000, 0x13b00000, 0xfb380000, 0x1be40000, 0xb94e0000, 0x7cef0000,
+	0x06c28000, 0xbbad4000, 0xa726e000, 0x7df6f000, 0xe0556800, 0xfe6bfc00, 0x511b6a00, 0x6e84fd00,
+	0xe9d9e980, 0xa829bc40, 0x3e7f0ba0, 0xf11f4ef0, 0xde8a62d8, 0x31c4b244, 0x8c290b3a, 0xcc644d67,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xa8000000, 0xf4000000, 0xf6000000, 0xbf000000,
+	0x7c800000, 0x07c00000, 0x4ee00000, 0x81f00000, 0x95680000, 0xc6bc0000, 0x8e420000, 0x18a70000,
+	0x05518000, 0x32334000, 0x4d86a000, 0xa85e3000, 0x3fa74800, 0x85c1d400, 0xc7e54a00, 0xe266d700,
+	0x1e34c880, 0x279594c0, 0xb5526a20, 0xfa3ba710, 0xe99d21f8, 0x064671ec, 0xdcba6a0a, 0xfb47a6f3,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x88000000, 0x1c000000, 0x16000000, 0xb9000000,
+	0x3f800000, 0x2a400000, 0xf3e00000, 0x62f00000, 0xf1680000, 0x35340000, 0x7bc60000, 0xa4a70000,
+	0xcc8c8000, 0x9ada4000, 0x2f3b6000, 0x9cd39000, 0xde3e5800, 0x5f446400, 0x72785a00, 0x9da36700,
+	0x3314d980, 0x50892540, 0x4cc7bba0, 0x762eb530, 0x335fe3f8, 0x7c7dd3d4, 0xb0a33906, 0x0680f47d,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x58000000, 0x2c000000, 0x12000000, 0x31000000,
+	0x0e800000, 0x1f400000, 0x62e00000, 0x1bf00000, 0x81780000, 0xd02c0000, 0x19d60000, 0x49ad0000,
+	0xe7108000, 0x699ec000, 0x36dee000, 0xf43a3000, 0x3fdd5800, 0xe6a5c400, 0x1a8b5a00, 0x1148c500,
+	0x69fbd880, 0x80660640, 0xf6bd39e0, 0xa28036f0, 0x4d4e61a8, 0xf3e4f234, 0xc563bb92, 0xc62ff749,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xf8000000, 0xa4000000, 0x1a000000, 0xa7000000,
+	0x88800000, 0x6b400000, 0x07200000, 0x08300000, 0x6cb80000, 0x61fc0000, 0x8fc20000, 0x4a6d0000,
+	0xc6018000, 0x591ec000, 0x15982000, 0xb4cc3000, 0x1cf4d800, 0xc04cfc00, 0x79b6da00, 0xa261fd00,
+	0x0a175a80, 0xcf0f3ec0, 0x04977960, 0xdd4f0c50, 0xe639a108, 0x99a2f2cc, 0x3274f92a, 0x220cce61,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xd8000000, 0x1c000000, 0x46000000, 0xd1000000,
+	0x20800000, 0x42400000, 0xae200000, 0xfb300000, 0xe1a80000, 0xa4fc0000, 0x135a0000, 0x4eb10000,
+	0x197a8000, 0x7f9e4000, 0x87c66000, 0xeee77000, 0xac53b800, 0xdb233c00, 0x11a9ba00, 0xdce23f00,
+	0x3f5b3880, 0xd0b07fc0, 0xd46f5be0, 0x191a0fb0, 0x149c62f8, 0x605670f4, 0x1529387a, 0x94bd7efd,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xf8000000, 0x4c000000, 0x6a000000, 0x8f000000,
+	0x43800000, 0x02400000, 0x7fa00000, 0xf4b00000, 0x59280000, 0xfa6c0000, 0x47560000, 0xa3390000,
+	0x6d788000, 0xb8c9c000, 0xe3762000, 0x29d35000, 0x29e99800, 0x5d14ac00, 0x609f9a00, 0xdbddaf00,
+	0xdaef1a80, 0x7c886c40, 0x89c73960, 0x39fe3d70, 0x850820c8, 0xfc86534c, 0x49c71bc6, 0x19e46c45,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xf8000000, 0x14000000, 0xe6000000, 0x99000000,
+	0x47800000, 0xef400000, 0x4de00000, 0x12f00000, 0xbc780000, 0xdca40000, 0x421e0000, 0x17110000,
+	0xd29b8000, 0x8adb4000, 0x25b26000, 0x95959000, 0xe052f800, 0x5b738400, 0x8634fa00, 0x14c68500,
+	0xe8b17980, 0xd40cc640, 0x46189a60, 0xa9021610, 0x6f9801f8, 0x03540074, 0xbfe602e6, 0x6df502c9,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x4c000000, 0x3a000000, 0x1f000000,
+	0x94800000, 0xebc00000, 0x37600000, 0x82700000, 0x31f80000, 0x6aac0000, 0x701a0000, 0x28130000,
+	0x5c128000, 0x4201c000, 0x9b142000, 0xe29fb000, 0xcecb4800, 0xbceae400, 0xfd294a00, 0xed55e500,
+	0xdfa1c880, 0xc38727c0, 0x73476ba0, 0x46a956f0, 0x1a000348, 0xef00028c, 0xfc80031a, 0x17c00023,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xa8000000, 0x2c000000, 0xfe000000, 0x51000000,
+	0xef800000, 0x06400000, 0x57600000, 0x10700000, 0x22e80000, 0x05240000, 0xfd0e0000, 0xd18b0000,
+	0x37568000, 0xe8e54000, 0xbe356000, 0x59859000, 0xeb5cd800, 0x8efbf400, 0x3b3ada00, 0xcc14f700,
+	0x6e025b80, 0x990ab640, 0x9389b920, 0x504e66f0, 0x2a6e02d8, 0x01fb03b4, 0x75be8366, 0xbdc140ad,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xc8000000, 0x7c000000, 0xc2000000, 0x13000000,
+	0x61800000, 0xc3400000, 0x58200000, 0xa1300000, 0x5fb80000, 0x97740000, 0xd3020000, 0x418b0000,
+	0x134c8000, 0x2038c000, 0x153ca000, 0xe1a19000, 0x467a7800, 0xa19f3c00, 0xe3407a00, 0x88203d00,
+	0xd92efb80, 0xeba3ffc0, 0x2966d8a0, 0x020eae30, 0x330203a8, 0xb18b027c, 0xbb4c802e, 0xec38c071,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xf8000000, 0x2c000000, 0x96000000, 0xcf000000,
+	0x62800000, 0xdd400000, 0xfea00000, 0x4bb00000, 0x90380000, 0x10ec0000, 0xf9860000, 0x45c90000,
+	0xdae48000, 0x48924000, 0x9c59a000, 0x8f36f000, 0xca66d800, 0xa8d6cc00, 0x7d78da00, 0xa643cd00,
+	0x96225880, 0xc7f48c40, 0x47197b60, 0xa6993cf0, 0x3f428138, 0xdbab43cc, 0x882522b2, 0xccf8b1b9,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x48000000, 0x5c000000, 0x3a000000, 0xe7000000,
+	0x99800000, 0x04400000, 0xbb200000, 0x0a300000, 0x46b80000, 0x407c0000, 0xec8a0000, 0xf6d30000,
+	0xc4f08000, 0xf643c000, 0x40312000, 0x89b71000, 0x15e61800, 0x2acd3c00, 0xbef41a00, 0x31523d00,
+	0x69b69a80, 0xc5feffc0, 0xf2dd3ba0, 0x1ae92eb0, 0x1f428348, 0xe8acc12c, 0x816ba32e, 0x8817d03d,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x58000000, 0xac000000, 0xde000000, 0xe9000000,
+	0x99800000, 0x82c00000, 0x9d600000, 0x3e700000, 0x6cf80000, 0x08ac0000, 0x239a0000, 0xb1c10000,
+	0x67fc8000, 0x0e234000, 0x85c06000, 0xf5fc5000, 0x29378800, 0x1d48e400, 0x1ab58a00, 0x4495e500,
+	0x894b0880, 0x38aba7c0, 0x3b95e9e0, 0xbdd9b570, 0x09e48298, 0xbf3f42d4, 0xb04262fe, 0xa92151df,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x08000000, 0x54000000, 0xd6000000, 0xe5000000,
+	0xab800000, 0xe9400000, 0x1b200000, 0x70b00000, 0x39f80000, 0x92c40000, 0xba7e0000, 0xdf870000,
+	0xcf498000, 0x462d4000, 0xd736e000, 0x5aaa1000, 0xeefa7800, 0x525ffc00, 0x41b3fa00, 0x0472bd00,
+	0x7e851980, 0x5ad8ac40, 0x4e7f61a0, 0xb9875110, 0x724c98f8, 0xb1b5ef84, 0xbc6983d6, 0x729d4061,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x18000000, 0x54000000, 0xfa000000, 0x83000000,
+	0xca800000, 0x95c00000, 0xb7a00000, 0x2d300000, 0x70f80000, 0x1b5c0000, 0x307a0000, 0x75810000,
+	0x89578000, 0x9f72c000, 0x8103a000, 0xcd9d7000, 0x2d550800, 0x5d745c00, 0xe6028a00, 0xe5069d00,
+	0x6f812a80, 0xda5befc0, 0xddf422e0, 0xe8dfb290, 0xcc2eab08, 0x2d752d9c, 0x9e0d82a2, 0x2103c00b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x48000000, 0x9c000000, 0x42000000, 0x51000000,
+	0xc2800000, 0x25c00000, 0x65600000, 0x9ff00000, 0xfe280000, 0xad5c0000, 0xeda60000, 0x8a070000,
+	0x0d088000, 0x2086c000, 0x24dbe000, 0xeff33000, 0x26354800, 0xd9500400, 0x63bdca00, 0xd116c700,
+	0x02862880, 0x85d5f640, 0x357b61a0, 0xd7e9f030, 0x6228aaa8, 0xef543674, 0xbca80122, 0x489c00a3,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x38000000, 0x04000000, 0x76000000, 0xdf000000,
+	0x84800000, 0x84400000, 0xfca00000, 0x5c300000, 0x7e780000, 0xf5c40000, 0x617a0000, 0xd1450000,
+	0x75218000, 0x65e54000, 0x1503a000, 0x6996b000, 0x49c97800, 0x53784c00, 0x9848fa00, 0x5ead0d00,
+	0x5d335980, 0x69ffbcc0, 0xbf002160, 0xb482f0d0, 0x5c495ab8, 0x88babeac, 0x1221a12a, 0xa567b07d,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x48000000, 0x5c000000, 0xaa000000, 0xb5000000,
+	0x17800000, 0x42400000, 0x06200000, 0xddb00000, 0x8de80000, 0x0acc0000, 0x06fa0000, 0x9e5b0000,
+	0x6c3c8000, 0x48a3c000, 0xaa666000, 0x00841000, 0x5ccd9800, 0xe9f43c00, 0x54d11a00, 0x55e7ff00,
+	0xeedf7a80, 0x98efefc0, 0xed48e3a0, 0x2cb0d2b0, 0xf46d7b08, 0x5388ef64, 0x2c4661d6, 0x1d3411ad,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0x5c000000, 0x12000000, 0x07000000,
+	0x4e800000, 0x4ac00000, 0xf7e00000, 0x2b700000, 0xa6a80000, 0xbfdc0000, 0x6e7a0000, 0xa7210000,
+	0x6f868000, 0xb556c000, 0xaaab2000, 0xe5de7000, 0xbd60e800, 0x8fb3b400, 0xf44e6a00, 0x45397700,
+	0x909f4880, 0xb7c605c0, 0xda7922e0, 0xd12370b0, 0x969c68a8, 0x76c477ac, 0xf5e3c912, 0x0471c747,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x78000000, 0x14000000, 0x2a000000, 0x69000000,
+	0x0e800000, 0x54c00000, 0x82200000, 0xc6b00000, 0x4b680000, 0xcfcc0000, 0x61b60000, 0xeef10000,
+	0xb08f8000, 0xd7d4c000, 0xc5a4e000, 0xccfcb000, 0xe583e800, 0x9f40cc00, 0xc6646a00, 0x03580f00,
+	0x10768a80, 0x0c55be40, 0x19fae360, 0x6d01b210, 0xbc9a69c8, 0x59d50cb4, 0x8ea70b72, 0x977c7fa7,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x28000000, 0x84000000, 0x82000000, 0x55000000,
+	0x37800000, 0xb0400000, 0x3be00000, 0x06700000, 0x37380000, 0xb15c0000, 0xc66e0000, 0x57330000,
+	0x814f8000, 0xfe69c000, 0xfb3c6000, 0x87431000, 0x2963d800, 0x99a14400, 0x00945a00, 0xa2d48500,
+	0xa4263a80, 0x31d49540, 0x24b26220, 0xd3001350, 0xa0945a28, 0xf2d48704, 0xac263876, 0xa5d49485,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x48000000, 0x8c000000, 0x9a000000, 0x57000000,
+	0x4b800000, 0x50400000, 0x0ca00000, 0x65300000, 0xe6780000, 0x975c0000, 0x1f220000, 0xa1730000,
+	0xc4ce8000, 0xfb67c000, 0xf3d22000, 0xe0ffd000, 0x9b851800, 0x28462c00, 0xe8b39a00, 0x033ded00,
+	0x6363ba80, 0x07c13cc0, 0x9ef023a0, 0xaa8cd2f0, 0xe6cb9bc8, 0x2861eeac, 0x8e41b866, 0x0db23f2d,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x88000000, 0x04000000, 0x66000000, 0xc5000000,
+	0x57800000, 0xcac00000, 0x99a00000, 0x6c300000, 0xe5f80000, 0x3ecc0000, 0x37b20000, 0x0d3b0000,
+	0xa4678000, 0xb9114000, 0xfd86e000, 0xcdd59000, 0x1d348800, 0xbc6ddc00, 0xe50b0a00, 0x67809d00,
+	0xe2c7e880, 0xeda20cc0, 0x8226e2a0, 0x24e590d0, 0x0f4c8938, 0x3861dec4, 0xc31908e6, 0x028b9d2f,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xb8000000, 0x94000000, 0xaa000000, 0xb9000000,
+	0x77800000, 0x87c00000, 0x5b600000, 0xc2f00000, 0xbe280000, 0x97c40000, 0xd36a0000, 0x8ef50000,
+	0x70338000, 0x3cd4c000, 0x89fae000, 0xd4b99000, 0x159aa800, 0xd2d1a400, 0x72e12a00, 0xa6316700,
+	0x93d9cb80, 0x3179f4c0, 0x1bfae160, 0x39b99290, 0xa81aa9c8, 0x1c11a774, 0xe6012b96, 0x770165ab,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x38000000, 0xdc000000, 0xde000000, 0x6d000000,
+	0x90800000, 0x6dc00000, 0x1e600000, 0x34f00000, 0xf6280000, 0xebcc0000, 0x3f720000, 0x127d0000,
+	0x62fa8000, 0x5f2b4000, 0x094fe000, 0xd9b17000, 0x2d948800, 0x754d2400, 0xb7a60a00, 0x589a6700,
+	0x49d3ea80, 0x3c6a16c0, 0xf7e7e260, 0x33bd71b0, 0xca868b18, 0x92c02704, 0x55f48bda, 0x30bd2473,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x88000000, 0xd4000000, 0x46000000, 0xd9000000,
+	0x81800000, 0xd5400000, 0xd0600000, 0xc0f00000, 0xe0380000, 0xf3040000, 0x02820000, 0xffdb0000,
+	0xabbd8000, 0x15534000, 0x70616000, 0x90efd000, 0xd83fb800, 0xaf059400, 0x90803a00, 0x60cdd500,
+	0xf33cd980, 0x418147c0, 0x755a03a0, 0x806f0090, 0xf8e780b8, 0xbc3c42f4, 0x6106e13e, 0x9d939361,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x08000000, 0xfc000000, 0xae000000, 0x11000000,
+	0x24800000, 0x8d400000, 0x88600000, 0x45f00000, 0x68280000, 0x870c0000, 0x918e0000, 0xd3d70000,
+	0xd62c8000, 0x5e1b4000, 0x69106000, 0x60977000, 0x47451800, 0xc3653400, 0x22679a00, 0x7ee97700,
+	0xb7bb7a80, 0xf5d54540, 0xfb2602a0, 0xf49b02b0, 0x65428218, 0xc47c41f4, 0x73f4e20a, 0x8d303181,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x58000000, 0xa4000000, 0x02000000, 0x39000000,
+	0x93800000, 0x41c00000, 0x80a00000, 0x3e300000, 0xf6780000, 0xca140000, 0xd5020000, 0x3d810000,
+	0xb6d98000, 0xd43fc000, 0x7363e000, 0x9f8d1000, 0x9fd96800, 0x4fa05c00, 0xfea2ea00, 0xe12e9d00,
+	0x3ee08b80, 0x11484dc0, 0xdff802e0, 0x66d40350, 0xfc2200e8, 0xef7102b4, 0x09818326, 0xfcdbc373,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xd8000000, 0xb4000000, 0xda000000, 0xa1000000,
+	0xcd800000, 0x69400000, 0xae600000, 0x7ef00000, 0x8c380000, 0x340c0000, 0x9a1e0000, 0x010d0000,
+	0xdd8f8000, 0xb156c000, 0x1a79e000, 0xa4e6d000, 0x2d38b800, 0xf98d5400, 0xf3493a00, 0xaf669500,
+	0xa3675880, 0x3d6a8540, 0x2e6003e0, 0x3ef00390, 0x2c380288, 0x240c0014, 0x421e033e, 0xb50d01f1,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x8c000000, 0x5e000000, 0xbf000000,
+	0xa9800000, 0x68400000, 0xd7e00000, 0x15700000, 0xbea80000, 0x041c0000, 0xb21a0000, 0xf11b0000,
+	0x6e9e8000, 0x85c34000, 0x6dada000, 0x23991000, 0xbd57d800, 0x7b76c400, 0x09b35a00, 0x819e8700,
+	0x34487880, 0x51e8d5c0, 0x5e6003a0, 0x0d3003f0, 0x014800d8, 0x2d6c020c, 0x9ab200fe, 0xc607016d,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xa8000000, 0x04000000, 0xba000000, 0xfb000000,
+	0xaf800000, 0x36400000, 0xdce00000, 0x42700000, 0xc8b80000, 0x298c0000, 0xcb420000, 0xce7f0000,
+	0xc6bb8000, 0x609ac000, 0x6bd4a000, 0x45b7d000, 0xd3175800, 0xeb952400, 0x2c56da00, 0xd7fce500,
+	0x45fbf880, 0xfaeef6c0, 0x4f638220, 0x7226c2d0, 0xa94ea2c8, 0xd974d03c, 0x7736daf6, 0xe7cce725,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x18000000, 0x1c000000, 0x96000000, 0x9b000000,
+	0x9c800000, 0x34c00000, 0x3d600000, 0x94f00000, 0xaba80000, 0x60840000, 0xd2c20000, 0xde790000,
+	0xa4668000, 0x117a4000, 0xdae62000, 0x4ca03000, 0xda176800, 0x65102400, 0x639bea00, 0x92576700,
+	0x1cb94b80, 0xb20415c0, 0x010683e0, 0x598a41b0, 0x874e23b8, 0x072430dc, 0x8c55684a, 0x93a926cf,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x58000000, 0x24000000, 0xca000000, 0xa1000000,
+	0xe2800000, 0xe4400000, 0x85600000, 0x44f00000, 0x3f280000, 0x62840000, 0x245e0000, 0xe56d0000,
+	0x14f58000, 0x673ec000, 0x468de000, 0xee4f3000, 0x4479f800, 0xf665f400, 0x837a7a00, 0xc3f23700,
+	0xaabc1b80, 0x7b5ec640, 0x94f582e0, 0xa73ec2d0, 0x268de3c8, 0xbe4f3354, 0x1c79f9c2, 0xd265f585,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x78000000, 0xb4000000, 0xfe000000, 0x8d000000,
+	0x51800000, 0xb5c00000, 0xc7a00000, 0xd1300000, 0x06780000, 0xc8940000, 0x2a460000, 0xf7610000,
+	0x9b0b8000, 0x508e4000, 0xce54e000, 0x11665000, 0xb2122800, 0x871afc00, 0x4287aa00, 0x7951bd00,
+	0x5be6cb80, 0x174cad40, 0xeeed8260, 0x92df4390, 0xb5276398, 0xa07c10a4, 0x8180cb5e, 0xedddae33,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x08000000, 0x84000000, 0x7e000000, 0x49000000,
+	0x24800000, 0x55400000, 0xd3600000, 0x64f00000, 0xf2280000, 0x01840000, 0x3bda0000, 0xd9230000,
+	0x2e0f8000, 0x91064000, 0xb89a6000, 0xd74c7000, 0x68661800, 0xf374d400, 0xb4fb9a00, 0xea259700,
+	0xfd9c7b80, 0xc9c8a6c0, 0x6a3583a0, 0x3d9540d0, 0xa9dde058, 0x1a3e32f4, 0x358e794a, 0x2ddfa661,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x78000000, 0x9c000000, 0x6a000000, 0xeb000000,
+	0x26800000, 0x18c00000, 0x76a00000, 0x15300000, 0x26680000, 0x379c0000, 0xcd560000, 0xa4e10000,
+	0xb9568000, 0x4ae9c000, 0xd447a000, 0x4576f000, 0xe511a800, 0xfb989c00, 0x1f592a00, 0x73fc5f00,
+	0x25d60880, 0xc12e6c40, 0x18688160, 0x2294c230, 0x5ec722c8, 0xffbe329c, 0xeca088d2, 0x9637adbf,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xf8000000, 0x44000000, 0xc2000000, 0x0d000000,
+	0x6b800000, 0x4b400000, 0xf0e00000, 0x9bb00000, 0xfb580000, 0x38fc0000, 0x57be0000, 0x555d0000,
+	0x4beb8000, 0xb72ec000, 0xba84e000, 0x96c75000, 0xfcbad800, 0x61db9400, 0x3e3e3a00, 0xf31cc500,
+	0xa084e080, 0x4fc75240, 0x0d3ad960, 0xb39b9650, 0x9f5e3ae8, 0x6aecc424, 0x02bce226, 0xaacb5359,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x08000000, 0x94000000, 0xb6000000, 0x5d000000,
+	0xdc800000, 0x3ec00000, 0x8d600000, 0xcbb00000, 0x8ad80000, 0x8b740000, 0x6eae0000, 0xda5b0000,
+	0x9fa78000, 0x9cca4000, 0x26766000, 0xaa2fb000, 0x78820800, 0x30de1400, 0xbc746a00, 0x2d31a500,
+	0xc3166180, 0xa59fb140, 0xac5a0ba0, 0x62aa1610, 0xb05a68f8, 0x00aaa624, 0xbb51e02a, 0x9125f0cf,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xc8000000, 0x14000000, 0xd2000000, 0x45000000,
+	0x28800000, 0xebc00000, 0xb6600000, 0xc9b00000, 0x6dc80000, 0x01640000, 0xd43e0000, 0xf6830000,
+	0x80df8000, 0x6df6c000, 0xc5e9e000, 0x81fe3000, 0x7bf4a800, 0xbaff5400, 0x887d4a00, 0x32b16700,
+	0x7e41e180, 0x192a3140, 0xea02a8a0, 0xc9185610, 0xc69cca68, 0xf8c4a644, 0xc1f7826a, 0x5be2c3fb,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xf8000000, 0xac000000, 0x1a000000, 0xd1000000,
+	0x0d800000, 0xfe400000, 0x3ea00000, 0xccf00000, 0x78480000, 0xcda40000, 0x5c7a0000, 0x21810000,
+	0x244e8000, 0x0fbcc000, 0x71606000, 0x7e191000, 0x5f0cb800, 0x8a8b7c00, 0x88ccda00, 0xe4626f00,
+	0xad886180, 0x6e4d11c0, 0x96beb860, 0x28ee7c70, 0x36585988, 0xaaafaef4, 0x9aee81de, 0x034cc17d,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x08000000, 0x84000000, 0x3e000000, 0xe9000000,
+	0x50800000, 0x7ec00000, 0x30600000, 0xfab00000, 0x5cd80000, 0xdb740000, 0x11320000, 0xd1870000,
+	0x1a458000, 0x98b54000, 0x57d5e000, 0xc0eeb000, 0x947e8800, 0x94b53400, 0xadcb6a00, 0xf7eb8500,
+	0xddede180, 0xb2eab2c0, 0x67748ba0, 0x033635d0, 0x9284ead8, 0x65ddc4b4, 0xd3f7803a, 0xf3f2409f,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x28000000, 0xd4000000, 0x42000000, 0xb1000000,
+	0xfb800000, 0x9cc00000, 0xf0e00000, 0xd0300000, 0x16c80000, 0x05f40000, 0x21b60000, 0xbf070000,
+	0x648b8000, 0x0854c000, 0xe0b16000, 0x9c86d000, 0x34462800, 0x16bfe400, 0x3f974a00, 0x56c93700,
+	0xa5f96380, 0x11b2d240, 0xc7102920, 0x9888e610, 0x9e54cba8, 0x13a9f694, 0xd61e0166, 0x530302f7,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x38000000, 0xf4000000, 0xee000000, 0x1f000000,
+	0xe4800000, 0x39400000, 0xea600000, 0x2f300000, 0xa7580000, 0x6d740000, 0x6fba0000, 0xf8090000,
+	0x540d8000, 0xbe094000, 0x970f2000, 0x2886f000, 0x2358f800, 0x1b644400, 0xd4b7da00, 0x7a92b500,
+	0xbe572180, 0xaaf2f3c0, 0x7062fb60, 0x9e2d4510, 0xbcda5958, 0x00abf6ac, 0x848001aa, 0xc9400359,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x98000000, 0x14000000, 0x6a000000, 0xc9000000,
+	0x4e800000, 0xdd400000, 0x84200000, 0x53700000, 0x0e580000, 0xdbbc0000, 0x74ba0000, 0xcd350000,
+	0x5dfd8000, 0x731dc000, 0xaf856000, 0xbfcb7000, 0xd770b800, 0xec5ecc00, 0xceadda00, 0x2c29bd00,
+	0x3f676080, 0x204272c0, 0x10b738e0, 0x7f360f90, 0x20f539c8, 0xa78f0e74, 0x23cab812, 0x616bce91,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x08000000, 0x8c000000, 0x66000000, 0x71000000,
+	0x7c800000, 0x6a400000, 0x7e200000, 0xa2700000, 0x85480000, 0xa7a40000, 0xb6be0000, 0x9a3b0000,
+	0x18648000, 0x7a5b4000, 0xb635e000, 0xce6f3000, 0x73449800, 0xdeb4ec00, 0x46397a00, 0x967fdf00,
+	0x1743e180, 0xa4b03140, 0x593e1ba0, 0x17e4ac70, 0x67801bb8, 0xc1dfacf4, 0xf9e499ea, 0x5a84ed2d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xa8000000, 0xd4000000, 0x4a000000, 0x9b000000,
+	0x3b800000, 0x56400000, 0x4ee00000, 0xdab00000, 0x6b480000, 0xc86c0000, 0xca6a0000, 0x95730000,
+	0x9cf38000, 0x5da1c000, 0x1edd2000, 0x97399000, 0x58017800, 0xbc00b400, 0x3e145a00, 0xa1152700,
+	0x089f2080, 0xb9d692c0, 0x52b0f820, 0x0f4e7690, 0x8a78f988, 0xf562763c, 0x4cf2f946, 0x85a175f5,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x78000000, 0x7c000000, 0xda000000, 0x45000000,
+	0xfb800000, 0x94c00000, 0xeae00000, 0x4c300000, 0xf7c80000, 0x4e6c0000, 0xc66a0000, 0x02690000,
+	0x047c8000, 0xeb66c000, 0x2deee000, 0x3ea55000, 0x9a842800, 0x795ea400, 0x3922ca00, 0x1457f700,
+	0x76ace080, 0xfe9052c0, 0x0f5aab60, 0xae3d6430, 0xaedaa888, 0xbffd67e4, 0x1fbaa806, 0x170d6587,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xc8000000, 0x8c000000, 0x82000000, 0x83000000,
+	0xc9800000, 0xb0400000, 0x3ee00000, 0xc8b00000, 0xbb480000, 0xdb740000, 0x8afe0000, 0xdeb30000,
+	0x9e4c8000, 0x8ff7c000, 0x3a272000, 0x968bd000, 0x93c3f800, 0xf1ae7400, 0x65ccda00, 0x04a1a700,
+	0x99592380, 0x2878d340, 0x9b6f7aa0, 0x2ae9b670, 0xaea3fb28, 0x465e773c, 0xcbe4daae, 0x3425a78d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x98000000, 0x84000000, 0x16000000, 0x99000000,
+	0x16800000, 0x9e400000, 0x3e600000, 0x9a300000, 0x17480000, 0x00e40000, 0xf8620000, 0xcb350000,
+	0x8dd78000, 0xe4b84000, 0x5500e000, 0x4c847000, 0x9d4c5800, 0xcbfb6400, 0x81e4ba00, 0xaaeb1700,
+	0xa362e180, 0x5ab172c0, 0xf01bd9e0, 0x580327d0, 0x64045838, 0x661f6774, 0x0106b982, 0x929e16dd,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x58000000, 0x0c000000, 0x3a000000, 0x5d000000,
+	0xf3800000, 0x08400000, 0x57e00000, 0x81b00000, 0x75480000, 0x54740000, 0xe1f60000, 0x26a90000,
+	0xbbce8000, 0xffb8c000, 0xe651e000, 0xfced5000, 0x752eb800, 0x83849400, 0xa0575a00, 0x33edc700,
+	0xbfa7e380, 0x46445240, 0xcce038e0, 0x7d3c5570, 0xd786bb88, 0x96409644, 0x54e958a6, 0x1130c715,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xa8000000, 0xd4000000, 0xd6000000, 0xb3000000,
+	0xc1800000, 0xe7c00000, 0xdba00000, 0x0f700000, 0x55580000, 0xdde40000, 0xa3020000, 0xd9830000,
+	0xfbc38000, 0x29be4000, 0xc269a000, 0xf3ccd000, 0x2dba0800, 0x2c73ec00, 0xccd1aa00, 0x463c3d00,
+	0x7aa82380, 0xb3f192c0, 0xdc102b20, 0xd2017c90, 0x5d0203f8, 0xfe83009c, 0x8c4381de, 0x8d7e4293,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xa8000000, 0xb4000000, 0x66000000, 0x93000000,
+	0x57800000, 0x4f400000, 0x2d200000, 0x99700000, 0x77d80000, 0xd7e40000, 0xc6120000, 0xc3130000,
+	0xef8f8000, 0x23544000, 0x572ba000, 0xd87e1000, 0xd557d800, 0x5c3a2c00, 0xf3ee7a00, 0x38173d00,
+	0x2c162380, 0x1a0950c0, 0x310bfb20, 0x0a847f10, 0x3fd80138, 0x53e4019c, 0x68120146, 0x941302b1,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x38000000, 0x34000000, 0x1e000000, 0xf3000000,
+	0x86800000, 0xc6c00000, 0xf5a00000, 0x68700000, 0x07580000, 0xebec0000, 0x881a0000, 0x6c010000,
+	0x7a058000, 0xa50b4000, 0x799aa000, 0x6a483000, 0xde6bc800, 0xe8480c00, 0x2f6b6a00, 0xdfc13d00,
+	0xfe252280, 0x8b3270c0, 0xfaace860, 0xbce77d10, 0x38800298, 0x05c0021c, 0x6b2002e2, 0xeab00117,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x98000000, 0x84000000, 0x72000000, 0x73000000,
+	0xdd800000, 0x86400000, 0x4e600000, 0xff300000, 0x3ed80000, 0x04a40000, 0x61960000, 0x00510000,
+	0xe76f8000, 0x1da4c000, 0x0b0b2000, 0x49815000, 0x0c433800, 0xe96e6400, 0xc8be1a00, 0x4f8e3500,
+	0xe54aa380, 0x6be09040, 0xad699be0, 0x9abef750, 0x0c8f81a8, 0xf0d4c2dc, 0xf1b3233e, 0x15155295,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x18000000, 0x9c000000, 0x32000000, 0x3d000000,
+	0x5c800000, 0xb3400000, 0x83200000, 0x59700000, 0x90c80000, 0x19f40000, 0xd18e0000, 0xc7c90000,
+	0x447c8000, 0xfc57c000, 0x42bae000, 0x46a3b000, 0x28a1b800, 0x47a6ac00, 0xb6355a00, 0x41fc1f00,
+	0xed806380, 0x05c97140, 0xf169d9e0, 0x24dbdc30, 0x5ff282a8, 0xca9ec184, 0x1046603a, 0x38b47079,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x38000000, 0x94000000, 0xd6000000, 0x99000000,
+	0x03800000, 0x43400000, 0xc5a00000, 0x59f00000, 0x2ec80000, 0x4be40000, 0xa9ca0000, 0x9d790000,
+	0x9b198000, 0x6c964000, 0x09d2e000, 0x8d67d000, 0x7305d800, 0xf0897c00, 0x73d53a00, 0x5673af00,
+	0x3f836180, 0x295593c0, 0xf6bd3b60, 0x8967ae90, 0x8d0161b8, 0x15889334, 0x3a4eb8d6, 0xf638efa9,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x38000000, 0xa4000000, 0xb6000000, 0x29000000,
+	0x48800000, 0x7a400000, 0x9ba00000, 0x16f00000, 0x00d80000, 0xeef40000, 0x04ca0000, 0x88e90000,
+	0x25df8000, 0x5c6c4000, 0x4d98e000, 0x58d6b000, 0x3aeb9800, 0x6adb9c00, 0x35e17a00, 0xe3502d00,
+	0xab3f6180, 0x28bef1c0, 0x1d617b60, 0xe9102e50, 0xe89f6038, 0xaa4ef334, 0x93b9787a, 0x8ae42d8d,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x38000000, 0x1c000000, 0xd2000000, 0x51000000,
+	0xc9800000, 0x65c00000, 0x23600000, 0x21b00000, 0xb4580000, 0x8abc0000, 0x48d60000, 0x48fd0000,
+	0x1d608000, 0xeab3c000, 0x38db6000, 0x40fe9000, 0xa97ec800, 0x1cac7400, 0xa7cbaa00, 0x0a63e500,
+	0x543be080, 0x938d5340, 0xc0c5aa60, 0xbce2e630, 0x4b6d61a8, 0xe5b39034, 0x4a464aee, 0xa1a3b693,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xd8000000, 0xdc000000, 0x3a000000, 0x4d000000,
+	0x60800000, 0xf0c00000, 0x76a00000, 0xe5700000, 0xc0580000, 0xfe740000, 0x3fde0000, 0x57210000,
+	0x772c8000, 0x4736c000, 0xef31e000, 0x7b283000, 0x45384800, 0xee2fec00, 0xf9afaa00, 0x24e2dd00,
+	0xc21d6180, 0xa11ef340, 0xf289a8e0, 0x29c7dd30, 0x2837e188, 0xbebd3344, 0xa16acaea, 0xc6482cb7,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xc8000000, 0xcc000000, 0xd6000000, 0x3f000000,
+	0xc9800000, 0xe5400000, 0x65e00000, 0xb9300000, 0x11980000, 0x915c0000, 0x17f20000, 0xac2f0000,
+	0xf9188000, 0x4e9f4000, 0x88cf2000, 0xaaa1d000, 0xfdd51800, 0x923b5400, 0x7a02ba00, 0x3905c500,
+	0xae988080, 0x18df41c0, 0x52af21a0, 0xf9d1d3f0, 0x882d1878, 0x931757cc, 0xcf88ba7e, 0x8246c669,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x38000000, 0xf4000000, 0x26000000, 0x33000000,
+	0xe4800000, 0x95c00000, 0x42e00000, 0xbbb00000, 0xe0980000, 0x2bd40000, 0x55fa0000, 0x71310000,
+	0x8a418000, 0x5fae4000, 0x6e88a000, 0x04d3f000, 0x6b6ba800, 0x3df6a400, 0xcd228a00, 0x804b1500,
+	0x8ea18180, 0xa71e41c0, 0xb290a360, 0x7ec7f310, 0x6271a878, 0x3077a71c, 0x657b090a, 0x52f1579b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xb8000000, 0xcc000000, 0xd2000000, 0x99000000,
+	0x77800000, 0x35c00000, 0xe6e00000, 0x50b00000, 0x5d880000, 0x40c40000, 0xb37e0000, 0x54650000,
+	0xb8e68000, 0x3bb7c000, 0x431f6000, 0xaa8cd000, 0x1458c800, 0xfc2ca400, 0xfec12a00, 0xc867b700,
+	0xf2ee8180, 0x9eb3c340, 0x4e816160, 0x7259d370, 0x9b3649a8, 0xd25f6554, 0xab204896, 0x9a4e65b3,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xd8000000, 0x5c000000, 0x9e000000, 0x31000000,
+	0xf7800000, 0x0b400000, 0xf1e00000, 0x29300000, 0x61980000, 0xfe440000, 0xa4660000, 0xdd610000,
+	0x8ee88000, 0x77ac4000, 0xa14be000, 0xcaedd000, 0x95b91800, 0x3e4e1400, 0x847a7a00, 0xed7f8500,
+	0x06f08380, 0xf3a84040, 0x634de2e0, 0x65fcd030, 0x53299918, 0xc29655b4, 0x7ecf9ba6, 0x35b755e9,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x58000000, 0xbc000000, 0x6e000000, 0x85000000,
+	0xf7800000, 0xf9c00000, 0xb6a00000, 0x9ef00000, 0x40980000, 0x354c0000, 0xf5f20000, 0x720d0000,
+	0x1b148000, 0x0a9e4000, 0x024b6000, 0x79655000, 0x11464800, 0x47ec2c00, 0x0901aa00, 0x819b3d00,
+	0xe0de8280, 0x9f2f43c0, 0xba35e1e0, 0xbdba1030, 0x3c6ba8d8, 0x86da3ce4, 0x2e380066, 0x57bc00f3,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xd8000000, 0xcc000000, 0xba000000, 0x11000000,
+	0xb1800000, 0xbec00000, 0xd1600000, 0x98300000, 0xa4980000, 0x11440000, 0xb0b20000, 0x6fd50000,
+	0x40ea8000, 0xb6f2c000, 0x5df36000, 0x9d7b1000, 0x62326800, 0xd58bb400, 0x50d38a00, 0xd6766500,
+	0x72b88380, 0x62d7c2c0, 0x0361e2e0, 0xfd3dd0f0, 0x930b0988, 0xdc91a774, 0x0d41622e, 0x42ae13bf,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x08000000, 0x0c000000, 0x9e000000, 0x77000000,
+	0xf9800000, 0x04400000, 0x7c600000, 0x83b00000, 0xea880000, 0xbfdc0000, 0x89220000, 0x45570000,
+	0x0ef88000, 0xc8664000, 0xd9b32000, 0x2f9cd000, 0x9f443800, 0x0bffc400, 0xc8e79a00, 0x6b695700,
+	0xaa3a8280, 0xf6c143c0, 0xf7a3a0a0, 0x909690f0, 0x4add1a58, 0xa1a815ec, 0xcb99239e, 0x1d57d2cd,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x78000000, 0xac000000, 0x5a000000, 0x11000000,
+	0x53800000, 0xf3400000, 0x63e00000, 0xed300000, 0xca980000, 0x04cc0000, 0x2ea60000, 0x01dd0000,
+	0xeb328000, 0x898ac000, 0xa2436000, 0x10635000, 0x0e739800, 0xd16e5400, 0x45fa7a00, 0xbe3bc500,
+	0x14148280, 0x9617c140, 0x7b11e160, 0x2a9992f0, 0x74c8f888, 0x66b106f4, 0xc5d7e226, 0x65349289,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xd8000000, 0xc4000000, 0xb2000000, 0x1d000000,
+	0xf1800000, 0xe4400000, 0xfce00000, 0x34300000, 0xbd180000, 0x818c0000, 0x1c420000, 0x08fd0000,
+	0x5e338000, 0x6416c000, 0xc219e000, 0xe51f9000, 0x059fb800, 0x8e409400, 0x25f7da00, 0x77b4c500,
+	0x44420280, 0x8cfd01c0, 0xcc3383e0, 0x4916c3d0, 0xeb99e1a8, 0xc55f9364, 0x4b7fb90e, 0xa77097e5,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x28000000, 0x2c000000, 0x96000000, 0x07000000,
+	0x14800000, 0xd4c00000, 0x4c600000, 0x23300000, 0xc3180000, 0x8e840000, 0x15ca0000, 0x47e30000,
+	0xe7708000, 0xe1af4000, 0x70c62000, 0xe6607000, 0xca270800, 0xe48d9400, 0xdcdbaa00, 0x3061a500,
+	0xad2a0380, 0xc01301c0, 0x20088120, 0x501b4070, 0x181422f8, 0x040770ac, 0xba1d8a0a, 0x9101d74f,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x38000000, 0xe4000000, 0x4e000000, 0x7b000000,
+	0x80800000, 0x46c00000, 0x3f600000, 0xda300000, 0x17080000, 0xd29c0000, 0xb7c20000, 0xbae10000,
+	0x5f6b8000, 0x0a3d4000, 0x3f0aa000, 0x3e857000, 0x25ddc800, 0x6bf2b400, 0xeafeea00, 0xb76b8700,
+	0xc6220280, 0x9d1103c0, 0xd7838060, 0x74514350, 0x98a0a1d8, 0x68c8727c, 0x947c4b3a, 0x72b2f4f7,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xd8000000, 0x5c000000, 0xe2000000, 0xe5000000,
+	0x5d800000, 0x4ac00000, 0x10a00000, 0xcaf00000, 0xe9080000, 0x17940000, 0x4bda0000, 0x432d0000,
+	0x5f208000, 0x1d3fc000, 0x2824e000, 0x1da51000, 0xd36be800, 0x7dc9cc00, 0xb0358a00, 0xe1be1f00,
+	0xe17a0380, 0xf0dd01c0, 0x69a882e0, 0x156bc3b0, 0xf6dee0e8, 0x82b812e4, 0x97e36afe, 0x58920ebf,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x48000000, 0xfc000000, 0xca000000, 0x4d000000,
+	0xe1800000, 0x2a400000, 0x2a200000, 0xf0f00000, 0x2b180000, 0x6e840000, 0x1ad60000, 0xfbf30000,
+	0xf5868000, 0xec4ec000, 0x553ce000, 0x387f9000, 0x9ec87800, 0x15fb8c00, 0xa6841a00, 0xa6c9dd00,
+	0x51ee0380, 0x68870240, 0x45c880a0, 0x8379c0b0, 0xd84c6208, 0x233252c4, 0xdf6a18ae, 0xe24edd9d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x18000000, 0xec000000, 0x5a000000, 0xc3000000,
+	0x72800000, 0x67c00000, 0x33200000, 0x59700000, 0xcd080000, 0x17840000, 0x445a0000, 0x21650000,
+	0xd10e8000, 0xb58ec000, 0x5b4f2000, 0x11f03000, 0x99d1a800, 0xae2f1c00, 0xa6ea0a00, 0x9d44ef00,
+	0xb0f20180, 0x145103c0, 0xc97c83e0, 0xc51fc370, 0x3393a108, 0xda5ff0bc, 0x4c6a08a2, 0xd684ee93,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x58000000, 0x4c000000, 0x8e000000, 0x5d000000,
+	0x15800000, 0xd6400000, 0x2e200000, 0x84f00000, 0x5b080000, 0x0c8c0000, 0xc9d20000, 0x0f6d0000,
+	0x78528000, 0x83204000, 0x697e6000, 0xf1471000, 0xf4bf7800, 0x5c348c00, 0xcfe19a00, 0xff8edf00,
+	0x715a0080, 0x34a103c0, 0xfc2083e0, 0xfffd41f0, 0xa784e358, 0x3d5b5044, 0xbabb1a6e, 0xa1229e2d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x84000000, 0xe6000000, 0x13000000,
+	0x78800000, 0xafc00000, 0x1ee00000, 0xccb00000, 0xde080000, 0x27040000, 0x768e0000, 0x30c10000,
+	0x9c638000, 0x127c4000, 0x4d76a000, 0x2ff97000, 0x613ce800, 0x6a432400, 0xe6afca00, 0x17031700,
+	0x5e880180, 0x5cc40140, 0xf66e01e0, 0xfb710050, 0x44eb81f8, 0x0db8425c, 0xbb98a27a, 0x6f4872f3,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x28000000, 0x8c000000, 0x2a000000, 0x9b000000,
+	0xe7800000, 0xfb400000, 0x86200000, 0x43f00000, 0xae080000, 0x4d0c0000, 0xde820000, 0xbbd30000,
+	0x98f48000, 0x2984c000, 0xa64e2000, 0xc0bb9000, 0x5c259800, 0x90e2ac00, 0xd5953a00, 0x0442ff00,
+	0x67a80080, 0xb9bc01c0, 0x7caa0220, 0x9e2f00f0, 0x27fe8008, 0xa81bc05c, 0x4c18a336, 0x8a1c5181,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0x3c000000, 0xda000000, 0x53000000,
+	0x2e800000, 0x11400000, 0x94a00000, 0x7e700000, 0xac080000, 0x02040000, 0x771a0000, 0x309f0000,
+	0x6c5e8000, 0x0f3cc000, 0xc8a12000, 0x5467b000, 0xd713f800, 0x2092bc00, 0x745e5a00, 0xcb22cf00,
+	0xe6a00180, 0xe17003c0, 0x708800a0, 0x4c440030, 0xdf3a0048, 0x30af01bc, 0xa07683d2, 0x3108c109,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x28000000, 0x54000000, 0xba000000, 0x85000000,
+	0x43800000, 0x29c00000, 0x70e00000, 0x81b00000, 0x4c080000, 0xa60c0000, 0xbb1a0000, 0x248b0000,
+	0x934f8000, 0xf4bdc000, 0xe797e000, 0x7bc0d000, 0x01f94800, 0x08352400, 0xc8d32a00, 0xc17f3700,
+	0xa9600080, 0x9d7002c0, 0xf7680220, 0x2a7c0090, 0x15f20248, 0xd2370344, 0x9ddd83e6, 0xdafac2b3,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x18000000, 0xec000000, 0xf2000000, 0xa1000000,
+	0x8e800000, 0xcbc00000, 0xdd200000, 0xe7900000, 0x2a080000, 0xed040000, 0xec8e0000, 0x02c70000,
+	0xa7a18000, 0x325ec000, 0xa4272000, 0x251e1000, 0x83cee800, 0xf92fbc00, 0x71925200, 0xfd0fb900,
+	0xc4880080, 0x16c40040, 0xc9ae00e0, 0x79570070, 0x67a98018, 0x925ac0ec, 0x342920f2, 0x4d1910a1,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x18000000, 0xbc000000, 0xce000000, 0xab000000,
+	0xbe800000, 0x98400000, 0x17200000, 0x17500000, 0xe2080000, 0xbd0c0000, 0x89820000, 0xf8c10000,
+	0x3c618000, 0x02fbc000, 0xa314e000, 0xe32eb000, 0x9d55e800, 0x0b028400, 0x6e8df200, 0xa0493500,
+	0xbb280080, 0xc15c00c0, 0xf50a0020, 0xcd8d0010, 0xbac38018, 0x516ac0bc, 0xb37d60ce, 0xf7d970ab,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xb8000000, 0x84000000, 0xd6000000, 0x83000000,
+	0xdc800000, 0x6f400000, 0x56200000, 0x80b00000, 0x5a080000, 0xc90c0000, 0x9d860000, 0xaecf0000,
+	0x5aeb8000, 0x37584000, 0xb6d56000, 0x1a1c3000, 0x3dffc800, 0x992bf400, 0x763be200, 0x844acb00,
+	0xe6a80080, 0x95fc00c0, 0x952e0060, 0xfc3300f0, 0xa54580b8, 0xd72b4084, 0x2130e0d6, 0xa6c77083,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x38000000, 0xd4000000, 0xca000000, 0xa7000000,
+	0xd9800000, 0xc8c00000, 0x9ce00000, 0xec500000, 0x76080000, 0xf10c0000, 0x38860000, 0x184b0000,
+	0xd8a38000, 0x12fd4000, 0xddf4a000, 0x987e7000, 0x16bf9800, 0x83558c00, 0xe3834e00, 0xf7c10500,
+	0x41680080, 0x669c00c0, 0xa1ee0060, 0xdad700b0, 0xeb4d8038, 0x0b2a40d4, 0x1d3920ca, 0x289430a7,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x78000000, 0xec000000, 0x52000000, 0x13000000,
+	0x43800000, 0xd0c00000, 0x9de00000, 0x1f900000, 0x5b080000, 0x97840000, 0xceca0000, 0x6ceb0000,
+	0x37178000, 0x2446c000, 0x88a12000, 0x5fbb3000, 0x6bf73800, 0x2b568c00, 0xe0e11e00, 0x3511d900,
+	0x5f4a0080, 0xef2b0040, 0x497780a0, 0x5b16c0b0, 0x36492078, 0x3baf30ec, 0xac353852, 0xc3398c13,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xa8000000, 0xc4000000, 0x2e000000, 0xdb000000,
+	0x3f800000, 0xf0400000, 0x85200000, 0x18100000, 0xdd080000, 0x60840000, 0x01ce0000, 0x1e6b0000,
+	0x0aba8000, 0xf1544000, 0x16aee000, 0xa257b000, 0xfd2ef800, 0x841a8400, 0x7f089200, 0xe1802100,
+	0x63460080, 0xceaf0040, 0x6e5480e0, 0x472f40b0, 0x691c60a8, 0xf787f0c4, 0xc44e182e, 0xe32634db,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x38000000, 0xbc000000, 0xea000000, 0xd9000000,
+	0x16800000, 0xb6c00000, 0xcce00000, 0x2dd00000, 0x3f080000, 0x7d8c0000, 0x954a0000, 0x4eaf0000,
+	0x0af38000, 0x9eb3c000, 0xea9aa000, 0xd4a39000, 0x2bf86800, 0x9435ec00, 0x465f8e00, 0xf94a3d00,
+	0xaca20080, 0xf7f300c0, 0x2e3180a0, 0x5750c0f0, 0x6bc32038, 0x4c6f50bc, 0x081948ea, 0xcc69bcd9,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xd8000000, 0xe4000000, 0xb6000000, 0x57000000,
+	0x28800000, 0x08c00000, 0x9ea00000, 0x3ef00000, 0x08880000, 0x18c40000, 0x16ae0000, 0xb2fb0000,
+	0x82858000, 0x1dca4000, 0xdf256000, 0xc5be7000, 0x3c670800, 0xb55acc00, 0x77f48a00, 0xeb019f00,
+	0x3a858080, 0x09ca4040, 0x512560e0, 0xc6be70b0, 0x7ae708d8, 0x0e9acce4, 0x77d48ab6, 0x8a319f57,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x78000000, 0x94000000, 0x6a000000, 0xdb000000,
+	0x60800000, 0xea400000, 0xed600000, 0xe9500000, 0x08880000, 0x96440000, 0xbb660000, 0x045b0000,
+	0x350f8000, 0x398d4000, 0x6dc0a000, 0x51a6b000, 0xb3718800, 0x493fe400, 0x4c547600, 0x99092500,
+	0xa78f8080, 0x6ccd4040, 0x9220a060, 0xadb6b0b0, 0x24198878, 0x936be494, 0x185a766a, 0xd30625db,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x68000000, 0x2c000000, 0x36000000, 0x13000000,
+	0x63800000, 0x62400000, 0x78a00000, 0x89300000, 0x0f880000, 0x344c0000, 0xfbaa0000, 0xb2b30000,
+	0x29ce8000, 0x56eec000, 0x57996000, 0xcdba3000, 0x1c44b800, 0xb7a2e400, 0x14bdea00, 0x62c42300,
+	0x716e8080, 0x2fdec0c0, 0x901160a0, 0xe5f63030, 0xb9eeb868, 0x3a11e42c, 0x68f36a36, 0x456ae313,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x28000000, 0x04000000, 0x4a000000, 0xad000000,
+	0xce800000, 0xffc00000, 0x45200000, 0x19900000, 0x92880000, 0x79cc0000, 0xb6220000, 0x28130000,
+	0x22ca8000, 0x43ac4000, 0xf256a000, 0x85a1d000, 0xe1526800, 0xa425bc00, 0x491ff200, 0xb243c900,
+	0x436a8080, 0xf8fc40c0, 0xe37ea020, 0x2e3dd030, 0xe2d86828, 0x456abc04, 0xcbff724a, 0xf2f089ad,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x78000000, 0x74000000, 0xf6000000, 0x5f000000,
+	0x7f800000, 0x5d400000, 0xe0e00000, 0xf0100000, 0x99880000, 0xea4c0000, 0xc3620000, 0x27570000,
+	0xdc6f8000, 0xb8db4000, 0xd1256000, 0x503ef000, 0x2d3a7800, 0x4bb19400, 0x6e70ee00, 0xa85cb100,
+	0x6be78080, 0xc99740c0, 0xc3c76020, 0x7129f070, 0xe035f878, 0x753ad474, 0x4fbd8ef6, 0xe07e415f,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xa8000000, 0xe4000000, 0x66000000, 0x11000000,
+	0xff800000, 0x30c00000, 0x90a00000, 0x72700000, 0xd1880000, 0x75cc0000, 0xd12a0000, 0xcfbd0000,
+	0x94a28000, 0xa4724000, 0x18846000, 0x16401000, 0xcbef7800, 0xcc104c00, 0x6e5dea00, 0xabbc7700,
+	0x32aa8080, 0x157e40c0, 0x370e60a0, 0x8e8d10d0, 0xbf45f8a8, 0xd86e0ce4, 0xaed38a66, 0x21f16711,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xe8000000, 0x4c000000, 0x0e000000, 0x49000000,
+	0x93800000, 0x81c00000, 0x49600000, 0xdc300000, 0x51880000, 0x86c40000, 0xb3e20000, 0x3e7f0000,
+	0x71268000, 0x5f90c000, 0x305ae000, 0xa0379000, 0xd789b800, 0x53c5dc00, 0x3667f600, 0x52bc1300,
+	0xe9ce8080, 0x4564c040, 0xf230e020, 0xe88c90f0, 0xfd4d38e8, 0x7e2a1c4c, 0x791b960e, 0xe41b4349,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x68000000, 0x8c000000, 0xe6000000, 0xbf000000,
+	0x3d800000, 0x85c00000, 0x59a00000, 0x67d00000, 0x47880000, 0x54c40000, 0x272a0000, 0x819d0000,
+	0xc0ee8000, 0x3d3cc000, 0xdbbc6000, 0x49faf000, 0x6c935800, 0x006b9c00, 0xf07e7a00, 0xb35ccd00,
+	0x18c68080, 0x2128c040, 0x4e9e60a0, 0x4563f0d0, 0x5cf7d868, 0xe81a5c8c, 0x77249ae6, 0xa99efdbf,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xb8000000, 0x54000000, 0x5e000000, 0xfb000000,
+	0xbd800000, 0xe6400000, 0x8be00000, 0x12900000, 0xa6880000, 0xcbcc0000, 0xb5a60000, 0x9d750000,
+	0x52138000, 0xc2414000, 0x9defe000, 0x359cb000, 0xf90d5800, 0x648ca400, 0x72ce1e00, 0x712e7900,
+	0xdfb58080, 0xcb3440c0, 0xf1fc6060, 0x5cddf050, 0x6162b8b8, 0xe3501454, 0x5e23465e, 0xfc32ddfb,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0xd4000000, 0xf2000000, 0xc9000000,
+	0x43800000, 0x30400000, 0x41600000, 0xb7f00000, 0xf6880000, 0xf5cc0000, 0xba260000, 0x04190000,
+	0x0eb68000, 0x54694000, 0x82752000, 0x75cb9000, 0x7a2fb800, 0x6416c400, 0x9eb77600, 0xbc624f00,
+	0x56708080, 0x87c040c0, 0xb32ba060, 0x279ed090, 0xaef498e8, 0xfd0854d4, 0xe1884ef2, 0x7144cbc9,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xe8000000, 0xb4000000, 0xfa000000, 0x09000000,
+	0x31800000, 0xd8c00000, 0x35200000, 0x25900000, 0xda880000, 0xfc440000, 0xb2620000, 0x4b770000,
+	0x1ab68000, 0x5e174000, 0x8341a000, 0x1ce19000, 0x2d389800, 0xf1d74c00, 0xbce53200, 0x1d302900,
+	0x39dc8080, 0x78e44040, 0x0f352020, 0x84d1d070, 0xb367b8e8, 0xdef59cb4, 0x80760afa, 0x4e35f509,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x68000000, 0x3c000000, 0x86000000, 0xb5000000,
+	0x36800000, 0x49400000, 0xa3200000, 0xc0700000, 0x9d880000, 0xeecc0000, 0xbee20000, 0xdd190000,
+	0xaf5e8000, 0xc3f7c000, 0x224e6000, 0x24ac5000, 0x4dbee800, 0xe8e0d400, 0xe01b1200, 0x15d6f700,
+	0xf4b48080, 0x6062c0c0, 0x6852e020, 0xaa729090, 0x26860868, 0xe147443c, 0xbf219a86, 0xd67f73b5,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x8c000000, 0x1e000000, 0xd1000000,
+	0x98800000, 0x15c00000, 0x5fe00000, 0xaeb00000, 0x65c80000, 0x27ec0000, 0x6ab60000, 0x67c10000,
+	0xc0ee8000, 0xaf3ec000, 0xf480e000, 0x5bc39000, 0xc6e74800, 0x2a39bc00, 0x46026e00, 0x2507a300,
+	0x4280e080, 0xc6c390c0, 0x20674860, 0x7ef9bc90, 0xa9626e28, 0x1277a38c, 0x66a8e09e, 0x9e9f9011,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xd8000000, 0xe4000000, 0xe2000000, 0x7b000000,
+	0x59800000, 0xa0c00000, 0x12a00000, 0x20b00000, 0xbcc80000, 0x04ac0000, 0xb1b60000, 0x12430000,
+	0x23e18000, 0x7ed84000, 0xe0dd2000, 0x3dde3000, 0x2d59d800, 0xc71d2c00, 0x10f21a00, 0x842d5300,
+	0x93fd2080, 0x29ae30c0, 0xd931d860, 0xcc012cb0, 0x7e0c1ad8, 0xad0253e4, 0xa88aa062, 0xbe4570bb,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x58000000, 0x44000000, 0x86000000, 0xdf000000,
+	0x1f800000, 0xa4400000, 0x29e00000, 0xced00000, 0xa8480000, 0x03e40000, 0xebd60000, 0x5ac70000,
+	0xb9218000, 0xe2f24000, 0x803f6000, 0x8d147000, 0xb1efb800, 0xaadf2400, 0xbe4bee00, 0x74e7d500,
+	0xe85f6080, 0x3c847040, 0xc9c7b860, 0xecab24f0, 0x93b5ee58, 0x0354d544, 0xbd00e006, 0x9685309f,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xc8000000, 0x74000000, 0xda000000, 0x9f000000,
+	0x13800000, 0x80400000, 0x47600000, 0x6e100000, 0xce480000, 0xf2640000, 0x9a920000, 0x71810000,
+	0x53488000, 0x82e54000, 0x8754a000, 0x63ad7000, 0x3eb27800, 0xc57fa400, 0xa6588600, 0xbd255900,
+	0x667ca080, 0x5bd97040, 0x58687820, 0x3d9aa490, 0x6e0206c8, 0x25011974, 0x3c80805a, 0xcbc140df,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x28000000, 0xfc000000, 0x96000000, 0x13000000,
+	0xe3800000, 0x96400000, 0x0f600000, 0x2b300000, 0x14480000, 0x56640000, 0x3db60000, 0x4a890000,
+	0xf8c68000, 0xe5a9c000, 0xff986000, 0x615bb000, 0xeffdf800, 0x47ea0400, 0xcaf2c600, 0x87610b00,
+	0xe7306080, 0xda4fb040, 0x8163f860, 0x9c370410, 0xa5ca4628, 0x9125cbfc, 0xa8588016, 0x9174c053,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xa8000000, 0x14000000, 0x5a000000, 0xa9000000,
+	0xbc800000, 0x80400000, 0xf3e00000, 0xa0500000, 0xb6480000, 0xece40000, 0x43d20000, 0xf58b0000,
+	0x6cce8000, 0xcba34000, 0xdfb6a000, 0xf0181000, 0xbda68800, 0xe0bba400, 0x239cae00, 0x56644d00,
+	0x749ea080, 0xf1ec1040, 0xd55c8820, 0x54c4a430, 0x07a82ea8, 0x19b80d14, 0x271c80da, 0x5a2840e9,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x18000000, 0x84000000, 0xee000000, 0x45000000,
+	0x7e800000, 0xe2c00000, 0x64a00000, 0x5a900000, 0x0bc80000, 0x28240000, 0xf7560000, 0x0ae30000,
+	0xb3f58000, 0x80764000, 0x1039e000, 0x345fd000, 0x8d6ea800, 0x95b84c00, 0x051eda00, 0x89826100,
+	0x934fe080, 0x83ecd040, 0x4f732860, 0x35ba0cb0, 0x95193a18, 0x418ab184, 0xbf4ac86e, 0xf1e5dc05,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xf8000000, 0x3c000000, 0x22000000, 0x07000000,
+	0xf9800000, 0x0f400000, 0x55e00000, 0x74b00000, 0xaa480000, 0xeb640000, 0x227a0000, 0x20e50000,
+	0x323b8000, 0xc081c000, 0x43cb2000, 0xfc25f000, 0x3b915800, 0x5e555400, 0x5b7aee00, 0xcc6cf300,
+	0x4bf92080, 0x77a4f040, 0x8bd0d8a0, 0x6e3194d0, 0xd28a4ef8, 0xccc8c33c, 0x11a358a2, 0xd2d45447,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x88000000, 0x84000000, 0x92000000, 0x4d000000,
+	0x95800000, 0x3cc00000, 0x50200000, 0x92900000, 0x13c80000, 0x20ac0000, 0xefde0000, 0xd5230000,
+	0xa3148000, 0xed0e4000, 0x058e2000, 0xe4c25000, 0xec2a1800, 0x0c926c00, 0x48c19200, 0x6a255100,
+	0x0b982080, 0x2c4d50c0, 0x5d6098e0, 0x3c7f2cb0, 0xa47b3288, 0x38794184, 0xf6741812, 0x95716c8d,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x48000000, 0x8c000000, 0x3e000000, 0xeb000000,
+	0xb3800000, 0xa1c00000, 0x2f600000, 0x48900000, 0x82480000, 0xd6a40000, 0xf3fe0000, 0x80d30000,
+	0x45e88000, 0xcfd2c000, 0xb46ee000, 0x13153000, 0xff817800, 0x3fce3c00, 0x94652600, 0x0312c100,
+	0xe7866080, 0x4bc7f040, 0x6e6f98e0, 0x5a1b0cb0, 0x81045e48, 0xb28cfd8c, 0x534b46be, 0x9c2131ab,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xf8000000, 0x64000000, 0x0a000000, 0x43000000,
+	0x10800000, 0x0b400000, 0x36a00000, 0xfe300000, 0xf3c80000, 0x91ec0000, 0x3e960000, 0xd0f70000,
+	0xc3ab8000, 0x93bc4000, 0xc901a000, 0x9388b000, 0x7bcec800, 0xcde95400, 0x30987a00, 0x69f49b00,
+	0x682a2080, 0xec74f0c0, 0xfeef6860, 0x1811e4f0, 0x66beb2f8, 0xa481cf64, 0xa94c5a8a, 0x79ab6b83,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x38000000, 0x44000000, 0x4a000000, 0x57000000,
+	0xa6800000, 0x3f400000, 0xbda00000, 0xb6900000, 0x5dc80000, 0x88e40000, 0x3c360000, 0xfdd30000,
+	0xd26f8000, 0x4d764000, 0x3d71a000, 0x2571f000, 0xb177a800, 0x73721400, 0x58788a00, 0xf0f2b100,
+	0xd2be2080, 0x9e97b040, 0xb1ce0860, 0x6ee7e4b0, 0xed392238, 0x3a53a544, 0x12a92aca, 0x74134117,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x38000000, 0x3c000000, 0xd6000000, 0xbd000000,
+	0x4c800000, 0xc0400000, 0xbe200000, 0xd6300000, 0xf8c80000, 0xec640000, 0xdf1e0000, 0xf9770000,
+	0x1d6f8000, 0x3d99c000, 0x58346000, 0xc9cb5000, 0xaeee8800, 0x6e53a400, 0xe5d9d200, 0x8a1e3b00,
+	0xe1fbe080, 0x1f229040, 0x1cb2e8e0, 0xad8cf4f0, 0xeac15a38, 0x1b6e9f3c, 0xe89bb256, 0x00b66bfd,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0xf4000000, 0xe2000000, 0x25000000,
+	0x92800000, 0x62400000, 0x0e200000, 0x02b00000, 0x1cc80000, 0xe26c0000, 0x679a0000, 0x47f50000,
+	0x15668000, 0x48194000, 0x1b312000, 0x9709d000, 0x5f82e800, 0xa4c04400, 0x5e631200, 0x01969300,
+	0x78f7a080, 0x7ee090c0, 0xaedbc8a0, 0xb05594d0, 0x2c13fa28, 0xb13fd7f4, 0x36003262, 0xd70643e5,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xe8000000, 0xac000000, 0xd6000000, 0x1f000000,
+	0x53800000, 0x24c00000, 0x25a00000, 0x3fd00000, 0xf1480000, 0x46640000, 0x2df20000, 0x60570000,
+	0xb3828000, 0xb4ccc000, 0x1da06000, 0x8bd07000, 0x63497800, 0x2361ec00, 0xb77cca00, 0x08103500,
+	0xe16ae080, 0x8a78b040, 0xf69b1820, 0x03269cf0, 0xf99732e8, 0x28ad19ac, 0x495e4a56, 0x6f0cf55f,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x18000000, 0x04000000, 0x46000000, 0x5d000000,
+	0x61800000, 0x2d400000, 0xfd600000, 0x5d300000, 0x96c80000, 0x8f240000, 0xfad20000, 0x0a350000,
+	0xb04d8000, 0xfce64000, 0x807b6000, 0xa3a15000, 0xce13d800, 0x2e1cf400, 0x9e1f6600, 0x76199b00,
+	0xba1ee080, 0xe0131040, 0xff12b820, 0x859ca4d0, 0x945b3e18, 0x25f22f04, 0xa8e566c6, 0x9e789b1d,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x68000000, 0x84000000, 0x9a000000, 0xc7000000,
+	0x4c800000, 0x37400000, 0xd4600000, 0xe5700000, 0x64c80000, 0x83ac0000, 0x78560000, 0x38db0000,
+	0xe1928000, 0x60fa4000, 0xba08a000, 0x5703f000, 0x748f0800, 0xeb471400, 0xa2665600, 0x3c770f00,
+	0x754c2080, 0x3f62b0c0, 0xd7f52860, 0x3e8ea430, 0xb449fe68, 0x62efeb84, 0x253b7e1a, 0x9425ab07,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x38000000, 0xc4000000, 0xf6000000, 0x9b000000,
+	0xf7800000, 0xaa400000, 0x66600000, 0x32900000, 0x42c80000, 0xadac0000, 0x15ba0000, 0x09b50000,
+	0x8bb78000, 0xaeb24000, 0xee3c6000, 0xb9f93000, 0xdcd3b800, 0x12a90400, 0xa4347600, 0x70fa4100,
+	0x3651e080, 0x3c6e70c0, 0x639058a0, 0xbc4e74d0, 0x4d61ae38, 0x8d1f75c4, 0xc481ae76, 0xc1cf755b,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xd8000000, 0xf4000000, 0xea000000, 0xbd000000,
+	0x5b800000, 0xddc00000, 0x4d200000, 0xfd500000, 0xbf480000, 0x396c0000, 0x84ba0000, 0x4eb70000,
+	0xc3b98000, 0xe0314000, 0x39ffa000, 0x46d75000, 0xf2867800, 0xfc48bc00, 0xa5e66200, 0x37f2dd00,
+	0x59dc2080, 0x680110c0, 0x4c0858a0, 0x4e02acf0, 0x7f05bad8, 0xca8a31f4, 0x984dba6a, 0xc7e6317d,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xf8000000, 0xec000000, 0xfa000000, 0xeb000000,
+	0xc2800000, 0x5c400000, 0x37e00000, 0x40f00000, 0xd7e80000, 0x50f40000, 0x7fea0000, 0x34f30000,
+	0x91e58000, 0xc9fdc000, 0x426a2000, 0xbc337000, 0xeb460800, 0x9766b400, 0x4bbd7600, 0x508ebb00,
+	0xb3460880, 0x4b66b440, 0x69bd7620, 0x278ebb70, 0x73c60878, 0x1026b4ac, 0x66dd76da, 0xd03ebb9b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x28000000, 0x9c000000, 0xe6000000, 0x59000000,
+	0x7c800000, 0x5e400000, 0x35e00000, 0xea300000, 0x01e80000, 0x503c0000, 0x1ee20000, 0x65bd0000,
+	0x14208000, 0x9214c000, 0x2dfee000, 0x20c95000, 0x00ad2800, 0x3052b400, 0x4e117600, 0xabf19700,
+	0xc9cd2880, 0x4422b4c0, 0xda1976a0, 0x01fd9710, 0xfec728a8, 0xeda3b45c, 0x36dbf646, 0xaf545749,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x38000000, 0xbc000000, 0x76000000, 0x9d000000,
+	0x26800000, 0x6f400000, 0x57600000, 0xd6f00000, 0x33680000, 0x2cf40000, 0x906a0000, 0x43710000,
+	0x2ba98000, 0x2c5ac000, 0x67bee000, 0x1d0b1000, 0x66808800, 0x4f43e400, 0x0766fe00, 0xeefa0b00,
+	0x8f608880, 0x5af3e440, 0x0d6efe20, 0x65fe0b50, 0x44e288b8, 0x7b36e4fc, 0xb14d7e56, 0x2e65cbcd,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x58000000, 0x54000000, 0x26000000, 0x4b000000,
+	0x05800000, 0x95c00000, 0xc4e00000, 0x2df00000, 0x12e80000, 0x4ef40000, 0x2b6e0000, 0xa1310000,
+	0x8e8b8000, 0xb0444000, 0x6121e000, 0xe114f000, 0x331fb800, 0x2e14ac00, 0x08947600, 0xc4d03300,
+	0xbff7b880, 0x6fe0ac40, 0x387a7660, 0xbf213350, 0x8e1c38d8, 0x7894ec14, 0xacd39646, 0xe3f1c31b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x98000000, 0x34000000, 0x52000000, 0x45000000,
+	0x63800000, 0x23c00000, 0xdc200000, 0xc8f00000, 0x06280000, 0xd1fc0000, 0x3ba20000, 0xe13f0000,
+	0x0b0b8000, 0x188c4000, 0xc346a000, 0xbb641000, 0x899a9800, 0x66bd2c00, 0xb2cada00, 0xbdace300,
+	0xa6329880, 0x25812cc0, 0xc4c8daa0, 0xc2a3e330, 0x8cb11818, 0x33c16cf4, 0xb4247af2, 0xc4f4f375,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x98000000, 0xac000000, 0x32000000, 0x29000000,
+	0x14800000, 0x02c00000, 0xcde00000, 0xadf00000, 0xb3e80000, 0xa6fc0000, 0xc6620000, 0xf4bb0000,
+	0x0f4b8000, 0x23a1c000, 0x1ed0a000, 0x09f75000, 0xa5efe800, 0x59fe7c00, 0x8debb600, 0xcdfae300,
+	0x63e7e880, 0x4ef27cc0, 0xf261b6a0, 0x6abde370, 0x144e6818, 0x1e28bc6c, 0x089a9692, 0xc6db7359,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x98000000, 0xb4000000, 0xde000000, 0x61000000,
+	0xca800000, 0x63c00000, 0x39200000, 0xc9300000, 0x6b280000, 0x923c0000, 0xa6aa0000, 0x7e750000,
+	0x70c38000, 0x38ae4000, 0xff766000, 0x0a4c5000, 0x5364c800, 0xea596c00, 0xa973da00, 0x87413f00,
+	0xd3ecc880, 0xa6956cc0, 0xa3d1da20, 0x53383f90, 0x3c2d4818, 0xa5b22c74, 0x6dee3afe, 0xb79f2ff1,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xb8000000, 0x3c000000, 0x82000000, 0x79000000,
+	0x1d800000, 0xf6400000, 0x67a00000, 0x8d300000, 0x82a80000, 0x22b40000, 0xc5ee0000, 0xcc950000,
+	0xb8958000, 0xee9ec000, 0xf199a000, 0x3b1f5000, 0x93d97800, 0x5abbb400, 0xd9ecc200, 0x3e934700,
+	0x69977880, 0x771eb440, 0xb9d14260, 0xa7b98710, 0x7a60d838, 0x33d4e47c, 0x6abdbae2, 0x11ecf369,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x88000000, 0x34000000, 0xd6000000, 0xe5000000,
+	0x25800000, 0x89c00000, 0xa2600000, 0x93b00000, 0xe3680000, 0xd8340000, 0x53ae0000, 0xcdd30000,
+	0xf2d68000, 0x78584000, 0xc31fe000, 0x06301000, 0xc2aab800, 0x5e580c00, 0xee17de00, 0x77b25700,
+	0xed64b880, 0x913b0c40, 0x6c295e60, 0xcb1e1770, 0x72355808, 0x74a81c74, 0xcb5d66b6, 0x439a5b95,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xa8000000, 0xe4000000, 0x2e000000, 0xc7000000,
+	0xfe800000, 0x22c00000, 0xfae00000, 0xf2300000, 0x7be80000, 0xcfb40000, 0x79a20000, 0x28910000,
+	0xc3f88000, 0x49874000, 0x64466000, 0x342d3000, 0x92d28800, 0xc8d29c00, 0x69d0e600, 0x44559f00,
+	0x4e188880, 0x1d379c40, 0x216a66a0, 0x6373df50, 0x144e6828, 0x8c29eca4, 0x7edc8e8e, 0x52dd7397,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x98000000, 0xd4000000, 0x1e000000, 0xe5000000,
+	0x6b800000, 0xb9400000, 0x56e00000, 0x33700000, 0xed680000, 0x423c0000, 0x678a0000, 0x93470000,
+	0x3deb8000, 0x95f64000, 0x73a06000, 0x679f1000, 0xf91d5800, 0xc3dac400, 0x407c5600, 0x5fe8e300,
+	0xe2f6d880, 0x172c84c0, 0xfe5c3620, 0x0037f3b0, 0xa08b8018, 0x6fc64014, 0x7028603e, 0x72d31055,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xe8000000, 0x0c000000, 0x22000000, 0xa3000000,
+	0xd0800000, 0x8bc00000, 0x44a00000, 0x13f00000, 0x0c280000, 0xac3c0000, 0x6e860000, 0x22cd0000,
+	0xdb208000, 0x7ab1c000, 0x8844a000, 0x27e6f000, 0xd8912800, 0x657b8c00, 0xdae3c200, 0xb11b4300,
+	0x9931a880, 0xfb0a4cc0, 0x048762e0, 0xbdcdb310, 0x31a88068, 0xa67dc0cc, 0xda6aa0c2, 0x32d7f0b3,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x88000000, 0x24000000, 0x5e000000, 0x85000000,
+	0xb6800000, 0x01c00000, 0xf2200000, 0x42f00000, 0x6aa80000, 0x5e3c0000, 0xa20a0000, 0xb7010000,
+	0x698a8000, 0xbc4f4000, 0x486d6000, 0x239a1000, 0x85b68800, 0x014c4c00, 0x62ea4a00, 0x205b3300,
+	0xd0940880, 0x823f0cc0, 0x400d2a20, 0xe00023d0, 0xf0080008, 0x580c00e4, 0xac02007e, 0x7a0d0055,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x98000000, 0x94000000, 0x6e000000, 0xa3000000,
+	0x96800000, 0x3e400000, 0x56200000, 0x91700000, 0xbba80000, 0xcdbc0000, 0x6dc20000, 0x41eb0000,
+	0xdd938000, 0xf3b64000, 0xe6cb6000, 0x7b657000, 0x69d28800, 0xf09f5400, 0xd638ca00, 0x060b5300,
+	0x6f030880, 0xcc8214c0, 0x83402aa0, 0xfba86370, 0xadb2e018, 0xbdc43054, 0xa9e868ce, 0xd19764d3,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x5c000000, 0x7a000000, 0xcd000000,
+	0x80800000, 0x5e400000, 0x4ce00000, 0x5b100000, 0x5b680000, 0x58dc0000, 0x31420000, 0x9d610000,
+	0x5fdf8000, 0x54c0c000, 0x97ae2000, 0x33731000, 0xa83aa800, 0xa058b400, 0x23070600, 0x538cf500,
+	0x45cf2880, 0xad2574c0, 0x0034a6a0, 0xb45e25d0, 0xfd0420d8, 0x688e109c, 0x2a4728da, 0xe2e9741d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xb8000000, 0x94000000, 0x1a000000, 0x4b000000,
+	0xa5800000, 0x7bc00000, 0x48600000, 0xd2700000, 0xe4e80000, 0xa33c0000, 0x60c20000, 0x35ed0000,
+	0x8db18000, 0x1e804000, 0x16462000, 0xafa7f000, 0xbc1af800, 0x4b908c00, 0x27539e00, 0x4cb53b00,
+	0x88017880, 0xfc01ccc0, 0x96063ea0, 0xd50f8b10, 0x4c842038, 0x014af054, 0x8c2b78ba, 0xaad0cc5b,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x08000000, 0x5c000000, 0x62000000, 0x81000000,
+	0xed800000, 0x87c00000, 0x6e600000, 0x9e300000, 0x58e80000, 0xf1740000, 0x4aca0000, 0xa9ed0000,
+	0xe4f28000, 0x2904c000, 0x6182a000, 0xcdcfd000, 0x2361f800, 0x19b0ec00, 0x0225fe00, 0x1093bf00,
+	0xd2317880, 0x72ed2c40, 0x0c7fde20, 0x5545af90, 0xa728a088, 0x3b12d01c, 0x52fb7842, 0xd6002c11,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xb8000000, 0xec000000, 0x66000000, 0x23000000,
+	0xab800000, 0xadc00000, 0x1b600000, 0x17100000, 0x09e80000, 0x0c5c0000, 0xabca0000, 0x88690000,
+	0x74998000, 0xa023c000, 0x2531e000, 0x15d6f000, 0x6f0dd800, 0x5d8d6c00, 0x16c2ce00, 0x0ce34d00,
+	0x64d65880, 0xdd8bacc0, 0xd6c8ae20, 0x2ce37d50, 0x34d9e038, 0x658af02c, 0x3ac7d846, 0x4ae46c73,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xd8000000, 0x44000000, 0x7e000000, 0x61000000,
+	0x23800000, 0x7ec00000, 0xf1200000, 0x26500000, 0x1fe80000, 0xcf7c0000, 0x1dbe0000, 0xbe950000,
+	0x6bcf8000, 0xc4af4000, 0xd59d6000, 0x3f46d000, 0x14e01800, 0x8bf45c00, 0x15f5da00, 0xa4f82100,
+	0x3f7d7880, 0x15b28cc0, 0x4295c260, 0x41cc7d10, 0x03a8a258, 0xd31aad84, 0x1c00ba9e, 0xfa02f1b1,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xa8000000, 0x7c000000, 0x16000000, 0x6d000000,
+	0x7b800000, 0x66400000, 0xe3200000, 0x87d00000, 0xf3680000, 0xf9f40000, 0x17320000, 0xa8dd0000,
+	0xcfec8000, 0x3f38c000, 0x94d8e000, 0x79e69000, 0x42359800, 0x47551400, 0x63a9ba00, 0xb71c3100,
+	0xad857880, 0xeb478440, 0x28ae22a0, 0x59942510, 0xc4404228, 0x1423753c, 0x9f53ba36, 0x47a5313d,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xb8000000, 0x24000000, 0x0e000000, 0xd1000000,
+	0x96800000, 0x05c00000, 0x12600000, 0x69b00000, 0x41a80000, 0x3ed40000, 0x689e0000, 0x7fb30000,
+	0x64a18000, 0x8e5f4000, 0xd05a6000, 0x6957d000, 0xf3da4800, 0x941aec00, 0xc57b3e00, 0xc14e7f00,
+	0xcca82880, 0xa2593c40, 0x225f7660, 0x625793f0, 0x025a9638, 0xf25c0364, 0x4a533eee, 0x6e5a7f61,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x28000000, 0x4c000000, 0x4a000000, 0xe5000000,
+	0x7c800000, 0x45400000, 0x8b600000, 0x90500000, 0x7c280000, 0xda340000, 0x76f60000, 0x1c590000,
+	0x96208000, 0x8f3bc000, 0x72752000, 0x3d111000, 0x1b472800, 0xb0656400, 0x97dc0e00, 0xdeef8900,
+	0xa39a0880, 0xb7007440, 0xed8d26e0, 0xf7c3ed50, 0x7d2e86a8, 0xe0b03d0c, 0x7cbc0e2a, 0x5ebf89f5,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x28000000, 0xfc000000, 0x0a000000, 0xf9000000,
+	0x8e800000, 0x6bc00000, 0x2ae00000, 0x9a300000, 0xe4280000, 0x24540000, 0xe4da0000, 0xc8190000,
+	0x137c8000, 0xe704c000, 0xe1812000, 0x6645d000, 0x4ea00800, 0x8194cc00, 0xc932b600, 0x83a4c700,
+	0xc91b2880, 0x09f81c40, 0x5ac63e20, 0x6860cb50, 0xa3f2bea8, 0xb3c00bbc, 0xeee19eaa, 0x6438dbe9,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x38000000, 0xb4000000, 0x46000000, 0x4b000000,
+	0xfc800000, 0x86400000, 0x03a00000, 0xb6700000, 0x52e80000, 0x73540000, 0xc3da0000, 0xd7970000,
+	0x493d8000, 0xc0ce4000, 0x64eae000, 0x60557000, 0x1b506800, 0x9fdc7400, 0x8d9a6200, 0x78391b00,
+	0xbd408880, 0xa72e0440, 0x143f8a20, 0x9f4f2fb0, 0x02220ab8, 0x9fb16ff4, 0x2f80eae6, 0x3ec01fbb,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x58000000, 0x9c000000, 0x1e000000, 0x3f000000,
+	0x83800000, 0x02400000, 0x18e00000, 0x1bd00000, 0xe1280000, 0xad7c0000, 0x04120000, 0x048b0000,
+	0x8dc38000, 0x0cacc000, 0x083b6000, 0xa377b000, 0xf3141800, 0x130c3400, 0xa5834600, 0xf1492100,
+	0x2d6cf880, 0xe29744c0, 0xf84c3ea0, 0x95e2a5f0, 0x4153a6d8, 0x33ee515c, 0x7251803e, 0xa667c00f,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xd8000000, 0xfc000000, 0x6a000000, 0xab000000,
+	0x71800000, 0x0fc00000, 0x83200000, 0x33b00000, 0x95680000, 0x5b5c0000, 0xd3fe0000, 0x0c870000,
+	0x1f478000, 0x066ac000, 0x26d82000, 0x0e30f000, 0xe8aa7800, 0xef76ec00, 0xcbc89a00, 0xe5265f00,
+	0x4ab5d880, 0x83ecdcc0, 0x971ac260, 0x08104330, 0xa79f3a58, 0x1d506f3c, 0x3af1808a, 0x9201c05b,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x38000000, 0x2c000000, 0xe6000000, 0xb7000000,
+	0x59800000, 0xea400000, 0xdf200000, 0x17d00000, 0x4ae80000, 0xb5b40000, 0x6b9e0000, 0xeac10000,
+	0x5fe18000, 0xe939c000, 0xc558e000, 0x07263000, 0xabdb3800, 0xf4e8b400, 0xfeb99a00, 0xec150100,
+	0x9b8a5880, 0x3f434440, 0xa3a44260, 0x091a85d0, 0x4f097ab8, 0x5587316c, 0xbc4f6006, 0x802af027,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x68000000, 0x3c000000, 0xd6000000, 0x51000000,
+	0x1a800000, 0x49c00000, 0xdf200000, 0xead00000, 0xfa680000, 0x5d3c0000, 0x9d1a0000, 0x884f0000,
+	0x5b688000, 0xcfbac000, 0x78d8e000, 0x59645000, 0xb4b10800, 0xc55dec00, 0xeb20ca00, 0x50d0d900,
+	0x85696880, 0xf2bf7cc0, 0x4c532220, 0xa5a665b0, 0xf3102ae8, 0xdd4889fc, 0x53e26076, 0xe57d9021,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x58000000, 0x14000000, 0xda000000, 0xf3000000,
+	0x01800000, 0x7e400000, 0x28600000, 0x55d00000, 0x21a80000, 0x2efc0000, 0x4c9e0000, 0x12490000,
+	0x966f8000, 0x94da4000, 0x4f2d2000, 0xc737f000, 0x27b2f800, 0x477c7400, 0x6eda2e00, 0xcc2ce100,
+	0x2eb85880, 0xc5fdc4c0, 0xf913f660, 0x060265d0, 0xc5090ed8, 0x8c8211d4, 0xdecd203a, 0xe8a7f0e3,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xa8000000, 0xcc000000, 0x22000000, 0xb1000000,
+	0xbe800000, 0xea400000, 0x9de00000, 0xf3100000, 0x48280000, 0x523c0000, 0x609e0000, 0xe6ef0000,
+	0x90908000, 0xeee9c000, 0x8c9fa000, 0xd4e35000, 0x59920800, 0x84631400, 0x20d2e600, 0x160cdd00,
+	0x87032880, 0x298684c0, 0xbbcfce60, 0xf22559b0, 0x473c6628, 0x501a1d0c, 0x2fa408c2, 0xaaf014c1,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xd8000000, 0x64000000, 0xaa000000, 0xc1000000,
+	0x47800000, 0x8f400000, 0x94a00000, 0xbb300000, 0x49680000, 0xc55c0000, 0x34b20000, 0xba2d0000,
+	0x3ffb8000, 0x748d4000, 0xadc22000, 0x566dd000, 0xf1d19800, 0xf97bc400, 0xdc436200, 0x862b9f00,
+	0x31fa3880, 0xbf8654c0, 0xbb435aa0, 0x46accb90, 0x8e38e258, 0x7ce6dfa4, 0xef18188a, 0x4d9b8491,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x68000000, 0x24000000, 0xa2000000, 0x15000000,
+	0x4f800000, 0xee400000, 0x0b600000, 0x6d700000, 0xb3a80000, 0x21dc0000, 0x9cf20000, 0x76ef0000,
+	0x8e308000, 0x1b4b4000, 0x94eba000, 0xfb3f9000, 0x44cf9800, 0xa2af1400, 0xbc5d5e00, 0xafb5eb00,
+	0xa606b880, 0xc704c4c0, 0x9281e6a0, 0x35c22fb0, 0x2f25dee8, 0x5712abe4, 0x33571882, 0x69385465,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xd8000000, 0xf4000000, 0x16000000, 0xfd000000,
+	0xc3800000, 0x53400000, 0x8a200000, 0x27b00000, 0x5be80000, 0x17540000, 0x323e0000, 0xd5af0000,
+	0x0eff8000, 0xaec24000, 0x286be000, 0xdc1b1000, 0x2c191800, 0xd41a0400, 0x701e0a00, 0x8e131700,
+	0x5f137880, 0x7e9c5440, 0xc6db7260, 0x72744330, 0xc5098a58, 0x478557b4, 0xfd4698f6, 0xb328448d,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x48000000, 0xe4000000, 0xbe000000, 0x51000000,
+	0xd1800000, 0xb7c00000, 0x1f600000, 0x47500000, 0x16280000, 0xaf7c0000, 0x485e0000, 0xa6ab0000,
+	0xe13e8000, 0xf4ff4000, 0x08946000, 0x054dd000, 0x222db800, 0x09780c00, 0x25543e00, 0x95273100,
+	0x15f15880, 0x311d9cc0, 0xc68d6660, 0x3b46adf0, 0xb3223ec8, 0xb8f03124, 0x6291d85e, 0xc249dc61,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xf8000000, 0x9c000000, 0x76000000, 0x0d000000,
+	0x9f800000, 0xc9c00000, 0x9b200000, 0x98100000, 0x76180000, 0x971c0000, 0xb6960000, 0x865f0000,
+	0x90f08000, 0x26294000, 0x2f962000, 0x7bdaf000, 0x763d0800, 0xad829400, 0xfec5a600, 0x27ae6700,
+	0xcf5da680, 0x35726740, 0xcceba620, 0x2a3d67d0, 0x3b8326d8, 0xc3c8274c, 0xd02306ae, 0x629dd741,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xd8000000, 0x34000000, 0xd6000000, 0x8d000000,
+	0xd3800000, 0xea400000, 0xfd600000, 0xca100000, 0x74180000, 0x85140000, 0x0c920000, 0xd9d70000,
+	0x743a8000, 0x3ee9c000, 0x585ca000, 0x8d707000, 0x11074800, 0x1982ec00, 0x6d49ba00, 0xc9eddb00,
+	0x44d1ba80, 0xdfb9dbc0, 0xd0a3bae0, 0xfb3edb90, 0x26613a38, 0x54931ba4, 0x2dd79aee, 0xc2306b29,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x48000000, 0x64000000, 0xfa000000, 0x17000000,
+	0xdd800000, 0xd0c00000, 0x9ba00000, 0x34f00000, 0xebf80000, 0x92740000, 0xd8b20000, 0xc41b0000,
+	0x656f8000, 0x3a51c000, 0xc98a6000, 0x32c91000, 0xc0a7c800, 0xe7714400, 0x9e3b3e00, 0xa7591100,
+	0x1b093e80, 0x738211c0, 0x85c6bee0, 0xed23d150, 0xefb4dea8, 0x299ec134, 0x0da11652, 0x1df48523,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x88000000, 0x44000000, 0xa6000000, 0x6b000000,
+	0xcd800000, 0x47400000, 0x69e00000, 0x62300000, 0xa1380000, 0x78bc0000, 0x01f20000, 0x3f1d0000,
+	0xfaa58000, 0x95d9c000, 0x840fa000, 0x060b1000, 0x7b02c800, 0xb58f3c00, 0x8b4a6200, 0x8beae100,
+	0xaf386280, 0x07b7e140, 0xf27de260, 0x2f5e21b0, 0x34ca42e8, 0x39a931f4, 0x4c5a8a4e, 0xfd4b0d9f,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xe8000000, 0xf4000000, 0x4a000000, 0x51000000,
+	0xae800000, 0xb5c00000, 0xb5a00000, 0x7a500000, 0x67580000, 0xdfdc0000, 0xe51a0000, 0x35370000,
+	0xed298000, 0xd09ec000, 0x3f766000, 0x23c17000, 0x7aa89800, 0x7fd44400, 0x1510de00, 0x6d359b00,
+	0x212ade80, 0x86929b40, 0xd07b5ee0, 0x96405b90, 0x30ef3e08, 0xd13a2b64, 0x6f2c2642, 0xc59baf35,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xf8000000, 0x34000000, 0x76000000, 0x4d000000,
+	0x88800000, 0x93c00000, 0x9e200000, 0x5fd00000, 0x40d80000, 0x9b540000, 0x511a0000, 0xde710000,
+	0x7b4e8000, 0x7de5c000, 0xd9fea000, 0x9b0c7000, 0x558bf800, 0xb34f4400, 0x71e0e600, 0x7bf6fb00,
+	0x1002e680, 0x6803fbc0, 0x9c0e6660, 0x0a033b70, 0xf7044698, 0x878b8b44, 0x20479eee, 0xc8697f09,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x68000000, 0x44000000, 0x32000000, 0x19000000,
+	0x5d800000, 0x52400000, 0x2b600000, 0x5c100000, 0xd9980000, 0x07dc0000, 0xcab20000, 0xa5a50000,
+	0x14bb8000, 0x6aa3c000, 0xf232e000, 0x64667000, 0xfa902800, 0x3752cc00, 0x7f7c9a00, 0xf1802b00,
+	0x64471a80, 0xe063eb40, 0x6895fa60, 0xbe559b30, 0x3afdd208, 0x8fcb5774, 0x392b483a, 0x97727c6d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x28000000, 0xcc000000, 0x4a000000, 0x63000000,
+	0x6e800000, 0x26400000, 0x3ee00000, 0xa1700000, 0x4bf80000, 0x5bb40000, 0x845a0000, 0x94ad0000,
+	0xf5978000, 0x198f4000, 0x26c1e000, 0x1da2d000, 0xa81fb800, 0xe94c9c00, 0xaa619200, 0x2c37d500,
+	0xa7961280, 0xbe8895c0, 0x5e4ff260, 0x4aee45b0, 0x7f724a48, 0x86fbd97c, 0xd03e5802, 0xe59e4c1f,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0x6c000000, 0x16000000, 0x45000000,
+	0x5a800000, 0x77c00000, 0x93e00000, 0xc9d00000, 0x05580000, 0xf7940000, 0x1ef60000, 0x70eb0000,
+	0x7e5a8000, 0x2c184000, 0x21b72000, 0xe3cc7000, 0xd9e55800, 0xf2d16400, 0x3ed5fa00, 0x38dd5700,
+	0xc5d77a80, 0x235117c0, 0xda965aa0, 0x60766710, 0xe5298238, 0xd2bf437c, 0xec4b582e, 0x4cae6439,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xb8000000, 0x54000000, 0xce000000, 0x93000000,
+	0xa1800000, 0xe3400000, 0x76600000, 0x13b00000, 0xc8380000, 0x66740000, 0xfa920000, 0x2fef0000,
+	0x04fc8000, 0xc05dc000, 0x8ecb2000, 0x7f211000, 0x30d18800, 0xd50f7c00, 0xce88ba00, 0x00cdd100,
+	0x4c2c3a80, 0x215411c0, 0x5e4d1ae0, 0x54ee0110, 0x89721258, 0xd913bd44, 0x75ad0896, 0xe612bcd7,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xb8000000, 0x04000000, 0x3e000000, 0x3b000000,
+	0x2e800000, 0x80400000, 0x05a00000, 0x8df00000, 0x51780000, 0x88340000, 0xb2160000, 0x1c250000,
+	0x61368000, 0xf592c000, 0x1bef2000, 0x43559000, 0x6a0bf800, 0x6d0e3c00, 0xb980c600, 0x1cc2c900,
+	0x3cee4680, 0xa7d409c0, 0x774f66a0, 0x492099f0, 0x1cbc1e18, 0xf75d65f4, 0x2c0b7826, 0x7209fccf,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x38000000, 0xac000000, 0xda000000, 0x3b000000,
+	0x73800000, 0x0a400000, 0xbd600000, 0x95100000, 0x8d980000, 0xac540000, 0x077e0000, 0xdd0f0000,
+	0x6a848000, 0x4ec24000, 0x0ea5e000, 0x21375000, 0x7a6be800, 0x64958c00, 0xa0ddfa00, 0x90b01b00,
+	0x37277a80, 0xe87d5bc0, 0xb8861a20, 0x31c84bd0, 0x93281218, 0x767a977c, 0x6d8600c2, 0x1f4b0047,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0xe4000000, 0x62000000, 0xdf000000,
+	0x8d800000, 0xfd400000, 0x01600000, 0x2bd00000, 0xe5580000, 0xd3940000, 0xb2b60000, 0x9a830000,
+	0xdcc48000, 0xf226c000, 0xdbb2e000, 0xe2021000, 0x1f014800, 0xad8edc00, 0xad4fea00, 0xf96a2700,
+	0xcfdd6a80, 0x875fe7c0, 0x0c930aa0, 0x3f3f3790, 0x67cea258, 0xdda4fb74, 0xd9f2803a, 0x3ee5c0ab,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x98000000, 0xd4000000, 0x6e000000, 0x1f000000,
+	0x0f800000, 0x4ac00000, 0x3de00000, 0x2b500000, 0x47d80000, 0x709c0000, 0x9ab60000, 0x36870000,
+	0xf6468000, 0x72afc000, 0xa5732000, 0x0debd000, 0xe35ea800, 0xabd14400, 0xda9b7a00, 0x73babf00,
+	0xf20bfa80, 0xdd027f40, 0x1a865a20, 0xbc4a6f50, 0x2ba5d2b8, 0xe9fbfb84, 0x6aa880d6, 0x3174c09b,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x84000000, 0x9a000000, 0xfd000000,
+	0xd5800000, 0xc5c00000, 0x5b600000, 0x3fb00000, 0x9d380000, 0x98740000, 0x37520000, 0x9c4b0000,
+	0xb0a18000, 0xdbd5c000, 0xb6026000, 0x2300b000, 0xd2856800, 0x7d4e7400, 0x6329e200, 0x251f0900,
+	0x63e26280, 0xc7f5c9c0, 0xe79382e0, 0xf6abb950, 0x40d50ac8, 0xc880bdd4, 0x4043e052, 0xd6a57029,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x08000000, 0x24000000, 0xee000000, 0xcb000000,
+	0x1a800000, 0xdb400000, 0xd5600000, 0xdab00000, 0xf5380000, 0x67f40000, 0x0f5a0000, 0xa9c10000,
+	0x5a298000, 0x09d7c000, 0x708f2000, 0x6e4c9000, 0x5cefb800, 0x87754c00, 0x39157a00, 0x692aa100,
+	0x1f5efa80, 0x31c861c0, 0x26225a60, 0x7bd23170, 0x798b4268, 0x75cc2d54, 0xb826a086, 0x58db509f,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x68000000, 0x9c000000, 0x6e000000, 0x9f000000,
+	0xd3800000, 0x1c400000, 0xcea00000, 0xd7f00000, 0xc9780000, 0xa7bc0000, 0x41da0000, 0x134d0000,
+	0x45238000, 0x5fbe4000, 0x85d6a000, 0xe94c5000, 0x5829e800, 0x1532ec00, 0x49106600, 0x862e2900,
+	0xc231e680, 0x16916940, 0xec66c6e0, 0x67927930, 0xe0e00e88, 0xc85f85ac, 0x420ca0e6, 0xb9015033,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xa8000000, 0xbc000000, 0x66000000, 0x3b000000,
+	0x1b800000, 0x66c00000, 0x74600000, 0x0fb00000, 0x51780000, 0x111c0000, 0xf4aa0000, 0x00d70000,
+	0x25418000, 0x76a04000, 0x39d12000, 0x47c31000, 0x12eae800, 0x79f9a400, 0xa05bf200, 0x1804e100,
+	0x040ad280, 0x1207f140, 0xb1003ae0, 0xee8e5510, 0xfa43c848, 0x6f26b4ac, 0x261b1aae, 0x312a45d7,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xf8000000, 0x64000000, 0xa2000000, 0x73000000,
+	0xca800000, 0x3bc00000, 0x5ca00000, 0x1c700000, 0x33b80000, 0x15140000, 0xce6a0000, 0x5d510000,
+	0x9c8a8000, 0x02c6c000, 0xa92de000, 0xe3385000, 0x19d63800, 0x2a4a6400, 0xc1e2fe00, 0xa51d8100,
+	0xf66f1e80, 0xd955d1c0, 0x0e812660, 0x89cbb5f0, 0x07a9d898, 0x7af73494, 0x367446ba, 0xfcb02527,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xf8000000, 0x0c000000, 0xca000000, 0x53000000,
+	0xef800000, 0x7ac00000, 0xde600000, 0x8b100000, 0xc5d80000, 0x3dbc0000, 0x9fa60000, 0x0eff0000,
+	0x520c8000, 0xaf0a4000, 0x6d89e000, 0xcdc85000, 0x0fe8e800, 0x64dca400, 0x6d301200, 0x70ebcb00,
+	0x1159f280, 0x1cf39b40, 0x5d091a20, 0xd2833f50, 0x584708d8, 0xce2bf45c, 0xa1347a92, 0x5aed2f4f,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x48000000, 0x94000000, 0xd6000000, 0xa1000000,
+	0x65800000, 0x7dc00000, 0x5fe00000, 0xd6b00000, 0x59780000, 0xf9940000, 0x1fa20000, 0xb8990000,
+	0x8a298000, 0xed52c000, 0x71cea000, 0xa5e13000, 0x1db3a800, 0xeff9d400, 0xded99a00, 0x6d0e1900,
+	0xff8f3a80, 0x86cb29c0, 0xa16692e0, 0x65fffdf0, 0xfdd488a8, 0x1f8a2464, 0x76c492fe, 0x8966fd05,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x08000000, 0x6c000000, 0x7a000000, 0x77000000,
+	0x74800000, 0x09c00000, 0xabe00000, 0xff900000, 0x51580000, 0xa6340000, 0x4c6a0000, 0x54db0000,
+	0x1e7f8000, 0x61cb4000, 0x97e3e000, 0x6d911000, 0xda561800, 0xa0b2e400, 0x5ea60a00, 0xf1be0b00,
+	0x9f2fea80, 0xeff41bc0, 0xc7867260, 0xdb4dbf50, 0xd7239868, 0xa3f2a43c, 0xcd826a92, 0x34405b8b,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x08000000, 0x7c000000, 0x5a000000, 0x33000000,
+	0xb8800000, 0x92c00000, 0x2fe00000, 0xafd00000, 0xdc180000, 0x447c0000, 0x3be60000, 0xf9d70000,
+	0x8d1b8000, 0x2bf24000, 0x3fa4e000, 0x51f65000, 0xdca69800, 0x417bd400, 0xa260ba00, 0x3c9d7f00,
+	0x42ba5a80, 0x02002f40, 0xa7014220, 0xae8ebbd0, 0x63c69828, 0xd06bd4ac, 0xa398baf2, 0x08317fdf,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xf8000000, 0x1c000000, 0x62000000, 0x77000000,
+	0xf3800000, 0x93c00000, 0xcb600000, 0x03500000, 0x19980000, 0xf4740000, 0x006a0000, 0xe2d70000,
+	0xb55c8000, 0x789f4000, 0x16f26000, 0x392f9000, 0xa4f6e800, 0x762c3400, 0xab7bd200, 0xd7ecaf00,
+	0xef1bb280, 0x3b303fc0, 0x0743da60, 0x73204b90, 0xf7fce898, 0x1bab348c, 0x7dbf527a, 0x6007ef3b,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x48000000, 0xbc000000, 0x02000000, 0xdf000000,
+	0xb8800000, 0xb1c00000, 0xc8600000, 0x77d00000, 0x8f180000, 0xcefc0000, 0xc5620000, 0xf85b0000,
+	0xca538000, 0xed524000, 0x51dd6000, 0x06151000, 0xe771d800, 0x49212400, 0x12787200, 0xc2a57700,
+	0xb13f1280, 0xc8076740, 0xfc074a60, 0xe2030350, 0xcf0bd828, 0xf08624ec, 0x0dc9f2aa, 0xca6c3773,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xa8000000, 0x94000000, 0xde000000, 0x11000000,
+	0xf1800000, 0xb8c00000, 0x95200000, 0xad700000, 0x94380000, 0x71d40000, 0x4d8e0000, 0x32c50000,
+	0xfa238000, 0x7df0c000, 0x75762000, 0xc831b000, 0xabdde800, 0x1a888400, 0xee424600, 0xf962c900,
+	0x9f17e680, 0xada3b9c0, 0xb83c2e20, 0x63da8df0, 0x1e838088, 0xa840c064, 0xd46e20d6, 0x2495b0b5,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x88000000, 0x2c000000, 0x66000000, 0x75000000,
+	0xe3800000, 0x2fc00000, 0xbaa00000, 0xeed00000, 0xea980000, 0xf3f40000, 0xd1820000, 0x58cd0000,
+	0x06298000, 0x419d4000, 0x61742000, 0x47c7f000, 0x26a50800, 0x60da9400, 0xc390ee00, 0xfe79fb00,
+	0xa74d4e80, 0x67e34bc0, 0xb23c66e0, 0xf22e2fb0, 0x53918068, 0xc679409c, 0x634e208e, 0x5deef029,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xb8000000, 0x9c000000, 0xc6000000, 0xb5000000,
+	0xab800000, 0x79400000, 0x0c600000, 0x78b00000, 0xe2780000, 0xc35c0000, 0x65860000, 0x38470000,
+	0xe5e88000, 0x7efb4000, 0x8e962000, 0x4022f000, 0x9f538800, 0x438d7c00, 0xbd4b6a00, 0x66689900,
+	0x23b5ca80, 0xd8f12940, 0x4b906220, 0x63aea5d0, 0x52108098, 0xade7404c, 0x2af020de, 0x5c95f0b9,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xe8000000, 0xc4000000, 0x3e000000, 0x47000000,
+	0xf4800000, 0x83c00000, 0xdc600000, 0xb5d00000, 0x74980000, 0x38340000, 0x23060000, 0x7a890000,
+	0x0ccb8000, 0x9ce5c000, 0xe0112000, 0x2bf3d000, 0x476cd800, 0x935d0400, 0x6a57b200, 0x19d32700,
+	0x4e951280, 0x613137c0, 0xe08eeaa0, 0xe5c6e3b0, 0x97660048, 0xcb590074, 0x665380f6, 0x93d1c0f3,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x28000000, 0x14000000, 0x92000000, 0xbd000000,
+	0xa0800000, 0x0e400000, 0x94e00000, 0xe6500000, 0x5d980000, 0x33bc0000, 0x7d460000, 0x5f650000,
+	0x5f938000, 0x56b0c000, 0x41c6e000, 0x672db000, 0xcc79f800, 0xb960bc00, 0x20946200, 0x733daf00,
+	0x63070280, 0x5385df40, 0x85cb9a20, 0x8d2813f0, 0x5d78e008, 0x07e4b0e4, 0x3dd4781a, 0x7c597c19,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x68000000, 0xb4000000, 0xfa000000, 0xcf000000,
+	0xb9800000, 0x67c00000, 0x27600000, 0x3d700000, 0xf8380000, 0xeb1c0000, 0x61c60000, 0x16610000,
+	0x79f38000, 0xad7ac000, 0x803e6000, 0x671e1000, 0xb7c1c800, 0xff669400, 0x41775200, 0x4632bd00,
+	0xb61cb280, 0xa3476d40, 0x32289a20, 0xf65929b0, 0x0ee66048, 0x22b21004, 0x535fc832, 0x006b948b,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xc8000000, 0xec000000, 0x42000000, 0x1f000000,
+	0x77800000, 0xe5c00000, 0xe8600000, 0xa9500000, 0x70180000, 0x9c340000, 0x71c20000, 0x1e6f0000,
+	0xb05f8000, 0xe69f4000, 0x9b726000, 0xf8e91000, 0x8f1da800, 0x7bbf5400, 0x3c04e200, 0x4a062f00,
+	0x930b0280, 0x658f7fc0, 0x32c34ae0, 0x73e27b90, 0x0e926028, 0x8779107c, 0x42e5a8ea, 0xe41b54a3,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xd8000000, 0xf4000000, 0x2e000000, 0x73000000,
+	0x1e800000, 0x67400000, 0x9f600000, 0xde700000, 0x7ab80000, 0x2f140000, 0xb7ce0000, 0x3b2b0000,
+	0xf79a8000, 0x3f87c000, 0xc8cc2000, 0xefa09000, 0xb5d93800, 0xe9652c00, 0x997d2a00, 0xea328500,
+	0xeb5d8a80, 0xee2ad5c0, 0x761c1220, 0x3c43a910, 0xbdeea0f8, 0x1b3350e4, 0x9cdb1856, 0x6aeebc57,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x28000000, 0xec000000, 0xca000000, 0x51000000,
+	0x17800000, 0xf1c00000, 0x65200000, 0xc7500000, 0xd2180000, 0xcc740000, 0x524a0000, 0x5aed0000,
+	0x35738000, 0x69cb4000, 0x812ce000, 0xf1597000, 0x911fc800, 0x4efdf400, 0x920cf600, 0x55049b00,
+	0xd1819680, 0x9acfabc0, 0x0bab3e60, 0xcd1d6f30, 0x8cff6048, 0x3f0230dc, 0x508b2802, 0xb540844d,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xf8000000, 0x3c000000, 0x4e000000, 0x19000000,
+	0x56800000, 0x7e400000, 0x65200000, 0xa7500000, 0xe2780000, 0xb52c0000, 0x0f5e0000, 0x36790000,
+	0x8f288000, 0x9c524000, 0x0bfe2000, 0xf0edf000, 0xc8b6b800, 0xe14cac00, 0xaea44600, 0x5d9e9f00,
+	0x1e12fe80, 0xc0d23340, 0x5eb6b820, 0x344cacf0, 0xee244658, 0xb6de9f8c, 0x9bb2fe36, 0x3cc23365,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x98000000, 0x34000000, 0xbe000000, 0x59000000,
+	0xff800000, 0x1fc00000, 0xae600000, 0xb7700000, 0x01180000, 0xc26c0000, 0xdd7e0000, 0xd61b0000,
+	0x6cec8000, 0x9134c000, 0xedb3a000, 0x92f2f000, 0x81d6a800, 0xce89a400, 0x3c4bea00, 0x93a23900,
+	0xc21d4280, 0x02eb9d40, 0xf036a820, 0xb639a4d0, 0xab33ea38, 0x42be39a4, 0x387b42a6, 0x7b9c9d2d,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xf8000000, 0xb4000000, 0x12000000, 0x39000000,
+	0x2d800000, 0x4bc00000, 0xa1e00000, 0xc8f00000, 0xf1180000, 0x3dec0000, 0xd6fe0000, 0xce170000,
+	0x6b668000, 0x71bac000, 0xbdbd6000, 0x5bb43000, 0xd0b38800, 0x943f0400, 0x0a709200, 0x54501900,
+	0x2f431a80, 0x2faf1d40, 0xced38820, 0x6e0f0410, 0xd7089258, 0xba8c19e4, 0x51451a6a, 0xa0a41dcd,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x98000000, 0x3c000000, 0xe2000000, 0xbb000000,
+	0x6c800000, 0x7a400000, 0xa0a00000, 0x70b00000, 0xcc180000, 0xcea40000, 0x71ba0000, 0x479d0000,
+	0x0a6e8000, 0x88504000, 0xc700e000, 0x2e831000, 0x91413800, 0x642f8c00, 0xaef1be00, 0xb2bbb900,
+	0xe7108680, 0x6a2435c0, 0x9ff938e0, 0xa13b8cf0, 0x1fd3bef8, 0x71c2b90c, 0xa46406fa, 0xe9597547,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x68000000, 0x74000000, 0x72000000, 0x8b000000,
+	0x7f800000, 0x31400000, 0x43200000, 0x88700000, 0x49580000, 0x722c0000, 0x38f20000, 0x6d9f0000,
+	0x874b8000, 0xe223c000, 0x10f76000, 0x79901000, 0xe5428800, 0x01268c00, 0x1b7fb600, 0x3adc7d00,
+	0x2d653e80, 0xf6d6f140, 0x636888e0, 0x0bd58c50, 0x9de63608, 0xd210bd64, 0x9601de9a, 0xd10921bf,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x58000000, 0x1c000000, 0x6a000000, 0xff000000,
+	0xe9800000, 0x02400000, 0x5ea00000, 0xc5f00000, 0x04580000, 0x38240000, 0xb63e0000, 0x64b50000,
+	0x397e8000, 0xd0924000, 0xad4e6000, 0xdf2dd000, 0xa3b82800, 0xdcfb5c00, 0x30dcde00, 0xb8e9bd00,
+	0xdd5af680, 0x2ca7e1c0, 0xc6f8a8a0, 0x57dc1c30, 0x6d6c3e78, 0x45162dec, 0xd50cbeb2, 0xf6816d23,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xa8000000, 0x34000000, 0x12000000, 0xbd000000,
+	0xb3800000, 0x50c00000, 0x06200000, 0x14d00000, 0xd7f80000, 0xbca40000, 0x259a0000, 0x5c110000,
+	0xedd18000, 0x1e7bc000, 0x056f6000, 0x72357000, 0x0d082800, 0xbb85d400, 0xf4c05e00, 0x4c2ca700,
+	0x35d27680, 0x427873c0, 0x4363a8e0, 0x2d3f1430, 0xab86bec8, 0x6cc617c4, 0xb02f3e3a, 0xe3d9d749,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x38000000, 0x94000000, 0x2a000000, 0x77000000,
+	0xc8800000, 0x27400000, 0xcf600000, 0x42d00000, 0x0eb80000, 0xdee40000, 0x58120000, 0xa51d0000,
+	0x8a9c8000, 0x0d50c000, 0xf97ae000, 0xf2c75000, 0x77a83800, 0x32739c00, 0x2c429200, 0xf1e74300,
+	0x7498aa80, 0x7059dfc0, 0x16feb860, 0x950a5c70, 0x338ef2d8, 0x01c9d324, 0x3d24f292, 0x9e30d323,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x88000000, 0x84000000, 0xe6000000, 0xe5000000,
+	0x4a800000, 0x25c00000, 0xfd600000, 0x11700000, 0xb5180000, 0xe4ec0000, 0x233e0000, 0x8b350000,
+	0x3f338000, 0xf136c000, 0xe0372000, 0xc4b9b000, 0x807b3800, 0xd1995400, 0x002c7a00, 0x02d39900,
+	0xd2894280, 0xb9cfcd40, 0xc76eb820, 0x6e769430, 0xf096da28, 0x0ca9e9f4, 0xb216daee, 0xed69e921,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x28000000, 0xc4000000, 0x9a000000, 0x9b000000,
+	0xbf800000, 0x60400000, 0xf8200000, 0x3b100000, 0xe2380000, 0x4dac0000, 0xf85e0000, 0x199d0000,
+	0x90f18000, 0x0f48c000, 0x15a4e000, 0x54579000, 0xe79b8800, 0x61f69c00, 0x03c3d600, 0x0e66db00,
+	0x563e5e80, 0xbfa14740, 0x07520820, 0xcc125cb0, 0x43b93688, 0x8cec4b34, 0xd4f45632, 0xd54f1b1f,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x38000000, 0xdc000000, 0xaa000000, 0x29000000,
+	0xb2800000, 0x83c00000, 0xd6600000, 0x65300000, 0x80580000, 0x86e40000, 0x0bf20000, 0x42b50000,
+	0xeb148000, 0x22444000, 0xe6266000, 0xb616b000, 0xceccf800, 0xd2ebf400, 0x85feaa00, 0xfdb32d00,
+	0xea985280, 0x0209d9c0, 0xdd007860, 0x2c8bb4f0, 0xd4cacad8, 0x03e09dec, 0x0b782a12, 0xe4726d35,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xa8000000, 0xb4000000, 0xe6000000, 0x15000000,
+	0x63800000, 0xf1c00000, 0xc5a00000, 0xedf00000, 0x6b580000, 0x682c0000, 0xfd320000, 0x4b7f0000,
+	0x71178000, 0x984bc000, 0x8b662000, 0xc4d2b000, 0x43efa800, 0x0f928400, 0x8e093600, 0x810e8d00,
+	0xf58c9e80, 0x5ccf0940, 0xba2028e0, 0x4e354450, 0x5dfd16c8, 0xf3533da4, 0x042cb6ce, 0x173a4de1,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xa8000000, 0x9c000000, 0xea000000, 0xbf000000,
+	0x54800000, 0x12400000, 0x33a00000, 0xd5900000, 0x47380000, 0x2f2c0000, 0x6bd20000, 0x56990000,
+	0xa9b18000, 0x3a694000, 0x48f26000, 0x4f46d000, 0x142ef800, 0xc15f8c00, 0x9dd18e00, 0x4398fb00,
+	0x22357680, 0x0ca27740, 0xc11f78e0, 0x3576cc30, 0x6c83eec8, 0x164e2bec, 0x8da38ec2, 0x6c91fb63,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x08000000, 0x7c000000, 0x72000000, 0xc3000000,
+	0x73800000, 0x50400000, 0x2de00000, 0x40300000, 0xfe580000, 0x5e2c0000, 0x75960000, 0xcf870000,
+	0x42498000, 0x1ee54000, 0xebbde000, 0xda139000, 0x7dc0c800, 0x84a31c00, 0x8154ea00, 0x3fa46500,
+	0x16dda280, 0x49e23940, 0x2634a8a0, 0xc355cc90, 0x44a9c228, 0xe154e9ac, 0xcfa980fa, 0xced540ff,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x58000000, 0x74000000, 0x5e000000, 0xa1000000,
+	0x23800000, 0x68c00000, 0xd7200000, 0x1b500000, 0xdbf80000, 0xd6640000, 0xabb20000, 0x2d050000,
+	0x198a8000, 0x1fccc000, 0x49a1a000, 0x221a7000, 0xef176800, 0xc6955400, 0x815bee00, 0xbcf7ff00,
+	0xc0e60680, 0x8efe6bc0, 0x6be44860, 0x8277e4f0, 0xe9a726b8, 0x3219db44, 0x67120086, 0xda950015,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x58000000, 0x24000000, 0x56000000, 0x41000000,
+	0x4e800000, 0x00400000, 0xe7600000, 0x33700000, 0x0c980000, 0xdeac0000, 0xabda0000, 0x2e450000,
+	0x12628000, 0xa3f9c000, 0x01dc2000, 0x5d48f000, 0xabe8b800, 0x9c3c8c00, 0xf074e200, 0xad126900,
+	0x2566da80, 0x3c7b2540, 0xc7141860, 0xf664bc70, 0x55f8fab8, 0x90dad514, 0x7bc4208e, 0xd7a4f025,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0xa8000000, 0x3c000000, 0x3e000000, 0x65000000,
+	0x92800000, 0x4ac00000, 0x0fe00000, 0x52900000, 0xd9f80000, 0xd8ac0000, 0x82360000, 0x77cf0000,
+	0x196b8000, 0x925b4000, 0xe11d2000, 0xebb33000, 0xda82b800, 0x46cd6400, 0xe9ef8200, 0xf390bf00,
+	0xe17eba80, 0xf56a9b40, 0x445a18a0, 0x98161410, 0x17359a88, 0x5d46ab6c, 0xe7ab2016, 0xcfbc3019,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xd8000000, 0x04000000, 0x16000000, 0xe5000000,
+	0x78800000, 0xb0400000, 0x05600000, 0x5c300000, 0x3fd80000, 0x4aac0000, 0xea9a0000, 0x77470000,
+	0xe6e88000, 0x5df3c000, 0x28782000, 0x8cbeb000, 0x039b9800, 0x65ceec00, 0x51a38200, 0x1b10dd00,
+	0x85889a80, 0x6cc1f140, 0x53293860, 0x74589c50, 0xc76aba38, 0xd7384114, 0x565a204e, 0x5c65b0a1,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0x3c000000, 0x92000000, 0xb7000000,
+	0x60800000, 0x0dc00000, 0xa8200000, 0x03100000, 0x2db80000, 0xea640000, 0xe2720000, 0xfd470000,
+	0x4def8000, 0x773f4000, 0xaca3e000, 0x58dcd000, 0x5498b800, 0x80faf400, 0xaf89ae00, 0x594c7b00,
+	0xfbe69680, 0xb63dcfc0, 0xed26d860, 0x049e64d0, 0x88fd76c8, 0x63851f2c, 0xf34c603a, 0x58e3904b,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x98000000, 0x0c000000, 0x6e000000, 0x15000000,
+	0x54800000, 0xa5c00000, 0xd1600000, 0x08900000, 0x78780000, 0x71a40000, 0x857a0000, 0x112d0000,
+	0x12b68000, 0x13474000, 0xcfa92000, 0xf8783000, 0xb1afd800, 0xe57c7400, 0x2128da00, 0x8ab13700,
+	0x1f4b8280, 0xa1a703c0, 0xed7cf8e0, 0xe52944f0, 0x40b182f8, 0xf04a033c, 0x822a7876, 0x673e04d9,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x38000000, 0x54000000, 0x8a000000, 0x43000000,
+	0xba800000, 0xf1400000, 0x9f200000, 0x8e700000, 0xb8d80000, 0x056c0000, 0xa7d60000, 0xe9e70000,
+	0x039a8000, 0xb94cc000, 0x6324e000, 0x487d1000, 0xf5dfd800, 0x4ee39c00, 0xfb119600, 0xb7051d00,
+	0xa082ce80, 0xaa4d4140, 0xa1ad38a0, 0xcd398c90, 0x30f4ce18, 0xbb9a4184, 0xad4fb832, 0xc9294c57,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xa8000000, 0x5c000000, 0x22000000, 0x2b000000,
+	0xaa800000, 0xd3400000, 0x3a200000, 0xd1b00000, 0xf0d80000, 0x774c0000, 0x3c2a0000, 0xbcb90000,
+	0xd7558000, 0xf3834000, 0x2acde000, 0x27e99000, 0x9ed59800, 0xe640dc00, 0xa9ad7600, 0xcb702900,
+	0x9f350e80, 0xc5996540, 0x506de060, 0x62199030, 0x94ad9848, 0x94fcdc2c, 0x7fff768a, 0x75752977,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xc8000000, 0x14000000, 0xa2000000, 0x65000000,
+	0x74800000, 0x22c00000, 0x2ce00000, 0x80900000, 0x96b80000, 0x26c40000, 0x26e60000, 0x019f0000,
+	0xd8318000, 0xbd09c000, 0xc88d6000, 0x64c37000, 0x73e89800, 0x4d18a400, 0x76f38200, 0xefe2b700,
+	0x9b167a80, 0x41f963c0, 0x666d6020, 0x11537090, 0xf9d09868, 0x0d1ca444, 0x16f5826a, 0x1fedb771,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x78000000, 0x9c000000, 0x6e000000, 0x03000000,
+	0xeb800000, 0xbf400000, 0x8ee00000, 0xf6500000, 0x4bf80000, 0xb54c0000, 0x3fe20000, 0x10dd0000,
+	0xac348000, 0x17624000, 0x641d2000, 0x4d93d000, 0xa7de0800, 0x3db10c00, 0x412d3a00, 0x407fdb00,
+	0xfa0e1280, 0xa90d0740, 0xca8520e0, 0xf1cfd0f0, 0x3d240818, 0xde700c2c, 0xe103ba16, 0x6e8c9b9f,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x48000000, 0xe4000000, 0xa2000000, 0x4f000000,
+	0x6b800000, 0x6c400000, 0x29a00000, 0xf0f00000, 0x77180000, 0x514c0000, 0x152a0000, 0x4b310000,
+	0xccf38000, 0xc916c000, 0xf0466000, 0x87abd000, 0xe9f7c800, 0x499dbc00, 0xb588be00, 0x7d470500,
+	0x13211680, 0x463d6940, 0x18746060, 0x86d6d0b0, 0x51ae48a8, 0xfcfa7c14, 0x211d5eea, 0x044a15ab,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0xb4000000, 0xa6000000, 0x1f000000,
+	0x68800000, 0x5ac00000, 0x57a00000, 0x51700000, 0xe2180000, 0x0fcc0000, 0xd22e0000, 0x2a3f0000,
+	0x50f48000, 0x175ec000, 0x7e272000, 0x78309000, 0x49f9f800, 0x30d8e400, 0xd46e7600, 0xc15bbd00,
+	0xe928ae80, 0x9cbfc940, 0x51312020, 0x46739010, 0x469b7838, 0xb70524e4, 0xf48bd63e, 0x20c6edab,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x08000000, 0x34000000, 0x6e000000, 0xa3000000,
+	0xd9800000, 0xc9c00000, 0x23e00000, 0x7ef00000, 0x6ed80000, 0x8ec40000, 0x5c620000, 0xc03b0000,
+	0xaabd8000, 0x92f7c000, 0xfcdfa000, 0x97c3d000, 0x18e02800, 0x7b79c400, 0xad168200, 0x682ec100,
+	0x6c110a80, 0xd0a0d5c0, 0x6d5da060, 0x4a08d090, 0xe505a8e8, 0xfe8a0464, 0x264b2266, 0x75261197,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x18000000, 0x0c000000, 0x22000000, 0xc5000000,
+	0x13800000, 0x2a400000, 0x3d200000, 0x6e900000, 0x0ff80000, 0x17440000, 0x92aa0000, 0x1ed10000,
+	0x8bde8000, 0x50554000, 0x7e10e000, 0x053b7000, 0x98a9e800, 0x6fdfdc00, 0xa65b1600, 0xf5190b00,
+	0x81ba1e80, 0x7c69a7c0, 0x673ae0e0, 0xfdaa70b0, 0x6c576878, 0xe41a9c7c, 0xdc33f63a, 0xc1267bc9,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xe8000000, 0xac000000, 0xae000000, 0xa1000000,
+	0x90800000, 0x54c00000, 0x9a200000, 0x93100000, 0x0cf80000, 0x0d4c0000, 0xb2620000, 0x93f30000,
+	0xf4c38000, 0xea204000, 0x4b162000, 0x18fdf000, 0xe7419800, 0x11648400, 0x0c750e00, 0x91890300,
+	0xb440b680, 0x16e37740, 0x1d37a0e0, 0x75eeb010, 0xa2b43888, 0x20a934fc, 0x44dab646, 0x395c770d,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xa8000000, 0x24000000, 0x9a000000, 0x01000000,
+	0xe2800000, 0x29c00000, 0xcd600000, 0x8b300000, 0x90980000, 0x0f440000, 0x2eaa0000, 0x8f5f0000,
+	0x4d2b8000, 0x8414c000, 0xc985e000, 0x524cb000, 0x7a22b800, 0xe997f400, 0xc1c56a00, 0x496a3500,
+	0xe1303280, 0xa99a71c0, 0x61ce60e0, 0xb9687050, 0xd93f58c8, 0x259f44b4, 0xdfcdd232, 0x2262c125,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x78000000, 0x1c000000, 0x86000000, 0x21000000,
+	0x60800000, 0x3c400000, 0x80e00000, 0x92300000, 0xb6180000, 0xc48c0000, 0x064a0000, 0xd7ef0000,
+	0xbbb68000, 0x8ede4000, 0xe225a000, 0xb3907000, 0xb2431800, 0x95e74c00, 0xf0b38a00, 0x21518d00,
+	0xfbe3b280, 0xf5b8f140, 0x3bd68060, 0x70ae4050, 0x4cdda098, 0xe92c700c, 0xfc1118fe, 0xbb844c3d,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x08000000, 0xfc000000, 0x5a000000, 0x41000000,
+	0x84800000, 0xa5400000, 0x6a200000, 0x7bb00000, 0xc8580000, 0x68840000, 0x874e0000, 0xff290000,
+	0xe93b8000, 0x7e174000, 0x3b2e6000, 0x873fb000, 0xb91d5800, 0x14ad9c00, 0xeffdb600, 0x0efa7900,
+	0xfa750e80, 0x773f15c0, 0x511b80a0, 0x78a74070, 0x0df66028, 0xbbfbb04c, 0xd8f35852, 0xc9749cbd,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0xc4000000, 0x06000000, 0x0b000000,
+	0x4f800000, 0x35400000, 0x52600000, 0xb1700000, 0x3dd80000, 0xdd840000, 0x604e0000, 0xf2ef0000,
+	0x1db48000, 0xc9fdc000, 0xb5182000, 0xdfa6d000, 0x4bd74800, 0x5e892c00, 0x53c2b200, 0xd5a99100,
+	0xdad95a80, 0xf80badc0, 0xf40c80a0, 0x6e09c010, 0x870e20b8, 0x158dd014, 0xfc4dc89e, 0x10ebeccf,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x48000000, 0x74000000, 0x36000000, 0xe3000000,
+	0x7e800000, 0x70400000, 0xaf600000, 0xd6300000, 0xfd980000, 0x95840000, 0x1ac60000, 0xf9210000,
+	0x625f8000, 0x692bc000, 0x5a582000, 0xf52f5000, 0xa85ed800, 0x68266c00, 0x41ddb200, 0x50e27500,
+	0x7dfcca80, 0x573489c0, 0x26198020, 0x904ac070, 0x7f67a0e8, 0x8e3490c4, 0x719ef87e, 0x9f8d3c97,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x38000000, 0x0c000000, 0x9a000000, 0x8f000000,
+	0x8a800000, 0xc2c00000, 0xbb600000, 0x1db00000, 0xc9980000, 0x530c0000, 0x08820000, 0x31c70000,
+	0x83e28000, 0x64734000, 0x6e716000, 0x997d5000, 0x7ffa5800, 0x373f8400, 0x3b5f1a00, 0xa0622d00,
+	0x3134a280, 0x5654b940, 0xc9e200e0, 0xf3770050, 0x98fa8058, 0xe9bf401c, 0x7f9360a2, 0x360a5083,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x58000000, 0x5c000000, 0xae000000, 0x83000000,
+	0xc4800000, 0xd4400000, 0x18200000, 0xc7500000, 0xd8b80000, 0xdd0c0000, 0x0f860000, 0x34c70000,
+	0x6e608000, 0xaa704000, 0x04672000, 0xbb76d000, 0x9dee7800, 0x20b00c00, 0x91034600, 0xd9893700,
+	0xbbcc9e80, 0x5ce8ab40, 0xa13e00a0, 0x76cb0010, 0x2b668078, 0x99f7400c, 0xeea7a0f6, 0x5e1690df,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x18000000, 0x0c000000, 0xb2000000, 0x09000000,
+	0xe0800000, 0x3cc00000, 0xbba00000, 0x6cb00000, 0x86580000, 0x5b040000, 0x39860000, 0xd4410000,
+	0x236a8000, 0x71114000, 0x5de3e000, 0x86d7b000, 0xb7cc9800, 0x8a2ac400, 0x1cf3f600, 0x033eb100,
+	0x9d100e80, 0x3fe385c0, 0x87de0020, 0xf3450070, 0x10ec80b8, 0x105040bc, 0x340960aa, 0xce06f005,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xe8000000, 0x74000000, 0xe2000000, 0x0f000000,
+	0x20800000, 0x98c00000, 0x10e00000, 0xe6700000, 0xb3d80000, 0xda040000, 0x730e0000, 0x068b0000,
+	0x0dc78000, 0xa369c000, 0xc8396000, 0xd6f6d000, 0x0316f800, 0x9eed8400, 0xe77f8200, 0x5252e900,
+	0x83419a80, 0xaaaf7dc0, 0xd15800a0, 0x1dc40050, 0x8b6e00c8, 0x9c3b00e4, 0xa4ff800a, 0xe41dc07b,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xa8000000, 0x4c000000, 0x4e000000, 0x97000000,
+	0xc5800000, 0x7d400000, 0xa7600000, 0x3bf00000, 0x55280000, 0xf8040000, 0x84020000, 0xb2010000,
+	0xe1048000, 0xb6854000, 0xbac26000, 0x03227000, 0xce14b800, 0xd61e2c00, 0x770fea00, 0xe0933b00,
+	0x58dadf80, 0xfe2b2940, 0x2b800020, 0x3a400010, 0xeae00008, 0x9ab00024, 0x1448002a, 0x18f40013,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x38000000, 0x8c000000, 0x5a000000, 0x21000000,
+	0x3b800000, 0x38400000, 0xcbe00000, 0x69f00000, 0x2d980000, 0x2c040000, 0x6a060000, 0xe9070000,
+	0x9f808000, 0xd641c000, 0x3ce46000, 0x2972d000, 0x0f590800, 0xe425dc00, 0xf057c200, 0x66895f00,
+	0xf7efcf80, 0xbddaacc0, 0x93e00020, 0x35f00030, 0xaf980038, 0x91040004, 0x3386000e, 0x7c470023,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xc8000000, 0xdc000000, 0x4a000000, 0x4f000000,
+	0x53800000, 0xe2c00000, 0x86600000, 0x10f00000, 0x7ed80000, 0xb4040000, 0xe6020000, 0xed010000,
+	0xf0818000, 0x33464000, 0xf7a6e000, 0x8f125000, 0xc3ea7800, 0x1f3e9c00, 0xa0311600, 0xf3bf3300,
+	0xb9740780, 0x5b1e36c0, 0x9de00020, 0x6e300010, 0x92b80008, 0xdbf4000c, 0x035a0032, 0x67c50037,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0x34000000, 0x6a000000, 0xa5000000,
+	0xda800000, 0x10c00000, 0xd5200000, 0xc6900000, 0xfcf80000, 0x02040000, 0xf1060000, 0xc0850000,
+	0x4dc68000, 0x13a14000, 0x8851a000, 0xe6db5000, 0xbb112800, 0xc7b8d400, 0x07618600, 0xaf762900,
+	0xe94a7480, 0x3b6cc7c0, 0x06780020, 0x02c40030, 0xac260028, 0xe2150034, 0xf33e800a, 0x80a5400d,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0xe4000000, 0xbe000000, 0x37000000,
+	0xdd800000, 0x3d400000, 0xf3200000, 0x6bd00000, 0x3c480000, 0xba040000, 0x99060000, 0x52830000,
+	0xd4c68000, 0xa866c000, 0x4bf72000, 0x341df000, 0x8c0db800, 0x0da4ec00, 0x9d14ea00, 0x492a1900,
+	0xad771e80, 0x46de0240, 0x97680020, 0xf5d40030, 0x7b4e0018, 0x0f870034, 0x48408036, 0x23a5c039,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x28000000, 0x84000000, 0xda000000, 0x23000000,
+	0x31800000, 0xcec00000, 0x2aa00000, 0x96100000, 0x4b580000, 0xae040000, 0xa1060000, 0x0e810000,
+	0x19448000, 0xb1614000, 0xf0342000, 0xdb0ed000, 0x13bd1800, 0x4cf38c00, 0x96a97600, 0x4e28d500,
+	0x7a6b7080, 0x0b8c3ac0, 0x33f80020, 0xcf140030, 0x09de0008, 0x59450024, 0x5162800a, 0x40304021,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x38000000, 0x84000000, 0x56000000, 0x27000000,
+	0x2b800000, 0xc7c00000, 0x4f600000, 0xd9900000, 0xdfb80000, 0x77040000, 0xf3820000, 0x73c50000,
+	0xb1648000, 0x4291c000, 0x263c2000, 0xc1c6b000, 0xb0633800, 0x46145c00, 0xe67abe00, 0xa367bb00,
+	0xd390ec80, 0x1ab94dc0, 0x85820020, 0x84c50010, 0x02e48028, 0x9151c024, 0x075c200e, 0xbb56b021,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xf8000000, 0x3c000000, 0x5a000000, 0x1b000000,
+	0xa8800000, 0x1c400000, 0x7b600000, 0x81100000, 0x4f080000, 0xab040000, 0x80860000, 0xf8410000,
+	0x0d608000, 0x3817c000, 0xc089e000, 0x45c6d000, 0xfca6d800, 0xaab44400, 0xdf386200, 0xa7781b00,
+	0x6a1fe880, 0x720ba840, 0xa2860020, 0x1f410030, 0xdfe08008, 0x2f57c004, 0xeb69e03e, 0xe496d00f,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x28000000, 0x3c000000, 0xd2000000, 0x7b000000,
+	0xef800000, 0x48400000, 0xc9200000, 0x88100000, 0x90a80000, 0xa3040000, 0x8b820000, 0xbe450000,
+	0xe4248000, 0xda914000, 0xa269e000, 0x64e29000, 0x1671d800, 0xc81a7c00, 0xdefac200, 0x23890900,
+	0x2c16a080, 0x86a99540, 0xbe020020, 0x61050010, 0x98848028, 0xcdc14024, 0xee61e00a, 0x40b6900f,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xf8000000, 0xbc000000, 0xc2000000, 0x57000000,
+	0xc0800000, 0x30c00000, 0x82200000, 0x28b00000, 0x66380000, 0xcb040000, 0x72860000, 0x3fc50000,
+	0x4ea58000, 0x2277c000, 0x0f1de000, 0xe1321000, 0x737cb800, 0xb6670400, 0x24520600, 0xf9aed100,
+	0xa20d2580, 0xd7f8e1c0, 0x88a60020, 0x6b750030, 0x4a9d8028, 0x0e73c02c, 0x451be03e, 0x5237102f,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x88000000, 0x0c000000, 0xca000000, 0x37000000,
+	0x2b800000, 0x9d400000, 0xd2e00000, 0x56b00000, 0x55c80000, 0xeb040000, 0x39820000, 0x3e430000,
+	0xc7638000, 0xb2f44000, 0x5da86000, 0xf6725000, 0x3f6bb800, 0xe7d65c00, 0xb23d6a00, 0xb62dd700,
+	0x4b375580, 0xfd89be40, 0x49620020, 0x63f30010, 0x9b2b8018, 0x8fb0401c, 0xdf4a6022, 0x38c15003,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x38000000, 0x54000000, 0x12000000, 0xed000000,
+	0x9c800000, 0x89400000, 0x8a600000, 0x07500000, 0xc1380000, 0x91040000, 0x82860000, 0xd2450000,
+	0x81e28000, 0x9391c000, 0x189aa000, 0x6a749000, 0xbf096800, 0x90ede400, 0x507cca00, 0xdf629300,
+	0x0fd31a80, 0xfa78d9c0, 0xa6660020, 0x21550030, 0xce3a8028, 0x8885c014, 0xfb44a00e, 0x97659015,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x48000000, 0x14000000, 0x6e000000, 0xc9000000,
+	0xf3800000, 0xd4c00000, 0x89e00000, 0xbb100000, 0x7eb80000, 0xe5040000, 0x11820000, 0x4fc30000,
+	0x59648000, 0x73524000, 0x0d18a000, 0x9eb77000, 0x400c4800, 0x15089c00, 0xbc8c2600, 0x3f4b0f00,
+	0x542cf880, 0x947b45c0, 0xcde20020, 0xbd130010, 0x53bc8018, 0xa0864024, 0x5042a012, 0x4fa07005,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xf8000000, 0x4c000000, 0x76000000, 0x07000000,
+	0xb5800000, 0x5f400000, 0x91e00000, 0x80900000, 0xb2980000, 0xb1040000, 0x52820000, 0xdac50000,
+	0xa6a48000, 0xa577c000, 0x080a6000, 0x729fb000, 0x51063800, 0x6282ac00, 0xb2c37a00, 0x12a7cf00,
+	0x9f71a480, 0x790c44c0, 0xc01a0020, 0xbbc10010, 0xac268028, 0xa3b2c024, 0x20aee03e, 0x9ce87013,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xb8000000, 0xfc000000, 0x26000000, 0xe3000000,
+	0xc1800000, 0xcec00000, 0x3ce00000, 0x41900000, 0xe9780000, 0xb5040000, 0x5a860000, 0x93430000,
+	0x24278000, 0x2675c000, 0x956fe000, 0xb4bd3000, 0x30651800, 0x49d30c00, 0x90daf600, 0x8bb7a700,
+	0xa80e2c80, 0x5bee9bc0, 0x15fe0020, 0x05470030, 0xdf218018, 0x8bf6c03c, 0x35a8602e, 0x2f58f03f,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xb8000000, 0x64000000, 0x7a000000, 0xf5000000,
+	0xb5800000, 0xd7c00000, 0x78600000, 0xdff00000, 0xca580000, 0x6b040000, 0xfa860000, 0xb7410000,
+	0x4a228000, 0xc855c000, 0x09cb2000, 0x04afd000, 0xaedda800, 0x9346ac00, 0xd0233e00, 0x4d558300,
+	0x544a9f80, 0x0f6f62c0, 0xc8be0020, 0xc3b50030, 0x5afc8008, 0x4410c014, 0x016fa02e, 0x1fbb1019,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x28000000, 0x6c000000, 0xa2000000, 0x55000000,
+	0x89800000, 0x0c400000, 0x1d600000, 0xcdb00000, 0x25580000, 0x73040000, 0xf2820000, 0xc2c50000,
+	0xf5a08000, 0x11114000, 0x37cb6000, 0x71891000, 0xb5eca800, 0xe3df4c00, 0xa7c3e200, 0x04262b00,
+	0xf951cd80, 0xf4ae9ac0, 0x633a0020, 0x20310010, 0xb71a8028, 0x11604004, 0x9fb1e00a, 0xe859501b,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xb8000000, 0xd4000000, 0xaa000000, 0x6b000000,
+	0xff800000, 0xc2c00000, 0x9e200000, 0x44500000, 0xf5980000, 0xaf840000, 0x4ac20000, 0x52250000,
+	0x4a538000, 0x8c9dc000, 0xef02a000, 0xdd875000, 0x65c65800, 0x6fa47c00, 0xff93d600, 0x2b3a5100,
+	0x7c937280, 0x88bef4c0, 0xd8538020, 0x739dc010, 0x1a82a028, 0x0447501c, 0xbc66582e, 0x3d347c35,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x48000000, 0x54000000, 0x96000000, 0xdb000000,
+	0x1d800000, 0x79400000, 0xd9600000, 0xf0500000, 0x22a80000, 0xb5840000, 0xfd460000, 0x67630000,
+	0x6f508000, 0xe12a4000, 0x43c6a000, 0xafa2b000, 0x3575d800, 0x89186c00, 0xddbd8a00, 0x454e6b00,
+	0x8d123280, 0x85ca4d40, 0xbad08020, 0x0c6a4030, 0x6ca6a018, 0x94f2b004, 0x425dd812, 0x11dc6c15,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x68000000, 0xa4000000, 0x26000000, 0x8f000000,
+	0x92800000, 0x61c00000, 0xfce00000, 0x6ff00000, 0x89780000, 0xa6840000, 0xefc60000, 0x77e50000,
+	0xcb708000, 0x0fbb4000, 0x6ce12000, 0xc7f73000, 0x8d797800, 0x90801400, 0x08c64e00, 0x4167c700,
+	0x8cb2cf80, 0x7c5b73c0, 0x91908020, 0x2f4b4030, 0xd7192028, 0x10b33004, 0xf65f781a, 0x2c951429,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xa8000000, 0x34000000, 0x2a000000, 0xc3000000,
+	0x6b800000, 0x67400000, 0x41600000, 0x83300000, 0x49280000, 0x0f840000, 0x35460000, 0x0e670000,
+	0xaeb78000, 0x5b6d4000, 0xf865a000, 0x53b75000, 0xc9e91800, 0x6fa0dc00, 0x82107a00, 0x72fcab00,
+	0x0ddec980, 0xef0b1140, 0x0dd78020, 0x1f5d4030, 0xb8cda038, 0x3c73503c, 0x544f182a, 0x72b7dc0d,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xe8000000, 0xcc000000, 0x5e000000, 0x39000000,
+	0x43800000, 0x8fc00000, 0x75e00000, 0x68900000, 0x10e80000, 0x97840000, 0x95c20000, 0xcee10000,
+	0x94118000, 0xc1af4000, 0xbc226000, 0x6070f000, 0xb9f8c800, 0xb7af9c00, 0x29253e00, 0x6df6cf00,
+	0xd7393480, 0xa5cb8f40, 0x5c718020, 0x6fff4010, 0x52aa6008, 0xeca4f00c, 0xff32c83a, 0x735a9c33,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x48000000, 0x34000000, 0xe2000000, 0xaf000000,
+	0xdf800000, 0x1cc00000, 0x52200000, 0xfed00000, 0xbaa80000, 0x7d840000, 0xd3c60000, 0x3da50000,
+	0xba108000, 0x948a4000, 0x5555a000, 0x24691000, 0x30a47800, 0xaa907c00, 0xe7cfa600, 0x43b7b100,
+	0xf49ca680, 0xa2d80d40, 0x20b88020, 0x390e4030, 0x6e93a028, 0x3dcc1004, 0x20b4f812, 0xa51a3c0d,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x88000000, 0xa4000000, 0x4a000000, 0x5f000000,
+	0x94800000, 0x90c00000, 0x71e00000, 0x89f00000, 0x4a980000, 0x9a840000, 0x55c20000, 0xa2610000,
+	0x11b58000, 0xcdbc4000, 0xd3912000, 0x17285000, 0x293ff800, 0xab572400, 0x52cbc600, 0xd2ce2f00,
+	0x92c9df80, 0xb2ceccc0, 0x02cd8020, 0x8ac84010, 0x2ecb2008, 0x64cd502c, 0x3bc87822, 0xaf4a6429,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xb8000000, 0x2c000000, 0x2e000000, 0xe7000000,
+	0x2e800000, 0xa6c00000, 0x58e00000, 0x61b00000, 0xf8c80000, 0x5c840000, 0xb7c60000, 0x2d650000,
+	0x4ff18000, 0x75edc000, 0x49556000, 0x417f7000, 0x184e3800, 0x4d42f400, 0xe9a3f600, 0x4e172700,
+	0x55de3d80, 0xadd85e40, 0xe1d98020, 0x5fd9c030, 0x30db6028, 0x8a5e700c, 0x2e99b82e, 0xbf7a340b,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x88000000, 0xec000000, 0x1a000000, 0xb5000000,
+	0x46800000, 0xf7c00000, 0xe3200000, 0x1c900000, 0x35780000, 0x88840000, 0x7cc20000, 0x06a70000,
+	0x32d18000, 0x5a1c4000, 0x2a736000, 0x5bcad000, 0xf1eea800, 0xa9fdb400, 0x6a42fe00, 0x0964f900,
+	0x55f2f480, 0x808ea3c0, 0x38098020, 0xccc84010, 0x26696038, 0x0eb9d00c, 0xe1a52822, 0x8d52f43b,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xf8000000, 0xec000000, 0xa2000000, 0xcd000000,
+	0x7a800000, 0x86400000, 0x83200000, 0x3e500000, 0x38b80000, 0x67840000, 0xc4c60000, 0x89630000,
+	0x4f728000, 0x33efc000, 0xc9bb6000, 0x87071000, 0x03836800, 0x82c25400, 0xc2617200, 0x1ef4b900,
+	0xb42b8280, 0x355ebdc0, 0xa9b48020, 0xb78cc030, 0x9c49e018, 0x62a8d014, 0xb118083e, 0xd795443b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x88000000, 0x34000000, 0x12000000, 0x4f000000,
+	0x08800000, 0x2e400000, 0x00a00000, 0x8a300000, 0xc3b80000, 0x6f840000, 0x62c60000, 0x04e70000,
+	0x29928000, 0xef0c4000, 0xeb7da000, 0x58629000, 0x85d37800, 0xc8adc400, 0x0dcbb200, 0x2f9fe500,
+	0x91f06180, 0x3adf75c0, 0xabd48020, 0x61ab4030, 0xb84f2038, 0x165ed014, 0x3f96d822, 0xaa0b540d,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x38000000, 0xd4000000, 0x7a000000, 0x91000000,
+	0x06800000, 0x47400000, 0x96600000, 0x3b300000, 0x5ba80000, 0x1f840000, 0xbdc60000, 0xa7270000,
+	0x42568000, 0xb519c000, 0x40eaa000, 0x0fe1d000, 0x61f58800, 0x1509b400, 0xcf117a00, 0x9a7dd300,
+	0x715fa980, 0x6d090540, 0x3b108020, 0xd07ec030, 0x085c2038, 0x87881034, 0xd257280e, 0xad1c6435,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xf8000000, 0x4c000000, 0x8a000000, 0xd9000000,
+	0x17800000, 0x6e400000, 0xeca00000, 0x2a100000, 0x8b180000, 0x6a840000, 0xd7c20000, 0xb5e70000,
+	0x06318000, 0x3fcfc000, 0x6bfe6000, 0x51325000, 0x8f4bc800, 0xed3a3c00, 0xa7533200, 0x113fc500,
+	0x9555e080, 0x643a80c0, 0x38d38020, 0x2b78c010, 0x8ff7e038, 0xe529900c, 0x314fa83e, 0xb23b6c13,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xc8000000, 0x24000000, 0x2e000000, 0xe1000000,
+	0xc0800000, 0x9d400000, 0x4b600000, 0xea300000, 0x84880000, 0x8f840000, 0xfcc20000, 0x36a10000,
+	0x2c108000, 0xedde4000, 0xc53d2000, 0xd9cf7000, 0xa4e00800, 0x26f58400, 0x6a2b2a00, 0x4f91bb00,
+	0x1b1b4180, 0x3c9e7c40, 0xd45a8020, 0x14fb4010, 0x35efa008, 0x12b03004, 0x85cda832, 0x36e4b409,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x28000000, 0x94000000, 0x3e000000, 0xed000000,
+	0xd7800000, 0x13c00000, 0xbe200000, 0x1cb00000, 0x4ed80000, 0x64840000, 0x59460000, 0xe2610000,
+	0x9d548000, 0x6e494000, 0x71e8a000, 0x779bf000, 0xf6e46800, 0x5c153c00, 0xa02c5e00, 0x6eb89100,
+	0x5ed6f580, 0x838f4ec0, 0x02ca8020, 0x2cac4030, 0x83fa2008, 0x12b3b024, 0xdbd8480a, 0x2f078c25,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0xac000000, 0xd2000000, 0xb3000000,
+	0x02800000, 0x38400000, 0x63e00000, 0x6f100000, 0x98e80000, 0x33840000, 0x31c60000, 0x5d270000,
+	0x7ab18000, 0xbd1a4000, 0xd9f96000, 0x726c9000, 0xb7c09800, 0x18209400, 0x55350200, 0xd6ddbf00,
+	0x7bdec880, 0xe858af40, 0xc99f8020, 0x0cb94030, 0xa20ee038, 0x2911d00c, 0x3de87812, 0x2c06442b,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xe8000000, 0xb4000000, 0x3a000000, 0x9f000000,
+	0x85800000, 0x3dc00000, 0x38e00000, 0x34f00000, 0x7a280000, 0x78840000, 0x4b420000, 0x96a30000,
+	0xd8d08000, 0x0abf4000, 0x9f19a000, 0x6c4fd000, 0x8e31f800, 0xcb4dac00, 0x77b12e00, 0x0889a700,
+	0x12559780, 0x7af9d940, 0x5e3a8020, 0xa2584010, 0x03eb2018, 0xc2639004, 0xdcb0d83a, 0xf7093c2d,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xc8000000, 0x54000000, 0xf2000000, 0x39000000,
+	0xe9800000, 0x44c00000, 0x59e00000, 0x5f100000, 0xe4b80000, 0xb6840000, 0x46420000, 0xdda30000,
+	0x13b38000, 0x3a8e4000, 0xf2cea000, 0x80699000, 0x195cc800, 0x9391cc00, 0xaffee600, 0x00a2af00,
+	0xe0300880, 0x034e9dc0, 0x08a98020, 0x3eb94010, 0xeb872018, 0xf5c0d01c, 0x8463e832, 0x99d51c15,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x58000000, 0x8c000000, 0xee000000, 0x7b000000,
+	0x28800000, 0xf4c00000, 0x94600000, 0xe2700000, 0x86280000, 0xe9840000, 0x05460000, 0xfd210000,
+	0xe1518000, 0x747ac000, 0x61786000, 0xf2fd7000, 0x0eb8d800, 0x5e1bc400, 0x700fe600, 0x98508300,
+	0x19f84380, 0x8e3ab940, 0x5edf8020, 0xb66fc030, 0xb727e008, 0x4052b00c, 0x55ff3816, 0x40397423,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x78000000, 0x64000000, 0xf2000000, 0xeb000000,
+	0x0c800000, 0x79c00000, 0x6d200000, 0x6fb00000, 0x3dc80000, 0xb9840000, 0x10420000, 0x35610000,
+	0x66d38000, 0xbd1bc000, 0x659f2000, 0xf6599000, 0x44785800, 0xdd4ce400, 0x6e448e00, 0x20630900,
+	0x3f568d80, 0xbd5a4640, 0x78f98020, 0xfc8ec010, 0x1766a008, 0xc5d7501c, 0x8d9ef81e, 0xfa5bb419,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x18000000, 0x1c000000, 0x22000000, 0x87000000,
+	0xac800000, 0x58400000, 0x2fe00000, 0xfab00000, 0x50680000, 0x70440000, 0x6be20000, 0xe4b10000,
+	0x456d8000, 0x43c4c000, 0x8322e000, 0xb1101000, 0x1739b800, 0x4599a400, 0xfb4c2200, 0x85576f00,
+	0x62dd6d80, 0xb42fa740, 0x8da2e020, 0x2e501010, 0xb459b808, 0x5769a42c, 0x9cc42206, 0x13a36f07,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xd8000000, 0x34000000, 0xc2000000, 0x7b000000,
+	0x20800000, 0xa8c00000, 0x76e00000, 0x50500000, 0xccf80000, 0xfcc40000, 0x84e60000, 0x13570000,
+	0x287f8000, 0x4e02c000, 0xbd07a000, 0xa1811000, 0x37445800, 0xe4a7c400, 0xc174e600, 0x08cda700,
+	0xb3ad5a80, 0xe2bd63c0, 0x93e7a020, 0x05d11030, 0xd9bc5838, 0x9363c43c, 0xbd12e636, 0x875aa70d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x38000000, 0x04000000, 0x8e000000, 0x13000000,
+	0xa2800000, 0xbf400000, 0x2a200000, 0x4ad00000, 0x54480000, 0x23440000, 0xb0260000, 0x3fd70000,
+	0xe9c98000, 0x8c85c000, 0xbc462000, 0x60a37000, 0xf9911800, 0xcc6cd400, 0xf091da00, 0xdbeb2100,
+	0x1251ce80, 0x6e083640, 0x6ce62020, 0x61337030, 0xd1f91838, 0x82f8d40c, 0x007fda0e, 0x6f382101,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xf8000000, 0x94000000, 0x16000000, 0x47000000,
+	0x54800000, 0x46c00000, 0x0a600000, 0xed900000, 0xdd580000, 0x1ac40000, 0xa0660000, 0x70950000,
+	0x5cd88000, 0xa183c000, 0x6b42a000, 0x9325b000, 0x67b2b800, 0xd56d6400, 0xa7ea9600, 0x8e2ae300,
+	0x1cca5480, 0x259bcec0, 0x5ba2a020, 0x2b75b030, 0x520ab828, 0x33f96404, 0x7c34963e, 0xdb2be325,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x88000000, 0x74000000, 0xa6000000, 0x41000000,
+	0x89800000, 0xa9c00000, 0xdaa00000, 0xfa700000, 0xf2280000, 0xcfc40000, 0xbba20000, 0xe3f30000,
+	0x23ef8000, 0xe9604000, 0x93d1a000, 0xf6de3000, 0x24a98800, 0x72860c00, 0x0347ee00, 0xf5e76500,
+	0xc5961b80, 0xdcbc3d40, 0x81f9a020, 0x891a3010, 0x770b8818, 0x15750c3c, 0x0ea86e22, 0x2987251d,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xa8000000, 0x2c000000, 0x52000000, 0x5f000000,
+	0x76800000, 0x5a400000, 0xe3600000, 0xadf00000, 0x4a780000, 0x70440000, 0x18620000, 0xd5730000,
+	0xa5388000, 0x3ea14000, 0xe7536000, 0x2b299000, 0xb26e7800, 0xed88f400, 0xb13eb200, 0xa8a00b00,
+	0xa6535780, 0x40ae47c0, 0x69ab6020, 0x0e2d9010, 0xf7ec7818, 0xf34bf404, 0x471e322a, 0x38b54b0b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xe8000000, 0xe4000000, 0xde000000, 0xbb000000,
+	0xe8800000, 0x24400000, 0x4ba00000, 0x7c300000, 0xfd680000, 0xc2440000, 0x8ca60000, 0xa6b70000,
+	0xe82d8000, 0xec634000, 0x63512000, 0x02b9f000, 0x82bc5800, 0x42ba0400, 0xa2bb0200, 0x12bc2d00,
+	0xfab9f980, 0x1eb84f40, 0xc0b92020, 0x7bbdf030, 0x933a5838, 0xb77d042c, 0xfcde823a, 0x80eb6d39,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x98000000, 0x3c000000, 0x6e000000, 0x53000000,
+	0xb2800000, 0xfa400000, 0x50600000, 0x5ed00000, 0xcc080000, 0x80440000, 0x89620000, 0x8d530000,
+	0x89c98000, 0x53e0c000, 0xf313e000, 0xdba87000, 0x98371800, 0x7a9b5400, 0x41293200, 0x86767300,
+	0x18fdae80, 0x12fc9440, 0x33fbe020, 0xec7c7010, 0x5fbd1818, 0xe31c540c, 0x45eab226, 0xba51b30f,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xe8000000, 0x8c000000, 0x92000000, 0x17000000,
+	0x26800000, 0x9ac00000, 0xbe600000, 0x6bd00000, 0xfe880000, 0x5cc40000, 0xef660000, 0xdc510000,
+	0xf3ca8000, 0xbfe34000, 0x8f926000, 0xce2d9000, 0x2f763800, 0x9b387400, 0x519db600, 0x7929e300,
+	0x99f7a680, 0xc9ff2040, 0x33fa6020, 0x68f99030, 0xfc783808, 0x21bd7414, 0x5159363a, 0x2c4fa323,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0x5c000000, 0x0e000000, 0xc5000000,
+	0xe0800000, 0x54400000, 0x59a00000, 0xb6900000, 0x09d80000, 0x41440000, 0x61220000, 0x1ed50000,
+	0x0e7a8000, 0xaad0c000, 0xd478e000, 0x05d17000, 0xf3fea800, 0xe212c400, 0x8798c200, 0xb7e77d00,
+	0xf031fc80, 0xf0cefac0, 0x3b5ae020, 0x9e047010, 0xbd042828, 0x4c820414, 0x92402226, 0x58a60d17,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0xfc000000, 0xea000000, 0x61000000,
+	0x30800000, 0xcb400000, 0xf0a00000, 0xb0100000, 0x31580000, 0x72440000, 0xcc260000, 0x99550000,
+	0xf4fc8000, 0xdcd5c000, 0x4139e000, 0xa0365000, 0x12098800, 0x7fb94400, 0x4c773a00, 0xc12a1500,
+	0x396ce880, 0xa4481ec0, 0xa59fe020, 0x5e235030, 0x64550828, 0x1e7c8424, 0xde96da0e, 0x4518453f,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xf8000000, 0x1c000000, 0x32000000, 0xeb000000,
+	0x73800000, 0x21400000, 0x7de00000, 0x55b00000, 0x30880000, 0x42440000, 0x8a620000, 0xcaf10000,
+	0xdc6d8000, 0x6b73c000, 0xc62ae000, 0x0d149000, 0xe6d8d800, 0x96795c00, 0x342a6a00, 0x8612bf00,
+	0x055b9580, 0xff3cc840, 0xadc8e020, 0xfda59010, 0xecd55808, 0x25fa9c2c, 0x75688a3e, 0x6bf22f07,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x98000000, 0x1c000000, 0x5e000000, 0xab000000,
+	0x85800000, 0x3cc00000, 0xa6600000, 0x23700000, 0xbc880000, 0xd3c40000, 0xc1e20000, 0x5ab70000,
+	0xfc6a8000, 0xcdf0c000, 0xa5cae000, 0xf961f000, 0x8cf5d800, 0x414fec00, 0xd1278600, 0x2ad10300,
+	0x101ba380, 0xe6fdb840, 0x27c8e020, 0xac66f010, 0x12775838, 0x300b2c14, 0xcf876626, 0xedc3f307,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x38000000, 0xc4000000, 0x6e000000, 0x59000000,
+	0x36800000, 0xb7c00000, 0xb5e00000, 0xc7900000, 0xc2f80000, 0x62c40000, 0xe1620000, 0x0b550000,
+	0x9a988000, 0xef15c000, 0xe43c2000, 0xada27000, 0x13304800, 0xb74d7400, 0xfa4f1e00, 0x7ac91f00,
+	0xe009d480, 0x256f53c0, 0xf03e2020, 0x1ba77010, 0x3e30c828, 0xc7ccb404, 0xe8893e0e, 0x53aa6f31,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x08000000, 0xf4000000, 0x12000000, 0x67000000,
+	0x01800000, 0xe8400000, 0xb9200000, 0xb6f00000, 0x5c680000, 0x4d440000, 0xe7a20000, 0x83310000,
+	0x9b0b8000, 0x3f944000, 0x9fbda000, 0x69dd9000, 0x078eb800, 0x55574c00, 0x85586200, 0x654b9900,
+	0xbbb4ef80, 0x9bce9f40, 0xbe77a020, 0x74a89010, 0x48a73808, 0x16b20c1c, 0x314e4202, 0x99b2493d,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x88000000, 0x54000000, 0x96000000, 0x31000000,
+	0x7f800000, 0xfec00000, 0x91200000, 0x85500000, 0x24c80000, 0xbdc40000, 0xf1a20000, 0x99150000,
+	0xaeae8000, 0x2c704000, 0x4d98a000, 0xa30db000, 0xe7610800, 0x6c30bc00, 0x45fed600, 0x35bef900,
+	0xc5dd4280, 0x5f6fca40, 0x37d2a020, 0xf78cb010, 0x5d258828, 0x2f51fc34, 0xa7caf622, 0x3d460915,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x68000000, 0x3c000000, 0x52000000, 0xf7000000,
+	0x69800000, 0x66400000, 0x91600000, 0x20b00000, 0x52580000, 0xf7440000, 0xb1e60000, 0xf2710000,
+	0x5ff98000, 0x4f574000, 0xad2fe000, 0x2a3f9000, 0x93743800, 0x377f0c00, 0x91965200, 0x9a8adb00,
+	0x59291d80, 0xb4392ec0, 0x7e71e020, 0xa5fa9030, 0xa453b808, 0xa6ad4c0c, 0xd37e321a, 0x57970b0f,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xa8000000, 0xec000000, 0xb6000000, 0x95000000,
+	0xef800000, 0x61c00000, 0x55200000, 0x90700000, 0xc3480000, 0x36c40000, 0xfda60000, 0x41370000,
+	0xe32b8000, 0xacd14000, 0x2ff96000, 0x332eb000, 0x54d52800, 0xfbfb3c00, 0xb12cee00, 0x33d3d900,
+	0xdb7b0b80, 0x1c6b3640, 0x7db76020, 0x906db030, 0x7bb0a838, 0x4d697c1c, 0x08300e2a, 0x32af293b,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xd8000000, 0xd4000000, 0x2a000000, 0xd3000000,
+	0x62800000, 0xcbc00000, 0x59e00000, 0x64500000, 0x07f80000, 0x89440000, 0x62220000, 0x45b50000,
+	0x07ad8000, 0x7cbac000, 0xec60a000, 0x6f165000, 0x5ade1800, 0x40745400, 0x3f4c3e00, 0xdd6c3f00,
+	0xd8df6a80, 0x7f7073c0, 0xb3cd2020, 0x87ac9010, 0x3cbeb828, 0x4c62042c, 0xdf122636, 0x82d86b35,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x48000000, 0x84000000, 0x76000000, 0x03000000,
+	0xa1800000, 0x00400000, 0x0ca00000, 0x46f00000, 0xfd480000, 0x85c40000, 0x6ae20000, 0x51530000,
+	0xe6398000, 0xc2ce4000, 0x12822000, 0xa9c2b000, 0xe8e29800, 0x0c56cc00, 0xf0be6200, 0x5d0bf500,
+	0x99679f80, 0x3413fe40, 0x501ba020, 0xd9fcf010, 0x5928b818, 0x97507c0c, 0xed3efa12, 0x874e3921,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xe8000000, 0x14000000, 0x22000000, 0x8d000000,
+	0x19800000, 0xf7c00000, 0x69200000, 0x14700000, 0x78980000, 0xaa440000, 0xf4e60000, 0x94530000,
+	0xaf688000, 0x541b4000, 0x1802a000, 0x2c041000, 0xbe07e800, 0xab070c00, 0x5e805e00, 0x7742f900,
+	0xa565db80, 0x079760c0, 0x1c4a2020, 0x316f5030, 0x4f1d4818, 0xde871c04, 0xb741b63a, 0xc566f505,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x58000000, 0x4c000000, 0x2e000000, 0x59000000,
+	0x57800000, 0x2b400000, 0x14a00000, 0xb4100000, 0x3ac80000, 0x32c40000, 0xd6e60000, 0xdf310000,
+	0xe19a8000, 0x26aec000, 0x6b306000, 0x139e7000, 0x29ad4800, 0x79b0fc00, 0x195efa00, 0x034c3500,
+	0xa0845880, 0xe5c60240, 0x4862e020, 0xdbf4b030, 0xc27b2808, 0xf01f8c14, 0xf0e93216, 0x62120913,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x68000000, 0xcc000000, 0xae000000, 0x27000000,
+	0xf7800000, 0x98c00000, 0xa7a00000, 0x5fb00000, 0xdba80000, 0x09440000, 0x64620000, 0xe9910000,
+	0x07df8000, 0x44cf4000, 0x41506000, 0xa87e7000, 0x077bb800, 0xacfd7c00, 0x223ee600, 0xf69ead00,
+	0x54ad7580, 0x52c5f940, 0x82a7e020, 0xf1353010, 0x0be9d808, 0x65a20c3c, 0x66b2de1a, 0x43289133,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x68000000, 0xdc000000, 0x96000000, 0xb9000000,
+	0x1c800000, 0x0f400000, 0xefa00000, 0x80300000, 0xba680000, 0xddc40000, 0xade20000, 0x59130000,
+	0xaa1d8000, 0x458f4000, 0x3fd0e000, 0x387db000, 0xf85f4800, 0x64a82400, 0x4ba0da00, 0x3231ad00,
+	0xf168b980, 0xea44df40, 0x25256020, 0x5676f010, 0xf94da818, 0x3ab6942c, 0x242a121a, 0x92e2c937,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x38000000, 0xd4000000, 0x16000000, 0xd9000000,
+	0x6a800000, 0xe9400000, 0x73200000, 0xe1700000, 0xa1b80000, 0x71c40000, 0xdd620000, 0x3dd50000,
+	0x690a8000, 0x691dc000, 0x4f70a000, 0xecbfb000, 0xad454800, 0xbd221400, 0x1c752a00, 0xb53f0900,
+	0xad84b380, 0x06c431c0, 0xfae22020, 0x08167010, 0x7a6fe828, 0xa9cca414, 0x32f8e20e, 0x59e5dd35,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x88000000, 0xd4000000, 0xce000000, 0xfb000000,
+	0xb8800000, 0xc3400000, 0xa4e00000, 0xe8500000, 0x8ab80000, 0x69c40000, 0x46a60000, 0xa1330000,
+	0xb22a8000, 0xb4584000, 0x7494a000, 0xef9b7000, 0xe3325800, 0x1b2d0400, 0x8ddbfa00, 0x6a557700,
+	0x43bfaa80, 0x004569c0, 0xd0662020, 0xd9173030, 0x9f58f818, 0x84117414, 0x98dd2222, 0xd9d73335,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x08000000, 0x9c000000, 0x32000000, 0xeb000000,
+	0xa0800000, 0xc1400000, 0x1f600000, 0xc2700000, 0xc7e80000, 0x37c40000, 0x83260000, 0x90950000,
+	0xf15e8000, 0x5f8c4000, 0x7f36e000, 0x5a8a9000, 0x66b0d800, 0xa04dc400, 0xc013aa00, 0x281d0b00,
+	0x74e99b80, 0xc3440340, 0x4c606020, 0x86f2d030, 0x70a83828, 0x65a65434, 0xa4d3f202, 0xefbd8f27,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xf8000000, 0x14000000, 0x32000000, 0x1d000000,
+	0xa2800000, 0x60400000, 0xa4200000, 0x07f00000, 0x93080000, 0xffc40000, 0xf6e20000, 0xeb970000,
+	0xecd98000, 0xb53bc000, 0xa12ea000, 0x6f309000, 0x2e6c6800, 0xd4905400, 0x3b5fe200, 0x4bf8d100,
+	0x8b4e6780, 0x0fe63440, 0x23152020, 0x559c5010, 0x499b4838, 0x379b040c, 0xdc9d2a3e, 0x99181505,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x78000000, 0x6c000000, 0x1e000000, 0x55000000,
+	0x77800000, 0x3cc00000, 0xcc200000, 0xd9100000, 0x51e80000, 0xce440000, 0x4f620000, 0x9df50000,
+	0xc6df8000, 0x75bfc000, 0x9e4d6000, 0x4993f000, 0xb1aa2800, 0x4c26fc00, 0x9914c600, 0xf1eb3100,
+	0x3e447080, 0x3762ab40, 0xf1f0e020, 0xd8d93010, 0x20b8c828, 0xe9cacc3c, 0x75538e1e, 0x7d8e3d1b,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x48000000, 0x4c000000, 0xe2000000, 0x0d000000,
+	0x44800000, 0x29400000, 0x03200000, 0xb8d00000, 0xebe80000, 0xc8c40000, 0xd2e60000, 0x58b30000,
+	0x21198000, 0x757e4000, 0x99886000, 0xe7361000, 0x37dce800, 0xa09ee400, 0x94baea00, 0x31ee2900,
+	0x61c05e80, 0x6864c340, 0xe6f7e020, 0x6fbb5030, 0x0e6d0818, 0xb706b40c, 0xdd866212, 0xdbc2dd13,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x58000000, 0x54000000, 0x06000000, 0x61000000,
+	0xd0800000, 0x2dc00000, 0x96a00000, 0x59d00000, 0x07b80000, 0x88440000, 0x8de60000, 0x93b10000,
+	0x70498000, 0xf7eec000, 0xc6b8a000, 0xa8c33000, 0xd8258800, 0x6114c400, 0x77988e00, 0xc550e500,
+	0x987d5680, 0x69e081c0, 0x0db72020, 0x654cf030, 0x116ca808, 0xd27d340c, 0xbae3a616, 0xaa361115,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x88000000, 0x54000000, 0xfa000000, 0x37000000,
+	0x21800000, 0x60c00000, 0x30200000, 0x91300000, 0x1bb80000, 0x92440000, 0x43620000, 0x42d70000,
+	0x51298000, 0xc7084000, 0x8f3ca000, 0x9806d000, 0x4c053800, 0xf603cc00, 0x21046600, 0x3080b100,
+	0xd8404180, 0xbc67b9c0, 0xd7572020, 0xfbe99010, 0x48281838, 0x6b895c0c, 0x197ffe22, 0xd962ad15,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xe8000000, 0x2c000000, 0xce000000, 0xdf000000,
+	0x74800000, 0xa0400000, 0x10a00000, 0x19f00000, 0x28880000, 0x4fc40000, 0xe6660000, 0x18150000,
+	0xda5a8000, 0x427b4000, 0x1dcb6000, 0x76e17000, 0xca577800, 0x93fb6400, 0x8c0da200, 0xc782d500,
+	0x7ac22780, 0x9fe5e840, 0xc5d7e020, 0x553f3030, 0x95ee9828, 0xa1555414, 0x7d7fba3a, 0x5949c10b,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x08000000, 0x24000000, 0x0a000000, 0xbd000000,
+	0x75800000, 0xfbc00000, 0xaa600000, 0xf9100000, 0x1bc80000, 0x3f440000, 0x1a260000, 0xc7b30000,
+	0x1c3d8000, 0x75dc4000, 0xfc0b2000, 0x73215000, 0x10356800, 0xaefd6c00, 0x183f3e00, 0x6fde6300,
+	0x990a5080, 0x9aa24a40, 0xcdf0a020, 0x979e1030, 0x23abc818, 0x47547c2c, 0x826f7602, 0x28355f09,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xb8000000, 0x4c000000, 0x26000000, 0xb7000000,
+	0x86800000, 0x64c00000, 0xcd600000, 0xde700000, 0xa2280000, 0x71440000, 0xdd260000, 0xdad70000,
+	0x8ebc8000, 0xac59c000, 0x4b686000, 0x90643000, 0x09f03800, 0x176a7400, 0xce640600, 0x12f6fb00,
+	0x27ef1b80, 0xa5a52d40, 0x1512e020, 0xbb5af030, 0x7decd838, 0x3ca38424, 0xa0925e2e, 0x1b1bbf13,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xe8000000, 0xb4000000, 0x22000000, 0x45000000,
+	0xed800000, 0x25400000, 0xa1600000, 0xa8100000, 0xee480000, 0x9bc40000, 0xcea60000, 0x64b70000,
+	0x1ff98000, 0xb1bb4000, 0x065fa000, 0x558c1000, 0x8566a800, 0x7210ac00, 0x274d4a00, 0x38437b00,
+	0xd0e29880, 0xfb518640, 0x18282020, 0x73545030, 0x5c2e8838, 0x5954fc0c, 0x9d2bc23a, 0x7ed3872d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xd8000000, 0x94000000, 0x52000000, 0x49000000,
+	0x7e800000, 0xfa400000, 0x35e00000, 0x45700000, 0xf6780000, 0x5bc40000, 0x82260000, 0x11570000,
+	0xf4298000, 0xe46ac000, 0xfc8ea000, 0xad7f9000, 0x4c46c800, 0xd6e5b400, 0x36f33200, 0xc8b8df00,
+	0x91649380, 0x4a363fc0, 0x43192020, 0x5bf65030, 0xfc3fe838, 0x5623e40c, 0x6354da36, 0x6d2f3b25,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x18000000, 0x1c000000, 0xae000000, 0x8f000000,
+	0x90800000, 0x7bc00000, 0x4ee00000, 0xbc300000, 0xc0380000, 0x1e440000, 0xc0a20000, 0xc4970000,
+	0xa8aa8000, 0x50ecc000, 0x1b4ee000, 0xfd5c7000, 0x0f37f800, 0x0ebbc400, 0x42827e00, 0x4ac7a700,
+	0xa963c980, 0x1b71edc0, 0x431e6020, 0x7f93b010, 0x82299838, 0xee287414, 0xa82be606, 0x932fd307,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x28000000, 0xb4000000, 0x22000000, 0xa7000000,
+	0x0b800000, 0xf3c00000, 0x64200000, 0x7b700000, 0xd5880000, 0x74240000, 0x33720000, 0x91890000,
+	0xae228000, 0x08734000, 0x0c0ca000, 0xd8e39000, 0xc0d67800, 0x8f3cfc00, 0x9a8c0e00, 0xaba15900,
+	0x12b52780, 0xaaafa240, 0x42d67820, 0xb83cfc10, 0x990c0e08, 0x3c615934, 0x7c95278a, 0xc2dfa26d,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x38000000, 0x54000000, 0x4e000000, 0x17000000,
+	0x6a800000, 0x6b400000, 0xa2a00000, 0x80b00000, 0x06280000, 0xdaa40000, 0x34b60000, 0xd8290000,
+	0x45a18000, 0x3237c000, 0xa96ba000, 0xbe03f000, 0xcf077800, 0xae80f400, 0xad44aa00, 0xd9a46d00,
+	0xf035f180, 0x34691b40, 0x05877820, 0xb5c0f430, 0x17e4aa08, 0xbd146d2c, 0x801df18e, 0xadcd1b55,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x18000000, 0xe4000000, 0xf2000000, 0x85000000,
+	0x0e800000, 0xb1c00000, 0xf5200000, 0x9c100000, 0x05e80000, 0x3d240000, 0x30160000, 0x9beb0000,
+	0x46238000, 0xb596c000, 0xb7ac2000, 0x7b441000, 0xe6e2e800, 0x64345400, 0x9b7d9e00, 0x870f4100,
+	0x6b11b480, 0x4e6f3140, 0xe262e820, 0x84f45430, 0xeadd9e18, 0x3bdf413c, 0x7f59b486, 0x3f9b3179,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x58000000, 0xdc000000, 0xe6000000, 0x89000000,
+	0x74800000, 0xa8400000, 0x7b200000, 0xb2100000, 0xb8b80000, 0x47240000, 0x44120000, 0x09bb0000,
+	0xbfa68000, 0x5250c000, 0x279de000, 0x9f31b000, 0xcbac8800, 0x6f1a4400, 0xc176f200, 0x018c5100,
+	0x258d5480, 0x6f89f7c0, 0x688c8820, 0x410a4410, 0xffcef218, 0x9fa85114, 0x4d1f5496, 0x1272f7f7,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xe8000000, 0xb4000000, 0x02000000, 0xf1000000,
+	0xa4800000, 0x50c00000, 0x73a00000, 0xb0500000, 0x68180000, 0xb7a40000, 0x1a520000, 0xcd1f0000,
+	0xe1238000, 0x53954000, 0xae3aa000, 0x03b39000, 0xb92ac800, 0x0d4b8400, 0x213b1600, 0xb0325500,
+	0x466f8680, 0xd7aa16c0, 0x488ac820, 0x0c1b8410, 0x0da31638, 0xa756553c, 0xc79d86ba, 0x1ee516ed,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x68000000, 0x7c000000, 0xa2000000, 0x69000000,
+	0x63800000, 0x24400000, 0x18600000, 0x55500000, 0x9ff80000, 0x5c640000, 0xd3520000, 0xe0fd0000,
+	0xf8e78000, 0x37914000, 0xaa5ee000, 0x50129000, 0xa81a0800, 0x4771fc00, 0x31cdb200, 0x4049cb00,
+	0x850fd680, 0x52e88dc0, 0x99fa0820, 0x6361fc10, 0xd7d5b228, 0x743dcb1c, 0xda45d69a, 0xe3618ddf,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x18000000, 0xdc000000, 0x16000000, 0x1f000000,
+	0x3a800000, 0x55c00000, 0x9e200000, 0x72d00000, 0x4c980000, 0x10240000, 0x71d60000, 0x801f0000,
+	0xeae18000, 0xcd76c000, 0x7b09e000, 0x2e593000, 0xb0823800, 0x7cc63400, 0xeba09e00, 0xb5914900,
+	0x437c6280, 0x36d29ac0, 0x469a3820, 0xf9223430, 0xe4569e38, 0xf75e492c, 0xfd05e286, 0x37805af7,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xe8000000, 0xe4000000, 0x7a000000, 0xb3000000,
+	0xd6800000, 0x93c00000, 0x16200000, 0x79900000, 0x43780000, 0x24240000, 0x7e920000, 0x17fb0000,
+	0x78e78000, 0xc8354000, 0xd0ac2000, 0x323c5000, 0x63c4d800, 0xbe209400, 0xfd97ce00, 0x4979e900,
+	0x7f211880, 0x4c1075c0, 0xfe3cd820, 0xddc49410, 0x6725ce18, 0x0012e91c, 0x003e98ba, 0x64c135f9,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xb8000000, 0xc4000000, 0xca000000, 0x89000000,
+	0xa9800000, 0x50c00000, 0x81600000, 0x6d500000, 0xf1c80000, 0x0f640000, 0xee560000, 0x714d0000,
+	0x46218000, 0x87f3c000, 0x597b2000, 0x10bfd000, 0xf05b8800, 0x11cc6c00, 0xdf665600, 0x46530300,
+	0xbd4d4680, 0xf0213840, 0x00f38820, 0xb3f86c30, 0x60f85628, 0x887a032c, 0xad3ac6ae, 0xc29ff871,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xa8000000, 0x8c000000, 0x6e000000, 0x4f000000,
+	0x09800000, 0x43400000, 0x83e00000, 0xa5b00000, 0xdd580000, 0x11e40000, 0x3cb60000, 0x9fd90000,
+	0x69228000, 0x75134000, 0x730d6000, 0x3509f000, 0x360d3800, 0x718f2c00, 0xadccea00, 0x8faea700,
+	0xe559c180, 0xd5e320c0, 0x2eb53820, 0xc6db2c30, 0x0ba2ea08, 0xddd3a734, 0x92ad41aa, 0x55d960e3,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x48000000, 0x24000000, 0xbe000000, 0xa7000000,
+	0xda800000, 0x5a400000, 0x94200000, 0xff300000, 0x12d80000, 0xd6240000, 0x9a360000, 0x6d5b0000,
+	0x93e18000, 0xfbd44000, 0xbb8a2000, 0x73ec7000, 0x73fd7800, 0x0e96f400, 0x712fa200, 0xb8995900,
+	0xaa05cd80, 0x9101d4c0, 0x39857820, 0x8ec2f430, 0x2161a218, 0x9596592c, 0x09aa4d92, 0xf7da94c9,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xf8000000, 0xf4000000, 0x9a000000, 0x41000000,
+	0xf4800000, 0xa4400000, 0x56600000, 0x97700000, 0x81980000, 0xd7640000, 0x03f20000, 0x75d90000,
+	0x09078000, 0x9885c000, 0x9a46a000, 0x05675000, 0x2ef5c800, 0xbf580400, 0xfe45f200, 0x7762bb00,
+	0x33f21f80, 0xaddaaec0, 0x8d07c820, 0xfa810410, 0x2f427208, 0x6be77b1c, 0xcbb4bfbe, 0x1dbdfefd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xa8000000, 0x94000000, 0xae000000, 0xbf000000,
+	0x9b800000, 0x71400000, 0xfba00000, 0x33d00000, 0x51d80000, 0xdca40000, 0xf4560000, 0xca9d0000,
+	0xee078000, 0xdf034000, 0x4b81a000, 0xa946f000, 0xc7a0b800, 0x09d07c00, 0x40defa00, 0xf8262500,
+	0x1e934280, 0x407c04c0, 0x2676b820, 0xbd0d7c30, 0xc6f97a28, 0x81b5651c, 0xf96ae2aa, 0x2d4ef4e5,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x88000000, 0xbc000000, 0x46000000, 0x65000000,
+	0x02800000, 0xcb400000, 0x90a00000, 0x4ff00000, 0xe6280000, 0xcda40000, 0xa9720000, 0xff6d0000,
+	0x52008000, 0x4f064000, 0x0980e000, 0x80c6b000, 0x97676800, 0xcd15f400, 0x7dfc6a00, 0xca3bad00,
+	0x10dc6b80, 0x1f0a6b40, 0x72956820, 0x6038f410, 0x5bdcea28, 0xf48ded24, 0xe5548ba2, 0x6ad8db6f,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x58000000, 0x8c000000, 0xe2000000, 0xc7000000,
+	0xb8800000, 0xb4400000, 0x70a00000, 0x5bf00000, 0xf3c80000, 0x43a40000, 0xfd720000, 0x9a8d0000,
+	0xf0858000, 0x1040c000, 0xe6a16000, 0xc2f69000, 0x364cf800, 0x0465a400, 0x6310b200, 0xc298bd00,
+	0x909a9b80, 0x4f9efc40, 0xdb1ef820, 0xbd58a410, 0x52fd3228, 0x3d8c7d0c, 0x9801fb96, 0x6c016c63,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x48000000, 0xf4000000, 0xa6000000, 0x9d000000,
+	0xc3800000, 0xb8c00000, 0xf4a00000, 0x84b00000, 0x87a80000, 0xe5a40000, 0xed360000, 0xc8690000,
+	0x05868000, 0x95c44000, 0x0f26a000, 0xd077b000, 0x690ea800, 0xae15bc00, 0x921ef600, 0xcb8e4d00,
+	0x6752b980, 0x957cbb40, 0xfd18a820, 0xa30cbc30, 0xe9107608, 0xbe9e0d14, 0xdbca1992, 0x3db60b7d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0x4c000000, 0xde000000, 0xe1000000,
+	0xbf800000, 0x36c00000, 0x7ca00000, 0x2cd00000, 0xea880000, 0xc3a40000, 0xb2560000, 0xc3cd0000,
+	0x39c18000, 0x7a22c000, 0x49976000, 0xceeb7000, 0xead7c800, 0x87899c00, 0x02264600, 0xd5976d00,
+	0x98ed5a80, 0x6fd50240, 0x3209c820, 0x47e09c30, 0x29b1c628, 0xdc78ad2c, 0x70bbbaa6, 0x971cb253,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x68000000, 0xfc000000, 0x46000000, 0x7f000000,
+	0x68800000, 0xcfc00000, 0x3ea00000, 0xbc900000, 0x6d980000, 0x67a40000, 0xfb160000, 0x32d90000,
+	0xb2c18000, 0xab254000, 0x26d6e000, 0xe97fb000, 0xefd4b800, 0x76faa400, 0x24914e00, 0x19998d00,
+	0x4da0e080, 0x1a1172c0, 0xb15ab820, 0xaf87a430, 0x6346ce08, 0xb365cd2c, 0x9f37809a, 0x148b82ff,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xe8000000, 0x1c000000, 0x16000000, 0xa3000000,
+	0x28800000, 0x8cc00000, 0xb4a00000, 0xc8f00000, 0xc7480000, 0xd1a40000, 0x8b760000, 0x0f0f0000,
+	0x87c08000, 0xa0214000, 0x2237e000, 0xa8ec3000, 0xc5d65800, 0xcaffa400, 0xdf0fd600, 0x4fc63d00,
+	0xcc214380, 0x4c313c40, 0xffe85820, 0xe754a430, 0xf3395638, 0xe0287d24, 0x237623ba, 0x330c4c47,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xc8000000, 0x0c000000, 0x4e000000, 0xc3000000,
+	0xf5800000, 0x0b400000, 0x68e00000, 0xfb500000, 0x99180000, 0xa9e40000, 0xa3d60000, 0xf4df0000,
+	0x47c18000, 0xff204000, 0xbc776000, 0x016ff000, 0x5a8c5800, 0xbc5dcc00, 0x72072a00, 0x8501df00,
+	0xda84b680, 0x00c732c0, 0x68a25820, 0x6a36cc30, 0x2708aa38, 0x9b1a9f2c, 0x04e456b2, 0xc55782c3,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x68000000, 0x14000000, 0x86000000, 0x8f000000,
+	0x3a800000, 0x7e400000, 0xa0200000, 0xe5f00000, 0xb1f80000, 0xeaa40000, 0x33b60000, 0xe5df0000,
+	0x79538000, 0x654d4000, 0x21fba000, 0xb2a1b000, 0xafb63800, 0x87d9f400, 0x18570200, 0xc4cc9900,
+	0xe3396b80, 0xe3c3b5c0, 0xd0e5b820, 0xad94b430, 0xe32ca238, 0xf82d293c, 0x84af539a, 0x95ea41c5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x48000000, 0x4c000000, 0x2a000000, 0xdd000000,
+	0x49800000, 0xbec00000, 0x55600000, 0x8a300000, 0x12680000, 0xf4e40000, 0xc8f60000, 0x550f0000,
+	0x37d08000, 0xbd1c4000, 0xa4296000, 0x14c7d000, 0x4865a800, 0x23b3ac00, 0x3caa6600, 0xe9806300,
+	0x0ec32d80, 0x6d65dd40, 0x1e352820, 0x3c6fec30, 0x4fe30638, 0x7677b324, 0x7f4e8592, 0x95f27153,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xa8000000, 0xbc000000, 0x6a000000, 0x6d000000,
+	0x95800000, 0xc9c00000, 0x90200000, 0x4b900000, 0xf8c80000, 0x1da40000, 0x86520000, 0x76eb0000,
+	0xbd368000, 0x441f4000, 0xe60ae000, 0x9d07d000, 0x4d872800, 0xedc0cc00, 0xbe22de00, 0x58974900,
+	0xd6484080, 0x46e5b040, 0x2731a820, 0xf11f8c10, 0x57883e18, 0x7ac09914, 0xcea768aa, 0x88d17c6f,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x48000000, 0x7c000000, 0x5a000000, 0x2b000000,
+	0xfc800000, 0xa1c00000, 0x8ce00000, 0xa7900000, 0x99a80000, 0x8c640000, 0x9c560000, 0xde4f0000,
+	0x67718000, 0xec3c4000, 0xa2c8e000, 0x06b55000, 0x80da1800, 0xb55a8400, 0xd71a1e00, 0x70b99f00,
+	0x730b6880, 0x22508b40, 0xeb4b9820, 0x3ef6c430, 0x0c7afe38, 0x4a68cf2c, 0x27877092, 0x35450f5f,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xf8000000, 0xa4000000, 0x7e000000, 0x71000000,
+	0xc7800000, 0xb5c00000, 0x54200000, 0xa1b00000, 0xa4580000, 0xe7a40000, 0x22720000, 0x7d7d0000,
+	0xab938000, 0xc4edc000, 0xdc7c2000, 0x24127000, 0x8d2b4800, 0xa25d9c00, 0x72a01e00, 0x3bf4c900,
+	0x49bf6180, 0xc034b4c0, 0x7498c820, 0x52005c10, 0x13043e28, 0xcc82b93c, 0x8d4629be, 0xaf6428e9,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x88000000, 0xd4000000, 0x46000000, 0x63000000,
+	0x1c800000, 0x3cc00000, 0xb4e00000, 0x77f00000, 0x58780000, 0xa4640000, 0x11320000, 0x3d990000,
+	0x3a128000, 0x820e4000, 0xd95ba000, 0x92f2b000, 0x47fc5800, 0x7425c400, 0xc1131600, 0xa28d5f00,
+	0x879d4b80, 0x5b104dc0, 0x138ed820, 0x9e1b8410, 0xc850b608, 0x0f2bef34, 0xb5cb13a2, 0x153889f5,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0xcc000000, 0x1a000000, 0x09000000,
+	0x18800000, 0x70400000, 0x7ca00000, 0xc0100000, 0x89b80000, 0x86240000, 0x55560000, 0xa79f0000,
+	0x37718000, 0xcccbc000, 0x47ed6000, 0x843f5000, 0x3ce08800, 0xc4b22400, 0x65ac1200, 0xa5998d00,
+	0x6277b480, 0x264837c0, 0xfaa90820, 0x8e1de430, 0x53b77238, 0x3a29dd2c, 0x425ebcae, 0x6d15d3f3,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xb8000000, 0x84000000, 0xb2000000, 0x29000000,
+	0xcf800000, 0x0d400000, 0x57200000, 0x45900000, 0x2e880000, 0xb2a40000, 0x55d60000, 0x1c2d0000,
+	0x27778000, 0xe9fbc000, 0x4b5d2000, 0x768c1000, 0x26a38800, 0x8fd2dc00, 0x792eba00, 0x66f59100,
+	0xfbbe2080, 0x48f8e640, 0xd8dc0820, 0x9dcd1c30, 0x22859a28, 0x10c4811c, 0xa36228ae, 0x1535fa61,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x08000000, 0x34000000, 0x3a000000, 0x0d000000,
+	0x7f800000, 0xbb400000, 0x09a00000, 0xd8700000, 0x37080000, 0xb8240000, 0x74320000, 0x5c2b0000,
+	0xdc978000, 0xcdda4000, 0x3bdea000, 0x70dc5000, 0x6c5d2800, 0xef9cdc00, 0x27faca00, 0x06ef4500,
+	0x61738f80, 0x328eba40, 0x6e62a820, 0x72129c10, 0x371e6a18, 0xd63c151c, 0x978b2782, 0x75e3264d,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x68000000, 0x3c000000, 0xba000000, 0xbf000000,
+	0x9a800000, 0xd9400000, 0x5c600000, 0x41100000, 0x5f680000, 0xa8e40000, 0x61560000, 0xfc8b0000,
+	0x65378000, 0x499d4000, 0xac5ee000, 0xfc7c5000, 0xbc8fb800, 0xc537b400, 0x599eda00, 0xb4593b00,
+	0xa8782c80, 0x3a8fb940, 0xc0303820, 0x7c1ef430, 0xf79e3a18, 0x2d5a6b1c, 0x27fe149a, 0xde4a4d4f,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0x4c000000, 0xda000000, 0xd3000000,
+	0xad800000, 0xd1c00000, 0x6fa00000, 0xb8300000, 0xf1b80000, 0x9c240000, 0x9cf60000, 0x629d0000,
+	0x3f528000, 0xc0af4000, 0xbdeb6000, 0x210a5000, 0xd8d8d800, 0x60368c00, 0x85bc9e00, 0x82214500,
+	0x09f5dd80, 0xee1f6bc0, 0xdc125820, 0x094dcc30, 0x68b9fe28, 0xaaa21534, 0xdcb1858a, 0xfeffa7d3,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0x0c000000, 0xee000000, 0x9d000000,
+	0xf2800000, 0x18c00000, 0xd4e00000, 0xf3700000, 0x11e80000, 0xdb640000, 0x29360000, 0xf5c90000,
+	0xf8f28000, 0xf1a8c000, 0x40456000, 0x8b27f000, 0x5a132800, 0x73d97400, 0xbd2d7600, 0xdd802f00,
+	0x81407f80, 0x8fa32140, 0xf3d7a820, 0x6bb8b430, 0x139a9608, 0xe60f1f34, 0x5f9637b6, 0xfe9da543,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x08000000, 0x5c000000, 0xf6000000, 0x69000000,
+	0x0f800000, 0x59c00000, 0x22600000, 0x6ef00000, 0x73280000, 0xb4e40000, 0x10b60000, 0x048f0000,
+	0xb6718000, 0x306e4000, 0x66c1e000, 0xd4e43000, 0x60b40800, 0xec8f1c00, 0x5a713e00, 0xce6ebb00,
+	0x53c7bb80, 0x2d619f40, 0x50738820, 0xc16e5c30, 0x6d415e38, 0x9f24cb2c, 0x89d25382, 0x4efab357,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xd8000000, 0x2c000000, 0xfa000000, 0x03000000,
+	0xce800000, 0x31c00000, 0xff600000, 0xb4f00000, 0x5c080000, 0x0ae40000, 0xf7b60000, 0xd0ab0000,
+	0x3e768000, 0xf3c8c000, 0x98866000, 0x08c35000, 0x52e5d800, 0x1bb59400, 0x4aa89e00, 0x6d728300,
+	0xe54a0380, 0x85447640, 0x0da55820, 0xe5165430, 0x89387e18, 0x71891314, 0x65a1bbb6, 0x8116b24b,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x78000000, 0xc4000000, 0xf2000000, 0x9f000000,
+	0x74800000, 0x87c00000, 0x18200000, 0xfa700000, 0x0a080000, 0x3ba40000, 0x75360000, 0xc3eb0000,
+	0x84f58000, 0x16cdc000, 0xc5012000, 0xa7801000, 0xdd443800, 0x06e40400, 0x83d06e00, 0x583a1900,
+	0x28cfe780, 0xb4029640, 0x2a07b820, 0x0b02c430, 0xce84ce18, 0xa4c7c90c, 0x5aa2ff9e, 0x10b28271,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x48000000, 0xbc000000, 0xae000000, 0x01000000,
+	0x19800000, 0xfcc00000, 0xc7600000, 0x8bf00000, 0xca180000, 0x67e40000, 0xeab20000, 0x9bbb0000,
+	0x20768000, 0xe9d84000, 0xc002e000, 0x2005f000, 0x30014800, 0x1807ac00, 0xf400d600, 0x1203d300,
+	0xaf01e380, 0x1881bec0, 0xe545c820, 0x3ba4ec10, 0x4c94b618, 0x41ee6314, 0xadfa4b92, 0x8d57e2ef,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x08000000, 0x84000000, 0xae000000, 0x89000000,
+	0xea800000, 0xbb400000, 0xb0a00000, 0x32500000, 0xd5080000, 0x67240000, 0x75960000, 0xabef0000,
+	0xbd508000, 0x828e4000, 0xe0e72000, 0xeb77f000, 0xe19b0800, 0x424bf400, 0x4d82ea00, 0x18c4ed00,
+	0x01603680, 0xa9b3fa40, 0x5ffd8820, 0x047ab430, 0x69bd4a38, 0x30595d24, 0x89aa1e82, 0x2f70fe61,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0xb4000000, 0xbe000000, 0xe3000000,
+	0x0e800000, 0xa9400000, 0x9f600000, 0xd4300000, 0x8b180000, 0x2ee40000, 0xf1f60000, 0xec390000,
+	0x52328000, 0xcc1ac000, 0x2660a000, 0xdfb57000, 0x5bdad800, 0x78475400, 0x68e27a00, 0x96f74300,
+	0x34bda580, 0xe476cac0, 0xcffe5820, 0xb2149430, 0x98485a08, 0xe5ccf334, 0x3a09dda6, 0x4829eeed,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x38000000, 0xfc000000, 0x42000000, 0x47000000,
+	0xdd800000, 0x8c400000, 0xa3e00000, 0xbfd00000, 0xd8f80000, 0x1b640000, 0xb9120000, 0xf2df0000,
+	0x27168000, 0x07dbc000, 0x3594e000, 0xc21a9000, 0x9c30f800, 0x27298c00, 0x239cb200, 0xf2744700,
+	0x73cdc280, 0x29cefdc0, 0x62cc7820, 0x75494c10, 0x2a0cd238, 0xd26a1714, 0x18ff5a8e, 0xbb6621ff,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x48000000, 0x94000000, 0x2e000000, 0x45000000,
+	0x06800000, 0x67c00000, 0xb8e00000, 0x4ad00000, 0x1ae80000, 0xe5640000, 0x96920000, 0xef490000,
+	0x52928000, 0xc9484000, 0xa391a000, 0x31cdf000, 0xc9556800, 0x1ba81400, 0xca450e00, 0xfca7cf00,
+	0x63705280, 0x171be140, 0xd1bde820, 0x99cd5410, 0xed542e08, 0x8dab7f34, 0x83461a92, 0x08264565,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0x54000000, 0x1a000000, 0xe9000000,
+	0x34800000, 0xc2400000, 0x2b200000, 0x98b00000, 0x22880000, 0x14a40000, 0xa3760000, 0x8d6b0000,
+	0xd0728000, 0x90e8c000, 0x46b5a000, 0xa9885000, 0x2d268800, 0x47b38400, 0x010b0200, 0x19663100,
+	0x1b957180, 0x8639ee40, 0x702a0820, 0xc8d44430, 0xbd9a2218, 0x58dda134, 0x747cd9b6, 0x930efa55,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x34000000, 0x2a000000, 0x93000000,
+	0x6e800000, 0x89400000, 0x09200000, 0xaa900000, 0xc4380000, 0x9aa40000, 0xec520000, 0xdddf0000,
+	0xfcd18000, 0x1d9fc000, 0x5072a000, 0xd4ced000, 0x862a5800, 0x4ad95400, 0x4051da00, 0xd3ddf100,
+	0xadd43080, 0xdc1d13c0, 0x11b1d820, 0xd9ad9410, 0xf218fa38, 0x50b7e12c, 0xf02f48ae, 0x8fda57cd,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xc8000000, 0x6c000000, 0x1e000000, 0x2d000000,
+	0x71800000, 0x09c00000, 0x09600000, 0x4a700000, 0x6f580000, 0xc0a40000, 0xe3120000, 0xb52f0000,
+	0x17ff8000, 0x87b04000, 0x243e6000, 0x91d07000, 0xcccea800, 0xdbcdac00, 0xb54e5e00, 0x1e0e9300,
+	0x32295780, 0xc17c88c0, 0x88f0c820, 0x7a1ddc10, 0x5180f638, 0xd9c33f1c, 0x516709b2, 0x9e721bdb,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x68000000, 0xc4000000, 0xc6000000, 0xa7000000,
+	0x71800000, 0x03400000, 0x2c200000, 0x41700000, 0xfc580000, 0x0f640000, 0x5d520000, 0x752d0000,
+	0x473f8000, 0xfc354000, 0x4b792000, 0x8594b000, 0x1f4ff800, 0xeaefec00, 0x8cdd8a00, 0x4aa22900,
+	0xbbb61f80, 0xc73f84c0, 0xbc36d820, 0xeb7b5c10, 0xf5927228, 0x774dc51c, 0x2eeb959a, 0x4addadf1,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xf8000000, 0x24000000, 0x36000000, 0x07000000,
+	0xe6800000, 0xb8400000, 0xc2e00000, 0xcab00000, 0x01a80000, 0x02a40000, 0x6c520000, 0x9d1b0000,
+	0xd40a8000, 0x7071c000, 0x6d082000, 0xbdf03000, 0x69cb7800, 0xfa56d400, 0x6a19d200, 0x7a8f5f00,
+	0xc430f980, 0x45ed8b40, 0x62435820, 0xbfe6e410, 0xa132aa18, 0x9a698b34, 0x57812bbe, 0x19c6d449,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0xa4000000, 0xc2000000, 0xa5000000,
+	0x55800000, 0xcd400000, 0x49600000, 0x85900000, 0x47a80000, 0x90240000, 0x76f60000, 0x4b390000,
+	0xf40c8000, 0xe4974000, 0x202a2000, 0x60639000, 0x7616e800, 0xcdebcc00, 0x39c1da00, 0xc3a23300,
+	0x2cb78880, 0x6ad86b40, 0xf55cc820, 0xe9185c30, 0xbfff3208, 0xe62dff04, 0xd76052aa, 0x0e935869,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x88000000, 0xa4000000, 0x3a000000, 0xbb000000,
+	0x2b800000, 0x95c00000, 0xb7600000, 0x57300000, 0xb9580000, 0xdea40000, 0xa6560000, 0xd3690000,
+	0x51798000, 0x6bb64000, 0x591a2000, 0x5d015000, 0x66821800, 0x0b413c00, 0xb025de00, 0xc915f300,
+	0x794b1d80, 0x936de8c0, 0xb1783820, 0xfbb06c30, 0x611fc608, 0x7100cf2c, 0xf880c3a2, 0x8a451be9,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x48000000, 0xc4000000, 0xb2000000, 0xcd000000,
+	0xcc800000, 0x71400000, 0x07a00000, 0x78300000, 0x27480000, 0x94e40000, 0x9a920000, 0xe7f90000,
+	0xa8e88000, 0x48d44000, 0xbfdd2000, 0x661c1000, 0x72fea800, 0xa86d0400, 0x6f93ba00, 0x577e0500,
+	0x57ae2d80, 0x2c77a440, 0xf86b8820, 0x47951410, 0x237f1208, 0x3daa0124, 0x6d751792, 0x42ede171,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0xac000000, 0xb2000000, 0x8f000000,
+	0xd7800000, 0x14c00000, 0x9b600000, 0x70300000, 0x70780000, 0x35a40000, 0xe8560000, 0xb5cf0000,
+	0xa61d8000, 0x75104000, 0x276c6000, 0xc5cf1000, 0xce1db800, 0x09149c00, 0xed68d600, 0xaecdf300,
+	0x079de580, 0x20d229c0, 0x2e89d820, 0x1dbf8c30, 0xf8436e38, 0xfe266f0c, 0xc690b392, 0xedab9aeb,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x18000000, 0x64000000, 0x76000000, 0xdb000000,
+	0x15800000, 0x37c00000, 0x63a00000, 0xa5b00000, 0xbbf80000, 0x6a640000, 0xa1160000, 0xb9cd0000,
+	0x9b5a8000, 0x7e52c000, 0xfb282000, 0xbb0c3000, 0x927a9800, 0x2fa44c00, 0x1fb4ae00, 0x1afd3500,
+	0x7ee23980, 0x52529dc0, 0x312ab820, 0xd20c7c30, 0xfaf83628, 0xcee47934, 0x3a541786, 0x9d2968d9,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x38000000, 0xdc000000, 0x82000000, 0xcf000000,
+	0x6a800000, 0x4dc00000, 0xa0e00000, 0x4f500000, 0xca180000, 0xc3240000, 0xdab20000, 0x5ccd0000,
+	0x5c7b8000, 0x03b7c000, 0xdf49e000, 0x4a3a9000, 0x39163800, 0xe0bb7400, 0x94d61e00, 0x105b2f00,
+	0x13817680, 0x3e401ac0, 0x8ea7d820, 0xa9f5e410, 0x77ea2628, 0xd2c95b3c, 0x997ee88e, 0xe231f5f7,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0xe4000000, 0x3e000000, 0xb7000000,
+	0xaf800000, 0xd6400000, 0x71e00000, 0x69300000, 0xdf980000, 0x75a40000, 0xe5d60000, 0x682f0000,
+	0x98f98000, 0xea574000, 0x2e6e2000, 0x111f7000, 0x7f677800, 0x83f61c00, 0x09bae200, 0xbc330700,
+	0x251fed80, 0x9960e2c0, 0x98f15820, 0xcc3d6c30, 0x4b739a38, 0xa87e1b2c, 0xb7928faa, 0x57cfa5f9,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xd8000000, 0x04000000, 0x2a000000, 0x2f000000,
+	0xc1800000, 0x5fc00000, 0xc7200000, 0x07300000, 0x76e80000, 0x9ee40000, 0x79160000, 0xa15d0000,
+	0x1b498000, 0x4d94c000, 0xa81b2000, 0x562dd000, 0x90403800, 0xede3ec00, 0x56930e00, 0x5b9d5100,
+	0x82edad80, 0x0ce43540, 0x42131820, 0x22da3c30, 0xb78d3628, 0x6537bd2c, 0xf5e923b6, 0x0964a441,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x68000000, 0x5c000000, 0xae000000, 0xad000000,
+	0x5a800000, 0x9ac00000, 0xcea00000, 0xf5b00000, 0xbdc80000, 0x99640000, 0x91960000, 0x8ab90000,
+	0xce0c8000, 0x67414000, 0xf9e5e000, 0x8454f000, 0x559ea800, 0x1aff7400, 0x12694600, 0x30556d00,
+	0x679f9180, 0x39fd2c40, 0xf5ed4820, 0x98128430, 0x6ffb6e08, 0xaceb5904, 0x1093379a, 0xe63cb157,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x88000000, 0xac000000, 0x4a000000, 0x3d000000,
+	0x99800000, 0x9b400000, 0xdf200000, 0x03700000, 0x03980000, 0x31640000, 0x49d20000, 0x61af0000,
+	0x08de8000, 0xc6424000, 0x56a06000, 0xf037d000, 0x20bf2800, 0xf011ec00, 0xdb49ea00, 0x834e4100,
+	0xe749bf80, 0xe14d4ac0, 0xc64d4820, 0xeac93c10, 0x44084238, 0x4a6ded14, 0xab3835a2, 0x3250dbeb,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xc8000000, 0xf4000000, 0xf6000000, 0x0f000000,
+	0x76800000, 0xa7c00000, 0xb8200000, 0x1d300000, 0x3b980000, 0xa8e40000, 0x2f960000, 0x636f0000,
+	0x225b8000, 0x2bc44000, 0x5226a000, 0x00373000, 0x8c19b800, 0x4aa65400, 0x44f32e00, 0x98bd0900,
+	0xc550a580, 0x74cf16c0, 0xf1291820, 0x413e6430, 0xc4111638, 0xb32f1d3c, 0x983d2bb2, 0xad912ffd,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xe8000000, 0xe4000000, 0x96000000, 0xed000000,
+	0x2a800000, 0xaec00000, 0x13e00000, 0xdf900000, 0x95180000, 0xdc240000, 0xd4f20000, 0x7f4f0000,
+	0xcd5e8000, 0xbb014000, 0x67822000, 0x34413000, 0x0522a800, 0xc0713400, 0x388ee600, 0x323f4700,
+	0xcf56c080, 0x2ffd8ac0, 0x0f328820, 0xba2f0410, 0x960ace38, 0x1afb3314, 0x39b006ba, 0x6ee8fdf9,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xc8000000, 0x4c000000, 0x66000000, 0x01000000,
+	0x49800000, 0x07c00000, 0x6fe00000, 0xa3900000, 0x13880000, 0x0d240000, 0x7ff20000, 0x88d90000,
+	0x0dc98000, 0x7d004000, 0xa7816000, 0x6ac7b000, 0xf063c800, 0x6d566c00, 0x79e96e00, 0xcf744700,
+	0x029d5880, 0x6fefee40, 0x6670a820, 0x9718dc10, 0x762b2608, 0x8c966b2c, 0x570f56b2, 0x05611953,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xe8000000, 0x3c000000, 0xe6000000, 0xaf000000,
+	0xc5800000, 0x61c00000, 0x8ea00000, 0x72300000, 0x24e80000, 0xa4640000, 0x9b160000, 0x4a1f0000,
+	0xeeae8000, 0x48054000, 0x4c00e000, 0xbe02b000, 0x2b00b800, 0xf7808c00, 0x14c5de00, 0x02263d00,
+	0x7970c580, 0x0e0c0540, 0x39365820, 0x436d3c30, 0xb8a3e638, 0xf537f114, 0x3d6bfbba, 0x73a3884f,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x88000000, 0x1c000000, 0x16000000, 0xc1000000,
+	0x2c800000, 0x3cc00000, 0x46200000, 0xecb00000, 0x8e380000, 0xede40000, 0x27160000, 0xa2cd0000,
+	0xe13f8000, 0xf4664000, 0xed53e000, 0xf72e3000, 0x322dc800, 0x8cafc400, 0x236eb600, 0x7ac80900,
+	0xc538c980, 0xd664d3c0, 0x56502820, 0x84a8f430, 0xff6afe28, 0xcccc8d1c, 0x743a1fa2, 0x72e4aac7,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x38000000, 0xe4000000, 0x0e000000, 0x7d000000,
+	0xc9800000, 0xecc00000, 0x9da00000, 0x19900000, 0xfc980000, 0x16640000, 0xe6b60000, 0xc9490000,
+	0xd4198000, 0x3923c000, 0x74d02000, 0x71fcf000, 0xc853a800, 0x48beac00, 0x73353600, 0x0f8cf500,
+	0x1ab9a880, 0x24366ec0, 0x950d8820, 0xf2ff5c30, 0xa4d11e08, 0x19fc992c, 0x84533e8e, 0x2abcabf9,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xa8000000, 0xfc000000, 0xe6000000, 0xe9000000,
+	0x73800000, 0xe6400000, 0xda600000, 0xe3300000, 0x4eb80000, 0x47240000, 0x29d20000, 0x3f4d0000,
+	0x833a8000, 0x8c634000, 0x9230e000, 0x193cb000, 0xc3608800, 0xa8b33c00, 0x5cfae200, 0x57442b00,
+	0x6de48d80, 0x17743bc0, 0xb7da6820, 0x70968c10, 0xe7aaea28, 0xd1cd5734, 0x9cfe0faa, 0xb746e0ff,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x18000000, 0x6c000000, 0x1e000000, 0x5b000000,
+	0xfc800000, 0x93c00000, 0xb5600000, 0xf2900000, 0x5da80000, 0x02240000, 0x58320000, 0x145d0000,
+	0x5e198000, 0x8f3ec000, 0xaf886000, 0xe2167000, 0x90689800, 0x4c40c400, 0xe6204e00, 0xc2312300,
+	0x855cb880, 0x3b9f7f40, 0xbd797820, 0x42a87410, 0xd4a0b628, 0x42f7972c, 0xa8bc6e86, 0x80ca985b,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xa8000000, 0x24000000, 0xda000000, 0x99000000,
+	0x9e800000, 0x85400000, 0x4a200000, 0xf7f00000, 0x57680000, 0x45e40000, 0x0a920000, 0x37bb0000,
+	0x11f98000, 0xac5b4000, 0x886c2000, 0x84665000, 0x0e550800, 0x195e1400, 0x78ef1a00, 0x3a222900,
+	0x7ff17380, 0xa36efd40, 0x87e0a820, 0x1f930410, 0x573e3218, 0xd7be6d2c, 0xe1f961aa, 0x6459c049,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x48000000, 0xe4000000, 0xf2000000, 0xf5000000,
+	0x6d800000, 0xd8c00000, 0x78e00000, 0x31700000, 0xddb80000, 0xf1a40000, 0x6f560000, 0xc72b0000,
+	0xefea8000, 0xaf084000, 0x827e2000, 0xd1c01000, 0x8b666800, 0x6ab38c00, 0x1fdab600, 0xc8929f00,
+	0x9b4bff80, 0x55dc7fc0, 0xe192c820, 0x18cbdc30, 0xf61afe18, 0x5ff50334, 0x7ff92192, 0xe1026cf9,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xe8000000, 0x54000000, 0xc6000000, 0x23000000,
+	0xbb800000, 0xefc00000, 0x29200000, 0xff700000, 0xe0180000, 0xcb640000, 0x02920000, 0x81c90000,
+	0xd1c88000, 0x59c94000, 0xbdcda000, 0x03cdb000, 0x9ccdd800, 0xb54bbc00, 0xbf8f2e00, 0x0e280100,
+	0xa51b6f80, 0x83e4eac0, 0x9ed0f820, 0x832b4c10, 0x299d5608, 0x31a70d24, 0xeb3119ba, 0x06fe17d5,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x58000000, 0x44000000, 0x22000000, 0x61000000,
+	0x2c800000, 0x21c00000, 0x4ee00000, 0xee100000, 0x65a80000, 0xd9a40000, 0x54320000, 0x23d90000,
+	0x9ed88000, 0xb45cc000, 0x669d2000, 0xadfa9000, 0x52aa4800, 0x3e220400, 0x04777e00, 0x967d0f00,
+	0x04ec6c80, 0x7887bf40, 0x1bc7e820, 0x4be05410, 0x70921608, 0x7d6c9b24, 0xffc1da96, 0xb9e07451,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0xcc000000, 0xb6000000, 0xf9000000,
+	0xe5800000, 0xc8400000, 0x5ea00000, 0x93100000, 0x3f880000, 0x3d640000, 0x28f20000, 0xe5b90000,
+	0x2abb8000, 0x763b4000, 0x7bf96000, 0x1d1d3000, 0x78aa0800, 0x18348c00, 0xacdc5200, 0x40492d00,
+	0x68836c80, 0x6fc2ca40, 0x6de0e820, 0xf336fc10, 0xaa5d3a08, 0xf289913c, 0xbae6b6aa, 0xebb02b73,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xb8000000, 0x74000000, 0x9a000000, 0x35000000,
+	0xc7800000, 0xbfc00000, 0xe3200000, 0x87b00000, 0x32e80000, 0xa5640000, 0xac560000, 0xe0fd0000,
+	0xda788000, 0x9e3fc000, 0xa4dca000, 0x334f5000, 0x2297e800, 0x165fdc00, 0x2b0ace00, 0x4e728100,
+	0x5aca1980, 0x52510d40, 0x37fbc820, 0xfcfb4c30, 0xec7f8628, 0x753b0d24, 0xe459bfae, 0xb20e905d,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xe8000000, 0x14000000, 0x56000000, 0x79000000,
+	0x08800000, 0xd6c00000, 0xb8e00000, 0xec900000, 0xcf880000, 0x0ca40000, 0x99b20000, 0x8c7b0000,
+	0x30fe8000, 0xc0394000, 0xd9dda000, 0x91cd3000, 0x22830800, 0xadc42400, 0xff626600, 0x1bd1df00,
+	0x4129b880, 0x9a155640, 0x54482820, 0xdac45410, 0x62e6ce18, 0x0f97cb14, 0x440c56ba, 0x01e6ed45,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x38000000, 0xf4000000, 0x5a000000, 0x6d000000,
+	0xb9800000, 0xd0400000, 0x0b600000, 0x09900000, 0x8e480000, 0x04a40000, 0x69b20000, 0x963b0000,
+	0xadbf8000, 0xd4ffc000, 0x641aa000, 0x54cc5000, 0x0a642800, 0x4e112c00, 0x410ab200, 0x67400300,
+	0x9fe05880, 0x00522440, 0x25690820, 0x3e56bc10, 0x1a6e3a18, 0x46d27f1c, 0xadab428e, 0x92f3cb7d,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x38000000, 0xdc000000, 0xa2000000, 0x7b000000,
+	0xc2800000, 0x22c00000, 0xf1a00000, 0x37b00000, 0x37e80000, 0xaae40000, 0x06520000, 0x033b0000,
+	0xd3198000, 0x48efc000, 0xe663e000, 0xa5919000, 0x271c9800, 0x9ee8b400, 0x0b652600, 0xea16a500,
+	0xfa5fe180, 0x8a0d2540, 0xf434f820, 0x80ade410, 0x4103de18, 0xf580412c, 0xaa45bf8e, 0xfc62a477,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xc8000000, 0x44000000, 0xba000000, 0xa5000000,
+	0xfb800000, 0xb3400000, 0xc2200000, 0x5c300000, 0x32d80000, 0x67e40000, 0x52d60000, 0x458f0000,
+	0x9e2b8000, 0x685c4000, 0xb5272000, 0x96b35000, 0x181be800, 0xcf803c00, 0x01422a00, 0xc323c900,
+	0xedb24580, 0xec98b8c0, 0x1a414820, 0x07a02c30, 0x10756238, 0x5e7ce53c, 0xbb14a7b2, 0x556c1dd1,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x68000000, 0xfc000000, 0x1a000000, 0xe1000000,
+	0xb2800000, 0x8ec00000, 0x04200000, 0xfe900000, 0x76980000, 0xa5640000, 0x9cf20000, 0xc3e90000,
+	0x4bca8000, 0x575d4000, 0x74c0e000, 0x55255000, 0xd413c800, 0xbc5fb400, 0x2f440600, 0x65621900,
+	0xfcf4b880, 0x33ebdec0, 0xf3cba820, 0xc35ea410, 0x92c5ae08, 0xae21bd34, 0x8791969a, 0x801a23ff,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x08000000, 0x7c000000, 0xd6000000, 0x91000000,
+	0xcb800000, 0xf0400000, 0x3ea00000, 0xbab00000, 0x03380000, 0xd0640000, 0x5dd20000, 0x2c6b0000,
+	0x6bc98000, 0x96fe4000, 0xdb86e000, 0x68423000, 0x9aa24800, 0xa8b07c00, 0x303a9200, 0x20e42d00,
+	0x2113b180, 0xb80e4fc0, 0xd41f2820, 0xe1970c10, 0x8ccfba18, 0x5c7c212c, 0x38478b82, 0x62a72edf,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xb8000000, 0xfc000000, 0x62000000, 0xc1000000,
+	0x56800000, 0x46400000, 0x03200000, 0x9a100000, 0xb9380000, 0x90e40000, 0xf8f20000, 0x78cf0000,
+	0xa2ac8000, 0x6e1bc000, 0x6cf6e000, 0xfece9000, 0x0da84800, 0x339e1400, 0xf9320200, 0x732f6100,
+	0x71dd3c80, 0x8417e7c0, 0x5a382820, 0xe7604410, 0xf8322a38, 0x85ab2504, 0xc79d16ae, 0x2f33c2ff,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x08000000, 0x04000000, 0xaa000000, 0x4d000000,
+	0x88800000, 0xad400000, 0x2ba00000, 0x4d700000, 0x8cb80000, 0x39640000, 0xa6120000, 0x3baf0000,
+	0xcc4c8000, 0x341e4000, 0x43912000, 0xae68d000, 0xb2a9a800, 0x4ecaa400, 0x24595a00, 0xf8b7c500,
+	0x425cd780, 0xbbb4c3c0, 0xddde0820, 0xcb773410, 0xdfbf5238, 0xaee4f104, 0xd2d18582, 0x93cf32c1,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x38000000, 0xf4000000, 0x12000000, 0x79000000,
+	0x0c800000, 0x59400000, 0xb4600000, 0x19500000, 0xf4980000, 0x62a40000, 0x1df20000, 0xc26d0000,
+	0x75498000, 0x8d7fc000, 0x9a34a000, 0xb64a1000, 0xc4fe8800, 0xb1f58400, 0x746b3a00, 0x364ddb00,
+	0x84f9b680, 0x11f3a2c0, 0xc469a820, 0x0e495410, 0x70fa9228, 0x03f08f2c, 0xbd69248e, 0x02ca2dfd,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x58000000, 0xd4000000, 0x16000000, 0xcf000000,
+	0x48800000, 0x34c00000, 0xd4e00000, 0x43900000, 0x42280000, 0x55a40000, 0x1a320000, 0xda1f0000,
+	0xb6ba8000, 0xfb0cc000, 0x0557a000, 0x87cb3000, 0xfdb13800, 0x365aa400, 0xee9e7600, 0x687e4f00,
+	0x4aed5080, 0x8b46ab40, 0xeca61820, 0x0db65410, 0x1e586e38, 0x52981b34, 0x227d3e96, 0x1feab075,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xd8000000, 0x5c000000, 0x26000000, 0x09000000,
+	0x94800000, 0x45c00000, 0xb9200000, 0x8e100000, 0xc7980000, 0x43640000, 0xd5720000, 0x6eeb0000,
+	0xdb898000, 0x6ff8c000, 0x1197e000, 0xf5ddb000, 0x0c040800, 0x0e070400, 0xed043e00, 0x5e83d100,
+	0xb2c76c80, 0x78a21ec0, 0x79506820, 0x327d7410, 0xe0d45618, 0xd93ea52c, 0x53333ab6, 0xc38cbbd7,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x78000000, 0xb4000000, 0x06000000, 0x29000000,
+	0x98800000, 0x15c00000, 0xe2e00000, 0xd8500000, 0xa7280000, 0xf8540000, 0x572e0000, 0xb0570000,
+	0xcb2c8000, 0x7a54c000, 0x50292000, 0xcdd4f000, 0xf4686800, 0xa2703400, 0xdb18c600, 0x3fef2300,
+	0x5c320480, 0x37b81a40, 0x4318c620, 0x1bef2330, 0x42320498, 0xfab81a54, 0xa598c63e, 0x932f231d,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x48000000, 0x94000000, 0x9e000000, 0x7d000000,
+	0x81800000, 0x8c400000, 0x87e00000, 0xffb00000, 0x18c80000, 0xe7b40000, 0x04ce0000, 0x8db70000,
+	0x37c88000, 0x39354000, 0xae0c2000, 0xac91b000, 0xab5fc800, 0xca6dbc00, 0xd867aa00, 0xaef38300,
+	0xaea95780, 0x0c44c540, 0x47e7aa20, 0x9fb38330, 0xc8c95798, 0xafb4c574, 0x90cfaa32, 0x13b78315,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xf8000000, 0xdc000000, 0x0e000000, 0x91000000,
+	0xad800000, 0xe8400000, 0x49a00000, 0xadf00000, 0xb8880000, 0xc5f40000, 0x8c8e0000, 0x3ff10000,
+	0x478d8000, 0x2976c000, 0x414b6000, 0xba16b000, 0x71dfe800, 0xa30bdc00, 0x00b4aa00, 0xb6ab9100,
+	0x6342c580, 0x3f20d540, 0x7b34aa20, 0xa3eb9130, 0xd162c5a8, 0x4790d55c, 0xd19caa1e, 0x6eaf9107,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x18000000, 0x64000000, 0x02000000, 0xb5000000,
+	0x06800000, 0x3cc00000, 0x51a00000, 0x8bb00000, 0xe8a80000, 0x2fb40000, 0x4aaa0000, 0x8ab30000,
+	0xa42d8000, 0xca73c000, 0x938ea000, 0xf6c3d000, 0xc8a30800, 0xe337e400, 0xef68ee00, 0xb3966900,
+	0x28593380, 0xbefeec40, 0xdec8ee20, 0x88266910, 0x38f133b8, 0x054aec7c, 0x8e62ee26, 0xd3956909,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x88000000, 0xd4000000, 0x82000000, 0x07000000,
+	0x10800000, 0x91c00000, 0xaa600000, 0x52100000, 0x48780000, 0x8e140000, 0xde7e0000, 0xab110000,
+	0x99fc8000, 0xa2554000, 0x765a2000, 0xd8215000, 0x6b321800, 0x0ecdd400, 0xaa9c9600, 0xd1c78700,
+	0xca638680, 0xa21404c0, 0x907c9620, 0xd2178730, 0x887b86a8, 0x2e1004d4, 0x8e7a9602, 0x23128705,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xd8000000, 0xbc000000, 0xc2000000, 0xc9000000,
+	0x5d800000, 0x50400000, 0x07e00000, 0x5eb00000, 0xf7680000, 0x0ab40000, 0xf16e0000, 0xadb70000,
+	0x0fed8000, 0x0d71c000, 0x7bc86000, 0x0f67d000, 0x41762800, 0xa1c93c00, 0x1a66aa00, 0xaef40300,
+	0xe088df80, 0xfc04f840, 0x6206aa20, 0xd9040330, 0xf580df98, 0x3440f85c, 0x79e0aa16, 0x55b7031f,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xb8000000, 0x24000000, 0x06000000, 0xa5000000,
+	0x1e800000, 0x04c00000, 0xdfa00000, 0xec700000, 0x5ee80000, 0xc0740000, 0xd4ea0000, 0x9f770000,
+	0x1d688000, 0x9e32c000, 0x5989a000, 0xb1a2f000, 0x95748800, 0x026e0400, 0x37b2ae00, 0x08c9f900,
+	0x4d444d80, 0x9ee44e40, 0xc892ae20, 0x2179f910, 0xb48c4d98, 0x43204e54, 0x3bb0ae0e, 0xb2caf919,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x78000000, 0xac000000, 0xfa000000, 0xbf000000,
+	0x21800000, 0x44400000, 0xc1e00000, 0x8b300000, 0xa4280000, 0xd1340000, 0x0b2e0000, 0xa8b50000,
+	0x33688000, 0xeb56c000, 0xab5de000, 0x94f91000, 0x812c1800, 0x7fb61c00, 0xe6eb3a00, 0x29109300,
+	0x57bda380, 0x2d4e5240, 0xbac33a20, 0x94249330, 0x8693a388, 0xeafb5274, 0xd02bba3e, 0x9732531b,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xc8000000, 0xd4000000, 0xd6000000, 0x21000000,
+	0x95800000, 0x3e400000, 0xb8600000, 0x8b900000, 0x1c580000, 0x69940000, 0x5b5a0000, 0xe5150000,
+	0x3c9c8000, 0xa9334000, 0x2c6a2000, 0x5c7df000, 0xd3672800, 0x7d175c00, 0x6099da00, 0x8b331f00,
+	0x0b6e4680, 0x20fc9dc0, 0xaca1da20, 0x2d371f10, 0x726c4688, 0x897d9df4, 0x40e75a12, 0xaa515f25,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xb8000000, 0x94000000, 0xaa000000, 0x11000000,
+	0x67800000, 0xa0c00000, 0x53200000, 0xb7500000, 0xa2780000, 0x11540000, 0x5d7e0000, 0xd5d10000,
+	0x0f3e8000, 0x53b4c000, 0xce8a2000, 0xd8399000, 0x7b36a800, 0x02c8ac00, 0xf558ae00, 0x7403b500,
+	0xda025480, 0x1900c6c0, 0x5b80ae20, 0x26c7b530, 0x7c2454a8, 0x6bd5c6c4, 0x74382e0e, 0x85367515,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xc8000000, 0xe4000000, 0x76000000, 0x29000000,
+	0x07800000, 0xbbc00000, 0x5de00000, 0x6d500000, 0xdc680000, 0x24540000, 0xebea0000, 0xb7930000,
+	0x22098000, 0x64c54000, 0x3366a000, 0x3112f000, 0x4a4de800, 0xdce1cc00, 0xbed1b600, 0x39ae6300,
+	0xc4b07c80, 0x3f387040, 0x1d3bb620, 0x2a3d6310, 0x70b9fcb8, 0x02fd305c, 0xe1dd1612, 0x44ef9329,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x68000000, 0x64000000, 0xfe000000, 0x5d000000,
+	0x8c800000, 0x99400000, 0x6d600000, 0x8af00000, 0xc6480000, 0xe3f40000, 0x7cce0000, 0x33b70000,
+	0x1b2e8000, 0x71044000, 0xa685a000, 0x2247b000, 0xa0e14800, 0x6d30d400, 0xf56d0200, 0x2be4ff00,
+	0x78b47580, 0x6eaa3d40, 0xfac30220, 0x1fa3ff30, 0x2152f598, 0x111a7d44, 0xdbe8a23a, 0xbda34f29,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xe8000000, 0xdc000000, 0x9e000000, 0xf9000000,
+	0x15800000, 0x4f400000, 0x42a00000, 0x3e300000, 0x3e380000, 0x0b340000, 0x2dba0000, 0x29710000,
+	0x089b8000, 0xd7064000, 0x44856000, 0x26c6b000, 0xa3e0a800, 0x6d931c00, 0xc98b5200, 0xe44a4900,
+	0x9d2a4380, 0x2f7848c0, 0x50915220, 0x960b4910, 0x8009c3a8, 0x750a08cc, 0x868e321a, 0x34ccf927,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0xc4000000, 0x9e000000, 0x1f000000,
+	0x60800000, 0x3a400000, 0xb3a00000, 0xa3700000, 0x19980000, 0x20740000, 0xfb1e0000, 0x47370000,
+	0x15398000, 0x73834000, 0xa0c7a000, 0x98e3b000, 0x17515800, 0xac2bb400, 0xea0b0a00, 0x4ab86900,
+	0x79453180, 0x3124d5c0, 0x34350a20, 0x7fbf6930, 0xd0c4b198, 0xd0e395fc, 0xb354aa02, 0xc22fd901,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xc8000000, 0x0c000000, 0xf6000000, 0x91000000,
+	0xbc800000, 0x02400000, 0x38e00000, 0x4a700000, 0x7b880000, 0xfd740000, 0x2e0a0000, 0x27b10000,
+	0x1ead8000, 0xfa274000, 0x0ed5e000, 0x341cf000, 0x760f6800, 0xf3b21400, 0x7cabfa00, 0xa9251300,
+	0x11550980, 0xe1dcdf40, 0x9729fa20, 0xaee01310, 0xcb7289a8, 0x5f0a9f7c, 0xcb319a12, 0x24eba313,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x78000000, 0x4c000000, 0x52000000, 0xe7000000,
+	0x28800000, 0x62400000, 0x00600000, 0x01300000, 0x4b480000, 0xec340000, 0x38ce0000, 0x2cf10000,
+	0xc1ef8000, 0x2f22c000, 0x42d5e000, 0xf2bc5000, 0x1258d800, 0x852a1400, 0x70014a00, 0x18015700,
+	0xdc036380, 0x1a033d40, 0xd3074a20, 0x36845730, 0xd742e3a8, 0xcfe0fd4c, 0x4bf52a3e, 0x296ec723,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xd8000000, 0xac000000, 0xe2000000, 0xb3000000,
+	0x03800000, 0xd5400000, 0x76600000, 0xaab00000, 0x09480000, 0x93b40000, 0xfdca0000, 0xa3770000,
+	0x6bea8000, 0x5921c000, 0xe3d7e000, 0x327ad000, 0x34bc7800, 0x6f9fcc00, 0x6f4b5200, 0xe6b13f00,
+	0xbb492780, 0x98b7c540, 0x42495220, 0x4c323f10, 0x0289a798, 0x12110544, 0x8cdc3216, 0xd42d2f3b,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xe8000000, 0x9c000000, 0x6a000000, 0xbf000000,
+	0xdd800000, 0xac400000, 0x42200000, 0xd0100000, 0xe8380000, 0x59140000, 0x80ba0000, 0x07d50000,
+	0xeb5f8000, 0x4da24000, 0x67536000, 0xf99d1000, 0x34409800, 0x5620fc00, 0xb6157a00, 0x653a2d00,
+	0x4f955a80, 0x077d5cc0, 0x3cb77a20, 0x1beb2d10, 0x0448da88, 0x381e1cec, 0xb2019a1a, 0x8b017d37,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x18000000, 0x74000000, 0x26000000, 0x43000000,
+	0xdc800000, 0x1c400000, 0x76a00000, 0xad100000, 0x82480000, 0x6c140000, 0xe3ce0000, 0x7bd30000,
+	0x23ac8000, 0xe723c000, 0xd2d72000, 0x9e2ef000, 0xeae73800, 0x1bb11400, 0xcf5e5a00, 0xbe5ae100,
+	0x97dd5280, 0xec1fe340, 0x7e785a20, 0x878de130, 0xe977d2b8, 0x50bb2354, 0x026dfa26, 0x5c43d12d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x58000000, 0xdc000000, 0xaa000000, 0xa9000000,
+	0x6b800000, 0xcbc00000, 0x64600000, 0x92900000, 0x7bf80000, 0xe5940000, 0xf77e0000, 0x8ad10000,
+	0xd85b8000, 0xf163c000, 0x83156000, 0x513a9000, 0xde722800, 0x802acc00, 0x4a4cf600, 0xc7daaf00,
+	0x74a24280, 0x2873c0c0, 0x432af620, 0x28cfaf30, 0xd79fc2a8, 0x830500ec, 0x02821636, 0x0043ff07,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x28000000, 0xb4000000, 0xde000000, 0x05000000,
+	0xd1800000, 0x5dc00000, 0x25e00000, 0x6bd00000, 0x8c480000, 0xaa540000, 0xb98a0000, 0xdbb30000,
+	0x9c5e8000, 0x7afa4000, 0x538f2000, 0x40b6b000, 0xa8dc0800, 0x66bebc00, 0x03aca600, 0xba84b300,
+	0x91434880, 0x45a7d940, 0xc1f22620, 0x857ef310, 0xf34c68b8, 0xc8d16964, 0x64ce2e2a, 0x3c104f3d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xe8000000, 0xac000000, 0x9e000000, 0x13000000,
+	0x0b800000, 0x68400000, 0x2fa00000, 0x21d00000, 0x99d80000, 0x3a540000, 0x899e0000, 0x01f10000,
+	0x82498000, 0x512e4000, 0x9298e000, 0x3674b000, 0xcc097800, 0xd98d6c00, 0x62cc7a00, 0xe6e8f100,
+	0x5f7bc480, 0x010647c0, 0xb685fa20, 0x38c6b130, 0x106324a8, 0x1032f7fc, 0x28ac821a, 0x17dbdd1b,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x18000000, 0x7c000000, 0xea000000, 0x27000000,
+	0x3a800000, 0x4c400000, 0x99600000, 0x4c700000, 0x04780000, 0xeef40000, 0x743a0000, 0xfd970000,
+	0xef4d8000, 0xdb6fc000, 0x31fa6000, 0xdc329000, 0xa71c5800, 0x0d86c400, 0xdec5fa00, 0xd1226f00,
+	0xb3120980, 0x9d0b94c0, 0x8b087a20, 0x060daf10, 0x7b886998, 0xfd4904fc, 0x306c2226, 0x997f6b0f,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x28000000, 0xbc000000, 0xae000000, 0xef000000,
+	0x5a800000, 0x58400000, 0xc3200000, 0xcf100000, 0x3c080000, 0xed940000, 0x104a0000, 0x0cb10000,
+	0x265e8000, 0x11384000, 0xdb0f6000, 0xdb173000, 0x6e091800, 0x0c936400, 0x35cf9a00, 0x26741d00,
+	0x013dd280, 0xb30f6540, 0xc7111a20, 0x500c5d10, 0xcb92b2a8, 0xd3485564, 0xd030022a, 0x2d1b393f,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x18000000, 0x3c000000, 0x6a000000, 0xdd000000,
+	0xdc800000, 0xf6c00000, 0xf9a00000, 0x9e100000, 0xfbd80000, 0x2e940000, 0xdf1e0000, 0x46370000,
+	0xff8e8000, 0xb22fc000, 0xa23b6000, 0xb2e29000, 0xe7f28800, 0xd7aef400, 0x7e7cfe00, 0x7a815900,
+	0x89c21e80, 0xbc20cfc0, 0xf2527e20, 0x5bbe9930, 0x74a17e98, 0xfa965fc4, 0x411ef626, 0xb5376d3f,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x78000000, 0xe4000000, 0xde000000, 0x8b000000,
+	0x44800000, 0xdcc00000, 0xeb200000, 0xb0700000, 0xb0e80000, 0x08f40000, 0xa62a0000, 0x2ed30000,
+	0x8ddf8000, 0xa078c000, 0xddcca000, 0xc7843000, 0xa443f800, 0x5de59400, 0xc653de00, 0x531f6d00,
+	0x1a5aed80, 0xcc3c5240, 0x1c2c5e20, 0x3bd7ad10, 0xa25e4db8, 0x883c626c, 0x922da63e, 0x78d53929,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xa8000000, 0x2c000000, 0x0a000000, 0x0d000000,
+	0x0d800000, 0xf3400000, 0x49600000, 0x53300000, 0x2ae80000, 0x6ab40000, 0x67ae0000, 0x50d10000,
+	0xea1c8000, 0x07fc4000, 0x1c09e000, 0x83c21000, 0x8fa08800, 0xcd12fc00, 0x46b95200, 0xbc6a5700,
+	0x0b765b80, 0xa9084840, 0x6a45d220, 0xaae61730, 0x7b77bba8, 0x910e5854, 0x4e435a0a, 0xdce1eb3b,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xe8000000, 0xcc000000, 0xba000000, 0x1d000000,
+	0x6c800000, 0x37400000, 0x06e00000, 0x9ad00000, 0x3dd80000, 0xcc540000, 0x579a0000, 0x46330000,
+	0x4a0f8000, 0x950c4000, 0xd08de000, 0x454b9000, 0x47ea0800, 0x345d7400, 0xa394f200, 0xa83f2300,
+	0xe907f480, 0x028125c0, 0x54437220, 0xb1676310, 0x8e1014b8, 0xb1f9b5ec, 0xb1a6fa1a, 0xdc365723,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x18000000, 0x2c000000, 0x62000000, 0x4b000000,
+	0xbd800000, 0x5cc00000, 0xb4200000, 0x31900000, 0xee880000, 0x7e140000, 0x414e0000, 0xebb70000,
+	0x86188000, 0xce1fc000, 0x3a1de000, 0x141ad000, 0xed1cb800, 0x0399bc00, 0xcede9e00, 0x443d7d00,
+	0x8a8c0280, 0xe8105140, 0x244e1e20, 0xaf36bd30, 0x345fe298, 0xb77d8174, 0x816a2626, 0x3420c13b,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x98000000, 0xb4000000, 0xb2000000, 0xf9000000,
+	0x2d800000, 0xa2400000, 0xd3e00000, 0x39300000, 0xaf980000, 0x9eb40000, 0xd0da0000, 0x6ad50000,
+	0xd6ac8000, 0x1129c000, 0x9e6d2000, 0x220e5000, 0x087be800, 0x7581bc00, 0x76463a00, 0x91e48300,
+	0x88316380, 0xae19b7c0, 0x3af2ba20, 0x48394310, 0x87664388, 0xf6f2e7f4, 0xfe3dd206, 0xa4653f3d,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x38000000, 0x74000000, 0x02000000, 0x4d000000,
+	0x9c800000, 0xdfc00000, 0x40e00000, 0x30300000, 0x09380000, 0x82b40000, 0x7dfe0000, 0x79d50000,
+	0x7f8d8000, 0x3d4cc000, 0x692a2000, 0xeadad000, 0xa5014800, 0x6081b400, 0xb1c47600, 0x0be71300,
+	0xdbb76780, 0x737f72c0, 0x8311f620, 0x9fefd330, 0x9cbb4788, 0x1bf4a2dc, 0x8bdb3e2e, 0xdf83a72d,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x28000000, 0x0c000000, 0x02000000, 0x39000000,
+	0xa5800000, 0x1b400000, 0x3ca00000, 0xb2500000, 0xd5780000, 0x61d40000, 0xe13e0000, 0xc7f50000,
+	0x2aa98000, 0x83ec4000, 0x4e4de000, 0x859a5000, 0x91a52800, 0xd1d4fc00, 0x293eb200, 0x1bf67900,
+	0xf0abb080, 0x9eeedac0, 0xe5cf3220, 0xa5de3930, 0x31805088, 0xdd458afc, 0xdba59a2a, 0xf4d78533,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0x0c000000, 0x46000000, 0x63000000,
+	0x7a800000, 0xf2c00000, 0x68e00000, 0x9cd00000, 0x57980000, 0x05540000, 0x9fda0000, 0xbf750000,
+	0x9bed8000, 0xfc394000, 0xc521e000, 0x20b57000, 0x868df800, 0x7eae2400, 0x139eae00, 0x2f55c300,
+	0x6aded880, 0xdef7f7c0, 0x97a92e20, 0x2c198310, 0x1412b888, 0xf27bc7fc, 0x5c053602, 0x7e02d713,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x48000000, 0x94000000, 0x72000000, 0xfb000000,
+	0xa2800000, 0x4f400000, 0x42200000, 0x52100000, 0xc7580000, 0x03940000, 0x1e9e0000, 0x2cf70000,
+	0x8daf8000, 0xc73d4000, 0xe0272000, 0x1114d000, 0xd9d9f800, 0x9ad14400, 0x9dbd4200, 0xb3673500,
+	0xd5332280, 0x32cfa7c0, 0x4c0cc220, 0xe7ed7530, 0xd29b8298, 0x12f637cc, 0x88aa1a32, 0x00bce115,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xc8000000, 0xec000000, 0x02000000, 0x77000000,
+	0x2f800000, 0x03c00000, 0x63600000, 0x94700000, 0xc9f80000, 0x14f40000, 0x51ba0000, 0x82550000,
+	0x07ad8000, 0xa15b4000, 0x6fe6e000, 0xde355000, 0x105a5800, 0x4964ac00, 0x9f708600, 0xfc7c1700,
+	0xb4349580, 0x3b5bd0c0, 0x8ce70620, 0xf7b25710, 0x7a9ff588, 0xb885c0fc, 0xbc43be12, 0x78a7ab2b,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x08000000, 0xc4000000, 0xea000000, 0x15000000,
+	0x17800000, 0x2cc00000, 0x6be00000, 0x05500000, 0x34280000, 0xf3d40000, 0x5d6e0000, 0x1df50000,
+	0x525c8000, 0x334d4000, 0xd2c6a000, 0x5ce01000, 0xe3d50800, 0xb56d2c00, 0xa9f3ae00, 0xe05c9300,
+	0xea4bb480, 0xeb426a40, 0x8f212e20, 0x8ab4d330, 0x8b799488, 0xdafb3a54, 0x7d3c8622, 0x865cef01,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0x94000000, 0x26000000, 0xdd000000,
+	0xe3800000, 0xf3400000, 0x47600000, 0x59300000, 0x19880000, 0x1bb40000, 0xab4e0000, 0xcc930000,
+	0x679f8000, 0x66e94000, 0xbe872000, 0xd0c27000, 0x5424c800, 0x2e55ec00, 0x08bf9200, 0x963cb700,
+	0x96f88b80, 0xbade0340, 0x488e1220, 0xf236f730, 0x9f082bb8, 0x3771334c, 0x9d6bfa32, 0x61c66b15,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0x24000000, 0x86000000, 0xd5000000,
+	0x3f800000, 0xddc00000, 0xa2600000, 0xb6100000, 0xe8d80000, 0xa0940000, 0x909a0000, 0x00350000,
+	0x3c6d8000, 0x67b94000, 0xc500a000, 0x27837000, 0xa1c10800, 0x78660c00, 0x49152600, 0xa059ff00,
+	0x11d5c680, 0x05bf01c0, 0xf602a620, 0x1d05bf10, 0x3b80e688, 0xabc131fc, 0xff610e02, 0xad91c319,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0x6c000000, 0x52000000, 0x2b000000,
+	0x55800000, 0x9bc00000, 0x56600000, 0x18700000, 0x98a80000, 0x74f40000, 0x9dee0000, 0x1cd50000,
+	0x40388000, 0x7e6bc000, 0x8a17e000, 0x76db5000, 0x0159b800, 0x799a7c00, 0xee7b2600, 0x83cc6f00,
+	0xec049580, 0x9201a240, 0x0b05a620, 0x8586af30, 0x43c5f588, 0x3a643274, 0x4a737e16, 0xb3ac432b,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x88000000, 0x44000000, 0xf6000000, 0xef000000,
+	0x47800000, 0x38c00000, 0x8fe00000, 0x20700000, 0xcc780000, 0x96f40000, 0x283e0000, 0xe8550000,
+	0x4c688000, 0xf6394000, 0x5356a000, 0x55ecf000, 0xb5fed800, 0xe5354c00, 0xe65fde00, 0x47e05300,
+	0x8474cd80, 0xca7838c0, 0x21f15e20, 0xa3b81330, 0x6294ed88, 0xda8888f4, 0x7ec9a602, 0xe06cef21,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x38000000, 0xfc000000, 0xc2000000, 0x27000000,
+	0x32800000, 0x8ac00000, 0x84200000, 0x17d00000, 0xf6980000, 0x44540000, 0x77de0000, 0x2d330000,
+	0x136c8000, 0x341ac000, 0x86976000, 0x87fed000, 0x6ce75800, 0xc4f2c400, 0x5bcc4e00, 0xac0ac500,
+	0xb1a80080, 0x5439d9c0, 0x1f46ce20, 0xfc670530, 0xf935e0b8, 0x356ac9d4, 0x9d1c762e, 0x3916d10f,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x18000000, 0x6c000000, 0xaa000000, 0x81000000,
+	0x50800000, 0xdac00000, 0xf3200000, 0xdd500000, 0x15b80000, 0xf2d40000, 0x08fe0000, 0x18b10000,
+	0x51ce8000, 0x1b39c000, 0xaf11e000, 0x205e9000, 0xdea6e800, 0x25119400, 0x715c7e00, 0x3627ad00,
+	0x83d7a480, 0x307fd8c0, 0x0674fe20, 0x6ceb6d30, 0x996ec4a8, 0xad2d88c4, 0x73cb7626, 0x2e38a92b,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xa8000000, 0xec000000, 0x32000000, 0xb7000000,
+	0x11800000, 0x06400000, 0x7b600000, 0x5b300000, 0x05a80000, 0x1d740000, 0xdece0000, 0x76470000,
+	0x23648000, 0x2f364000, 0x23ade000, 0xdc70d000, 0xa64cd800, 0xe4861c00, 0xf8c10a00, 0x18a51700,
+	0x00170b80, 0xe4ff2640, 0x3b6cea20, 0x54d5c730, 0x6e5bd398, 0xbc793a54, 0x59ade00a, 0x1770d00b,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x08000000, 0x3c000000, 0xfe000000, 0xed000000,
+	0xae800000, 0x54400000, 0xba600000, 0x94f00000, 0xf4180000, 0xf0b40000, 0xf67e0000, 0x20410000,
+	0x18608000, 0xf7f54000, 0x6f9f6000, 0x3e73b000, 0xda588800, 0x1dd38400, 0x3b0d4a00, 0x0999e700,
+	0x87736580, 0xc6dec3c0, 0x82922a20, 0xf6ea5730, 0xa5abeda8, 0x8e4d47f4, 0x5b7f6022, 0xeec3b03f,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xf8000000, 0x14000000, 0xda000000, 0x33000000,
+	0xcc800000, 0xb7400000, 0xae600000, 0xc8700000, 0xbd080000, 0xf7340000, 0x6f6e0000, 0xa9410000,
+	0x7f648000, 0x83f2c000, 0x4cca2000, 0x25151000, 0xd1ff3800, 0xb179b400, 0xa83ca200, 0x1f5bd700,
+	0x80aed980, 0xaa640b40, 0x8a768220, 0x6a0ec730, 0x49b1e1a8, 0x072dbf54, 0x05a2201e, 0xe9511035,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x68000000, 0x8c000000, 0xe2000000, 0x19000000,
+	0x83800000, 0x61400000, 0x25600000, 0x9d900000, 0x37b80000, 0xf0d40000, 0xb0da0000, 0xd4410000,
+	0x74e18000, 0x2dd64000, 0x6d5fe000, 0x86005000, 0x3706a800, 0xd8860c00, 0x8bc04200, 0xafa67700,
+	0x55b38680, 0x6d4f86c0, 0x43ffa220, 0xf4362710, 0xf50d2ea8, 0x351d8adc, 0x10e5e03a, 0x03d15033,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x78000000, 0xbc000000, 0xc2000000, 0x49000000,
+	0x1b800000, 0x12c00000, 0x0e200000, 0xa8700000, 0x1ff80000, 0x3eb40000, 0x4fde0000, 0x4dc30000,
+	0xcaa38000, 0xbe34c000, 0xe7986000, 0xdea1d000, 0xc831a800, 0x4899cc00, 0x42235e00, 0x32756d00,
+	0xbaff3580, 0x2f371ec0, 0xd01b3e20, 0x2664bd30, 0xfb169db8, 0xfd6ad2ec, 0x781e603e, 0x9266d01f,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x18000000, 0x34000000, 0x8a000000, 0xd3000000,
+	0x90800000, 0x78c00000, 0xa6e00000, 0x31300000, 0x15280000, 0xc5f40000, 0xddce0000, 0x95c50000,
+	0xaf668000, 0x2a71c000, 0x4b892000, 0x32e09000, 0x6b313800, 0xfe29d400, 0x7171de00, 0x370f7300,
+	0xd426ef80, 0x84d74e40, 0x9498fe20, 0xb81fe330, 0xa6dfd788, 0x4d3a9a44, 0xa58f2026, 0x93e1903d,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x88000000, 0x1c000000, 0x4a000000, 0x4d000000,
+	0xfc800000, 0x22400000, 0x8b200000, 0x15900000, 0x5cf80000, 0xadd40000, 0x62da0000, 0xb0c70000,
+	0x7a638000, 0x19374000, 0xa0a96000, 0x61ca1000, 0x937c8800, 0x7810b400, 0xe83bfa00, 0x19b17d00,
+	0xb8ee9e80, 0x4fef4ec0, 0x566a9a20, 0xc4af6d10, 0x9fc81698, 0xd878facc, 0x3b92e002, 0xeff95017,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x18000000, 0x2c000000, 0xbe000000, 0xc7000000,
+	0xe2800000, 0x1b400000, 0x3be00000, 0xe8d00000, 0x07780000, 0x31940000, 0x1d9a0000, 0xf0c50000,
+	0x8d248000, 0x3ef1c000, 0x8d0fe000, 0x84d93000, 0xca215800, 0x9c71e400, 0xb6496200, 0x6f3c8b00,
+	0x3af03c80, 0xb70e74c0, 0x39de8220, 0xb5a1bb10, 0x28b36488, 0x216e90f4, 0x3cc96026, 0xd079f01b,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x98000000, 0xd4000000, 0x06000000, 0x91000000,
+	0xb3800000, 0xd7c00000, 0x2b600000, 0xef900000, 0x5f180000, 0x3a540000, 0x2b7a0000, 0xab430000,
+	0xaa258000, 0xb6b3c000, 0xb5292000, 0x5e38f000, 0xa4642800, 0x5910ac00, 0xdd5ab600, 0xa7f38700,
+	0xc409a280, 0x180e33c0, 0xe20b9620, 0xd90f7710, 0xd98f8ab8, 0xb2c99ffc, 0xb8eea006, 0x1e5c3025,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xc8000000, 0xfc000000, 0xfe000000, 0x81000000,
+	0x3e800000, 0x30c00000, 0x13600000, 0x8a300000, 0xfec80000, 0xf0f40000, 0x2eaa0000, 0xdb430000,
+	0xaf258000, 0xfe914000, 0xd4186000, 0xbc4db000, 0x7e35e800, 0x5ccb0400, 0x9ff10e00, 0xa92aaf00,
+	0xe1077780, 0x8e82fd40, 0x18c16e20, 0x1f631f10, 0xbc309fb8, 0x83cef97c, 0x3077e012, 0x9f6ff02f,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x48000000, 0xc4000000, 0xf2000000, 0x73000000,
+	0x24800000, 0x1dc00000, 0xe7600000, 0x2d700000, 0x01780000, 0x5eb40000, 0x4b1a0000, 0x22430000,
+	0x6a248000, 0x5dd54000, 0xe468a000, 0x2839d000, 0x4c13b800, 0x750bb400, 0x644ef600, 0xcaecdf00,
+	0x5afce580, 0x11f100c0, 0xd0be5620, 0x6fd10f10, 0x376d5db8, 0x3cbdb4f4, 0xc9d62032, 0x1e6f9021,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x68000000, 0x2c000000, 0x8e000000, 0x07000000,
+	0x16800000, 0x93c00000, 0x10a00000, 0x96700000, 0xadd80000, 0xffb40000, 0x607e0000, 0xd2470000,
+	0x3de08000, 0x59104000, 0x750fe000, 0xab1b3000, 0x08935800, 0x5049c400, 0x987d2600, 0x3647f100,
+	0x2fe70d80, 0x68157bc0, 0x208ac620, 0x8c58c130, 0x02f25598, 0xc71fbff4, 0x2691603a, 0xe74c703b,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xb8000000, 0x74000000, 0xae000000, 0x59000000,
+	0xfa800000, 0x11c00000, 0xdbe00000, 0x45f00000, 0x15780000, 0xd9340000, 0x0a1a0000, 0x4c050000,
+	0x9a048000, 0xd704c000, 0x73852000, 0x5340b000, 0xbe216800, 0x3012a400, 0x098a4600, 0x36cd0b00,
+	0xc2eca180, 0x9df974c0, 0x93f56620, 0x5878bb10, 0x7db14988, 0x2adb10f4, 0xa160000e, 0x1430000d,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x68000000, 0x1c000000, 0x1a000000, 0xb7000000,
+	0x1a800000, 0xedc00000, 0xeaa00000, 0xf9700000, 0xd3980000, 0x4fb40000, 0x11ba0000, 0x10030000,
+	0x58018000, 0x94044000, 0x76036000, 0xc5039000, 0xb1855800, 0xed400400, 0xb062d600, 0x09578100,
+	0xc728a580, 0x768dc9c0, 0xa77bb620, 0xd2271110, 0x07b47db8, 0xddbd8ddc, 0xf200003a, 0xeb000017,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x38000000, 0x04000000, 0x36000000, 0x2f000000,
+	0x1e800000, 0x05400000, 0x72e00000, 0x3c100000, 0x22180000, 0xaa540000, 0xbc7e0000, 0x6a030000,
+	0x6d038000, 0xdf86c000, 0x80c5a000, 0x67207000, 0x60b15800, 0x44694400, 0x9e1d5200, 0x58516300,
+	0x4578ca80, 0xeb8407c0, 0x4ec6f220, 0xac221330, 0xf83212b8, 0x562f83ec, 0xf678002e, 0x57040031,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x08000000, 0x6c000000, 0x02000000, 0x05000000,
+	0x1f800000, 0x27400000, 0xa2200000, 0x41900000, 0xb8280000, 0x41d40000, 0x908e0000, 0x90810000,
+	0x91c48000, 0x38e54000, 0x91f1e000, 0x4c185000, 0xf32f4800, 0xc952ec00, 0x054a1200, 0x36666d00,
+	0x5f37f680, 0x0a7ef040, 0x341df220, 0x072b3d30, 0x0f523ea8, 0x3e485c54, 0x26e28022, 0x0ef0402b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x84000000, 0x22000000, 0x85000000,
+	0xd4800000, 0xc7400000, 0xd7200000, 0x09900000, 0x03b80000, 0x51d40000, 0xb11e0000, 0x81830000,
+	0xabc28000, 0xe463c000, 0xf4b0a000, 0x932dd000, 0x20ec0800, 0x808db400, 0xb63f1200, 0x30119d00,
+	0x5c7f3680, 0x9fb1c4c0, 0xdca9b220, 0x602b4d30, 0xeb6fbeb8, 0xe24cb0e4, 0x58dc8006, 0xb0e0c011,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x68000000, 0x94000000, 0x02000000, 0xd7000000,
+	0xfe800000, 0xfac00000, 0x07a00000, 0x93100000, 0xeab80000, 0xe4d40000, 0x989e0000, 0xf5870000,
+	0x42458000, 0x50604000, 0x31372000, 0x83eb5000, 0xb20e1800, 0xc37de400, 0xc7f06e00, 0xba494900,
+	0x001c8e80, 0x724108c0, 0x98614e20, 0xb5311930, 0x99e91698, 0x990bacdc, 0xabfb803a, 0xe8374015,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xe8000000, 0x4c000000, 0x3e000000, 0x4f000000,
+	0x63800000, 0x8ac00000, 0x97200000, 0x64300000, 0xbe480000, 0x03f40000, 0x73ea0000, 0x7d830000,
+	0x75c28000, 0xeca04000, 0x5af2e000, 0xb36eb000, 0x5ac41800, 0xdf20ec00, 0xd8312e00, 0x784f2500,
+	0xe8f43780, 0x62692b40, 0x8641ce20, 0xce669510, 0x61d0afb8, 0xf95e8744, 0x438a801a, 0xf3544003,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x28000000, 0x7c000000, 0xde000000, 0x7f000000,
+	0xa6800000, 0x6b400000, 0xe8e00000, 0xf5500000, 0xa9180000, 0x2b140000, 0xda7e0000, 0x82850000,
+	0x11468000, 0x2de04000, 0xb6d36000, 0x91dfb000, 0xd3341800, 0xab0dc400, 0x84eda200, 0x4338f300,
+	0x0366b080, 0x71966fc0, 0xaf38c220, 0x35664330, 0x52922888, 0xc7baebc4, 0x0926802a, 0x60f0402f,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x28000000, 0x14000000, 0xf6000000, 0xbf000000,
+	0x17800000, 0xf8400000, 0x21a00000, 0xfd300000, 0x41f80000, 0x92f40000, 0xd81a0000, 0xae630000,
+	0x34d08000, 0x556e4000, 0x6a3e2000, 0xd510f000, 0x4f885800, 0xa32e8c00, 0x889ffa00, 0x3da15100,
+	0xef30bb80, 0x90fd8ac0, 0x56715a20, 0xfddfe110, 0x2a86c3b8, 0xb6c3f6d4, 0xb966f82a, 0x77503c15,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x08000000, 0x24000000, 0xae000000, 0x05000000,
+	0x17800000, 0x73c00000, 0x6c200000, 0x71500000, 0xe5e80000, 0x3d140000, 0x6e0a0000, 0x26610000,
+	0x2bb58000, 0x4f1d4000, 0x2a6aa000, 0xd2d33000, 0x202e0800, 0x28334c00, 0x7ade7600, 0x374bbd00,
+	0xe205c480, 0x9f065640, 0xe4815620, 0xbd45cd10, 0x8a616ca8, 0xe1b62a7c, 0x44192822, 0xc8e93c19,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xb8000000, 0xfc000000, 0xf6000000, 0x53000000,
+	0xff800000, 0xc2400000, 0x07e00000, 0x50500000, 0x8dc80000, 0xd1940000, 0x5e6e0000, 0xc5250000,
+	0xf4778000, 0x1f3cc000, 0x766a6000, 0x71207000, 0x66727800, 0x7638cc00, 0x94ecca00, 0xe3e7e300,
+	0xaa53c080, 0xb0c9f940, 0xb1112a20, 0x2dab5330, 0xaf83d888, 0xaa45454c, 0x53e1980e, 0xd2517c0f,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xd8000000, 0x64000000, 0x3e000000, 0x41000000,
+	0xdc800000, 0x84400000, 0xe2e00000, 0x76500000, 0x0a180000, 0xaa940000, 0xe2be0000, 0xc7270000,
+	0x56758000, 0x05edc000, 0xd9bca000, 0xb4a53000, 0x87b42800, 0x73cf9400, 0x4b4f6a00, 0x310e1300,
+	0xf2ec4080, 0x283e3fc0, 0x7e664a20, 0x5216e330, 0xf8fcc898, 0x74c09bdc, 0x54a30816, 0x37b06429,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x58000000, 0x4c000000, 0x0e000000, 0x05000000,
+	0xc6800000, 0xcac00000, 0x5e600000, 0xb4300000, 0x83c80000, 0x04740000, 0x316e0000, 0x4f230000,
+	0x8a148000, 0x1d5dc000, 0x60ece000, 0xd060b000, 0x71334800, 0xa54bc400, 0x9eb23e00, 0x370a6700,
+	0xb712e780, 0x07da3540, 0x1c2a5e20, 0x97071730, 0x55854fb8, 0xa5454154, 0x0c252836, 0x7d95b423,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x48000000, 0x54000000, 0x1a000000, 0x07000000,
+	0x87800000, 0x86c00000, 0xdd200000, 0xcab00000, 0xa6680000, 0xb7f40000, 0x838e0000, 0x05650000,
+	0xa3d08000, 0x13bb4000, 0x85482000, 0x18409000, 0x49659800, 0x65d36c00, 0x7ab8ce00, 0xcfce3500,
+	0x56021380, 0xc1043240, 0xee806e20, 0xcc45e530, 0x9367ab88, 0x42d3ce74, 0x2d3b3832, 0x0109bc25,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xf8000000, 0x34000000, 0x5e000000, 0x83000000,
+	0x5a800000, 0x72400000, 0xc2e00000, 0xa6700000, 0xcfe80000, 0x10b40000, 0x5c4a0000, 0xdea30000,
+	0xaf928000, 0x0f18c000, 0x2f1d2000, 0x9f1b3000, 0x971cb800, 0x4b19a400, 0xd919ca00, 0x301b2300,
+	0xb79bb180, 0x1c596040, 0xf67e6a20, 0xe0acd310, 0x4bd029b8, 0x32f8f444, 0xb1e9981e, 0x23b6941d,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xe8000000, 0xdc000000, 0x32000000, 0xcb000000,
+	0xd1800000, 0x16c00000, 0x36a00000, 0x48700000, 0xb1d80000, 0x4d340000, 0x72be0000, 0x5e670000,
+	0xdfd58000, 0xb72c4000, 0xa5a96000, 0x0eecd000, 0x9489b800, 0x8d5d9c00, 0x7f732e00, 0x82581900,
+	0x68f64580, 0xd19fd3c0, 0x06d7ce20, 0x7dac8930, 0x9ae89d98, 0x6a899fdc, 0xec58d81a, 0x51f54c07,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xe8000000, 0x4c000000, 0x8e000000, 0xd9000000,
+	0xa8800000, 0x52400000, 0x3ea00000, 0x3ab00000, 0x44e80000, 0x32740000, 0x070a0000, 0x83e70000,
+	0x91948000, 0x269c4000, 0x9d78e000, 0xa8ed3000, 0x4c71a800, 0x860eb400, 0x5f629a00, 0xe9d51100,
+	0x03391780, 0x58498a40, 0xcfc6fa20, 0xba606110, 0xd7525f98, 0x9c790e74, 0x346b481a, 0x54308403,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x08000000, 0x6c000000, 0x22000000, 0xc9000000,
+	0x30800000, 0x47400000, 0x9ea00000, 0xfcb00000, 0x44f80000, 0x7d740000, 0x221a0000, 0xd0e70000,
+	0x72928000, 0x8f0b4000, 0xbf2fe000, 0xc7df5000, 0xf8002800, 0x34011400, 0x2607b200, 0x9706d100,
+	0xd387ef80, 0xd2c2eac0, 0xcb62d220, 0xec56c110, 0x166a2798, 0x827faec4, 0x8535c822, 0x7339440b,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x18000000, 0xa4000000, 0x1a000000, 0xc7000000,
+	0x46800000, 0x20400000, 0xbd600000, 0xc3900000, 0xba880000, 0xc2540000, 0x312a0000, 0xa4e50000,
+	0x41528000, 0x1da9c000, 0x6ba1a000, 0x16b21000, 0x587a1800, 0x154e6400, 0x8cf1fa00, 0x7219ff00,
+	0xa85a4e80, 0xa2384740, 0x0f28da20, 0x39e72f10, 0xe0d37688, 0x6b6df344, 0xee829826, 0xcc42a439,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x18000000, 0x44000000, 0xee000000, 0x29000000,
+	0x87800000, 0xe9400000, 0x6da00000, 0x2bd00000, 0x44a80000, 0x54140000, 0x33ce0000, 0xfd270000,
+	0xd4128000, 0xf3cbc000, 0x9d22a000, 0x4411b000, 0xebc86800, 0xd923cc00, 0xaa10c200, 0xc2ce7100,
+	0x5ea1e480, 0x4356c040, 0xaf6ee220, 0x75730130, 0x07f9ac98, 0xfb7f7c64, 0x46bce826, 0xfadb0c21,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x78000000, 0xbc000000, 0x06000000, 0xc3000000,
+	0x39800000, 0xcd400000, 0x5aa00000, 0x34b00000, 0xbdb80000, 0xcb740000, 0xb7da0000, 0x82250000,
+	0xa9718000, 0xfedac000, 0x26a26000, 0x52b1f000, 0x2ebaf800, 0xfaf67c00, 0xbe99b200, 0x6283f900,
+	0x58c67f80, 0xb9e3e0c0, 0x19105220, 0x728dc910, 0xc28f6788, 0xda8eacdc, 0x3689783e, 0x388dbc3f,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0x84000000, 0xaa000000, 0x41000000,
+	0x94800000, 0x8ec00000, 0x8c600000, 0xab700000, 0xb2f80000, 0xa4340000, 0x36de0000, 0xe0e10000,
+	0xe9b18000, 0xb0994000, 0x1447a000, 0xd9a71000, 0xda932800, 0x77ce7400, 0x366e3e00, 0x70fee700,
+	0xf1337d80, 0xd05f7cc0, 0xd3261e20, 0x5751b730, 0xfa2e75a8, 0x555b58fc, 0x8da2a802, 0xc8973411,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xd8000000, 0x3c000000, 0x4a000000, 0xeb000000,
+	0xcf800000, 0x49400000, 0xb3e00000, 0xab300000, 0x82580000, 0xe2f40000, 0x217a0000, 0x02610000,
+	0xf7778000, 0xab3bc000, 0x3a006000, 0xd3069000, 0xe383b800, 0x6b41ac00, 0xbce3d200, 0x12b20300,
+	0x6a1d4380, 0x7592d5c0, 0x0c8e3220, 0x7a9e5310, 0x0d511ba8, 0xa32a29ec, 0x58cc3816, 0xe7fe6c1f,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x08000000, 0xdc000000, 0x8e000000, 0x23000000,
+	0x99800000, 0x02c00000, 0x32200000, 0x75900000, 0x1d280000, 0xbbd40000, 0x834e0000, 0xd5230000,
+	0x06158000, 0x86ef4000, 0x11716000, 0xc89a3000, 0x9e6cf800, 0xef313c00, 0x7ef84e00, 0xbc9b3d00,
+	0x9c6e0a80, 0xda33c040, 0x607aae20, 0x7dd94d30, 0xdd8812b8, 0xa9048c5c, 0xb082f822, 0x72423c07,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xa8000000, 0x94000000, 0x06000000, 0xb1000000,
+	0x3b800000, 0x54c00000, 0x45e00000, 0xf9700000, 0x6b680000, 0x15340000, 0x86ce0000, 0xffe50000,
+	0x1a738000, 0xc7ec4000, 0x7b752000, 0x046b7000, 0x83b42800, 0xcb8a6c00, 0xf1c76e00, 0xb864d300,
+	0x3cb11d80, 0xa50ddc40, 0x1087ce20, 0x3c42e330, 0x15a59588, 0x46d1806c, 0x16bc280a, 0xb30e6c15,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x88000000, 0x44000000, 0xc2000000, 0x77000000,
+	0x96800000, 0x2a400000, 0x13a00000, 0xcc300000, 0x46a80000, 0x79f40000, 0xc0ce0000, 0x03a70000,
+	0x84328000, 0x62af4000, 0x2bf2a000, 0x3fcc5000, 0xd1269800, 0x6c702400, 0x060daa00, 0x71468900,
+	0x53236380, 0xbb703040, 0x608b8a20, 0x43069930, 0x8c83db98, 0xf1400464, 0x93269802, 0xdb702421,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x0c000000, 0xde000000, 0x65000000,
+	0xb1800000, 0xd9400000, 0x2ee00000, 0xa3100000, 0xe6880000, 0x3df40000, 0x9d9e0000, 0xcf7f0000,
+	0x0a6e8000, 0x0de64000, 0xc391e000, 0xd44e3000, 0xed548800, 0xf2ea5c00, 0x8b247200, 0x4933a300,
+	0x9c393680, 0x4b8de540, 0xb070fa20, 0x82d9ff30, 0xf09d4498, 0x22fe4664, 0x8529cc9a, 0xda041a73,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0x54000000, 0xf6000000, 0x63000000,
+	0xab800000, 0xad400000, 0xf0e00000, 0x64500000, 0x99d80000, 0x40b40000, 0xcb8e0000, 0x1a690000,
+	0xb0be8000, 0x44a6c000, 0x0e352000, 0x664ff000, 0xb048f800, 0x834b8c00, 0xb0cc6200, 0xd98df300,
+	0xe76a4c80, 0xb43b9fc0, 0x70649a20, 0xfe967f30, 0x6e7e2ea8, 0xbd026ce4, 0x6480d6ae, 0x04c4e0e5,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x68000000, 0x7c000000, 0xc6000000, 0x11000000,
+	0x25800000, 0x60400000, 0xc0600000, 0x61100000, 0xdd280000, 0x4d740000, 0x323a0000, 0xcd5f0000,
+	0xa4cc8000, 0x9a264000, 0x36706000, 0xe8bcf000, 0x859ea800, 0xb769bc00, 0x22135a00, 0x13aa1700,
+	0xbfb76e80, 0xf69ae440, 0x41edf220, 0xc4d3ab10, 0x6d0c3498, 0xe404f354, 0xa2009cba, 0xf3064f4f,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xf8000000, 0x8c000000, 0xd6000000, 0x0b000000,
+	0xcb800000, 0xfec00000, 0xa4a00000, 0xe0900000, 0xe1180000, 0x78340000, 0xbf8e0000, 0x862f0000,
+	0x06388000, 0xe266c000, 0x6833e000, 0xe788f000, 0x3a2d7800, 0x78394c00, 0x9d647e00, 0xf9b21100,
+	0xc448b680, 0x5e0ea7c0, 0xade90620, 0x261b5d30, 0xc5b4c898, 0x7a48b6d4, 0x410fb09e, 0x6c6afad3,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x88000000, 0x84000000, 0xc6000000, 0xf5000000,
+	0xc8800000, 0xef400000, 0x13a00000, 0x79d00000, 0x31180000, 0x96740000, 0xf2ce0000, 0x286f0000,
+	0x433c8000, 0xc2654000, 0xe837a000, 0xffeff000, 0xa3fd4800, 0xfd021400, 0x8c87c200, 0x4942c100,
+	0x36a79880, 0x39504bc0, 0x5a5a8a20, 0x43d0d530, 0x7e185a98, 0xd1f68af4, 0x3a0b1282, 0x230b9ed1,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xd8000000, 0x3c000000, 0x16000000, 0x6d000000,
+	0xd6800000, 0x4cc00000, 0xeee00000, 0xa8d00000, 0x1ae80000, 0xd0340000, 0x1f3e0000, 0x3c5d0000,
+	0x33cf8000, 0x1585c000, 0x9b436000, 0x2aa2f000, 0x33f1c800, 0x78592400, 0x69cc5e00, 0x96801b00,
+	0xacc5fc80, 0x7ee7f240, 0xc0d59620, 0xfeed3f30, 0xfa37a288, 0x643ae96c, 0x87dfea96, 0xa98f0d7f,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x68000000, 0x8c000000, 0x6e000000, 0xff000000,
+	0x9b800000, 0xef400000, 0xe1600000, 0xa7100000, 0xa2580000, 0xd8740000, 0x024a0000, 0xa5a90000,
+	0x07788000, 0xbf804000, 0xed45e000, 0x0063b000, 0x7b965800, 0x32988c00, 0x34539200, 0xd53d5f00,
+	0xc4606680, 0x09953fc0, 0x6b9dca20, 0x0cd1d310, 0xa7f9f4a8, 0xb94160f4, 0xba652cba, 0x7e94acf3,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x98000000, 0x0c000000, 0xb2000000, 0x25000000,
+	0x69800000, 0xc3c00000, 0xa9600000, 0xdef00000, 0xdef80000, 0xd1940000, 0xdb0a0000, 0xd1ed0000,
+	0x35db8000, 0x91c3c000, 0x5c66e000, 0xbf75d000, 0x39380800, 0x5ef67c00, 0x9ef8c600, 0xf197bf00,
+	0x6b0d0d80, 0x49ef2ec0, 0x39d8ce20, 0x23c5c310, 0x7967cb88, 0xd6f191ec, 0xfafc4386, 0xf7902dd3,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xa8000000, 0xc4000000, 0x9e000000, 0x11000000,
+	0xfe800000, 0x52c00000, 0x16e00000, 0xef700000, 0x1ab80000, 0x78940000, 0x434a0000, 0x04e90000,
+	0x4b3c8000, 0xd5d64000, 0xf1eba000, 0x3bba3000, 0x9e176800, 0x8d8f6400, 0xb00b4e00, 0x474afb00,
+	0x7aeaf180, 0xaa3e50c0, 0xd3562620, 0xcf2c9f10, 0x775d3fa8, 0xfe62ebd4, 0x78b7778a, 0x64d8ffe1,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xe8000000, 0x4c000000, 0xaa000000, 0x6d000000,
+	0x34800000, 0x82c00000, 0x69a00000, 0xd3900000, 0xe9a80000, 0xe7340000, 0x76be0000, 0xc85b0000,
+	0x4e288000, 0x42724000, 0x7a59e000, 0xf72b9000, 0xc8f6c800, 0xcb98d400, 0xc909ce00, 0x26231100,
+	0x3ad46680, 0x4f4b0240, 0xb5410620, 0xc4e0c530, 0xc37528b8, 0x94da5354, 0x40ec809a, 0x61d05763,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xc8000000, 0x44000000, 0xfa000000, 0x83000000,
+	0x1a800000, 0xbd400000, 0x1fa00000, 0xbad00000, 0x5bd80000, 0x4e740000, 0x8f8a0000, 0xbaed0000,
+	0x695d8000, 0xa7314000, 0xf22aa000, 0x7f3f1000, 0x5e05f800, 0x69006400, 0x01868200, 0x5bc62100,
+	0xd4e09080, 0x9872edc0, 0x82897a20, 0x316b4510, 0x799b9288, 0x2d558cdc, 0x2d1b4a92, 0x6112b8c1,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0x5c000000, 0xd2000000, 0x27000000,
+	0xaf800000, 0xa9400000, 0x1a600000, 0x19100000, 0xfd380000, 0x38740000, 0x39ae0000, 0xbb0f0000,
+	0xbc3e8000, 0xf6f5c000, 0x6e6b6000, 0x9ea9d000, 0xd4899800, 0x757ccc00, 0x7c958200, 0xef7f4700,
+	0x3f946680, 0x3efd3cc0, 0x6bd21a20, 0x681c8b30, 0xfa076498, 0xd303bbe4, 0x49831c86, 0x084767e7,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x28000000, 0x2c000000, 0x22000000, 0x03000000,
+	0xca800000, 0x75400000, 0xc4200000, 0xb3100000, 0x61e80000, 0xa8340000, 0x627e0000, 0x0b990000,
+	0xf2ea8000, 0x8ab64000, 0x9b3ae000, 0xfdb9d000, 0x6afab800, 0x0dd86400, 0x644c4200, 0x58e7bd00,
+	0x18f3de80, 0xeb9c6040, 0x82e8fa20, 0x12b6d930, 0x8f3d1ca8, 0xdbb99d44, 0x67ffc4aa, 0xe65a697b,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x78000000, 0x14000000, 0xea000000, 0xb3000000,
+	0x45800000, 0x24400000, 0x3ba00000, 0x47100000, 0x4f480000, 0x93b40000, 0x5bda0000, 0xadbf0000,
+	0x2b488000, 0xf1b6c000, 0x34df2000, 0xbe3d1000, 0x3a0e7800, 0xc2931c00, 0x4b0cca00, 0x18137900,
+	0xb4cb4e80, 0x8ef39940, 0x46f8b220, 0xf36f6510, 0x6fe70498, 0xf4b22074, 0xd45edcbe, 0x8afaec55,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x28000000, 0x54000000, 0x12000000, 0x5d000000,
+	0x69800000, 0xf0c00000, 0x96e00000, 0xd0f00000, 0x99780000, 0x69140000, 0xad0a0000, 0xa12b0000,
+	0x663a8000, 0x70304000, 0x879b2000, 0x9de65000, 0x9e778800, 0xe93f3c00, 0xe4b7de00, 0x6edec300,
+	0x43c10580, 0xa462a6c0, 0xe6b25620, 0x5bdeff10, 0x9e465bb8, 0xd6a725e4, 0x0552f3aa, 0xb6aa49c5,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x68000000, 0xac000000, 0x22000000, 0x35000000,
+	0x28800000, 0xc6400000, 0xc4600000, 0x9db00000, 0x73180000, 0xa6d40000, 0x1f2a0000, 0x390d0000,
+	0x1eda8000, 0x3f744000, 0xa33ae000, 0x1203d000, 0x8d010800, 0xcc877400, 0xd8476a00, 0xbb649f00,
+	0x2c375380, 0xbfdbddc0, 0x91f46220, 0x6e7aeb10, 0x11e0b988, 0x0f7602e4, 0x1b3b51ba, 0xf602a6fb,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xc8000000, 0x54000000, 0x0a000000, 0x3b000000,
+	0xf4800000, 0xf6c00000, 0xf2a00000, 0x0ab00000, 0xbbc80000, 0x21140000, 0x5afe0000, 0xea9f0000,
+	0x088c8000, 0x2af74000, 0xc0a92000, 0x8f879000, 0xa245b800, 0xb4601400, 0xe0121e00, 0x2d7ff900,
+	0xc4df3f80, 0x4ae80940, 0x7fe1a620, 0xe054ed30, 0x261fa198, 0x124fb074, 0xfe533992, 0xb7183465,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x08000000, 0x9c000000, 0xb2000000, 0xab000000,
+	0xc9800000, 0x74c00000, 0xdce00000, 0xd5f00000, 0x57380000, 0x0c140000, 0x924e0000, 0x2d6f0000,
+	0x8ff98000, 0xcaf14000, 0x60ba6000, 0x79d15000, 0xc82c7800, 0x63d87c00, 0xf5e60e00, 0x1f752300,
+	0x667a7d80, 0x6e33e4c0, 0xa45c7620, 0x48265f30, 0xb913f398, 0xeacc87dc, 0xb72beba2, 0x245aabd7,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x98000000, 0xc4000000, 0xb6000000, 0x7d000000,
+	0x51800000, 0xfd400000, 0x0b200000, 0xb2100000, 0xd4080000, 0x16340000, 0x4c9a0000, 0x7bff0000,
+	0x314a8000, 0x9911c000, 0x288ba000, 0x42f2f000, 0xeeff8800, 0xeccadc00, 0xee551200, 0xbca94d00,
+	0xf266be80, 0x2f346f40, 0xeb189a20, 0x9bb89110, 0xfbeb2c98, 0x4e47e264, 0x33a50486, 0x50d0ce61,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x48000000, 0x2c000000, 0x1e000000, 0xf1000000,
+	0x15800000, 0x4a400000, 0xd6e00000, 0x60500000, 0x38e80000, 0x25b40000, 0x0a3a0000, 0xaf990000,
+	0x60aa8000, 0xcc514000, 0x66eae000, 0x74b73000, 0x8fba2800, 0xadda7c00, 0x9a4eca00, 0xb2002300,
+	0xaf049480, 0x4486be40, 0xcfc6e220, 0xd4a75f10, 0x9ab2dea8, 0x46badd64, 0xec5816b2, 0x3a0e915b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xe8000000, 0x5c000000, 0xce000000, 0xef000000,
+	0x5f800000, 0x08400000, 0x82600000, 0xe4100000, 0xcd980000, 0xa9f40000, 0xf9ce0000, 0xb20b0000,
+	0xd62d8000, 0x4f5a4000, 0x21506000, 0xf97fb000, 0xb9265800, 0x37f0ac00, 0x2ecbea00, 0x498e8700,
+	0x5469d680, 0x583859c0, 0xe7c03220, 0x42246b30, 0x2a725cb8, 0xff896efc, 0x3f6fbc9a, 0x9dbc9ee7,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xa8000000, 0xcc000000, 0xf6000000, 0x37000000,
+	0x6f800000, 0xa1400000, 0xb6e00000, 0xfb500000, 0xb8180000, 0x9a340000, 0x460e0000, 0xcecf0000,
+	0x766e8000, 0xc05c4000, 0x2053e000, 0x119b7000, 0x54711800, 0x6b6d6c00, 0x06df2200, 0x75902300,
+	0x0fbfe480, 0x278259c0, 0x3d40ba20, 0x88e10f30, 0x90532698, 0x89990ae4, 0xc076468a, 0x696a3ac3,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x18000000, 0xa4000000, 0x36000000, 0xeb000000,
+	0xc3800000, 0x4bc00000, 0xfca00000, 0xc7300000, 0xedb80000, 0xac140000, 0x0f4a0000, 0x52090000,
+	0xe1ed8000, 0x083bc000, 0x84d5a000, 0x5c6df000, 0x24f83800, 0x91f7cc00, 0xd99e5600, 0x3360b100,
+	0x3d95d380, 0x798b72c0, 0x562bee20, 0xc69cbd10, 0xeee625a8, 0x815233dc, 0xa4ac05a6, 0x1fd903f9,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x28000000, 0xc4000000, 0x62000000, 0x1d000000,
+	0xbc800000, 0x3ec00000, 0xebe00000, 0x3f900000, 0x28a80000, 0xdcf40000, 0x93fa0000, 0x5ebd0000,
+	0xd21a8000, 0x482e4000, 0xbc35a000, 0xcb1dd000, 0xf6ae0800, 0x2ff31400, 0x247e6e00, 0x1bfee300,
+	0x4abdd680, 0xb81a8040, 0x012ae620, 0x4ab3b710, 0x2cde1888, 0xc3cdb364, 0x33a338aa, 0x5bb72361,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x68000000, 0xa4000000, 0x36000000, 0x2f000000,
+	0x6f800000, 0x05c00000, 0x40a00000, 0xc9b00000, 0xd2580000, 0x8a940000, 0x9c2a0000, 0x396f0000,
+	0x638f8000, 0xe75e4000, 0x2811a000, 0xe76a7000, 0xa8899800, 0xdedb2c00, 0x32d38600, 0xa04c1100,
+	0xc0f81780, 0x7a275dc0, 0x5ef59e20, 0x81b97d10, 0x76c23198, 0xc5253ccc, 0x497611ba, 0x187e0cf9,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xf8000000, 0x64000000, 0x5e000000, 0x09000000,
+	0xff800000, 0x9bc00000, 0xffe00000, 0x4ef00000, 0x2f380000, 0x02940000, 0x980a0000, 0x114b0000,
+	0x94ee8000, 0x573ec000, 0x2692a000, 0x2608b000, 0x084f2800, 0x936f6c00, 0xa8fb8600, 0x87701b00,
+	0x61f9ad80, 0xd8f28cc0, 0x0a3a2e20, 0xcf11b710, 0xd8c88bb8, 0xda2e27c4, 0x8d5eab9e, 0xb4a357c9,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x78000000, 0x5c000000, 0x6a000000, 0x01000000,
+	0x82800000, 0x94c00000, 0x0aa00000, 0x0f100000, 0xdc380000, 0x0d340000, 0xf6ea0000, 0x412f0000,
+	0xcc098000, 0x735ec000, 0xd2006000, 0x7d061000, 0x7885a800, 0x1dc1e400, 0xac26de00, 0xadd5f900,
+	0xbd9b9280, 0x81a20ec0, 0x3c92f620, 0xd27edd10, 0x3f572c98, 0xe15ee7fc, 0xcf054cbe, 0xf583f7c7,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x88000000, 0x14000000, 0xa2000000, 0x49000000,
+	0x4a800000, 0xc3400000, 0xfe600000, 0xc5b00000, 0x84b80000, 0xab540000, 0xf74e0000, 0xfd0f0000,
+	0x89ef8000, 0xef1d4000, 0x25c42000, 0xc321d000, 0xa4d02800, 0x508e2400, 0x6729a200, 0x3fb85f00,
+	0x50d43b80, 0x828d50c0, 0xc62e0a20, 0xd13f3b30, 0xb997b998, 0x21ebdfec, 0xeb1d9982, 0xdfc50ff5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xe8000000, 0xec000000, 0x62000000, 0x4f000000,
+	0xc6800000, 0xe1400000, 0x8a200000, 0x88f00000, 0xc4280000, 0xea540000, 0xd09e0000, 0x55db0000,
+	0xe1f98000, 0x4c0a4000, 0x9da1e000, 0xda36d000, 0xc2ced800, 0x31428400, 0x32204200, 0x1cf36d00,
+	0xd22f9180, 0xc3527640, 0xd71f1a20, 0x5f1fa930, 0x031833b8, 0x6918cb5c, 0xba19d39a, 0xf69e1b4b,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x68000000, 0x6c000000, 0x32000000, 0xad000000,
+	0x35800000, 0x12400000, 0x9e200000, 0x24900000, 0xa4180000, 0x59340000, 0x11ce0000, 0xc18f0000,
+	0x3aaf8000, 0x97ba4000, 0xcbe7e000, 0xa5f25000, 0xfb2bc800, 0x13f99c00, 0x76c64a00, 0xf3e7c500,
+	0xd1f26280, 0xad2b47c0, 0x50fa0220, 0xb4401930, 0x1525c898, 0x5a15d2ec, 0xa8da28ba, 0x7bd382eb,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xe8000000, 0x5c000000, 0x92000000, 0xe5000000,
+	0x75800000, 0xddc00000, 0xb7a00000, 0xfe900000, 0x50f80000, 0xa9b40000, 0xae2a0000, 0x2f2b0000,
+	0x2ca98000, 0x226e4000, 0xd34c6000, 0x469d5000, 0x22840800, 0x1d401c00, 0xe7e07600, 0xd0f78900,
+	0x3fccae80, 0x2cdf20c0, 0x55e7fe20, 0x65f2d510, 0xb24938b8, 0xb51bb9fc, 0xc443389a, 0xb060b9c7,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x88000000, 0x3c000000, 0xa6000000, 0xad000000,
+	0x67800000, 0xdbc00000, 0xd4a00000, 0x5e500000, 0x00580000, 0x70740000, 0xda4a0000, 0x3b4f0000,
+	0xa2ca8000, 0x00094000, 0xb9286000, 0xbfb8f000, 0x9dc14800, 0xa9a62c00, 0xd1d4a600, 0x779ce100,
+	0x8ad6e880, 0x1518fdc0, 0xfa956e20, 0xa47c8d10, 0x6960ae98, 0x07f5ace4, 0xc98aae82, 0xb3eaacdf,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x28000000, 0x94000000, 0x82000000, 0xa1000000,
+	0x13800000, 0x69400000, 0x90200000, 0x7d700000, 0xa7580000, 0x6bd40000, 0x52ea0000, 0x8cef0000,
+	0x2bec8000, 0x536c4000, 0x4cab2000, 0x0c4ad000, 0xbd5f6800, 0x66d6ec00, 0x1f6c3200, 0x02ad6500,
+	0xa3484580, 0x61db95c0, 0x8315da20, 0x4288c910, 0xb63bd798, 0x328460d4, 0x3ac3d7aa, 0x996060f5,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x94000000, 0x0a000000, 0x0b000000,
+	0x04800000, 0x7cc00000, 0x02200000, 0x09d00000, 0xb3980000, 0xe0740000, 0xd00a0000, 0xe20b0000,
+	0x3d0b8000, 0xd38cc000, 0x14482000, 0xaae91000, 0x4bfdb800, 0xf0459400, 0x12e20e00, 0x75f3dd00,
+	0x0b4f6480, 0xe46b27c0, 0xdc3e3620, 0x46e18910, 0xdff6cab8, 0x50492aec, 0xe8eeca8e, 0x8cfd2af5,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xc8000000, 0x24000000, 0x62000000, 0x07000000,
+	0x13800000, 0xec400000, 0xa8a00000, 0x6df00000, 0x2d080000, 0x5dd40000, 0xe93e0000, 0x793b0000,
+	0x913c8000, 0x853b4000, 0xff3aa000, 0x143ed000, 0x41bcd800, 0xc8ff6c00, 0x74d8aa00, 0xe6ea1100,
+	0x8f035980, 0x17801b40, 0xbe46f220, 0xb7a53d30, 0x9275d3b8, 0x874b9a74, 0x9075d392, 0x904b9a79,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xa8000000, 0x3c000000, 0xe2000000, 0x51000000,
+	0x84800000, 0xd1400000, 0x29a00000, 0xe2900000, 0xbfa80000, 0x00b40000, 0x5bfa0000, 0x02790000,
+	0x5dbf8000, 0x685e4000, 0xf5eb6000, 0x8090d000, 0xaea8a800, 0x24371400, 0xbabc3200, 0x83dd5100,
+	0x832e4280, 0x35f5c640, 0xa4591a20, 0x5fe90510, 0x7d9490a8, 0x502b074c, 0x3071108a, 0xc99c475f,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x68000000, 0x6c000000, 0x92000000, 0x6d000000,
+	0x94800000, 0x51c00000, 0x25600000, 0xcb500000, 0xd9680000, 0x01b40000, 0x847e0000, 0xe7fd0000,
+	0x73bf8000, 0xf9984000, 0x9f6de000, 0xaab15000, 0x7bf9c800, 0x69b89400, 0x689ad600, 0x41e95700,
+	0x92726880, 0x341ff240, 0x0c2a9e20, 0x6d108330, 0x4e4cde88, 0xbbc6b56c, 0x3c655eba, 0xe9d7f56b,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x98000000, 0x9c000000, 0xf6000000, 0x49000000,
+	0x20800000, 0x01400000, 0x84a00000, 0x88b00000, 0x9df80000, 0xa7940000, 0x1f8a0000, 0x440f0000,
+	0x66c88000, 0xcca9c000, 0xe07f6000, 0x5450f000, 0x096de800, 0x9f9f1400, 0x1f455200, 0x39a1f900,
+	0xea31d380, 0xf7be7cc0, 0xb8b23a20, 0x95fc2d10, 0xc3916198, 0xa58db5f4, 0x630be186, 0x934f75f7,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x58000000, 0x7c000000, 0x2a000000, 0x73000000,
+	0xe2800000, 0xd6400000, 0x58e00000, 0x1ef00000, 0x11280000, 0x30540000, 0x673a0000, 0x178f0000,
+	0x72468000, 0x4ee3c000, 0x27f06000, 0x90ab1000, 0x5c96b800, 0x959fa400, 0x7b9b7a00, 0x0e98cb00,
+	0x8d1e9180, 0xa6da9c40, 0xb8fda220, 0x27ac7f10, 0xb8135398, 0x22ddf344, 0xdef849b6, 0x56ae284f,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x78000000, 0x74000000, 0x9e000000, 0x67000000,
+	0x17800000, 0xb2400000, 0xd8e00000, 0xc3100000, 0xc5880000, 0x91b40000, 0x8a7e0000, 0x992b0000,
+	0xb1418000, 0x9962c000, 0xfa572000, 0x90ecb000, 0x61e75800, 0x9391ec00, 0xf04d5a00, 0xf312c300,
+	0x9d8ef680, 0x75b5d940, 0x1c7d2220, 0xf22f9f30, 0x4cc4f4b8, 0xd226f65c, 0x52368ebe, 0xf63c856d,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xe8000000, 0x24000000, 0xc2000000, 0x21000000,
+	0xeb800000, 0xb0400000, 0x29200000, 0x5dd00000, 0x2a280000, 0x0cb40000, 0x6ada0000, 0xf1490000,
+	0x19448000, 0x56a04000, 0x3796a000, 0xbe0bd000, 0xb4e36800, 0x37b26c00, 0xdc5f9a00, 0x54899d00,
+	0xff217080, 0xe6d3ba40, 0xdcaa5220, 0x09702110, 0xdcbd82a8, 0xa9384b54, 0xd67cb89a, 0x23de0659,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xa8000000, 0x24000000, 0xde000000, 0xd1000000,
+	0x23800000, 0x0bc00000, 0x3d600000, 0x85f00000, 0x38280000, 0x07540000, 0x36be0000, 0x2f8f0000,
+	0xe4428000, 0x6ca04000, 0xc792a000, 0xf75b3000, 0x9b3ee800, 0xfd4ccc00, 0xaea12600, 0x8493ff00,
+	0x9fdbad80, 0xac789440, 0x916d6e20, 0x1a740330, 0xd1ec6398, 0xc933a744, 0x03c9e58a, 0xbce06879,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x58000000, 0x9c000000, 0x2a000000, 0x87000000,
+	0xde800000, 0x40c00000, 0x4be00000, 0xee300000, 0xaa480000, 0x7f140000, 0x109e0000, 0x19ef0000,
+	0x9f038000, 0xe287c000, 0x3ac66000, 0xa4e21000, 0xf4b21800, 0x5c8b4400, 0x99f36e00, 0xa72e9300,
+	0x2de48380, 0xeb328b40, 0x57cf1620, 0x6753c730, 0xeebbf598, 0x79b85c4c, 0x6f3b7bb6, 0xbbf81f57,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x58000000, 0x64000000, 0xe2000000, 0xfb000000,
+	0xc5800000, 0x4f400000, 0x27a00000, 0x05b00000, 0x3dd80000, 0x3f540000, 0x8cca0000, 0x8ebb0000,
+	0x8f028000, 0x3f87c000, 0x3040a000, 0x90215000, 0xe9f63800, 0xbbfa1c00, 0x97a6b200, 0x6db2c900,
+	0x71db7b80, 0x715229c0, 0xa9c82a20, 0x363d8510, 0x1cc1f1b8, 0x69e1fce4, 0x989763b6, 0xc0aaa5c9,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0x54000000, 0xce000000, 0x85000000,
+	0xc2800000, 0xebc00000, 0x9a600000, 0x6d500000, 0xdcb80000, 0x1af40000, 0x028e0000, 0x439d0000,
+	0xec068000, 0xca07c000, 0x73072000, 0x83823000, 0xff464800, 0xa0a2c400, 0xfbb50600, 0xdf2eef00,
+	0x9eae2080, 0x9eef68c0, 0x07cc6e20, 0xd83a1b30, 0xf8336e88, 0xe06e43e4, 0x1e09c8a6, 0xf5585ce5,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x08000000, 0x2c000000, 0x0a000000, 0x0f000000,
+	0xf8800000, 0x77400000, 0x3be00000, 0xc0700000, 0xd9c80000, 0x1ed40000, 0x395a0000, 0xb1ef0000,
+	0xd0058000, 0x58014000, 0x3401e000, 0x5e039000, 0x21015800, 0xd186f400, 0x8ac39200, 0xbb266300,
+	0x74527d80, 0x551cab40, 0x3c8b2a20, 0x3e370710, 0x4faab798, 0x46633c5c, 0x00b745a2, 0x0de88f5b,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x78000000, 0x9c000000, 0xd2000000, 0x83000000,
+	0xed800000, 0x74400000, 0x16a00000, 0x36100000, 0x77280000, 0x9af40000, 0x469a0000, 0xd54f0000,
+	0x02878000, 0x13c2c000, 0x2de66000, 0x5734d000, 0x527b3800, 0x58f91c00, 0xcf3f2a00, 0x9cdec100,
+	0xe2e9fe80, 0x4217ee40, 0x512a7220, 0x7ff70d10, 0x2e1fec98, 0xf98b334c, 0x40e126be, 0xfbb3e277,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x98000000, 0xfc000000, 0xf6000000, 0x83000000,
+	0xcf800000, 0x83400000, 0x39200000, 0x9a700000, 0x61f80000, 0x7a140000, 0x8faa0000, 0x411b0000,
+	0x26828000, 0xe9c1c000, 0x8ee46000, 0x8397f000, 0x2fef3800, 0xc7ba2c00, 0x37b1b200, 0xd51ead00,
+	0x64813580, 0x18c49cc0, 0x5862ea20, 0x22577110, 0x250dbfb8, 0xde2f1de4, 0xf55aed86, 0xa22780ef,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xc8000000, 0x8c000000, 0xf6000000, 0x2d000000,
+	0xaa800000, 0xc9400000, 0x3ca00000, 0xfd100000, 0xdcc80000, 0x75f40000, 0xaffe0000, 0xc96b0000,
+	0x78658000, 0x71774000, 0x3fbce000, 0x0d4a7000, 0xeb314800, 0x289f8400, 0x759c1200, 0xd71e1900,
+	0x725bd680, 0x48f81940, 0x50efba20, 0xaaa0ed30, 0xe0130cb8, 0x5e4ec47c, 0xc0b49e92, 0xad5c9d53,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0xe8000000, 0x24000000, 0x5e000000, 0xe3000000,
+	0x19800000, 0xd8c00000, 0xea200000, 0x63900000, 0x46f80000, 0xda740000, 0xb2ca0000, 0x59dd0000,
+	0x77648000, 0xa3744000, 0x264aa000, 0xe39b3000, 0xc0077800, 0x60001c00, 0x7000ae00, 0xb8054500,
+	0xcc037680, 0x7a0070c0, 0xbd077620, 0xfa836910, 0xc1402088, 0x32e169d4, 0x89b60e9a, 0x25696cd9,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xf8000000, 0x24000000, 0x8e000000, 0x75000000,
+	0x8e800000, 0xb1c00000, 0x68a00000, 0x59b00000, 0xc4180000, 0x2dd40000, 0x0f8a0000, 0x67bb0000,
+	0xd7e18000, 0xc0d2c000, 0x1509a000, 0x40783000, 0x1e434800, 0x61e42400, 0x31d2d600, 0x058cd900,
+	0x8cb9d780, 0x2463bbc0, 0x23923e20, 0x666bcd10, 0x8a69c9b8, 0x786986fc, 0xb7689f9e, 0xcae89fd9,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x28000000, 0x4c000000, 0x9e000000, 0x19000000,
+	0x96800000, 0x67c00000, 0xe9e00000, 0x28500000, 0x65980000, 0x27740000, 0x86ae0000, 0xd77d0000,
+	0xf6a28000, 0x67764000, 0x66abe000, 0xe7793000, 0xcea1e800, 0x03752400, 0xb4ae8600, 0x607ef300,
+	0x4127e880, 0xf236cdc0, 0x3a8a8e20, 0xa1cfe730, 0x0cea0688, 0xb0db5ac4, 0x9b5000aa, 0xf01ae9e3,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x88000000, 0xcc000000, 0xc6000000, 0xb9000000,
+	0xdf800000, 0x0ac00000, 0x41600000, 0x0db00000, 0x0d680000, 0x43140000, 0x303e0000, 0x2c0d0000,
+	0x9ea38000, 0xa5534000, 0x1b1ee000, 0x2c9ff000, 0x3a5de800, 0x253dac00, 0xe5892e00, 0xb567ff00,
+	0x4fb26780, 0x9e6ea640, 0xd3942620, 0xd478a330, 0x742d2188, 0x1eb3b54c, 0x5def8f82, 0x87530a43,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xe8000000, 0x34000000, 0x66000000, 0x5d000000,
+	0x03800000, 0xf8c00000, 0x5ea00000, 0xbc900000, 0xd6880000, 0xdbf40000, 0x853e0000, 0x822d0000,
+	0xb0648000, 0x47304000, 0x959e2000, 0x77bef000, 0xd36e0800, 0xd1018c00, 0x79879e00, 0xd7c0c100,
+	0xb6225e80, 0xf2d65740, 0x4769b620, 0xa702bd30, 0xec874888, 0x30435a74, 0xc0e4569a, 0xc573db7d,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x38000000, 0x64000000, 0x96000000, 0x11000000,
+	0x4d800000, 0xf5400000, 0x99e00000, 0x4cd00000, 0x3e580000, 0x1d740000, 0x2cea0000, 0x19bf0000,
+	0xaca18000, 0xf530c000, 0xe28fa000, 0xeb2ef000, 0x6d9c6800, 0xc750fc00, 0x321d1200, 0x05176b00,
+	0xaf78c080, 0x6503c7c0, 0x5384da20, 0xd8466710, 0xd6603a98, 0x069090fc, 0x9f3ca8ae, 0x7f673bc9,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xd8000000, 0xb4000000, 0x8e000000, 0x49000000,
+	0x70800000, 0xbec00000, 0x2f200000, 0x47300000, 0x59780000, 0x19d40000, 0x34ee0000, 0xbbd90000,
+	0x7ea38000, 0x2575c000, 0x52992000, 0x86c73000, 0xcb272800, 0x81375400, 0x4c7a4e00, 0x8b527500,
+	0xf92feb80, 0x237b34c0, 0xbed24620, 0x9d6f1130, 0x9d9f0da8, 0x8342d5cc, 0x77654396, 0x8bd0a0dd,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x08000000, 0x9c000000, 0x8a000000, 0x71000000,
+	0x0e800000, 0x5cc00000, 0x83600000, 0x31900000, 0x75280000, 0x51340000, 0x865a0000, 0x50cf0000,
+	0x90668000, 0x82114000, 0xc56f6000, 0x73909000, 0xb82d2800, 0xa5b7c400, 0xb39fbe00, 0x4928a700,
+	0xeb317e80, 0x8f584440, 0xda4ff620, 0xd2a4f310, 0x66776898, 0x017d6744, 0x25fad6a2, 0x383ec077,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xb8000000, 0xf4000000, 0x36000000, 0xb7000000,
+	0x99800000, 0x6bc00000, 0xa8200000, 0xac500000, 0x7df80000, 0x92b40000, 0xbd0a0000, 0x1c5f0000,
+	0xad208000, 0xfcd4c000, 0xc4ba2000, 0x62d6f000, 0x1fbdd800, 0x8955dc00, 0x9d7bd600, 0x43f6f500,
+	0x0169d080, 0x7cee80c0, 0xb92e2e20, 0xe20ed910, 0x89dd5e98, 0x64e269f4, 0x05f4888e, 0xfe6f9ced,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x28000000, 0xec000000, 0xea000000, 0xc5000000,
+	0x97800000, 0xb4400000, 0x6da00000, 0x2d300000, 0x32080000, 0x03540000, 0x56de0000, 0xb9cb0000,
+	0xf6b08000, 0x1c484000, 0x33f6e000, 0x786a9000, 0x11830800, 0x5b400c00, 0xdf229a00, 0x5ef41900,
+	0xc3ee6780, 0xafc21740, 0xa3e7f220, 0x4d96c530, 0x34b915b8, 0x471c9254, 0x112807aa, 0xbfa0c74b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xd8000000, 0x84000000, 0xc6000000, 0xed000000,
+	0xf2800000, 0xb1c00000, 0x53200000, 0xc0500000, 0x9f880000, 0x40340000, 0xa53e0000, 0x68c90000,
+	0x6cd28000, 0x274dc000, 0x9795a000, 0xf1ae7000, 0x0ae48800, 0x1f730400, 0x65df1600, 0x60bac500,
+	0xe48ee880, 0xe7b7a340, 0xd27cbe20, 0x842a7130, 0x4ea0d6a8, 0xc8101244, 0xd2e9c896, 0x58041351,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x68000000, 0x24000000, 0xce000000, 0xc9000000,
+	0x0b800000, 0xedc00000, 0xfda00000, 0x0a500000, 0x41680000, 0xf9b40000, 0x3f5a0000, 0xe12f0000,
+	0x54d68000, 0x052a4000, 0xbad6a000, 0xbc2fb000, 0xc9532800, 0x1ded8c00, 0xdef31600, 0x10ba5900,
+	0x5d1d5080, 0x0f4b6040, 0x72201e20, 0x19922510, 0x6dcbce98, 0xa4630544, 0x11f570ba, 0xc63a9059,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0x74000000, 0x6e000000, 0x55000000,
+	0x6e800000, 0xa9400000, 0x4c600000, 0xe1d00000, 0x8eb80000, 0xa2740000, 0x4e4e0000, 0xb7790000,
+	0x5a548000, 0x897a4000, 0xe7542000, 0x33fab000, 0xf0114800, 0x029b2400, 0x0b44d200, 0x4b609f00,
+	0xb0560080, 0x8a7cd4c0, 0x20d53a20, 0x3e3b4b30, 0x0637baa8, 0xe0addff4, 0xcdeea0aa, 0xd78824ed,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x38000000, 0xf4000000, 0x12000000, 0xe9000000,
+	0x82800000, 0x8c400000, 0x77200000, 0xfb700000, 0x4c580000, 0xbe940000, 0xe24a0000, 0x799d0000,
+	0x4e768000, 0x50dac000, 0x1dd22000, 0xfcebd000, 0x5d2c2800, 0x8fcda400, 0xfc5d7a00, 0xd690c500,
+	0x0e4d7d80, 0x8f9911c0, 0x8d75f220, 0xcf5c7110, 0x01160f88, 0xee8ba0c4, 0x53fbddae, 0xb4a101ed,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x08000000, 0x44000000, 0xce000000, 0x47000000,
+	0x6f800000, 0x35400000, 0x68200000, 0x6d300000, 0xdab80000, 0x11d40000, 0x6dee0000, 0xc1ff0000,
+	0x2ef48000, 0x075d4000, 0xba03a000, 0x9106b000, 0x04835800, 0x00c1ac00, 0xdc65a200, 0x69902500,
+	0x234fcf80, 0xd10a06c0, 0x16a9da20, 0x2ede7930, 0x4c449598, 0x38a23ff4, 0xcbf46fa2, 0xd5d8b6e1,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xc8000000, 0xd4000000, 0x72000000, 0xbb000000,
+	0x0c800000, 0xadc00000, 0x96e00000, 0xff900000, 0x59e80000, 0x0a340000, 0x8e5e0000, 0xb2290000,
+	0xc5d58000, 0x5e4d4000, 0xa6802000, 0x9ac45000, 0xa4603800, 0x7752d400, 0x168d6600, 0x49e3ab00,
+	0x29176680, 0xcb2bce40, 0xda50fe20, 0x7b0c6f30, 0xd7a418a8, 0x54b7e17c, 0xa89f4692, 0x404b9e45,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x38000000, 0x7c000000, 0xae000000, 0x81000000,
+	0xf6800000, 0x81c00000, 0xc2600000, 0x48300000, 0x90e80000, 0x23140000, 0x727a0000, 0x6b2b0000,
+	0xca768000, 0x7fccc000, 0xb3806000, 0xe5463000, 0x8ca12800, 0xedd1a400, 0x979cb600, 0x8c5a4f00,
+	0x753a8b80, 0x408b9240, 0xe4237e20, 0x65151b10, 0x177d75b8, 0xbfad4944, 0x4cb2ebae, 0x8e29a24f,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0x44000000, 0x2e000000, 0x1d000000,
+	0x09800000, 0x3fc00000, 0x73e00000, 0x6ff00000, 0x60a80000, 0xdc540000, 0xf27a0000, 0xe36d0000,
+	0xddb18000, 0x628e4000, 0x0d40a000, 0xaca1b000, 0x8c568800, 0xea7c9c00, 0x2f692600, 0x47b71b00,
+	0xf988bd80, 0x5dc30c40, 0xb4e68e20, 0xdd707710, 0xffedb388, 0x1ff43b7c, 0x88a81d8a, 0xb852bc41,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x88000000, 0x84000000, 0xbe000000, 0x81000000,
+	0x57800000, 0x73400000, 0x23e00000, 0xa4900000, 0x48a80000, 0xa5b40000, 0x819a0000, 0x7fef0000,
+	0x18528000, 0x540d4000, 0x78c7a000, 0xc2a73000, 0xcc776800, 0x9cbfec00, 0x44da2200, 0x190d8b00,
+	0x3544f280, 0x7ee14840, 0x21106a20, 0x10ec1710, 0x66d41898, 0x04cb1f64, 0x8e635282, 0xc8d67871,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xb8000000, 0x4c000000, 0x7e000000, 0xd1000000,
+	0x7c800000, 0x91c00000, 0xaba00000, 0x7f700000, 0x45880000, 0x2b940000, 0x1f9e0000, 0x0f490000,
+	0xdfb18000, 0x82aec000, 0xad20e000, 0x75b3b000, 0xd1ac2800, 0x66a5f400, 0x75f23600, 0x514f5100,
+	0xbeb0e180, 0xe62eb740, 0x00e77e20, 0x1813d530, 0x33d81fa8, 0x21aaa25c, 0x1ea6018e, 0x99f00763,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x28000000, 0x4c000000, 0x9e000000, 0xf1000000,
+	0xe5800000, 0x58c00000, 0xb5e00000, 0xcf100000, 0x71b80000, 0xc5b40000, 0xd48e0000, 0xf67f0000,
+	0xdcd08000, 0xa2dc4000, 0xe8e7e000, 0x24913000, 0x907fa800, 0x89d73c00, 0xf55efe00, 0x8f206b00,
+	0xadf3e280, 0xae292cc0, 0x8b4e3620, 0xbb1e2730, 0x00835498, 0xb7444bd4, 0xd62202aa, 0xc4731ce3,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xa8000000, 0xa4000000, 0xc2000000, 0x77000000,
+	0x40800000, 0xc0400000, 0xc0a00000, 0xda700000, 0xf1e80000, 0x25140000, 0x1ffa0000, 0x846b0000,
+	0x92d28000, 0xbf984000, 0xcefaa000, 0xd1e9d000, 0x1512d800, 0xc7f8b400, 0x18696a00, 0x5cd55900,
+	0xae99a580, 0x3b788040, 0x26299220, 0x55777d10, 0x1d6a37b8, 0xf354fd64, 0x5259258a, 0x659fc079,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x48000000, 0x74000000, 0x46000000, 0xff000000,
+	0x46800000, 0xea400000, 0xdc600000, 0x02900000, 0x2b880000, 0x99340000, 0xefba0000, 0xd10b0000,
+	0x01738000, 0x6adf4000, 0xda1d2000, 0xce3bf000, 0xb1cf1800, 0xad572400, 0xc9285a00, 0x44844f00,
+	0x5b412280, 0xf1e3c540, 0x5853e220, 0xaaacdb10, 0x7540c0b8, 0x6ae01e6c, 0x40d2a2b2, 0x33ec854d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x68000000, 0xcc000000, 0x7a000000, 0x9d000000,
+	0x58800000, 0xd3c00000, 0xe4a00000, 0xdd300000, 0x08e80000, 0x53d40000, 0x983e0000, 0x786b0000,
+	0x6c128000, 0xf69a4000, 0x405de000, 0x987a1000, 0xc08cc800, 0xdbc2f400, 0xf8a36600, 0x2f33a900,
+	0x49ecc380, 0x1957e440, 0x1afece20, 0xbe4a0d30, 0xffe40db8, 0x4252e944, 0x1d7e43ba, 0xec0da443,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0x34000000, 0x12000000, 0x37000000,
+	0xc6800000, 0x04c00000, 0xbae00000, 0x4e700000, 0xe2180000, 0x1dd40000, 0xb2ca0000, 0x0a9d0000,
+	0xb8118000, 0x63ae4000, 0x75ab2000, 0x98ac5000, 0x8d2a5800, 0x056f8400, 0x104cce00, 0x045e3b00,
+	0x89f09180, 0x3d5ba9c0, 0x1e763620, 0xfa1eaf10, 0xa1d4a788, 0x64cc06fc, 0x8799118a, 0x7d91e9dd,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xc8000000, 0x94000000, 0x6a000000, 0xed000000,
+	0x9f800000, 0x31400000, 0x21a00000, 0x4b500000, 0x2e680000, 0x13340000, 0x1f5a0000, 0x356b0000,
+	0x3fb58000, 0xa69b4000, 0xef0c2000, 0xa7809000, 0x2d408800, 0x3fa78c00, 0xbc507200, 0x94e87900,
+	0x29f4dc80, 0x65bfcc40, 0xb29b5a20, 0xc50b2510, 0xaa8786b8, 0xc2c0e95c, 0xc6e6dc92, 0x09f0cc75,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xb8000000, 0x44000000, 0x46000000, 0xf7000000,
+	0xa1800000, 0xc9c00000, 0x1d200000, 0xe6100000, 0x89b80000, 0x4a740000, 0xa1ca0000, 0x4ab90000,
+	0x55f18000, 0x7b0ac000, 0x401ca000, 0x35267000, 0x0a175800, 0x63bf9c00, 0xf7758600, 0x4d4fbd00,
+	0xd7fd6280, 0x9196e2c0, 0x1f7dfe20, 0x5ad19110, 0xc4189ca8, 0x932373fc, 0xad17628e, 0x8a3fe2c1,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x48000000, 0xec000000, 0xaa000000, 0x69000000,
+	0xf6800000, 0xbec00000, 0xcce00000, 0x18700000, 0x2d580000, 0x13d40000, 0x228a0000, 0x935f0000,
+	0x54d58000, 0xeb0b4000, 0x201be000, 0x1d729000, 0x31df6800, 0xa4110400, 0x68e82e00, 0x7de8bb00,
+	0x596d3180, 0x4aaba3c0, 0x46cb2620, 0x6b7b6f10, 0xf9461798, 0x10a0ccdc, 0x045531b2, 0xa6cfa3eb,
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x78000000, 0x84000000, 0x0a000000, 0xfd000000,
+	0x40800000, 0x9c400000, 0xbee00000, 0xae900000, 0xbd480000, 0xcfb40000, 0xaefe0000, 0xdf4f0000,
+	0x0eb68000, 0x007ec000, 0x240fa000, 0x75d51000, 0xf62d0800, 0xb1e5f400, 0x57121a00, 0x0b8cfb00,
+	0x80176280, 0x860e8740, 0xd4d03220, 0xc8a9df30, 0x32a75098, 0xa8775864, 0xf7df62be, 0xe8fa8751,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x38000000, 0xbc000000, 0x2a000000, 0xa1000000,
+	0x75800000, 0x14c00000, 0x31a00000, 0xdeb00000, 0xba080000, 0x21540000, 0xd35e0000, 0x860d0000,
+	0xcb528000, 0x525ec000, 0xe3886000, 0xe7921000, 0xdffe2800, 0x173a9c00, 0xfc9fbe00, 0x8b280900,
+	0xd0a2cf80, 0x4b36e340, 0x9ecd7620, 0x38f74530, 0x89efb988, 0xaa01a644, 0x6102cfae, 0x5586e35f,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x18000000, 0xa4000000, 0x32000000, 0x75000000,
+	0xbb800000, 0xc2c00000, 0xa2200000, 0xe8300000, 0xfda80000, 0xd8540000, 0xa5fe0000, 0xbdab0000,
+	0xf8578000, 0xf5f9c000, 0x15aba000, 0x4456d000, 0x63ff4800, 0x52afec00, 0x8ad36e00, 0x1abf8500,
+	0x324ebb80, 0xc0c19240, 0x0f260620, 0x17b07930, 0xbd68bdb8, 0x1771eb6c, 0x524ebba6, 0xb0c19259,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xf8000000, 0x4c000000, 0xce000000, 0xad000000,
+	0xed800000, 0x2f400000, 0xfe600000, 0xb6900000, 0x22980000, 0x829c0000, 0xd29e0000, 0x3a9d0000,
+	0xfe9e8000, 0x84994000, 0xab9b2000, 0x251d5000, 0x4ad83800, 0x767f5400, 0x11ce2e00, 0x7ba1dd00,
+	0x6d306980, 0x1fab7d40, 0x753069a0, 0x63ab7d50, 0x233069b8, 0xf2ab7d4c, 0xf8b06986, 0x3ceb7d5f,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xc8000000, 0x1c000000, 0xba000000, 0xff000000,
+	0x99800000, 0x1c400000, 0xeca00000, 0x8b900000, 0xd8380000, 0x703c0000, 0x1c3e0000, 0x8e390000,
+	0x5d388000, 0xb6bec000, 0x49fe2000, 0x86dbf000, 0xee0c0800, 0x4310c400, 0xa4fc2600, 0x8c5d4300,
+	0xf9cc1f80, 0x60f45e40, 0x284c1fa0, 0x20b45e50, 0x9eec1f98, 0x64245e5c, 0x17541faa, 0x14585e5b,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0xe4000000, 0x9e000000, 0x8f000000,
+	0x52800000, 0x01400000, 0xada00000, 0x0c100000, 0x15a80000, 0x2dac0000, 0x41aa0000, 0x9baf0000,
+	0x7aa88000, 0xef2ac000, 0x58ede000, 0x6a091000, 0x44bd6800, 0x0f87fc00, 0x36c3f600, 0xf7609b00,
+	0x2175fb80, 0xd5dad6c0, 0x6df5fba0, 0x9b9ad6f0, 0x32d5fb88, 0x66cad6cc, 0xc2ddfb9a, 0xa376d6f5,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xe8000000, 0xb4000000, 0xb6000000, 0x31000000,
+	0x5e800000, 0x73400000, 0x36e00000, 0x50300000, 0xf4d80000, 0xb0dc0000, 0x9eda0000, 0x43df0000,
+	0xe75f8000, 0x4f18c000, 0x147d6000, 0xee88d000, 0x30715800, 0xcbbfac00, 0xb42e3600, 0xd5248100,
+	0xb8978080, 0x6e89e640, 0xf07780a0, 0x6bb9e670, 0xa42f8088, 0x3d25e674, 0x0c9580b2, 0xd88ae659,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x58000000, 0xf4000000, 0x52000000, 0xe7000000,
+	0xba800000, 0xadc00000, 0x31600000, 0x39300000, 0xa8880000, 0xaa8c0000, 0x558e0000, 0x7b0d0000,
+	0x54cb8000, 0xdaa94000, 0xad1ee000, 0xfa547000, 0x86bf4800, 0x50849c00, 0x2ec4f200, 0xe1e2f900,
+	0x57f47080, 0x296ad4c0, 0x2d7c70a0, 0x24e6d4d0, 0xa27270b8, 0x222bd4e4, 0x9fd9f0ae, 0x35b294d9,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x28000000, 0xcc000000, 0x86000000, 0x35000000,
+	0xf1800000, 0x17c00000, 0xf2e00000, 0x0f700000, 0xb0a80000, 0x26ac0000, 0xabaa0000, 0xee2d0000,
+	0x2be88000, 0x8e09c000, 0x0fffa000, 0xea139000, 0xed1e3800, 0x5d63b400, 0xe9b60a00, 0xa9cd1d00,
+	0x151aa680, 0xc96383c0, 0x6bb2a6a0, 0x66cf83f0, 0x7f98a698, 0xd62283dc, 0xf9102692, 0xb99b43ef,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x28000000, 0xe4000000, 0x5a000000, 0xeb000000,
+	0x44800000, 0xc6400000, 0x85a00000, 0x67d00000, 0x30a80000, 0x2eac0000, 0xefaa0000, 0xd82d0000,
+	0xc6ef8000, 0x130ec000, 0xa479e000, 0x06833000, 0x71406800, 0xb7244c00, 0xa4957e00, 0x688bd300,
+	0xc4bdad80, 0x826508c0, 0x39b5ada0, 0xbf1908f0, 0x74b7ad98, 0x169808e4, 0x6b722d92, 0x14fbc8dd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xc8000000, 0xdc000000, 0xce000000, 0xb1000000,
+	0x28800000, 0xd7400000, 0x8fe00000, 0x08f00000, 0xef380000, 0x853c0000, 0x2e3a0000, 0x05bf0000,
+	0xb57e8000, 0xbc58c000, 0x188e2000, 0x69e05000, 0x35f1d800, 0x51be9c00, 0xc7792600, 0x535ad900,
+	0x7909de80, 0x8221c740, 0x7f51dea0, 0xa9adc770, 0xb933de88, 0xc69ec77c, 0x8aaf5eba, 0x2eb5074b,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xa8000000, 0xa4000000, 0x86000000, 0x83000000,
+	0x7e800000, 0x6bc00000, 0x9ea00000, 0xc6d00000, 0x6b280000, 0x512c0000, 0x682e0000, 0x6fad0000,
+	0x63ed8000, 0xe108c000, 0x0d3de000, 0x2e21d000, 0xda11c800, 0xc5083c00, 0xcb3c6200, 0xcd221700,
+	0xb4966180, 0x06ca98c0, 0xf19e61a0, 0x8df698d0, 0x5cb861b8, 0x296798d4, 0xf273e192, 0x7cfe58fd,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0x1c000000, 0x9a000000, 0xdd000000,
+	0x80800000, 0xa5c00000, 0x08e00000, 0xb8500000, 0x4d880000, 0xb88c0000, 0xe40a0000, 0xfbcb0000,
+	0x3e2b8000, 0xaefec000, 0x5ab62000, 0x70def000, 0xf1821800, 0xc7451c00, 0xe427b200, 0xa6333500,
+	0xbf1bd780, 0xbc64cbc0, 0x5b91d7a0, 0x226fcbf0, 0x4d5a57a8, 0x24c10bf4, 0xf2647782, 0xf093fbf3,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x18000000, 0x5c000000, 0x5a000000, 0x6b000000,
+	0x95800000, 0xb8c00000, 0x7ea00000, 0x00300000, 0x62e80000, 0xd5ec0000, 0xda6a0000, 0xa9af0000,
+	0x728e8000, 0xd27e4000, 0x9234a000, 0x1dea7000, 0xce6b2800, 0x27ac8400, 0x378dc200, 0x32ff7700,
+	0xd2755680, 0x7f0a71c0, 0xf6bf56a0, 0x169571f0, 0x46d9d688, 0x210731fc, 0x1687768e, 0xc94241eb,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x18000000, 0x94000000, 0xda000000, 0x25000000,
+	0x79800000, 0xf5c00000, 0x98a00000, 0x69b00000, 0x78e80000, 0xf1ec0000, 0x966e0000, 0x24ab0000,
+	0x648b8000, 0x437b4000, 0xe7f7e000, 0x448d3000, 0x137a1800, 0x5ff6d400, 0xc088fa00, 0xd17a7f00,
+	0xeef25280, 0x630a65c0, 0x01bc52a0, 0x0fd165d0, 0xff7fd288, 0xe1f625d4, 0x978e328e, 0x11fc15f1,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xf8000000, 0x1c000000, 0x0a000000, 0xc1000000,
+	0xc6800000, 0xd8c00000, 0xbae00000, 0xd6b00000, 0xe8880000, 0xfd8c0000, 0x650e0000, 0x62cb0000,
+	0x61a98000, 0x865e4000, 0x1d76a000, 0x59eaf000, 0x677af800, 0x62a3cc00, 0xc7968a00, 0x3f5c1d00,
+	0x87f48880, 0x2b2ffcc0, 0x4c9a88a0, 0x8a94fcd0, 0xebdb0888, 0x7236bcc4, 0xf54ba8b6, 0x67eb4cc3,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x88000000, 0xec000000, 0xc2000000, 0xe9000000,
+	0xc2800000, 0x95400000, 0x7ea00000, 0x65f00000, 0x0f180000, 0xa41c0000, 0xcf9e0000, 0xb85f0000,
+	0x43bf8000, 0xd0ebc000, 0x5604a000, 0x3f06b000, 0xbd83f800, 0x08c4ec00, 0x6660c600, 0x8b977300,
+	0x688b3c80, 0x0e915440, 0x280d3ca0, 0x52d25450, 0x842cbca8, 0x2a669454, 0x19979c8a, 0x298be46f,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x38000000, 0xa4000000, 0xd6000000, 0x35000000,
+	0x37800000, 0x1f400000, 0xbd200000, 0x78100000, 0xeef80000, 0xf5fc0000, 0x337e0000, 0x5dbf0000,
+	0x42da8000, 0x2c6b4000, 0xd7c66000, 0x92e4d000, 0x2ef77800, 0x860fc400, 0xcef6be00, 0x560c9700,
+	0x66f57780, 0x7a0e3040, 0x2cf377a0, 0x3d0d3050, 0xf877f7a8, 0x20c9707c, 0x6d9317a6, 0xfabae055,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xf8000000, 0x74000000, 0xea000000, 0x03000000,
+	0xb6800000, 0xf2c00000, 0x8e600000, 0x84b00000, 0xb8c80000, 0x19cc0000, 0xe04a0000, 0x5a090000,
+	0xffa88000, 0xb8ff4000, 0xb4c4e000, 0x8367b000, 0x7331a800, 0x438f1c00, 0xb5ed0a00, 0x8558b900,
+	0xb7943c80, 0x9d5b2ac0, 0x33963ca0, 0xef5e2af0, 0x7494bcb8, 0x4bd86afc, 0xf150dc86, 0x993c9ae1,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xb8000000, 0x0c000000, 0x02000000, 0xa7000000,
+	0xed800000, 0x9fc00000, 0xe2600000, 0xf0100000, 0x60480000, 0x694c0000, 0xb1ce0000, 0xfc8f0000,
+	0xb0a98000, 0x871c4000, 0x5e242000, 0x48b03000, 0xc8bf0800, 0xe3556400, 0x71691a00, 0x387cc900,
+	0xc8b6a980, 0x88bbfbc0, 0xc350a9a0, 0xa168fbd0, 0x807f29a8, 0xc4b7bbe4, 0x8abc8986, 0x6454cbe7,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x28000000, 0xbc000000, 0x82000000, 0x7b000000,
+	0x89800000, 0xc3c00000, 0x0be00000, 0x07700000, 0xed380000, 0xf83c0000, 0x70be0000, 0x45fb0000,
+	0x225a8000, 0x800bc000, 0xad262000, 0x0c163000, 0x530fe800, 0xd8a2a400, 0xedd33a00, 0x13ed2500,
+	0x7e507e80, 0x7f2dc740, 0x62367ea0, 0x729ac750, 0x5e6afe88, 0x7b96075c, 0x89c85e82, 0xb1c0f773,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0x84000000, 0xba000000, 0xed000000,
+	0xe9800000, 0x6bc00000, 0x58200000, 0xfad00000, 0x7e180000, 0x379c0000, 0x6c5a0000, 0x7c7b0000,
+	0xf2ac8000, 0x5eb7c000, 0x002fe000, 0x3ff03000, 0xc54c5800, 0x86479400, 0x49e30a00, 0x6ff62b00,
+	0x9d4dcd80, 0x4a406540, 0x87e14da0, 0x50f7a570, 0x1dceada8, 0x7207954c, 0x5902f5b2, 0x1b80016d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x98000000, 0x1c000000, 0xca000000, 0xe7000000,
+	0x4d800000, 0xb8400000, 0xaca00000, 0xd0f00000, 0x40180000, 0xfd9c0000, 0xadda0000, 0x357f0000,
+	0xbb8f8000, 0x52934000, 0xd38fa000, 0xa693f000, 0x2d8bc800, 0x1f962400, 0xc908a600, 0xdb566300,
+	0xbd6d1480, 0xb5c5dc40, 0x74e294a0, 0xcc569c70, 0x18ed3488, 0x39856c74, 0x8646fcae, 0xb5a34873,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x78000000, 0xc4000000, 0x5a000000, 0xa3000000,
+	0xd8800000, 0xbf400000, 0xfde00000, 0x0c900000, 0x50e80000, 0x146c0000, 0xe52e0000, 0x39cb0000,
+	0x1adf8000, 0x0ff44000, 0x3e3e6000, 0xa8e2b000, 0xd114a800, 0xaa29ec00, 0xe74a5600, 0xa89ed900,
+	0x3b948d80, 0x4a6f62c0, 0xfc2b0da0, 0x724b22d0, 0x951d6d88, 0xf15592f4, 0x514fc596, 0x0d9b7ec5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0xa4000000, 0x3e000000, 0x59000000,
+	0x2e800000, 0x9bc00000, 0x0d200000, 0x2e900000, 0x89c80000, 0x394c0000, 0x4b8a0000, 0x802d0000,
+	0x99798000, 0x1f954000, 0xcb4c6000, 0x408f9000, 0x15ac5800, 0x7f3eac00, 0x58f23200, 0xa0bfbb00,
+	0x61b01f80, 0x445a69c0, 0x89019fa0, 0x968329f0, 0x4fc7ff98, 0x3b21b9d4, 0x4b9227be, 0x3d4a55fd,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x58000000, 0xb4000000, 0xfe000000, 0x55000000,
+	0xc2800000, 0x6dc00000, 0x67a00000, 0x1dd00000, 0xf8e80000, 0xf46c0000, 0xc4ae0000, 0x2d8b0000,
+	0x079b8000, 0x6bd14000, 0xa1e8e000, 0xcce91000, 0x4a6cb800, 0x31af2c00, 0xff0e0200, 0x325a5f00,
+	0xb870e180, 0x423e7ec0, 0x610361a0, 0x7c833ed0, 0x98c58188, 0xb5212ed4, 0x2812b99e, 0x2b4f42f9,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x68000000, 0xa4000000, 0x02000000, 0xcf000000,
+	0xd9800000, 0x92400000, 0x26e00000, 0x6bd00000, 0x55880000, 0x360c0000, 0xf74a0000, 0x56290000,
+	0x5ebe8000, 0xf555c000, 0x8a4ce000, 0x88aef000, 0x217d8800, 0xdbf7c400, 0xc47b9600, 0xc976c100,
+	0x1db9af80, 0x2ad3ebc0, 0x450f2fa0, 0x20ca2bf0, 0xcd69cfb8, 0x9cdddbcc, 0x7242c7a2, 0x16e3dfe5,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x68000000, 0xc4000000, 0x2a000000, 0x1f000000,
+	0x62800000, 0xc7c00000, 0xb0600000, 0xb8f00000, 0xdee80000, 0x126c0000, 0x40aa0000, 0xdd490000,
+	0x98f88000, 0x9db3c000, 0x6949e000, 0x7afab000, 0x16b74800, 0x79cadc00, 0x0e3c2200, 0x2a51c100,
+	0x33fdf680, 0x1d3269c0, 0x258d76a0, 0xda1da9f0, 0xda8696b8, 0x9bc219fc, 0x56635ea2, 0x79f205cd,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x38000000, 0xac000000, 0x12000000, 0x8d000000,
+	0x42800000, 0x90c00000, 0x84600000, 0x05d00000, 0x1de80000, 0x596c0000, 0x3aaa0000, 0x434b0000,
+	0x29da8000, 0x5a134000, 0xbe0a2000, 0x0af8b000, 0x85e3d800, 0x90954c00, 0x7acf8a00, 0x109a0900,
+	0x2f305780, 0x7af880c0, 0x5de2d7a0, 0x2c97c0f0, 0x60caf7a8, 0x099870fc, 0xd3b1afa6, 0x75397cd7,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x78000000, 0xcc000000, 0x2e000000, 0xd5000000,
+	0xbe800000, 0xd4c00000, 0x57600000, 0x8d500000, 0x6ad80000, 0x1e5c0000, 0xa59a0000, 0x8b7d0000,
+	0xff6d8000, 0xc9964000, 0x85bc2000, 0xbf0f5000, 0xf140f800, 0x38268c00, 0x28756a00, 0xb82d7100,
+	0xf8b28b80, 0x454fc540, 0xcae70ba0, 0xce158570, 0xf1f92b98, 0x61abd574, 0x31f65386, 0x916a1947,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xc8000000, 0x8c000000, 0x86000000, 0x8d000000,
+	0x11800000, 0x66400000, 0xb1e00000, 0x16d00000, 0x33680000, 0x63ec0000, 0xf22a0000, 0x988f0000,
+	0x763b8000, 0x71c5c000, 0x9aa5a000, 0x16b79000, 0xd3fef800, 0x2966f400, 0x0b118600, 0xdfcb6900,
+	0x005a6f80, 0xe4535cc0, 0x15abefa0, 0x4bc99cf0, 0xa25dcf88, 0x5357ccd4, 0x572c97ba, 0xf509a8f7,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x78000000, 0x84000000, 0x36000000, 0xb5000000,
+	0x2e800000, 0x15c00000, 0xdc200000, 0xdb700000, 0x2a480000, 0x05cc0000, 0xb08a0000, 0x28690000,
+	0x87bc8000, 0xae474000, 0xf7676000, 0xba90d000, 0x611e7800, 0x3ef68c00, 0x980fe200, 0x30ac2300,
+	0x911bc880, 0xe6f272c0, 0xcc0d48a0, 0xceac32f0, 0xd81ea8b8, 0x7a77a2dc, 0x5acdb0a6, 0x8908fefd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xc8000000, 0xfc000000, 0xde000000, 0x89000000,
+	0xa0800000, 0xccc00000, 0x58200000, 0x60b00000, 0xe3380000, 0x1ebc0000, 0x00fa0000, 0x9b1f0000,
+	0x8e0e8000, 0x8bc0c000, 0x49a32000, 0x98f3d000, 0x65da9800, 0xb92a1c00, 0x56f43a00, 0xd4d81b00,
+	0x8dae6e80, 0x88307f40, 0x13faeea0, 0x389fbf70, 0xd94f4e88, 0x10a0af7c, 0xa074f6ba, 0x0d1a6343,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x28000000, 0xe4000000, 0xc6000000, 0x3b000000,
+	0xcd800000, 0xbd400000, 0xab600000, 0xf7100000, 0x73780000, 0xe3fc0000, 0x783a0000, 0xab9b0000,
+	0xbeab8000, 0x7fa2c000, 0xc731e000, 0x2409d000, 0x92150800, 0x99f9e400, 0xb93e4e00, 0x671bb500,
+	0xef6afd80, 0x95065e40, 0xf2837da0, 0x86c39e70, 0x15231da8, 0x5df38e74, 0x1b2c75a2, 0xc6e17a4d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x58000000, 0x54000000, 0x32000000, 0x93000000,
+	0x77800000, 0x71c00000, 0x58a00000, 0x3b900000, 0xe0380000, 0x06bc0000, 0x0bfa0000, 0xa11f0000,
+	0x31ea8000, 0x79e04000, 0x8776e000, 0x29c97000, 0x4e34e800, 0x9928d400, 0xe1c69a00, 0x70a47f00,
+	0x97907380, 0x363b0a40, 0xffb8f3a0, 0xbb784a70, 0x955e9388, 0x8b8e7a5c, 0x6d561b9e, 0x2d1f9e49,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x28000000, 0xd4000000, 0xb6000000, 0xcd000000,
+	0xaa800000, 0x0fc00000, 0x5a600000, 0x61d00000, 0xdef80000, 0x977c0000, 0xa33a0000, 0xae190000,
+	0x396e8000, 0x47a7c000, 0xa8b56000, 0x6caed000, 0xaac7b800, 0x84e76c00, 0x48135200, 0x919ba100,
+	0xa02fdf80, 0x1006a040, 0x18035fa0, 0x9c046070, 0x9202bfb8, 0x5304704c, 0xb386e7b2, 0x13460c79,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x58000000, 0x54000000, 0xc6000000, 0x4f000000,
+	0x1f800000, 0x94400000, 0xfae00000, 0xe2d00000, 0xa4b80000, 0xe63c0000, 0xa4fe0000, 0x7ad90000,
+	0x192e8000, 0x69e44000, 0x6752e000, 0xa5fed000, 0x765fa800, 0x48ead400, 0x7243b600, 0xe5e54100,
+	0xb554a780, 0xccfe5a40, 0xd6dc27a0, 0x9b2f1a50, 0x48e64798, 0x3bd08a6c, 0xbc3b8f8e, 0x91f9ce79,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x48000000, 0x54000000, 0x5a000000, 0xaf000000,
+	0xe2800000, 0x6cc00000, 0xe7e00000, 0xa5900000, 0xd9780000, 0xcafc0000, 0x59ba0000, 0xbb190000,
+	0x75298000, 0x31e3c000, 0x8c956000, 0xfaf9b000, 0xa1bbc800, 0xd71a5c00, 0x23287a00, 0xd8e56500,
+	0xcf14d980, 0x81bbca40, 0x671f59a0, 0x1b2d0a70, 0xd4e1b9b8, 0x89127a74, 0x20bc91aa, 0x709b5661,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x78000000, 0x84000000, 0xf2000000, 0x79000000,
+	0x7d800000, 0x6bc00000, 0x8ce00000, 0xce900000, 0x83380000, 0xe1bc0000, 0xb4fe0000, 0xcb5d0000,
+	0x196a8000, 0x40e14000, 0xe0916000, 0x1c3cf000, 0x9f383800, 0x27be5400, 0x27fdca00, 0xbbda0d00,
+	0x85282980, 0x5ac3d840, 0x2d64a9a0, 0x43539850, 0x0cd949b8, 0xd7af286c, 0x578491a6, 0x46c1cc4d,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xf8000000, 0x3c000000, 0x8e000000, 0x1d000000,
+	0xac800000, 0x61c00000, 0x90e00000, 0xaf900000, 0x0ac80000, 0x314c0000, 0x330e0000, 0x4daf0000,
+	0xca9b8000, 0xf6644000, 0x2151a000, 0x85afd000, 0xde9a3800, 0x9c61dc00, 0x1e501200, 0x422bf500,
+	0x32d83980, 0x4fc7e7c0, 0x5de5b9a0, 0xdb10a7d0, 0xc70999a8, 0xd7a837f4, 0xbd9f8196, 0x65e17bfb,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xb8000000, 0x74000000, 0xbe000000, 0x97000000,
+	0xa3800000, 0xb5c00000, 0x50e00000, 0x65700000, 0x5cd80000, 0xaa5c0000, 0x691a0000, 0x3abd0000,
+	0xec6d8000, 0x76604000, 0xfe37e000, 0x6b7c1000, 0x7a8ba800, 0x10103400, 0xaf6b5a00, 0x5be0fd00,
+	0x94f6e680, 0x441a9840, 0xd83966a0, 0x412bd870, 0xeac10698, 0xef668874, 0x42b2ceb6, 0x413bec69,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x48000000, 0x74000000, 0x9e000000, 0x5b000000,
+	0x3f800000, 0xe3400000, 0xa1a00000, 0x52300000, 0xa6180000, 0xb55c0000, 0x1cfe0000, 0xdac90000,
+	0x92d28000, 0x348cc000, 0x63f16000, 0xc47c9000, 0xac0cc800, 0xf531f400, 0xd39f8e00, 0x031a1300,
+	0xe1da4a80, 0x683f8e40, 0x9c2b2aa0, 0xb7431e50, 0xefa7e298, 0xd132ea4c, 0xd5986c8a, 0xf418f951,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x68000000, 0x94000000, 0xb2000000, 0x49000000,
+	0x4a800000, 0x77400000, 0xeea00000, 0xd0f00000, 0x10680000, 0xb72c0000, 0x618e0000, 0x5d7b0000,
+	0xb3168000, 0x0339c000, 0x47336000, 0xdc8df000, 0xf5f93800, 0xf552ac00, 0xeb1a7600, 0xae84f300,
+	0x4d414c80, 0x23a263c0, 0xf0722ca0, 0xd22f93d0, 0x350b1488, 0x3d3d3ffc, 0xa0316292, 0xe909ccd9,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x28000000, 0xec000000, 0x6e000000, 0xff000000,
+	0x6f800000, 0x72c00000, 0xfd600000, 0x0ed00000, 0x83680000, 0x89ac0000, 0x00ca0000, 0x041f0000,
+	0x8a748000, 0xd559c000, 0xdbd4a000, 0x51e8d000, 0xa5eba800, 0x6fe91400, 0xc2ea2200, 0x646b1900,
+	0x4229c780, 0x200d48c0, 0x307d67a0, 0xd02598f0, 0xc976cf88, 0x4cdc8cec, 0x3214ed82, 0x310b95d7,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xd8000000, 0x2c000000, 0xbe000000, 0x41000000,
+	0xa2800000, 0xd0c00000, 0x71600000, 0xed900000, 0x76580000, 0x6a9c0000, 0xb5fe0000, 0x916f0000,
+	0xc1b48000, 0x31ee4000, 0x26712000, 0x070bd000, 0x83a55800, 0xdbf20c00, 0x044baa00, 0x7884f100,
+	0xcbc64580, 0x88e3bb40, 0xe4d765a0, 0x7e786b50, 0x572a3da8, 0xd216674c, 0x221f979e, 0x863d9647,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xd8000000, 0x84000000, 0xc6000000, 0xaf000000,
+	0x19800000, 0xe4400000, 0x29600000, 0x73b00000, 0x81280000, 0x096c0000, 0xfa0e0000, 0x44bf0000,
+	0x05128000, 0x86b84000, 0x2c126000, 0x103b5000, 0x61d4a800, 0x05182400, 0xbf076600, 0x31807d00,
+	0x9844c880, 0xdb6525c0, 0xc2b6a8a0, 0xb3ae75d0, 0x32aa00a8, 0x982a51fc, 0x07eb669e, 0x13c92cdd,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x68000000, 0x94000000, 0x3e000000, 0x63000000,
+	0x88800000, 0x66400000, 0xe4600000, 0xf0500000, 0xab980000, 0xe3dc0000, 0x6cba0000, 0x706f0000,
+	0xbbb58000, 0x230ac000, 0x9d646000, 0x7dd29000, 0x2a580800, 0x7b7c8c00, 0xbfccde00, 0x8e40ed00,
+	0xb067a780, 0x6e511740, 0x989bc7a0, 0x035f8770, 0x9ef9cf88, 0xaa0c0b64, 0x28e09192, 0x00162641,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xb8000000, 0x4c000000, 0xd6000000, 0x55000000,
+	0x8d800000, 0x82c00000, 0x3fa00000, 0x1c300000, 0x0d280000, 0x21ec0000, 0x274e0000, 0x70fd0000,
+	0x62168000, 0x05df4000, 0x26632000, 0xe7109000, 0x6058b800, 0x40a59400, 0x8ab3a200, 0x0b6a4f00,
+	0x0f085680, 0x271c0bc0, 0x49c376a0, 0x53209bd0, 0xe975ceb8, 0x43480fcc, 0x62f8ec96, 0x751100df,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x68000000, 0x24000000, 0x66000000, 0x51000000,
+	0x2b800000, 0x9ac00000, 0x07a00000, 0xaf300000, 0xa4b80000, 0xc07c0000, 0x1ada0000, 0x7c6f0000,
+	0x05148000, 0xd04bc000, 0xf0e0e000, 0xd354d000, 0xefaed800, 0x05364400, 0x77b97200, 0x7cff1f00,
+	0x8a9a7e80, 0xa28a7f40, 0x13429ea0, 0xba62af70, 0x6a164688, 0x86cbeb6c, 0xd3a3b492, 0x61333465,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x48000000, 0xb4000000, 0x46000000, 0xdb000000,
+	0xc8800000, 0x43c00000, 0x77200000, 0x28900000, 0xd5f80000, 0xc43c0000, 0x9e1e0000, 0xcd0f0000,
+	0xd7b08000, 0x296ec000, 0x87c56000, 0x39205000, 0x67920800, 0xab788c00, 0x14fef200, 0x95ba9b00,
+	0xe05b9780, 0xae681440, 0x0d46f7a0, 0x8fe44450, 0x4732ffa8, 0x06afc86c, 0x9ae28dba, 0x80b49341,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x48000000, 0xb4000000, 0x22000000, 0xdb000000,
+	0x54800000, 0xd1400000, 0xb9600000, 0x64500000, 0x5aa80000, 0xd0ec0000, 0x7d0e0000, 0x28190000,
+	0x7bd48000, 0x876ac000, 0x14c96000, 0xce3d7000, 0x13e12800, 0xe8104c00, 0x564b2600, 0xa6795d00,
+	0xc5023780, 0xb985dec0, 0x2cc557a0, 0x1fa1aed0, 0xa4f0ff98, 0xc0db22fc, 0xae72b98a, 0x1c9f0fd1,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xa8000000, 0xac000000, 0x4a000000, 0x21000000,
+	0x91800000, 0x59c00000, 0x08e00000, 0xb5300000, 0xdbe80000, 0xcb2c0000, 0x5e4e0000, 0x68b90000,
+	0x42b28000, 0xa92bc000, 0x9348a000, 0x533ff000, 0x4a727800, 0x984c3400, 0xd3b8da00, 0xca32ad00,
+	0x156cdc80, 0x8c6f47c0, 0x29ea7ca0, 0xde29b7d0, 0x61ca8498, 0x867e43cc, 0x18d2feb2, 0x595f1ee7,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xf8000000, 0xd4000000, 0x4a000000, 0x0f000000,
+	0x4a800000, 0xed400000, 0x44e00000, 0xd7500000, 0xaa780000, 0xe03c0000, 0x025a0000, 0xc6490000,
+	0xbdd78000, 0x373c4000, 0xecd8e000, 0x290fb000, 0x0a324800, 0xcced5c00, 0x3ae15600, 0x82568100,
+	0x77f99380, 0x43f8ac40, 0x19fb73a0, 0x8efe1c70, 0xc07ebbb8, 0x9f3f0044, 0x00df0d86, 0xd70a3171,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x98000000, 0xb4000000, 0xa2000000, 0xdf000000,
+	0x60800000, 0x6dc00000, 0xffe00000, 0xf2700000, 0x18a80000, 0x026c0000, 0x010a0000, 0x60bb0000,
+	0x86f18000, 0x47694000, 0x9a8ee000, 0x77fcf000, 0x2fd18800, 0x1078cc00, 0x7690c200, 0x505c8d00,
+	0x6c017680, 0xf6010fc0, 0x0d0596a0, 0x7786fff0, 0x21459ea8, 0x842773e4, 0x7093bc8e, 0x555b0ec9,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x58000000, 0xfc000000, 0x46000000, 0x3d000000,
+	0x7f800000, 0x8cc00000, 0x39600000, 0xbaf00000, 0x68f80000, 0x953c0000, 0x8dde0000, 0x9ae90000,
+	0xc2f08000, 0x04fe4000, 0x5b3fa000, 0x24d89000, 0x076ff800, 0xc9374400, 0x391a0200, 0x2f881900,
+	0x86031680, 0x9d00c540, 0xaf82b6a0, 0xe4c15550, 0x9d65ce98, 0x00f4515c, 0x13fe6c8e, 0xd7bdd863,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x68000000, 0xc4000000, 0x5e000000, 0xb9000000,
+	0x77800000, 0x37400000, 0xbfa00000, 0xe3300000, 0x3fe80000, 0x7dac0000, 0x5f8e0000, 0x34fb0000,
+	0x46378000, 0x6a68c000, 0xa1e8e000, 0x24ad1000, 0x18095800, 0xfbbd2400, 0x5591fe00, 0x135cd300,
+	0x7902f280, 0x978679c0, 0x074412a0, 0x47a069d0, 0x4f32ca88, 0xa5e98df4, 0x9aadd492, 0x910f4ec5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0x94000000, 0xfe000000, 0xdf000000,
+	0x19800000, 0x59400000, 0x3c600000, 0xefd00000, 0xd6c80000, 0x7c8c0000, 0xdb6a0000, 0x08fd0000,
+	0x22d48000, 0x724ec000, 0x69486000, 0xb6ce9000, 0x8c8ee800, 0xf369e400, 0xacf9ce00, 0x14d37d00,
+	0x39490b80, 0x8ecb89c0, 0x308b6ba0, 0xa96819f0, 0x45f90398, 0x46533dfc, 0x878aadaa, 0x34efd0d9,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xf8000000, 0x94000000, 0xe2000000, 0x1f000000,
+	0xc1800000, 0xd0400000, 0x9b600000, 0x60700000, 0xacf80000, 0x41bc0000, 0xa45e0000, 0xa5e90000,
+	0x2a358000, 0xfc9e4000, 0xe24ce000, 0x57e6f000, 0x46b18800, 0xaa5ec400, 0x8ce82600, 0xf6b1cd00,
+	0x6259e680, 0x90ec5540, 0xe8b306a0, 0xf35fa550, 0x38690e98, 0x04762174, 0x66f848a6, 0xd2bf5c51,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xb8000000, 0xec000000, 0xee000000, 0xdd000000,
+	0x24800000, 0x2e400000, 0xfae00000, 0xb4500000, 0x50180000, 0x955c0000, 0x0a3a0000, 0x52ab0000,
+	0xcf178000, 0x8a7e4000, 0x954b2000, 0xefc35000, 0xdc243800, 0xaef25c00, 0x53a88e00, 0xed97c900,
+	0x0d3c3380, 0xd92d1f40, 0xfed513a0, 0x63594f70, 0x6b3caba8, 0x002e5354, 0x40508586, 0x02188a6f,
+	0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x38000000, 0x84000000, 0x6a000000, 0xb3000000,
+	0x21800000, 0x2e400000, 0xc0a00000, 0x70f00000, 0x91980000, 0x4edc0000, 0xc0fe0000, 0xa1cf0000,
+	0xefb18000, 0x3fbc4000, 0xffee6000, 0xb6863000, 0xf5c02800, 0x45e46400, 0xc5d1f600, 0x9d2e0300,
+	0x28e68c80, 0xb554b440, 0x6deeeca0, 0xe1818450, 0x4e4144a8, 0x30a6a064, 0x98f752a6, 0x2d9ed345,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xf8000000, 0x94000000, 0x2e000000, 0xd7000000,
+	0x86800000, 0x59400000, 0x19e00000, 0x28500000, 0x83d80000, 0xd79c0000, 0xe1fa0000, 0xa96b0000,
+	0x30968000, 0xcdfd4000, 0xf36be000, 0x59959000, 0xd47ba800, 0x40afdc00, 0xa3317600, 0x1ccce900,
+	0xbaa22380, 0x28b4d140, 0x6a0bc3a0, 0xc3864170, 0x1ac4eba8, 0xc323dd5c, 0xcb72fd96, 0xf8ace479,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x98000000, 0x6c000000, 0xd6000000, 0x37000000,
+	0x2d800000, 0x11c00000, 0xd3e00000, 0x71700000, 0x02c80000, 0x1e8c0000, 0xacaa0000, 0x26390000,
+	0x71878000, 0x4fc74000, 0x70e22000, 0x36f79000, 0x6a08a800, 0xbbe90400, 0x379cea00, 0xd1d7c500,
+	0xe01f7680, 0x8110ccc0, 0x997ad6a0, 0x84201cf0, 0xad905eb8, 0x823e88c4, 0x93841c9e, 0xa2c049df,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x18000000, 0x4c000000, 0x46000000, 0xf7000000,
+	0x18800000, 0x84400000, 0xbe600000, 0xcf500000, 0xc0380000, 0xa4fc0000, 0x62de0000, 0x2ded0000,
+	0x69828000, 0x4bc64000, 0xb2a62000, 0x1d771000, 0xe50f2800, 0xa1932c00, 0xb71b6e00, 0x0449ad00,
+	0xba76ef80, 0x35886a40, 0xe1d24fa0, 0xeb793a50, 0x2e1b47b8, 0x9fcd066c, 0xbcb701be, 0x56ab877f,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xb8000000, 0x64000000, 0xd6000000, 0x8b000000,
+	0xf1800000, 0x7dc00000, 0x9fa00000, 0x0f300000, 0xf6380000, 0x4e7c0000, 0x121e0000, 0x45890000,
+	0x37028000, 0x73834000, 0x78c26000, 0xf123d000, 0xed740800, 0xfb5e4400, 0xf96a8a00, 0x1dd2c700,
+	0x93ede680, 0x19905b40, 0x4d8d06a0, 0x4b00cb50, 0x51836e98, 0xedc15f4c, 0x57a3ecb6, 0xd334dc55,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x18000000, 0x3c000000, 0x16000000, 0xc5000000,
+	0x43800000, 0xd1c00000, 0x7b200000, 0x11300000, 0xacb80000, 0xb0fc0000, 0x231a0000, 0x7c890000,
+	0x05c78000, 0x39234000, 0x5634a000, 0xc83f1000, 0xd5bbb800, 0x257f6400, 0x57db0a00, 0x942ee300,
+	0xdd308280, 0xd2ba1b40, 0xe1fba2a0, 0x829a4b70, 0x5a4ebab8, 0xd2633f44, 0x695188be, 0xd6edf84b,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xc8000000, 0xbc000000, 0xbe000000, 0x15000000,
+	0x38800000, 0x4cc00000, 0x7d200000, 0xbf900000, 0x09380000, 0x1b7c0000, 0xbb9a0000, 0x2baf0000,
+	0xf6c68000, 0xc224c000, 0x00172000, 0x2e7fd000, 0x731af800, 0x0f6b7c00, 0x07e1fa00, 0x0bb26300,
+	0xa02f7780, 0xb3821a40, 0x9146d7a0, 0x61650a70, 0x02710f88, 0xbd8ea67c, 0x04d48dba, 0x2f5f7953,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x98000000, 0x4c000000, 0xc6000000, 0xd5000000,
+	0xb5800000, 0x70400000, 0x5be00000, 0xb2300000, 0x4ec80000, 0x790c0000, 0xddae0000, 0x6afd0000,
+	0x5ac18000, 0xad214000, 0x09112000, 0x6adc1000, 0x7a523800, 0x89bd5400, 0x21a1b600, 0xbad4d900,
+	0xfc7ea080, 0x62045ac0, 0x170600a0, 0x12850ad0, 0x0ac318b8, 0x15254ef4, 0xb517169e, 0xa4dc83e7,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x28000000, 0xc4000000, 0x7e000000, 0x3d000000,
+	0x4e800000, 0xd6400000, 0x3e200000, 0xaf100000, 0xda580000, 0xf79c0000, 0x257e0000, 0xc40d0000,
+	0xce618000, 0x9034c000, 0xc9c8e000, 0xec841000, 0xc9477800, 0x2fa54c00, 0x08d25e00, 0xd3bd9f00,
+	0x796a6f80, 0xb5d11940, 0xdd3d0fa0, 0xcf2cc950, 0x1bf317b8, 0x5a295574, 0xd176d1b2, 0x92699645,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x08000000, 0xa4000000, 0xda000000, 0x77000000,
+	0xf9800000, 0xeac00000, 0x6c600000, 0xe5b00000, 0xfab80000, 0xc6fc0000, 0x75de0000, 0xd8cf0000,
+	0x9ea38000, 0x65d7c000, 0x4108e000, 0x01433000, 0x35a20800, 0x1a568400, 0x1ac97200, 0x05a40100,
+	0xc253f480, 0x96cb1d40, 0xeba694a0, 0x6750ed50, 0xbc4ffca8, 0x22e29974, 0x96f466aa, 0xcc1f2c5d,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x68000000, 0x84000000, 0xda000000, 0x7b000000,
+	0x90800000, 0x00c00000, 0x9ee00000, 0xad500000, 0x85480000, 0xba0c0000, 0xe6aa0000, 0x1adb0000,
+	0x9ea38000, 0x9b74c000, 0x12fee000, 0x58153000, 0xcaec6800, 0x52f8ac00, 0xb8130a00, 0xfaefed00,
+	0x2afcbf80, 0x5412a1c0, 0xa4ebdfa0, 0x8bf851f0, 0xbf92d7a8, 0x34ad0df4, 0x15d955b2, 0x8c247cd5,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x48000000, 0xe4000000, 0xa6000000, 0xdd000000,
+	0x2f800000, 0x0ac00000, 0x94a00000, 0x1c900000, 0xdee80000, 0xbaac0000, 0xc14a0000, 0xfcbb0000,
+	0x4ee68000, 0x8670c000, 0x7699e000, 0xd531d000, 0x2df8b800, 0x4e808400, 0x5f417200, 0x69602700,
+	0x88b7cb80, 0xd43d90c0, 0xeca2aba0, 0x709780f0, 0xbced73a8, 0x71aa14dc, 0x7bcf59ba, 0x3dfc67e5,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x58000000, 0xc4000000, 0x42000000, 0xdb000000,
+	0x72800000, 0x48400000, 0x55a00000, 0xd1f00000, 0x8c780000, 0xafbc0000, 0x5bde0000, 0x05490000,
+	0x75208000, 0x8ab64000, 0xe75a6000, 0xd80b7000, 0x87062800, 0x54847c00, 0x01439e00, 0x9426e300,
+	0x77311480, 0x179e3340, 0xb2edf4a0, 0xafd60350, 0x1c4f3c98, 0x9ca64f5c, 0x50706a8e, 0xcab9e06d,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x98000000, 0xac000000, 0x86000000, 0xc1000000,
+	0x14800000, 0xc0c00000, 0x32e00000, 0x05100000, 0x79980000, 0x8adc0000, 0x7d7a0000, 0x16cb0000,
+	0x9c628000, 0xead24000, 0x8af92000, 0x41881000, 0x29c19800, 0xd260fc00, 0xcfd41a00, 0x3c7c7d00,
+	0xc24abd80, 0x7ca72540, 0xe8331da0, 0x17ea7570, 0x941325a8, 0x251bd97c, 0x6e1d078e, 0xcd9d0857,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x28000000, 0x74000000, 0x66000000, 0xaf000000,
+	0x94800000, 0x86c00000, 0x00200000, 0x8c500000, 0xc9380000, 0x5a7c0000, 0x631e0000, 0x53290000,
+	0xfba48000, 0x3e11c000, 0x1fd86000, 0x4e085000, 0x7a72a800, 0xd26c4c00, 0x0bc05a00, 0x35a32b00,
+	0xa5111180, 0x0d5b0c40, 0xd7cbf1a0, 0xc6d79c50, 0xacfbb998, 0xa4db407c, 0x4c8dab92, 0x9bb1b761,
+	0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xa8000000, 0x84000000, 0xea000000, 0xb7000000,
+	0xff800000, 0x7a400000, 0xa0600000, 0xcd100000, 0xbad80000, 0xa61c0000, 0xfeba0000, 0xb10d0000,
+	0xbb628000, 0x9c93c000, 0x7d99e000, 0xbefdb000, 0x1e698800, 0x55f43400, 0x9a084600, 0xa2e55500,
+	0x2fd7a580, 0x277c5f40, 0x6d2ec5a0, 0xef132f70, 0xb9de2d98, 0xfb986b4c, 0x47fe83b2, 0xacea7a6d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x48000000, 0x0c000000, 0xfa000000, 0x93000000,
+	0xb3800000, 0x89400000, 0x2e200000, 0xbe900000, 0x4b280000, 0x74ec0000, 0x990a0000, 0x087d0000,
+	0xb5278000, 0x2111c000, 0x886fa000, 0xd1cb7000, 0xd01b6800, 0x3c13b400, 0x86e91e00, 0x260fff00,
+	0xf1fff380, 0xb76266c0, 0xf8b5d3a0, 0x49b9d6f0, 0xddc49b98, 0x3ae1d2e4, 0xd4f4cd8a, 0x5d1a29e7,
+	0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x98000000, 0x14000000, 0x82000000, 0x61000000,
+	0xf1800000, 0x5e400000, 0xbe600000, 0x5b100000, 0x5d980000, 0x7d5c0000, 0x8bfa0000, 0x6a4f0000,
+	0xe0648000, 0x84144000, 0x631ae000, 0x559ff000, 0xe1597800, 0x55ff3400, 0x754ee600, 0x7ee3c500,
+	0xdcd6b580, 0x91b9c540, 0x7e2ad5a0, 0xf6717570, 0xce0fcd88, 0x3b06f16c, 0xe48433ae, 0xfdc2b069,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x58000000, 0x54000000, 0x52000000, 0x71000000,
+	0x8a800000, 0x20c00000, 0xb8600000, 0x41300000, 0x49f80000, 0x1cbc0000, 0xc19e0000, 0x558b0000,
+	0x24638000, 0x5f354000, 0x9efde000, 0xa53e7000, 0x42df7800, 0x13acec00, 0xaff7ca00, 0x9e9e5900,
+	0x000b7880, 0x1120f340, 0x721318a0, 0xe2ecc350, 0xc8d40088, 0x678c1f54, 0xa564d29e, 0x3db29a41,
+	0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x78000000, 0x44000000, 0xca000000, 0x45000000,
+	0xdd800000, 0xd8400000, 0x66200000, 0x58d00000, 0xa3780000, 0x555c0000, 0xb58a0000, 0x32f10000,
+	0xbdad8000, 0x35244000, 0x9e576000, 0x31bcb000, 0x27bad800, 0x3cbb5400, 0x76392600, 0x62fccf00,
+	0xb31f5d80, 0x54aa6040, 0xdea585a0, 0xed113470, 0x151ca3b8, 0x47adfb74, 0xb823fe26, 0x0fd79b25,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x18000000, 0xdc000000, 0xbe000000, 0x63000000,
+	0x25800000, 0x30c00000, 0xf1200000, 0xf5b00000, 0xb6f80000, 0xafdc0000, 0xbe6e0000, 0x3a950000,
+	0x60488000, 0x5ca64000, 0x1175a000, 0x6dd8d000, 0x736d8800, 0x34110400, 0x810c5200, 0xe7445300,
+	0x14e1fa80, 0xd6119f40, 0x1c0c72a0, 0xc1c09b50, 0x31a020b8, 0x0ff4c85c, 0xc499da3e, 0x3c89572b,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x98000000, 0x5c000000, 0xba000000, 0xd5000000,
+	0x78800000, 0x89c00000, 0xa3600000, 0x24900000, 0xf1880000, 0x6eec0000, 0x207a0000, 0x8cf30000,
+	0x6e9e8000, 0xb9204000, 0xa5b1a000, 0xf83af000, 0x94d41800, 0x0daa7c00, 0xdbdec200, 0xb584c100,
+	0x6d451980, 0xb0a217c0, 0x62f101a0, 0x35986bf0, 0x4aa7c3a8, 0x57f0aafc, 0x5d18da0e, 0x6b61bd2b,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xb8000000, 0x3c000000, 0x6a000000, 0xf9000000,
+	0xe9800000, 0x81c00000, 0x0be00000, 0x2e500000, 0x0cc80000, 0xed2c0000, 0xfa7a0000, 0x3f330000,
+	0xe3da8000, 0xaa454000, 0x8727a000, 0x02367000, 0xbc58f800, 0x28821400, 0x94436a00, 0xc0214d00,
+	0x6cb76b80, 0x731bc7c0, 0x5c2793a0, 0x76b5d3f0, 0x121ef9a8, 0x39a79edc, 0x25731206, 0xdcf91913,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xe8000000, 0x94000000, 0x56000000, 0xcb000000,
+	0x74800000, 0xdb400000, 0x09a00000, 0x78d00000, 0x55480000, 0x5aec0000, 0xb13e0000, 0xccf70000,
+	0x7f5c8000, 0xb2c5c000, 0x2d666000, 0xfeb05000, 0x0f7fc800, 0x96d40c00, 0x524d8600, 0x246a8300,
+	0x937a8980, 0xc4d2c5c0, 0xf74d41a0, 0x17eac9d0, 0x16bec7a8, 0x1f374aec, 0x6fb8ce12, 0x5eb04f09,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xd8000000, 0x9c000000, 0x56000000, 0xa1000000,
+	0x7f800000, 0x03c00000, 0xb6e00000, 0x34100000, 0x0f780000, 0x279c0000, 0x668a0000, 0x54750000,
+	0x732c8000, 0x6fc04000, 0x18e1a000, 0x59179000, 0x4efed800, 0xc15e8400, 0x65e80a00, 0x94a1e500,
+	0x14358180, 0x000bd040, 0xc43359a0, 0xa8095470, 0x60315398, 0xd20db15c, 0x4f30522e, 0x908a213b,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x18000000, 0xd4000000, 0xa2000000, 0x43000000,
+	0xbb800000, 0xcdc00000, 0xede00000, 0xbf500000, 0x0c580000, 0xa7bc0000, 0xa1ee0000, 0x61310000,
+	0xa2c88000, 0x78064000, 0x2401e000, 0x5a047000, 0x27042800, 0x01821400, 0x5ac70a00, 0xf461cd00,
+	0x3196e380, 0x5a3f2b40, 0xd52acba0, 0x40513f50, 0x79dbc198, 0x0f7df27c, 0xbe8ba21e, 0x27259909,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x78000000, 0x94000000, 0xba000000, 0xe9000000,
+	0x7b800000, 0x7d400000, 0xa5200000, 0xccb00000, 0xa9080000, 0xba2c0000, 0xc19e0000, 0x08170000,
+	0xa1fb8000, 0x95864000, 0x4e45e000, 0x07a3b000, 0xa276b800, 0x9d6a8400, 0xfdbfde00, 0xf726cf00,
+	0x89b4ee80, 0xdc8c58c0, 0x846a56a0, 0x8e3adcd0, 0x566388a8, 0x6a9713d4, 0xaf3ae636, 0x91e60b31,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x38000000, 0x2c000000, 0x0a000000, 0x69000000,
+	0x45800000, 0xf5c00000, 0x9ae00000, 0x21300000, 0x79480000, 0xcdac0000, 0x3b9a0000, 0x58510000,
+	0x0ebe8000, 0x62854000, 0x17452000, 0x4da3f000, 0x0c91f800, 0x05d8f400, 0xf073aa00, 0xe7ef0500,
+	0xb5be3880, 0xd205b8c0, 0xf507c0a0, 0x17814cf0, 0xc0c66ab8, 0xed6349ec, 0x91f4d236, 0xac2eb127,
+	0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x98000000, 0xc4000000, 0xd6000000, 0xe3000000,
+	0xb4800000, 0x19400000, 0x2c600000, 0xa5900000, 0xe6b80000, 0x49dc0000, 0x88ce0000, 0x7f330000,
+	0x768e8000, 0xd1d44000, 0xb9596000, 0x078d5000, 0x10500800, 0x579fcc00, 0xb62cd600, 0x18e1fd00,
+	0xfcd67d80, 0x6adace40, 0xdc4875a0, 0xf6760250, 0xf2ea2388, 0x2843bf5c, 0x4de53e2e, 0x7b54212d,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xc8000000, 0xa4000000, 0xca000000, 0x79000000,
+	0x68800000, 0x49400000, 0xf2200000, 0x8d300000, 0xada80000, 0x2e8c0000, 0xcf3e0000, 0x51d10000,
+	0x6c7f8000, 0x2af7c000, 0xf1cbe000, 0xf21e3000, 0x8b643800, 0xa7159c00, 0xac9a6600, 0xbd200f00,
+	0x9ab31a80, 0x2b69a1c0, 0xd66922a0, 0x84ed3dd0, 0xccacc498, 0x6a0af2c4, 0x087c3e2a, 0x40f1632d,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x38000000, 0x04000000, 0x12000000, 0x0d000000,
+	0xe7800000, 0xfec00000, 0x7c600000, 0xc5700000, 0x03580000, 0xba3c0000, 0xe4ce0000, 0x6f550000,
+	0xc60a8000, 0x35354000, 0x44786000, 0xa8ee7000, 0xcd055800, 0xc7870400, 0xeec00200, 0x3461f900,
+	0xf973b680, 0x155a5e40, 0xa538eea0, 0x0e485a50, 0x76126cb8, 0x44ace34c, 0x8c21ba36, 0x8254cd0d,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x28000000, 0x8c000000, 0xfe000000, 0x61000000,
+	0x82800000, 0xc5400000, 0x64e00000, 0x32700000, 0xc3880000, 0x6a6c0000, 0x549a0000, 0xbb570000,
+	0x0b5e8000, 0x7ef5c000, 0x8fcea000, 0xa00bd000, 0xedaf1800, 0x553eac00, 0x5dc7d600, 0xd2a12900,
+	0x5b123680, 0x4f3fecc0, 0x2ec72ea0, 0xdf2640f0, 0xe5d67888, 0xc81ea9dc, 0xcf10ee02, 0xd53d953f,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x58000000, 0x34000000, 0x5a000000, 0x5b000000,
+	0xd0800000, 0x19400000, 0xf6a00000, 0xe3d00000, 0x41d80000, 0xb07c0000, 0xa52e0000, 0x70b10000,
+	0x83ef8000, 0x55d34000, 0x34dbe000, 0x81fab000, 0x67ed2800, 0x17d54c00, 0xbbdab600, 0x5b786b00,
+	0x7dad5980, 0x05f49140, 0x1b4e71a0, 0xb700dd50, 0xfe834798, 0xf847f644, 0x2d23fe0e, 0x7214d709,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x28000000, 0xfc000000, 0x72000000, 0x31000000,
+	0x65800000, 0x27400000, 0x0e600000, 0x57100000, 0xfda80000, 0x40cc0000, 0x2b5e0000, 0x08350000,
+	0x63da8000, 0x08f5c000, 0x33ff2000, 0xb8023000, 0xe4047800, 0xc6037400, 0xcf07fe00, 0x0e80b500,
+	0x8fc59980, 0x3ea59ac0, 0x4f37e1a0, 0xc15feed0, 0xcd349fb8, 0x985f9bcc, 0x34b4a632, 0xbd1df133,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x18000000, 0xac000000, 0x1e000000, 0x9b000000,
+	0x3f800000, 0x7a400000, 0x91a00000, 0xe7500000, 0x98180000, 0x84bc0000, 0x136a0000, 0x8cb70000,
+	0x2ee98000, 0x5bf34000, 0x5fc92000, 0x03645000, 0x1d35c800, 0xe7a81400, 0xb1d51600, 0x38d89300,
+	0x3bd8dd80, 0x685efb40, 0xac1f15a0, 0xf6bdef70, 0x36698388, 0x78313c64, 0x7329fe0e, 0x1c14d70f,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xe8000000, 0x74000000, 0x8a000000, 0xd7000000,
+	0xcf800000, 0x5bc00000, 0x2e600000, 0x76d00000, 0xbdd80000, 0x9abc0000, 0xaeee0000, 0x28710000,
+	0xe4ee8000, 0x5f77c000, 0xbb6d6000, 0x9cb3b000, 0x0908c800, 0x1460d400, 0xe9d03a00, 0x9659c100,
+	0xd37a8380, 0xcb8c4740, 0x6f244ba0, 0x5ff19350, 0xf32cf198, 0xf712924c, 0x7cbb9222, 0x2feba511,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x58000000, 0x84000000, 0xb2000000, 0x95000000,
+	0xd8800000, 0xb0400000, 0xb3a00000, 0x63d00000, 0x0fc80000, 0xf76c0000, 0xf73e0000, 0x13370000,
+	0x283a8000, 0xaab64000, 0x8afd6000, 0x88567000, 0x680e9800, 0x45083c00, 0x498c4e00, 0x03ce8b00,
+	0xc96d0980, 0x1c39e9c0, 0x00b591a0, 0xbbfad5d0, 0xd2d55fa8, 0x15491edc, 0xaa29b63e, 0x281bc73d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x68000000, 0x94000000, 0x26000000, 0x77000000,
+	0x02800000, 0x91400000, 0xfea00000, 0x66100000, 0x41980000, 0x8dbc0000, 0xc2ea0000, 0x21d70000,
+	0x687b8000, 0xd20ac000, 0x9fe56000, 0x80b5d000, 0x6b8ba800, 0x06255c00, 0xe256c600, 0x24bbfb00,
+	0x8b6e4780, 0xa0142540, 0x469e6fa0, 0x573bb970, 0xbfadc988, 0x05759274, 0xcb682612, 0xc014eb11,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x28000000, 0xc4000000, 0xce000000, 0xf5000000,
+	0x6b800000, 0x80c00000, 0x10a00000, 0x7d700000, 0x3c680000, 0x1f4c0000, 0xfefa0000, 0xc0350000,
+	0xa50f8000, 0xdb1cc000, 0x1023e000, 0x8b301000, 0xe38e7800, 0xec594400, 0x72459200, 0x31e68f00,
+	0x36173080, 0x1f39b9c0, 0x9d16c8a0, 0x89bc3df0, 0x8250ba98, 0x2fdaa2c4, 0xf681f212, 0x0f465f35,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x08000000, 0x0c000000, 0x32000000, 0xc5000000,
+	0x7e800000, 0x60c00000, 0xd2600000, 0x8db00000, 0x06e80000, 0x060c0000, 0x897a0000, 0xb0f30000,
+	0xd9cb8000, 0x0c99c000, 0xa106a000, 0x3086b000, 0x2fc25800, 0xfde08c00, 0xa5f6fa00, 0x4f4f9100,
+	0xd05a4080, 0xd96515c0, 0x7c3398a0, 0x69ac59f0, 0x6c2bc2a8, 0x456978d4, 0x6c49da2a, 0xbddfe117,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xa8000000, 0x24000000, 0x92000000, 0xc9000000,
+	0xca800000, 0xf9c00000, 0x36a00000, 0xf2500000, 0xbce80000, 0x4ccc0000, 0x315a0000, 0x40170000,
+	0x0d0c8000, 0x1bfbc000, 0xfc41e000, 0x96e3f000, 0x4ab17800, 0x815e4c00, 0x8817b200, 0x790b9f00,
+	0xd1fa3180, 0xb9465cc0, 0xea67c9a0, 0xe873d0f0, 0xb4799b88, 0x4907bfcc, 0x0a80d222, 0x59c4af05,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xf8000000, 0xdc000000, 0x32000000, 0x53000000,
+	0xd2800000, 0x62c00000, 0xe1e00000, 0x85100000, 0xf3a80000, 0x44cc0000, 0x7d1e0000, 0x86550000,
+	0xf2098000, 0xdaf84000, 0x2647a000, 0x7e21b000, 0xb7766800, 0x85fadc00, 0x1ec23a00, 0xe3e7fd00,
+	0x5e103980, 0x152836c0, 0x300fd1a0, 0x21faaad0, 0xb0c24bb8, 0xe2e0e7d4, 0xcf921a06, 0x5d6b0d23,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xb8000000, 0x54000000, 0xf2000000, 0xb7000000,
+	0x3e800000, 0x56c00000, 0x11e00000, 0xe6500000, 0x86e80000, 0xbb8c0000, 0xec1e0000, 0x9d950000,
+	0xd2898000, 0xe39a4000, 0xc0d1e000, 0xb429f000, 0x906f0800, 0x41489c00, 0x3bfc9a00, 0x2ec37d00,
+	0x65e36380, 0x645326c0, 0x99edeba0, 0x690dfad0, 0x1cde91b8, 0xc97277d4, 0xbd5b7a16, 0x0d338d01,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x88000000, 0xb4000000, 0x22000000, 0xdf000000,
+	0x85800000, 0xc6c00000, 0xe2e00000, 0x51d00000, 0x04d80000, 0x51bc0000, 0x01aa0000, 0x0e110000,
+	0xe6bc8000, 0xc02ac000, 0x02d26000, 0x5f5df000, 0xbe7cc800, 0xabcc0400, 0x4b840200, 0xf7c53d00,
+	0xc6628780, 0x6b970b40, 0xd07acfa0, 0xcacdcf70, 0xd706adb8, 0xf184027c, 0x84c4621a, 0x0de5cd11,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0xec000000, 0x0a000000, 0x85000000,
+	0x07800000, 0xb2c00000, 0xbbe00000, 0x09900000, 0x5a380000, 0x345c0000, 0xde0e0000, 0x76570000,
+	0x6a5c8000, 0x550ec000, 0xc2d2a000, 0x28187000, 0xbaa99800, 0x23e18400, 0xfd91a200, 0xe439c500,
+	0x2f5bbd80, 0x328e7640, 0xa016a5a0, 0xebfd3250, 0xd73ba7a8, 0x9fdb876c, 0x46cd020a, 0xb8b6b517,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xd8000000, 0x34000000, 0xee000000, 0x4d000000,
+	0x79800000, 0xf8c00000, 0xe7600000, 0xe8700000, 0x92b80000, 0x665c0000, 0x5dee0000, 0xd0b70000,
+	0x15db8000, 0xbe2b4000, 0x0751e000, 0x5aeb1000, 0x92313800, 0xcd9a9400, 0x260c0200, 0x65836100,
+	0x8ac76680, 0x98656940, 0xcef5dea0, 0x5cf8bd50, 0x977e3ca8, 0x70bbcc54, 0x815de21e, 0x6f687119,
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0xc4000000, 0x56000000, 0xa5000000,
+	0x18800000, 0x98400000, 0x9e200000, 0x47500000, 0x0fc80000, 0xa36c0000, 0xab7a0000, 0xa1130000,
+	0xc8ed8000, 0x4eb84000, 0x9ff16000, 0xd9dc5000, 0x60063800, 0xb0041c00, 0x8801ce00, 0x6c06e700,
+	0x6a025180, 0x370579c0, 0xeb81e9a0, 0x25c525f0, 0x1ee347a8, 0x413092e4, 0xd6b8ae16, 0xebf6b715,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x58000000, 0xfc000000, 0x2a000000, 0xfd000000,
+	0x72800000, 0x92400000, 0xc0e00000, 0xe8700000, 0x81680000, 0x4d0c0000, 0x343e0000, 0x44310000,
+	0xa28b8000, 0x44ff4000, 0xae95a000, 0xa6197000, 0x5fe4d800, 0x63f36c00, 0x87aace00, 0x40ad3100,
+	0x372fae80, 0x1befd3c0, 0xeb48f6a0, 0x9adfffd0, 0x57419898, 0xde66bee4, 0xe8376e0e, 0x9088411b,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x6c000000, 0x22000000, 0x83000000,
+	0x93800000, 0xdfc00000, 0xbaa00000, 0x58300000, 0x65780000, 0xa75c0000, 0x172a0000, 0x01350000,
+	0x39fc8000, 0x991b4000, 0xf9492000, 0xa422b000, 0x9572e800, 0x409ed400, 0x01895a00, 0x9b020700,
+	0x6f868280, 0x15c72b40, 0x5da2eaa0, 0x3db7bf70, 0x77be1098, 0x2f7c485c, 0x805b5a36, 0x92ab0707,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xe8000000, 0x1c000000, 0xc2000000, 0x0f000000,
+	0x38800000, 0x6f400000, 0x6b600000, 0x5cb00000, 0x23080000, 0xe3ec0000, 0x6a9e0000, 0xe2b30000,
+	0x9e0b8000, 0x0c6ac000, 0x595d2000, 0xd092b000, 0x78dd0800, 0x86556c00, 0xc17be600, 0x65415500,
+	0xa862cc80, 0xee354ac0, 0xcf4a44a0, 0x9a09e6d0, 0x4a6f0288, 0x505cc3f4, 0x4113e632, 0x161d5533,
+	0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x68000000, 0xc4000000, 0xc6000000, 0x6b000000,
+	0xa1800000, 0x32400000, 0x55200000, 0xbff00000, 0xa5080000, 0x86ac0000, 0x009a0000, 0x8bf30000,
+	0x7b0b8000, 0xf1aac000, 0x5b1be000, 0xb8b05000, 0xe6a8c800, 0x709aa400, 0x53f42600, 0x470a6700,
+	0x9bac0c80, 0x321fdac0, 0xb43544a0, 0x1e6cbef0, 0xb67902a8, 0x8b6049d4, 0x08d42632, 0x07fa6725,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x48000000, 0x4c000000, 0x7a000000, 0xa1000000,
+	0x03800000, 0x15c00000, 0x49600000, 0x89700000, 0x57d80000, 0x963c0000, 0x500e0000, 0x7cf70000,
+	0xf91c8000, 0xadd8c000, 0x7739a000, 0x738cf000, 0x99343800, 0xf8780400, 0x68af1a00, 0x5ae08900,
+	0x44b35680, 0xcabe9a40, 0x914deea0, 0xd8d55e50, 0x7e49d4a8, 0x6456e76c, 0x2f0b9a3a, 0x5874493f,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x78000000, 0x4c000000, 0xbe000000, 0x2d000000,
+	0x95800000, 0xcf400000, 0x7aa00000, 0xd9700000, 0x0f380000, 0xeb1c0000, 0x39aa0000, 0xb0f10000,
+	0xa67a8000, 0x60bb4000, 0x435c2000, 0x698d5000, 0x50407800, 0xdc217400, 0x3eb69e00, 0xa75ad300,
+	0xb38a5c80, 0x67453340, 0x1ea2a4a0, 0xc3720770, 0x58389ab8, 0xd99fc44c, 0xbc6c1e26, 0x0391931f,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x18000000, 0x94000000, 0x0e000000, 0x13000000,
+	0x71800000, 0x03400000, 0x31a00000, 0x20100000, 0x27480000, 0x726c0000, 0xffbe0000, 0x21970000,
+	0xcc0f8000, 0x7fc94000, 0xcdaee000, 0x97db1000, 0x46e7c800, 0xefb42400, 0xbc5aee00, 0x38a68b00,
+	0x0c961f80, 0x668f73c0, 0xa10857a0, 0xf54917d0, 0x836dd9a8, 0xb73accf4, 0xc6556e2e, 0x106fcb11,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x78000000, 0x34000000, 0x22000000, 0x6f000000,
+	0x43800000, 0xe8400000, 0x8f200000, 0x32b00000, 0x38480000, 0x4dec0000, 0x799e0000, 0x5a330000,
+	0x89888000, 0xd18d4000, 0x558be000, 0xaf887000, 0x048f4800, 0x1d0f3400, 0xae48c600, 0x40eed700,
+	0xf51e2680, 0x01f2bac0, 0x96efeea0, 0x581fced0, 0x7d724888, 0xb52b29ec, 0x737e4616, 0xd6e09721,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xd8000000, 0xe4000000, 0x3e000000, 0x13000000,
+	0x8b800000, 0x19c00000, 0x56a00000, 0x27700000, 0x6a880000, 0xceac0000, 0x4e9a0000, 0x37f30000,
+	0x14ce8000, 0x93ca4000, 0x1e4a6000, 0xe08b1000, 0xebacc800, 0xfa197400, 0x97b76a00, 0x4aa8b700,
+	0xa09f4880, 0xecf78ec0, 0x934f00a0, 0x880bbaf0, 0x81ee8aa8, 0x617d5dfc, 0x0063ea1e, 0xf051f705,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x78000000, 0x34000000, 0x86000000, 0x53000000,
+	0x0b800000, 0xc7c00000, 0xd8e00000, 0x80f00000, 0x69180000, 0xab7c0000, 0x3ace0000, 0x68770000,
+	0x8d5b8000, 0xd85e4000, 0xc0dce000, 0x2c995000, 0x23b88800, 0x03aab400, 0xde411a00, 0x9a257500,
+	0x5891b680, 0x01ad9c40, 0x2344bea0, 0xaea26850, 0x36d4c4a8, 0xb38b0d54, 0x17d49a36, 0x0d0c3519,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x18000000, 0x04000000, 0x7a000000, 0x1f000000,
+	0x14800000, 0x85400000, 0xfd200000, 0xfe300000, 0xd9980000, 0x21fc0000, 0xe2ea0000, 0xa5410000,
+	0x2d268000, 0xf6304000, 0xb59b6000, 0x47ff3000, 0x83e90800, 0xd4c28c00, 0xa3e2f600, 0x9ad32700,
+	0x33cf5280, 0x9d71e440, 0x85bd3aa0, 0xce4c5870, 0xc5b6c4b8, 0xf05df36c, 0x4d9b603e, 0xf3ff302d,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x88000000, 0x6c000000, 0xa2000000, 0x4f000000,
+	0x35800000, 0x33400000, 0x03a00000, 0x06100000, 0x98980000, 0x187c0000, 0x75ce0000, 0x57430000,
+	0x8da48000, 0x4b12c000, 0x921ca000, 0x96be3000, 0x292a0800, 0xf0f5c400, 0x5c2ece00, 0xfe76eb00,
+	0xccef1780, 0xb797d940, 0xf5d9bfa0, 0xaedc2d50, 0x9d5d7988, 0x8f1f024c, 0x243ca02a, 0xe3ee3017,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x98000000, 0xc4000000, 0xb6000000, 0xc9000000,
+	0x8d800000, 0xed400000, 0x51600000, 0xeeb00000, 0x9e880000, 0x0aac0000, 0xd97e0000, 0x33470000,
+	0xd4618000, 0xa9374000, 0x98c86000, 0x314b5000, 0x5a0bd800, 0x2a689400, 0x4558ce00, 0xdc90cd00,
+	0x3c59f480, 0xf911dac0, 0xfd1a4ca0, 0x12721ed0, 0x30a95aa8, 0xba7a47c4, 0x25c0600e, 0x9ba75035,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x58000000, 0x34000000, 0x92000000, 0xc5000000,
+	0x12800000, 0x36c00000, 0xf1600000, 0xd2900000, 0xbc080000, 0x2fac0000, 0x4e5e0000, 0x5dc10000,
+	0x78e18000, 0xe5d14000, 0xf62fe000, 0x811bf000, 0x53e51800, 0x8c572c00, 0x516c8a00, 0x933ce900,
+	0xc955c980, 0x03eccfc0, 0x45ff31a0, 0xa83013d0, 0x897ea398, 0xcdf7d6f4, 0x1599e00e, 0x0226f039,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x58000000, 0x1c000000, 0x96000000, 0xcd000000,
+	0x03800000, 0xccc00000, 0x31e00000, 0x29500000, 0xcab80000, 0xfb9c0000, 0x7d2e0000, 0x07c10000,
+	0x17628000, 0x42124000, 0x4d9da000, 0xe02a9000, 0x4c443800, 0x6fa7c400, 0xa1f09200, 0x23cab500,
+	0x72108380, 0xb598c040, 0xec291ba0, 0x72459450, 0xe6a5b198, 0x2874e56c, 0xb40ba00e, 0x8d77902b,
+	0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xd8000000, 0x94000000, 0xbe000000, 0x29000000,
+	0x99800000, 0x29400000, 0x86a00000, 0xd9d00000, 0x11980000, 0x827c0000, 0x8f0a0000, 0x14410000,
+	0x61248000, 0xb9944000, 0x3ebbe000, 0xaaeb9000, 0x8c321800, 0xf1ed7400, 0xd6b24e00, 0xb628f300,
+	0xf9d6d180, 0x819ca740, 0x0a7f29a0, 0xf30a4370, 0xe6477fb8, 0x6223c47c, 0xb711e00e, 0xa77a9019,
+	0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xa8000000, 0xc4000000, 0x72000000, 0xb3000000,
+	0x36800000, 0x9cc00000, 0xdfa00000, 0x1af00000, 0x5be80000, 0xda8c0000, 0xc4da0000, 0xd7470000,
+	0x88e28000, 0x5211c000, 0xa9fae000, 0x4374f000, 0x2fae2800, 0x3ceebc00, 0xc60b4a00, 0x2719ef00,
+	0xb8626c80, 0x67d0a5c0, 0x97dea4a0, 0xb1c6e9f0, 0x2c21c688, 0xd1b6bafc, 0xad0a6022, 0x1d9e300d,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x58000000, 0x4c000000, 0x56000000, 0x89000000,
+	0x4a800000, 0xa9c00000, 0xc0e00000, 0x0f500000, 0x2b280000, 0xcc0c0000, 0x86be0000, 0x5e410000,
+	0xc9a78000, 0x51774000, 0x631a2000, 0x49361000, 0x9bbe9800, 0x4ec7ac00, 0x5f63d200, 0x0214dd00,
+	0xd70bd380, 0x473b54c0, 0xce076ba0, 0x6506e8d0, 0xac842198, 0x28c499c4, 0x9e63a00e, 0xbc905017,
+	0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x78000000, 0x0c000000, 0x8a000000, 0x51000000,
+	0x43800000, 0x27c00000, 0xaa600000, 0xd4900000, 0xc6980000, 0xa93c0000, 0x92ca0000, 0xb5470000,
+	0x0e218000, 0xf9344000, 0xe8692000, 0xc333f000, 0xf168b800, 0x04b5c400, 0x78ad2a00, 0x01d4b100,
+	0x38be2980, 0x780b5340, 0x0ea7b1a0, 0xf0716770, 0x24482388, 0xef071264, 0xf482a016, 0x4f40b027,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x48000000, 0xf4000000, 0x62000000, 0x35000000,
+	0x9f800000, 0x06400000, 0xcde00000, 0x51100000, 0x13380000, 0x469c0000, 0x196a0000, 0x23c70000,
+	0x82a38000, 0x3577c000, 0x036d6000, 0x7ac2f000, 0x63231800, 0x80334400, 0x4e0de600, 0x7314e100,
+	0x463d7580, 0x691e6e40, 0x472b0da0, 0x5223da70, 0x45b7f388, 0x714f7f74, 0xef76e01a, 0xfa693009,
+	0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xf8000000, 0xac000000, 0x12000000, 0x65000000,
+	0x23800000, 0xe5c00000, 0x29e00000, 0xc4b00000, 0xb5f80000, 0x1fdc0000, 0x598a0000, 0x24470000,
+	0x31268000, 0x72d74000, 0xce8f2000, 0xb2c63000, 0x1f60d800, 0x5af7a400, 0x65d89a00, 0x188cbd00,
+	0xe1c72480, 0xbfe15540, 0xf7b0dca0, 0x057cc170, 0xfa9a9e88, 0x6d2cd85c, 0x7851a036, 0xcacd7037,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x78000000, 0x14000000, 0x3a000000, 0x6d000000,
+	0xff800000, 0xec400000, 0x6c600000, 0xe5d00000, 0xd8180000, 0xcd3c0000, 0x6f0a0000, 0xa4830000,
+	0xa0c78000, 0x60a24000, 0x8b73e000, 0x146ab000, 0x33d61800, 0x5b1b4400, 0x45bef600, 0x01c97d00,
+	0xa323ef80, 0xd135ad40, 0x0b0c17a0, 0x16875970, 0x91c379a8, 0xd9272074, 0x5c358036, 0xc48d4031,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0xc4000000, 0xb6000000, 0x6f000000,
+	0x6b800000, 0x07400000, 0xeae00000, 0x06100000, 0x4e480000, 0xf4ec0000, 0x9f9a0000, 0x32810000,
+	0xc3c28000, 0xe620c000, 0x1bb5e000, 0x2abfd000, 0x78b4e800, 0x933b9400, 0x36f71e00, 0x055db100,
+	0x10241d80, 0xd4b2b5c0, 0xd13f15a0, 0x07f7f1f0, 0x35de63b8, 0x42e114cc, 0x9210801a, 0xe04dc03d,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0xf4000000, 0x16000000, 0x6f000000,
+	0x51800000, 0xc2400000, 0x42a00000, 0x45900000, 0xa6d80000, 0xa13c0000, 0x8b8a0000, 0xf0830000,
+	0xe8c18000, 0x37634000, 0xe275e000, 0x9c6bd000, 0x62306800, 0xb7cf4400, 0xa122e600, 0xa6d60b00,
+	0x0efbeb80, 0xb1682f40, 0x5ab463a0, 0xf30fbb70, 0x54476da8, 0xeda5b444, 0x3413800e, 0xb49c4039,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x88000000, 0xdc000000, 0xea000000, 0x5b000000,
+	0xe3800000, 0x48400000, 0x45a00000, 0x39100000, 0x8b380000, 0xf1dc0000, 0xdcee0000, 0xc9810000,
+	0xb3418000, 0xd627c000, 0x69562000, 0x9a9df000, 0xfecf6800, 0xe6d49400, 0x80da8600, 0xc468f300,
+	0x12476780, 0xa6a01c40, 0xfe902fa0, 0xed787850, 0x517c4198, 0x6b7fdf74, 0x5879803a, 0xf7fbc003,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xc8000000, 0x4c000000, 0xf6000000, 0x25000000,
+	0x00800000, 0x45400000, 0x59a00000, 0xb9500000, 0x8ba80000, 0x744c0000, 0x993a0000, 0xf2030000,
+	0x5f048000, 0xf384c000, 0x10c7a000, 0xd4639000, 0xe9b4f800, 0x9d5e9c00, 0x63b70600, 0x665ee300,
+	0x5a302d80, 0x6d9edac0, 0xe7d175a0, 0x37ecd6f0, 0x436c0ba8, 0xb42b69ec, 0x5288001a, 0x485c003f,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x98000000, 0x5c000000, 0xae000000, 0xeb000000,
+	0x68800000, 0x72400000, 0xff200000, 0xb4d00000, 0x38680000, 0x280c0000, 0x9c7a0000, 0x74050000,
+	0xaa008000, 0xf9024000, 0x1d87a000, 0x69c35000, 0xb9e0c800, 0x97b16c00, 0x989f8e00, 0xcc332f00,
+	0xfe5fcd80, 0x3f509cc0, 0xf6aaa5a0, 0x1f6ba0f0, 0x668f6398, 0x113ea3fc, 0xb9a0003e, 0xed90002b,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x28000000, 0xac000000, 0x2e000000, 0x3d000000,
+	0xaf800000, 0xc5c00000, 0x07600000, 0x7d900000, 0x5ae80000, 0x434c0000, 0x973a0000, 0xbc010000,
+	0xa6078000, 0xa100c000, 0xf986a000, 0x7cc55000, 0x2ae5f800, 0xab55e400, 0xcf0aba00, 0x549f6900,
+	0x0f77f980, 0x85bc00c0, 0x1646a1a0, 0x04a1b4f0, 0x8bf463b8, 0xf6faf9e4, 0xc9600032, 0xd090000f,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x28000000, 0x04000000, 0x36000000, 0xe7000000,
+	0xc0800000, 0x40400000, 0x9da00000, 0xa8d00000, 0x38780000, 0xf09c0000, 0xf46e0000, 0x13050000,
+	0x9e828000, 0xc341c000, 0x1b22e000, 0x2790d000, 0x615ea800, 0x2e0c8c00, 0xb6b53e00, 0x8bc9eb00,
+	0x12d72980, 0xbd78a840, 0xd91d61a0, 0xcfadf450, 0x146277b8, 0x3eb0534c, 0xdfce0032, 0x1cd5000d,
+	0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xd8000000, 0x4c000000, 0xae000000, 0xfd000000,
+	0x41800000, 0xab400000, 0xd9e00000, 0xf8f00000, 0x52d80000, 0x4f7c0000, 0x54ea0000, 0x4d030000,
+	0x49878000, 0x1f474000, 0x2be42000, 0x73f1d000, 0xa258f800, 0x0bbc9400, 0xdb4abe00, 0x2d929900,
+	0x48ebd280, 0xdb00de40, 0xc8850aa0, 0x38c29a70, 0xe9a2cca8, 0x0994d774, 0xa2ea001e, 0x3c030027,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0x44000000, 0x16000000, 0x51000000,
+	0x5f800000, 0xa0400000, 0xe3a00000, 0xbbd00000, 0xe2980000, 0x9efc0000, 0x16ca0000, 0xe4250000,
+	0xd7948000, 0x033fc000, 0x7a2ee000, 0x16d5d000, 0xd7191800, 0xc5be4400, 0xb1efb600, 0x0b328300,
+	0x2a69d180, 0x7d742f40, 0x78caa9a0, 0x29207b70, 0x9212e798, 0x10796c5c, 0x290d9832, 0x47c1840d,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x78000000, 0x7c000000, 0x52000000, 0xd5000000,
+	0x1b800000, 0xe8c00000, 0xf4200000, 0x03100000, 0xbca80000, 0xcbcc0000, 0x5c3a0000, 0x23a10000,
+	0x51d78000, 0xf98a4000, 0xad5ea000, 0xf750b000, 0xaecad800, 0xafb96400, 0xaf627200, 0xdbf51b00,
+	0x05980f80, 0xa37324c0, 0x9ddbf7a0, 0x3b10b0f0, 0x60adfdb8, 0xa9cc7fe4, 0xa13d5826, 0x3c23243b,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x38000000, 0x6c000000, 0x82000000, 0xdf000000,
+	0x38800000, 0x13c00000, 0xea600000, 0x38f00000, 0xaa280000, 0x630c0000, 0x565e0000, 0xd0e10000,
+	0xb4328000, 0x98c94000, 0xb8392000, 0x2e10b000, 0xe71c8800, 0xca47ac00, 0xf423e200, 0x62d3a900,
+	0x75fefa80, 0x0174edc0, 0x4469d2a0, 0x012ab1d0, 0xe58f9898, 0x309e04ec, 0x79060816, 0x7182ec37,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xb8000000, 0xdc000000, 0x66000000, 0xa7000000,
+	0xf7800000, 0x06400000, 0xc6200000, 0xd7700000, 0x18f80000, 0x731c0000, 0xc20a0000, 0x8ca50000,
+	0xb7b28000, 0xa0194000, 0x878ca000, 0xcfe21000, 0xeb11e800, 0xffad3400, 0xd390f600, 0x3a6c9f00,
+	0x81f66880, 0xfe3bc540, 0x1cf9a0a0, 0x791da170, 0x5b0c1e98, 0x70221a6c, 0x98716836, 0x1b7d741b,
+	0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xd8000000, 0x3c000000, 0xbe000000, 0xc1000000,
+	0xa8800000, 0x67c00000, 0x79e00000, 0xc0d00000, 0x1e380000, 0x049c0000, 0x8c6e0000, 0x6e650000,
+	0xee928000, 0xb89e4000, 0x7268a000, 0xcf64d000, 0x36131800, 0x075e3c00, 0x37893200, 0xb1b49500,
+	0xe92be780, 0xab424040, 0xdc22dfa0, 0xa636ec50, 0xc76855b8, 0x0de4954c, 0xaad7980e, 0xe5397c03,
+	0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x98000000, 0x1c000000, 0xba000000, 0x29000000,
+	0xd8800000, 0x89c00000, 0x32200000, 0xc6100000, 0x7c180000, 0xeb7c0000, 0xe88e0000, 0x0fa10000,
+	0xe5528000, 0x7afc4000, 0x09cfa000, 0xcc47f000, 0xfd617800, 0xe2f2dc00, 0xaba88200, 0xad333b00,
+	0xba8cdf80, 0xe2a3d940, 0x7bd087a0, 0x903ab550, 0x526edd98, 0x4710a26c, 0x809df83e, 0xd4bf9c2b,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x68000000, 0x3c000000, 0x6a000000, 0x45000000,
+	0xd8800000, 0x0ec00000, 0x8ba00000, 0xd1f00000, 0xc2b80000, 0x755c0000, 0x24ce0000, 0x84a10000,
+	0x5c708000, 0x2cf9c000, 0x143b2000, 0x409ff000, 0x84e99800, 0x1c133c00, 0xee2f5a00, 0xe9b6cf00,
+	0xccdcd480, 0x6c8c1f40, 0x42c6eca0, 0x29a51350, 0xf8f50e98, 0xa83e107c, 0x6a9f9802, 0x21ee3c33,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xb8000000, 0x14000000, 0xe6000000, 0xc9000000,
+	0x70800000, 0x1b400000, 0xede00000, 0xf3900000, 0xc3c80000, 0x83ec0000, 0xdfde0000, 0x1ae10000,
+	0x2e148000, 0x160b4000, 0x9848e000, 0xef2c5000, 0xecf8d800, 0x15527c00, 0x6bec5600, 0x03dbd100,
+	0xb0e5f980, 0x2517f5c0, 0xf18941a0, 0x2e8e99d0, 0x8f0b2f98, 0x20ca64dc, 0xb86ed836, 0xc31f7c19,
+	0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x88000000, 0x04000000, 0x4e000000, 0x8f000000,
+	0xb4800000, 0xa4c00000, 0x8a200000, 0x01700000, 0x99d80000, 0x05bc0000, 0xc12e0000, 0xb9270000,
+	0x37f68000, 0xd818c000, 0x4a1de000, 0xd7181000, 0xbe992800, 0x53d92c00, 0x84ba3a00, 0xdaaa3300,
+	0x1965ec80, 0x91147c40, 0x574fa4a0, 0x9cb18050, 0xc47f56a8, 0xce8d8f7c, 0x8f17280a, 0x804e2c3d,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xd8000000, 0xe4000000, 0xaa000000, 0xe3000000,
+	0x82800000, 0x1dc00000, 0xeb200000, 0xf7d00000, 0xdab80000, 0xb8dc0000, 0x54ee0000, 0x79270000,
+	0x00d78000, 0x9a3b4000, 0xea196000, 0xab4ab000, 0x3e326800, 0xfac9dc00, 0xa974a200, 0x102cc300,
+	0x6b81b980, 0xac45da40, 0x8c6531a0, 0x7531f650, 0xb44c9ba8, 0x92b55974, 0x1e0a681e, 0x6bd5dc0d,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x78000000, 0x1c000000, 0xd6000000, 0x11000000,
+	0x9d800000, 0x0c400000, 0xc6e00000, 0x38900000, 0xf3680000, 0xb64c0000, 0xcf7a0000, 0x70e50000,
+	0x99928000, 0xf6ef4000, 0xd60ca000, 0xa79f9000, 0x4573d800, 0x21785400, 0x5de74600, 0x42141900,
+	0xe3ad0180, 0xe96930c0, 0x5948f9a0, 0xb7fdb4f0, 0x2322c798, 0xf03769ec, 0x4e1bd806, 0x4b34542b,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xe8000000, 0x0c000000, 0x5e000000, 0xed000000,
+	0x4e800000, 0xc0400000, 0x68e00000, 0xc7f00000, 0x63d80000, 0x58fc0000, 0x712a0000, 0x21a30000,
+	0x73948000, 0xf76dc000, 0x8040a000, 0x88e3d000, 0x97f4f800, 0xfbdc6c00, 0xbcf85e00, 0x232d5100,
+	0x92a28a80, 0xd0158e40, 0x79a852a0, 0x28e4f270, 0x27f0d4a8, 0x33dbdf6c, 0xc0fe5812, 0x952cbc2f,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xc8000000, 0x9c000000, 0x7e000000, 0x0f000000,
+	0x37800000, 0xd6400000, 0x6e200000, 0x5e100000, 0xefb80000, 0x475c0000, 0xbaae0000, 0x65650000,
+	0x9eb68000, 0x536ac000, 0x61012000, 0x40835000, 0xd5c46800, 0xaa65b400, 0x89313600, 0x15289f00,
+	0x3720c380, 0x4a948440, 0xd87d0ba0, 0x9c3da050, 0x0b1ff5b8, 0x91891b6c, 0x11f3480a, 0x29cfe40b,
+	0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x18000000, 0x8c000000, 0x52000000, 0xd7000000,
+	0x31800000, 0xdfc00000, 0x80200000, 0x5cb00000, 0x93180000, 0xa27c0000, 0x44ae0000, 0xeae10000,
+	0x92158000, 0x45ef4000, 0xb8802000, 0x2b443000, 0x59674800, 0x22d52400, 0x88490a00, 0x61f31300,
+	0x7b788a80, 0x482fc440, 0xafa462a0, 0xa6709050, 0x05bf8098, 0x188dd754, 0x1c51681e, 0x4a0c1437,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x08000000, 0x7c000000, 0x32000000, 0xf7000000,
+	0x38800000, 0xd2400000, 0x31a00000, 0x72100000, 0xd9c80000, 0xc9ac0000, 0x32da0000, 0x3de70000,
+	0x4eb38000, 0xb85dc000, 0xd8a72000, 0xe7943000, 0x0808c800, 0x38cb6c00, 0x202aae00, 0xd11a3b00,
+	0x3b829f80, 0x64c0abc0, 0x86e4f7a0, 0x9c3537f0, 0x491a3188, 0x8f8190f4, 0x8ac7e80a, 0x53e35c2b,
+	0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x98000000, 0xa4000000, 0x62000000, 0xf3000000,
+	0x70800000, 0xf3400000, 0x1e200000, 0x0af00000, 0x20880000, 0xcc6c0000, 0xb87e0000, 0xf7e50000,
+	0x08938000, 0xb2dd4000, 0x4c576000, 0xf538f000, 0xccc6a800, 0x1be78c00, 0x16944600, 0xe7db4f00,
+	0xfdd4ec80, 0x1df91ac0, 0xf520a4a0, 0x9e7226d0, 0xd1c8aab8, 0x714e55c4, 0x5a0a481e, 0x802e3c2d,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x78000000, 0x3c000000, 0xd2000000, 0x8d000000,
+	0x29800000, 0x12c00000, 0xd1600000, 0xdc300000, 0xa3180000, 0x863c0000, 0x552e0000, 0xd4270000,
+	0x08908000, 0x6ec94000, 0x5c55a000, 0x94aeb000, 0x92e61800, 0x1ff23400, 0xd9ff7200, 0xcdc93100,
+	0x4ad3ac80, 0x72ebfa40, 0x70c694a0, 0x44653e50, 0x99b4dea8, 0x6bdecb4c, 0x9e5b3836, 0x4e99c403,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x68000000, 0x6c000000, 0x5e000000, 0xc7000000,
+	0xde800000, 0xd2400000, 0x77e00000, 0x48500000, 0x45080000, 0x4f2c0000, 0x975e0000, 0x5f210000,
+	0x2ff78000, 0x3bbec000, 0x0ff6a000, 0xcbb8d000, 0xd7f4a800, 0x9fbabc00, 0x8df61e00, 0x6ab83900,
+	0xca75df80, 0xa17e0dc0, 0xb15657a0, 0x4c8fa1d0, 0xcbebc198, 0x0efa34c4, 0x56958802, 0x89acac1f,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xb8000000, 0x7c000000, 0x3e000000, 0x51000000,
+	0x2a800000, 0x08400000, 0x62200000, 0xa4f00000, 0xf3b80000, 0x845c0000, 0xdd4a0000, 0x1ce70000,
+	0xc0948000, 0x7c6f4000, 0x7595a000, 0x24e9d000, 0x0ad19800, 0xb14bac00, 0x0ae75e00, 0x05906700,
+	0x5cef4480, 0xd6d34340, 0x7f4dfca0, 0xe3e57f70, 0x53101a88, 0x6aaf244c, 0xe5f0b826, 0xf13d3c13,
+	0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xa8000000, 0x0c000000, 0x5e000000, 0x63000000,
+	0x75800000, 0xebc00000, 0xd8600000, 0x9a300000, 0xf6980000, 0xd5bc0000, 0x5eae0000, 0x2e230000,
+	0x45918000, 0x9acec000, 0xa217a000, 0xac0dd000, 0x1cf08800, 0xd07ec400, 0x7dcbaa00, 0x1592d100,
+	0x72cdfc80, 0x0e115e40, 0x220d54a0, 0xd7f38a50, 0xa9fe5688, 0xc80f8f64, 0xaef6a822, 0x9d7dd427,
+	0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x88000000, 0xd4000000, 0xaa000000, 0xdb000000,
+	0x24800000, 0x20c00000, 0xa7600000, 0x36b00000, 0x25380000, 0xa31c0000, 0x078e0000, 0x4c270000,
+	0x6f928000, 0xd72cc000, 0x5f776000, 0x61ddb000, 0xcfe82800, 0xe4152c00, 0x0969ba00, 0xabd73900,
+	0x308f1880, 0xdea49f40, 0xca54d0a0, 0x15cbc350, 0x3e86a2a8, 0x33c3a65c, 0x77e3c80a, 0x8c735c29,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x88000000, 0xfc000000, 0xe2000000, 0x07000000,
+	0x5c800000, 0x8b400000, 0x5da00000, 0xdeb00000, 0x9b680000, 0x400c0000, 0xedde0000, 0x17630000,
+	0x67d48000, 0x71bac000, 0x46342000, 0x662eb000, 0xd4a9c800, 0x72e84c00, 0x28c9c600, 0xb3bb3300,
+	0x71339280, 0x12afdbc0, 0xd3ecfaa0, 0x454ce7d0, 0x0d7a5488, 0x9654e8cc, 0xbd7f682a, 0xfe533c33,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x78000000, 0x54000000, 0x56000000, 0x6f000000,
+	0x4d800000, 0xac400000, 0x2b200000, 0x1a700000, 0x70680000, 0x2a1c0000, 0xfa720000, 0x406d0000,
+	0x32188000, 0x5e764000, 0x6e6c6000, 0x09189000, 0x45f78800, 0xad2d7400, 0x6fbf9e00, 0xf3c3b300,
+	0xf664fe80, 0x5fd0cec0, 0x79db60a0, 0x9c137df0, 0x97bf9e38, 0x67c3b30c, 0xc064fe86, 0xc0d0cee9,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x78000000, 0x74000000, 0xba000000, 0x05000000,
+	0xb4800000, 0xb2400000, 0x56e00000, 0xf6100000, 0x0d480000, 0xdb5c0000, 0x86160000, 0x854f0000,
+	0x67598000, 0x20154000, 0x364f6000, 0x18dff000, 0x99d0b800, 0x636aec00, 0xbeefc600, 0x862f9d00,
+	0x158beb80, 0x18fa1cc0, 0x53642da0, 0xaad581d0, 0x5cefc608, 0xa72f9d14, 0xc30bebb6, 0xcbba1cd9,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x68000000, 0xa4000000, 0xe6000000, 0xaf000000,
+	0x9d800000, 0xea400000, 0x0f600000, 0xb1900000, 0x8b480000, 0xf2dc0000, 0x8d920000, 0x61490000,
+	0xffd88000, 0x2912c000, 0xd18f6000, 0x237a9000, 0x9ba08800, 0x4b36f400, 0x76fd2e00, 0x85e1a100,
+	0x5a540380, 0xd46f78c0, 0xb9292da0, 0xafced9f0, 0x821d2e18, 0xb131a12c, 0xa3fc03a2, 0x0d6378f5,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xc8000000, 0x14000000, 0xce000000, 0x35000000,
+	0xd3800000, 0xcac00000, 0x52200000, 0x18f00000, 0xe2c80000, 0x623c0000, 0xacf60000, 0xbcc90000,
+	0x4f3a8000, 0x1375c000, 0x640fe000, 0xf21c5000, 0x23021800, 0xaa80d400, 0xdb409a00, 0x0fe0df00,
+	0xbe538280, 0x0c79cbc0, 0x309318a0, 0xa85914d0, 0xa1609a38, 0xf310df3c, 0x3a9b82aa, 0xff45cbe9,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x34000000, 0xca000000, 0xd3000000,
+	0xbf800000, 0x51400000, 0x0c200000, 0x6a700000, 0x8a680000, 0x341c0000, 0x04760000, 0xdb6b0000,
+	0x4c9d8000, 0x30b6c000, 0x5d0ae000, 0xa14a7000, 0x4bee0800, 0x3c5d8400, 0x44d70600, 0x4fd9e300,
+	0x93943680, 0x56fd46c0, 0x736330a0, 0x1754a5d0, 0x889f0628, 0x82b5e314, 0x820a368a, 0xf8ca46c9,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xf8000000, 0xb4000000, 0xa6000000, 0x9d000000,
+	0xfe800000, 0xaf400000, 0x69200000, 0x45100000, 0x71d80000, 0x38cc0000, 0x7b120000, 0x08d90000,
+	0x784f8000, 0x6d514000, 0xc17b6000, 0xbb1f1000, 0x2d289800, 0x8ee47c00, 0x26779e00, 0xf76bab00,
+	0x95409d80, 0x3e227840, 0x449703a0, 0x7319d370, 0xd12f9e18, 0x14e7ab14, 0xc1729d86, 0x7eeb7849,
+	0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x08000000, 0x24000000, 0x8a000000, 0x11000000,
+	0x40800000, 0x46400000, 0x91200000, 0xb8100000, 0xf0680000, 0x727c0000, 0xfb160000, 0xbdeb0000,
+	0xf2be8000, 0xe375c000, 0x475a6000, 0x8903f000, 0x7c851800, 0xb042ec00, 0x5626c600, 0x4f922300,
+	0x49aae580, 0x7e9a25c0, 0xc5e423a0, 0x627406d0, 0x1fd8c628, 0xb345230c, 0x3ba2658a, 0xbf54e5d5,
+	0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x58000000, 0x74000000, 0x66000000, 0x8f000000,
+	0x26800000, 0x6c400000, 0xd7600000, 0x90d00000, 0xb0480000, 0x8e9c0000, 0x5dd20000, 0x07c90000,
+	0xcf5b8000, 0xee704000, 0x8f386000, 0x0c231000, 0xc5330800, 0x92db2c00, 0x02b64600, 0x5b1e5100,
+	0x7d17d180, 0xd1eee2c0, 0x0f6997a0, 0x272cb3f0, 0x3e4c4618, 0x1d9b5134, 0xc15651ae, 0xbe8ba2d9,
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xa8000000, 0xac000000, 0x1a000000, 0x43000000,
+	0x58800000, 0x7e400000, 0xcba00000, 0x4f300000, 0x98a80000, 0xf19c0000, 0xd8360000, 0xbe2b0000,
+	0x4add8000, 0xaa13c000, 0x90db2000, 0x89103000, 0xf85d0800, 0x4f55fc00, 0x37fe0600, 0xb6672700,
+	0xf6531880, 0x5c7b1ac0, 0x08a51ea0, 0x57b03dd0, 0xc6e80628, 0x2a3c2714, 0x3f0698a2, 0x8a84daef,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xd8000000, 0xfc000000, 0xde000000, 0x2f000000,
+	0x74800000, 0xc3400000, 0x38a00000, 0x68f00000, 0x64480000, 0x76bc0000, 0x5ff60000, 0xccc90000,
+	0xbbfa8000, 0x20554000, 0xf4b82000, 0x3ef39000, 0x9f4ec800, 0x983cfc00, 0x21b72e00, 0xa9ef9700,
+	0xb7cd3e80, 0x157e6bc0, 0x3e1210a0, 0x219dfcd0, 0xeac12e38, 0x5666973c, 0x8c97beae, 0x11db2bd3,
+	0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xe8000000, 0x6c000000, 0xee000000, 0x8d000000,
+	0xf6800000, 0xf2c00000, 0x39a00000, 0x48700000, 0x13c80000, 0x7abc0000, 0x51f60000, 0xe4890000,
+	0x42598000, 0x9867c000, 0x72552000, 0xbbf99000, 0xf016d800, 0xd19dfc00, 0xf9433200, 0x25e1c300,
+	0xb7141280, 0xd81f1fc0, 0xc60120a0, 0xc107dcd0, 0xa884b238, 0x47c30324, 0x4b26b2a2, 0x38b44fef,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xb8000000, 0x14000000, 0x9e000000, 0xd7000000,
+	0x51800000, 0x25400000, 0xe1a00000, 0x95f00000, 0x01e80000, 0x6f1c0000, 0xf5760000, 0x96290000,
+	0xf4788000, 0x3b644000, 0x1e146000, 0xa038d000, 0x08440800, 0x01235400, 0x4234f600, 0xfa8bef00,
+	0x510e5680, 0xc549a6c0, 0xd66ca0a0, 0x595b49d0, 0xf3527638, 0xad9aaf2c, 0x77b4b6b6, 0xb9cc36f9,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x98000000, 0x14000000, 0x02000000, 0x27000000,
+	0xcc800000, 0x8c400000, 0x58a00000, 0x33d00000, 0x2a680000, 0x22bc0000, 0x2a520000, 0xc5ab0000,
+	0x16df8000, 0x0b604000, 0x39b76000, 0xd25b3000, 0x6b276800, 0x07153c00, 0x8c8fb600, 0x26cd0f00,
+	0x736ac780, 0x573d6bc0, 0x639771a0, 0x3ccb64f0, 0x806a3608, 0x39ba4f04, 0x18d0278e, 0x30ed1bf1,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x98000000, 0xac000000, 0x12000000, 0xb1000000,
+	0xe0800000, 0x6fc00000, 0x09200000, 0x83b00000, 0xb1280000, 0xc19c0000, 0x79320000, 0xfbed0000,
+	0x26398000, 0x7e404000, 0x2664a000, 0x55507000, 0x73bf5800, 0xc7072c00, 0xb7878a00, 0xe0452f00,
+	0xf5605880, 0x2cd12ec0, 0x18fdd2a0, 0x87e501f0, 0x32160a38, 0x91596f04, 0xbb96f8be, 0x121c5edf,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xb8000000, 0x34000000, 0x7e000000, 0x6d000000,
+	0x65800000, 0x94400000, 0x67a00000, 0xfb100000, 0xd7080000, 0xcf1c0000, 0xd8920000, 0xda4b0000,
+	0x13398000, 0xcac74000, 0xb7676000, 0x8777d000, 0xdcfdd800, 0x34202400, 0xfe53de00, 0x972a0700,
+	0x2f482180, 0x92b92ec0, 0x3881ffa0, 0x99c429f0, 0xdfe25e08, 0xc6b14734, 0x871d4186, 0x2495fec9,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x18000000, 0x24000000, 0x6a000000, 0xaf000000,
+	0xc3800000, 0x2a400000, 0xa0600000, 0xed100000, 0x8b180000, 0x070c0000, 0xca960000, 0x2b5f0000,
+	0xd86a8000, 0x8c054000, 0xb606e000, 0x3104f000, 0x6e856800, 0x7ac28400, 0x07a53e00, 0xa2327900,
+	0xaae90f80, 0x88c07e40, 0xcca231a0, 0xabb10750, 0x5fafbe08, 0xf327390c, 0x2ff7efae, 0xeac88e55,
+	0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xe8000000, 0xac000000, 0x12000000, 0x05000000,
+	0x68800000, 0x13400000, 0x73e00000, 0xb7d00000, 0xfe880000, 0xda5c0000, 0x17560000, 0x71cf0000,
+	0xf3ba8000, 0x7982c000, 0x1dc52000, 0x93a37000, 0x67b47800, 0xcd994c00, 0x85f22e00, 0x60f9bd00,
+	0x4a644d80, 0x0a1014c0, 0x1d2863a0, 0x55eaa9d0, 0x76c8ae08, 0xe63b7d0c, 0x96416d92, 0x5b6364f7,
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xc4000000, 0x0a000000, 0x8f000000,
+	0x41800000, 0xc0c00000, 0xd2a00000, 0x39d00000, 0x43f80000, 0xc32c0000, 0xc8520000, 0x6b3b0000,
+	0x858e8000, 0x8381c000, 0xebc16000, 0xc924f000, 0x0e17e800, 0x9cdc1400, 0xf43e7a00, 0xdc0ebb00,
+	0x5f462f80, 0x8f635b40, 0x39f255a0, 0x4d6ae070, 0x5bb0fa08, 0xe08f7b0c, 0xdd074f8a, 0xb287ab4d,
+	0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xd8000000, 0x6c000000, 0x36000000, 0x9f000000,
+	0x50800000, 0xfdc00000, 0xc6600000, 0xfd100000, 0x3df80000, 0x106c0000, 0x90560000, 0x26590000,
+	0xfb1a8000, 0x38bd4000, 0xbfc8a000, 0x21225000, 0x27b70800, 0xad0d5c00, 0x4fc0fa00, 0x9b633500,
+	0x08967780, 0x89bba540, 0x3c4c0da0, 0x6a65d050, 0xeb12da38, 0x72fc253c, 0x28e9dfae, 0xd994a977,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xb8000000, 0xe4000000, 0xee000000, 0x43000000,
+	0xf0800000, 0x90400000, 0x30a00000, 0xcf700000, 0xa6680000, 0xf99c0000, 0x1fb20000, 0x7e8f0000,
+	0xc24c8000, 0xa8ae4000, 0xda79e000, 0x30e2d000, 0xb7d62800, 0x151ffc00, 0x65f31600, 0xf32c8f00,
+	0x36bf3280, 0x3206a6c0, 0x8900a4a0, 0x7d8469f0, 0x13c67628, 0xe8601f3c, 0x8b90faa6, 0xb7bb8af5,
+	0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x98000000, 0x9c000000, 0xae000000, 0x3d000000,
+	0xa4800000, 0xa4400000, 0xdda00000, 0x01f00000, 0x35580000, 0xc02c0000, 0xa9320000, 0x98bb0000,
+	0x16798000, 0x829e4000, 0xc24f2000, 0xdea61000, 0xc073d800, 0x09996c00, 0x07c9d600, 0xd0657700,
+	0x9490be80, 0xe948bb40, 0x0b20e8a0, 0x56b38c70, 0xc17f7608, 0x491d2734, 0xe18c468e, 0xb6c7c763,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x28000000, 0x64000000, 0x1e000000, 0xf1000000,
+	0x41800000, 0xcbc00000, 0xdae00000, 0xbd500000, 0xfb380000, 0xefec0000, 0x9b160000, 0xc0190000,
+	0x2f5f8000, 0x19ffc000, 0x688f6000, 0xdf865000, 0x7ac7b800, 0xfb646400, 0x66964200, 0x09dd9100,
+	0x36b96980, 0x7e2f1940, 0xdef0aba0, 0xf5cd4850, 0x1226a238, 0x9d340114, 0x7b29b192, 0xe9712d5d,
+	0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0x34000000, 0x9a000000, 0x57000000,
+	0xda800000, 0x0e400000, 0x4da00000, 0x40700000, 0xf6980000, 0x006c0000, 0x96b20000, 0x767d0000,
+	0xfd398000, 0x711a4000, 0xfbae6000, 0x8bd2f000, 0xe7eb2800, 0xbd728c00, 0xb31d9600, 0x58ac1700,
+	0xab55f280, 0x6eaeb940, 0xf251e4a0, 0xc928ee70, 0x79927638, 0xbc48a704, 0xd402baae, 0x8a03c579,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xb8000000, 0xcc000000, 0xea000000, 0x25000000,
+	0xa5800000, 0xba400000, 0x4ba00000, 0xc6b00000, 0x93480000, 0xaa7c0000, 0x2e720000, 0xee2f0000,
+	0xf2ab8000, 0x7f694000, 0x4788a000, 0x551cb000, 0x27a63800, 0x3cb62400, 0x2e4b8e00, 0x13f8d700,
+	0xc6369c80, 0x4c8d49c0, 0x7b9e92a0, 0x7360def0, 0x03d2ae28, 0x079e2704, 0x116184a6, 0xa2d19dc7,
+	0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0x44000000, 0xc6000000, 0xa7000000,
+	0x2b800000, 0xb4400000, 0x5c200000, 0x31500000, 0x43a80000, 0xbb7c0000, 0x9d960000, 0x9e4f0000,
+	0x214b8000, 0x0ec84000, 0xdc8de000, 0x77ad9000, 0xf57e4800, 0x46930400, 0x67c9ae00, 0x6c092b00,
+	0x9a6b5f80, 0xb41981c0, 0x7b6171a0, 0x08f4ead0, 0x1db9ce08, 0x5d73fb04, 0x5afb778e, 0xd4d355c5,
+	0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x08000000, 0xcc000000, 0xee000000, 0xd3000000,
+	0x52800000, 0x4ac00000, 0xa5e00000, 0xbed00000, 0x68780000, 0x562c0000, 0x51920000, 0x47db0000,
+	0x42df8000, 0xb75cc000, 0xf5192000, 0x33389000, 0x83882800, 0xbc63ac00, 0x02941200, 0xd55b3100,
+	0xa81f0580, 0xc2bbbf40, 0x43cc97a0, 0x97404e70, 0x3ba0b208, 0x3ef46104, 0x17c98daa, 0xdd404347,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xe8000000, 0xb4000000, 0x22000000, 0x81000000,
+	0x21800000, 0x56400000, 0xc2200000, 0xa9100000, 0xe6480000, 0x2fdc0000, 0x5e560000, 0xb5ef0000,
+	0x988e8000, 0x3e3ec000, 0xf921e000, 0x15943000, 0xa788d800, 0xe8bc6400, 0x7de64e00, 0x39731b00,
+	0xe77dcd80, 0xa5810cc0, 0x7c4303a0, 0xa723d7d0, 0xb291ae08, 0x6d082b2c, 0x5a7b9592, 0x0203a8d1,
+	0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xb8000000, 0x1c000000, 0x1a000000, 0xd1000000,
+	0x03800000, 0x65c00000, 0x27a00000, 0xc0500000, 0xe3b80000, 0x516c0000, 0x04960000, 0x8f9b0000,
+	0xe0f98000, 0xee8f4000, 0x71a22000, 0xd357b000, 0x9d3e1800, 0x052b3400, 0x33f0c200, 0x6defab00,
+	0x6dd0fb80, 0xa97fe540, 0x824fb9a0, 0xf9840e50, 0x44c4e228, 0x2c231b34, 0x919763a6, 0x7a1b9163,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x48000000, 0xec000000, 0xb2000000, 0x03000000,
+	0xf3800000, 0x70c00000, 0x3f200000, 0x9c300000, 0xec580000, 0x28ec0000, 0x9bf60000, 0x76fb0000,
+	0xb91f8000, 0x5a0ec000, 0x0a622000, 0x9ed37000, 0x65cc4800, 0x64c42400, 0x1926aa00, 0xf9319700,
+	0x5add8c80, 0xbea9c140, 0x7a92a6a0, 0xe7ad9650, 0x76128a28, 0xbee9e704, 0x86f6449a, 0x147f256f,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xa8000000, 0x04000000, 0x2a000000, 0xcb000000,
+	0x32800000, 0x68400000, 0xada00000, 0xabf00000, 0x2ba80000, 0xfddc0000, 0x66b20000, 0xb58f0000,
+	0x97ee8000, 0x627cc000, 0x8a466000, 0xf2a5f000, 0x4b70c800, 0x54e92c00, 0xe4fae600, 0x40030700,
+	0xe001ae80, 0x50020cc0, 0xd807c8a0, 0xac02cbf0, 0x2e068628, 0xe105f72c, 0xf985e6a2, 0x5ac4e0dd,
+	0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x38000000, 0x7c000000, 0x06000000, 0xf7000000,
+	0xae800000, 0x79400000, 0x9d600000, 0x22500000, 0xc5880000, 0x625c0000, 0x86120000, 0xff690000,
+	0xfccd8000, 0xdf3d4000, 0x94472000, 0xd2e45000, 0xda97c800, 0x232e6c00, 0x9a28ae00, 0x77a94900,
+	0xd26a0580, 0x534db8c0, 0xf7fd2ba0, 0x4ae0b1f0, 0x56958e18, 0x2d281904, 0xf92a4db6, 0x9b2b94eb,
+	0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xd8000000, 0x84000000, 0xd6000000, 0xc5000000,
+	0x92800000, 0xb6400000, 0xdb200000, 0xa0b00000, 0x03380000, 0x600c0000, 0x79f60000, 0x0d9d0000,
+	0xbf788000, 0x6c2b4000, 0xb8c3e000, 0x9f641000, 0xf892d800, 0x5c0bdc00, 0x1bf17600, 0x269dd300,
+	0x1cfcd080, 0x46ef9240, 0x94a326a0, 0xa0740150, 0x285c9618, 0x7698c30c, 0x14f8888e, 0x8aee0e7d,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xc8000000, 0x8c000000, 0x0a000000, 0xfd000000,
+	0x44800000, 0x35400000, 0xff200000, 0xd3b00000, 0x38880000, 0x88bc0000, 0x94f20000, 0x2eab0000,
+	0xf18d8000, 0x7238c000, 0x22b52000, 0xb60bb000, 0xe0fc7800, 0xbf516c00, 0x005afe00, 0xba200b00,
+	0x23303880, 0x73cc1fc0, 0x549d46a0, 0xb0c3d4f0, 0x1ce7de08, 0x00d7bb14, 0x469e409a, 0x69c673c7,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x78000000, 0x8c000000, 0x86000000, 0x53000000,
+	0x93800000, 0x2bc00000, 0x68e00000, 0xb0f00000, 0x1a380000, 0x5c4c0000, 0x45360000, 0xdddd0000,
+	0xb13d8000, 0x03cb4000, 0x08f6a000, 0x363bd000, 0xea48e800, 0xbe312400, 0xba5b5200, 0x90fd5100,
+	0xbe2fb480, 0x7884ac40, 0x944766a0, 0xf523bd50, 0x2315f218, 0xcd4a8124, 0x67b15ca6, 0xa4988857,
+	0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x18000000, 0x44000000, 0x6e000000, 0x8d000000,
+	0x7b800000, 0xf7c00000, 0x0ea00000, 0xed700000, 0x26280000, 0x0bdc0000, 0xc8b20000, 0xff8d0000,
+	0x062a8000, 0x1bdf4000, 0x00b3e000, 0x1389d000, 0x342d5800, 0xbcdad400, 0x9834f200, 0x12ca7300,
+	0xb6c99a80, 0xa8cb30c0, 0x5dcde8a0, 0xd24f03f0, 0x538f1238, 0x942fa31c, 0x6cdec29e, 0x3030e4fd,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x58000000, 0x94000000, 0xae000000, 0xe9000000,
+	0xe4800000, 0xa3400000, 0x70600000, 0xb7500000, 0x61080000, 0x91dc0000, 0x58160000, 0x6b6f0000,
+	0xc1898000, 0x249c4000, 0xe5756000, 0xdebe5000, 0x26c17800, 0x1ba48c00, 0xee742e00, 0xa9388100,
+	0x8605e580, 0xd50564c0, 0x36864ba0, 0x3842a5d0, 0x1fe14e08, 0x2396d114, 0x11ac9dbe, 0xf82de8e1,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x18000000, 0x7c000000, 0x86000000, 0xa7000000,
+	0xda800000, 0x02400000, 0x51600000, 0x45500000, 0x23980000, 0x594c0000, 0x2f160000, 0x56f90000,
+	0x86188000, 0xdd894000, 0x6a362000, 0x0dc95000, 0x5e514800, 0x5f1d4c00, 0x6c0ed600, 0x4cf1f100,
+	0x75eebd80, 0x0ee3a840, 0xe096eba0, 0x1b3e1950, 0xdab8f638, 0xa478a12c, 0xc05ff59e, 0xe6eee463,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x38000000, 0xfc000000, 0x86000000, 0x11000000,
+	0x05800000, 0xdcc00000, 0xe7e00000, 0x79500000, 0x94780000, 0x4bac0000, 0x05960000, 0x43990000,
+	0x7aff8000, 0x45ef4000, 0x4a332000, 0x146a5000, 0x94f2f800, 0xf88c0400, 0x6f23da00, 0x9cb00100,
+	0xe62aa180, 0x5d524b40, 0xbe78fba0, 0x84a80a50, 0xfd10fa38, 0x24da5114, 0xacd85996, 0x58de4f7b,
+	0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x84000000, 0xe2000000, 0x75000000,
+	0xf7800000, 0x09c00000, 0xe0600000, 0xa0100000, 0xac780000, 0xa5ac0000, 0x59b20000, 0xb4090000,
+	0xcdc78000, 0x22664000, 0xa517e000, 0x53ffb000, 0xb06c7800, 0xdfd23400, 0x8319e200, 0xe33b6500,
+	0x798fff80, 0x1505cd40, 0xa781fda0, 0x71c11870, 0xf4627a18, 0xda16e114, 0x5d7a659e, 0xb02c9c45,
+	0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x08000000, 0x0c000000, 0xce000000, 0x25000000,
+	0x64800000, 0x37c00000, 0x89a00000, 0x36d00000, 0xca980000, 0x178c0000, 0xd2b60000, 0x3aed0000,
+	0xd8418000, 0xefe0c000, 0x04372000, 0x1e2c9000, 0xa4631800, 0x10706c00, 0x9fcbea00, 0x35525b00,
+	0x32dc9f80, 0x086d3c40, 0x6e8055a0, 0x70c3f750, 0xb627d218, 0x1892a704, 0x147a6dba, 0x5d3e0b57,
+	0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xe8000000, 0xc4000000, 0x66000000, 0x21000000,
+	0xdb800000, 0xe5400000, 0x6ba00000, 0x52900000, 0x42b80000, 0xc16c0000, 0x16760000, 0xb88f0000,
+	0xedc58000, 0x1a61c000, 0xd2f46000, 0x5b499000, 0x52a17800, 0xd513f400, 0xddffc600, 0x51cdff00,
+	0xf4665580, 0x47f68b40, 0x3ecdf3a0, 0x2ae2e450, 0x2f32de08, 0xe92b9b34, 0xe456eb92, 0x785b8055,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x08000000, 0x14000000, 0x22000000, 0x5d000000,
+	0x6c800000, 0x9ac00000, 0x4ca00000, 0x54d00000, 0xbe780000, 0xbc6c0000, 0x00b60000, 0xeb090000,
+	0x62468000, 0xb463c000, 0x2573e000, 0xb6283000, 0x90d7b800, 0xe47b2c00, 0x9d69a200, 0x6a33db00,
+	0x06cae780, 0x0b65a340, 0x34f0a5a0, 0x106e4850, 0x7eb5fa38, 0xe00cc71c, 0x41c2fd9a, 0x17245449,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x18000000, 0x54000000, 0x0a000000, 0x29000000,
+	0x07800000, 0x2bc00000, 0x69600000, 0xb7900000, 0xd6080000, 0xd85c0000, 0xda320000, 0x987f0000,
+	0x26808000, 0x10434000, 0x24a36000, 0x19f77000, 0x5d19d800, 0x5f17d400, 0x4d4f3200, 0x9e7e5d00,
+	0xb1814b80, 0xa4c592c0, 0x89e519a0, 0x10d0bff0, 0xf62f8a28, 0x74edf91c, 0xda0d218e, 0x665c5bf9,
+	0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x48000000, 0xe4000000, 0x6e000000, 0x7f000000,
+	0x27800000, 0x47c00000, 0x37a00000, 0x89d00000, 0xf9a80000, 0x81bc0000, 0x2cb20000, 0xa15d0000,
+	0xb6848000, 0xdf47c000, 0x37e66000, 0x89b7d000, 0x0fdac800, 0x15c1e400, 0x3aa67200, 0x73537b00,
+	0x1cef4f80, 0x8f5ffdc0, 0x69875da0, 0xe8c756f0, 0x4820da38, 0x12144f2c, 0x0c0d758a, 0xfd6ba2e5,
+	0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xb8000000, 0x44000000, 0xba000000, 0x81000000,
+	0x4e800000, 0x21c00000, 0xda600000, 0x71500000, 0x82b80000, 0xac2c0000, 0x8ff60000, 0x7d0d0000,
+	0xcf058000, 0x5d814000, 0xf240e000, 0x9b217000, 0x09f41800, 0xa20c5c00, 0x8a82aa00, 0xdbc1d500,
+	0xbb602d80, 0xefd01140, 0x1b7a67a0, 0x324cb450, 0x44a05218, 0x7eb1f924, 0x2dab1f96, 0xf3b0d865,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0xf8000000, 0xec000000, 0xc6000000, 0x21000000,
+	0xd4800000, 0x52400000, 0x6ee00000, 0x16f00000, 0x37080000, 0xb9bc0000, 0x37560000, 0xe59b0000,
+	0x27078000, 0x95874000, 0xf6c1a000, 0x94a3d000, 0x6c10f800, 0x0bf8cc00, 0x69b60600, 0x7b6aed00,
+	0x54086480, 0xfe3f1dc0, 0xca97c2a0, 0x42ba20d0, 0xecd15e28, 0x765af104, 0xb5211ab6, 0xa0d67cef,
+	0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x88000000, 0xd4000000, 0x9a000000, 0x8b000000,
+	0xd9800000, 0x60c00000, 0x06200000, 0xe4100000, 0x37680000, 0xb5bc0000, 0xe1f60000, 0x08dd0000,
+	0xf4078000, 0xaa02c000, 0x7305e000, 0x1586f000, 0xa6c4c800, 0xc3243400, 0x2c911a00, 0x052f6f00,
+	0x0adddd80, 0x63039dc0, 0xdd8127a0, 0x92c602d0, 0xc9263218, 0x2f90ab34, 0x08af8f9a, 0xf01a06d1,
+	0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xa8000000, 0xe4000000, 0x5a000000, 0xa1000000,
+	0xa5800000, 0xb3c00000, 0x22200000, 0xd9700000, 0x82680000, 0x1edc0000, 0x91920000, 0xc0bd0000,
+	0x70008000, 0x6804c000, 0x84016000, 0xaa027000, 0x09029800, 0x41870400, 0xe9c26200, 0x83218700,
+	0x7cf2f680, 0x31af46c0, 0x3cf9f4a0, 0x48e0b1f0, 0x42d39a38, 0x6ed9f30c, 0xf9928cb2, 0x44bd05c5,
+	0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x18000000, 0x0c000000, 0xd2000000, 0xc9000000,
+	0xba800000, 0xdb400000, 0x72e00000, 0x4ef00000, 0xcfc80000, 0x837c0000, 0xdcd60000, 0xa6190000,
+	0x85e38000, 0x3f764000, 0x1f0ba000, 0x0c5e7000, 0xf1861800, 0x90c2fc00, 0xef221e00, 0xbd574500,
+	0x2edc9480, 0x66c023c0, 0x50232aa0, 0xf8d016d0, 0xd01a2638, 0x7ae48934, 0x1af0b29e, 0x71cdaae7,
+	0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0xac000000, 0x1a000000, 0x63000000,
+	0x24800000, 0x28c00000, 0x2c200000, 0xdf100000, 0xaf080000, 0x8fdc0000, 0x36720000, 0xbb7f0000,
+	0xa3a28000, 0x4f52c000, 0xf9ef2000, 0x43ee3000, 0x10ea8800, 0x7c6c5c00, 0x08ac3200, 0x568cff00,
+	0x469c1d80, 0xd710b6c0, 0x130d0fa0, 0x2ddd79f0, 0x61711a28, 0x41ff530c, 0x5e650792, 0x3ef3e5d7,
+	0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x28000000, 0x24000000, 0x8a000000, 0xb1000000,
+	0xe0800000, 0x0bc00000, 0x61a00000, 0x46500000, 0x84a80000, 0xe43c0000, 0x77b20000, 0x39190000,
+	0x4c228000, 0x0b16c000, 0x21cf6000, 0x0048f000, 0xe30a9800, 0x7d6eac00, 0xc89f8a00, 0xb7631b00,
+	0x9976db80, 0x3a3cf9c0, 0x44b431a0, 0x9c9e12f0, 0x3562f218, 0xdc76873c, 0x48bc29b2, 0xf2767ec5,
+	0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x18000000, 0xb4000000, 0x02000000, 0x7b000000,
+	0xcc800000, 0xe1c00000, 0x19a00000, 0x80900000, 0xeea80000, 0x06fc0000, 0x4e760000, 0x695b0000,
+	0xd7e78000, 0x40704000, 0xb45c6000, 0x5a633000, 0xf2310800, 0x9ab91c00, 0xed97fa00, 0x4b2edb00,
+	0x68ba0d80, 0x9e90efc0, 0x0baf97a0, 0x6f7a04d0, 0xe6351228, 0x88b8b704, 0xae969f8e, 0x63af18f9,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x98000000, 0xbc000000, 0xae000000, 0x87000000,
+	0xf0800000, 0xc7c00000, 0x0ca00000, 0xd5100000, 0x46080000, 0xa5dc0000, 0x44f20000, 0x9d7b0000,
+	0xdbe58000, 0xee764000, 0x37bc2000, 0x82c01000, 0x2d238800, 0xe9535c00, 0xdbe84a00, 0x18aaa300,
+	0x39cea980, 0x4578d6c0, 0x07e0c3a0, 0x707565f0, 0xb8ba6208, 0x5643af14, 0xf8e34b8e, 0xccf639cb,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x18000000, 0x64000000, 0x1e000000, 0x1b000000,
+	0x5a800000, 0xf1c00000, 0x53a00000, 0xa1100000, 0xe2880000, 0x0f5c0000, 0x8bf20000, 0xa8ff0000,
+	0xcce38000, 0xc5704000, 0x4f3ae000, 0xd8415000, 0x94e6e800, 0x41702c00, 0xa13b2a00, 0x0b410b00,
+	0xb2606180, 0xcab462c0, 0xf79baba0, 0xebd739f0, 0xfbaca228, 0x678c3704, 0x8edd438e, 0x00b715ed,
+	0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xf8000000, 0x14000000, 0xce000000, 0x35000000,
+	0x00800000, 0xe3c00000, 0x97200000, 0xe7100000, 0xd0e80000, 0xc73c0000, 0xc9760000, 0xf81d0000,
+	0xb2628000, 0xeaf44000, 0xaa586000, 0x20035000, 0x90021800, 0x28060c00, 0xdc00ea00, 0x2205cf00,
+	0xef032580, 0xfb80d1c0, 0xd645afa0, 0x74674ed0, 0x93f01218, 0xa0d8d31c, 0xf0c7b786, 0xdea142c9,
+	0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x28000000, 0x14000000, 0x62000000, 0x87000000,
+	0x8c800000, 0xbac00000, 0x5f200000, 0xb9d00000, 0xf8d80000, 0xeacc0000, 0x74b60000, 0xdee90000,
+	0x3fe78000, 0x1df3c000, 0xdb8ae000, 0x5dd73000, 0xe2dc6800, 0x31cffc00, 0x9e342200, 0xa92b5700,
+	0x7f447380, 0xf0670e40, 0x41b4b1a0, 0xdd6e6950, 0x6da52a38, 0xa2105b14, 0x867ed992, 0xe6589541,
+	0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x98000000, 0xf4000000, 0xfa000000, 0xc7000000,
+	0x95800000, 0x80c00000, 0xaaa00000, 0x17100000, 0xdb980000, 0x554c0000, 0xd4f20000, 0xd0ed0000,
+	0xca658000, 0x2db04000, 0x34886000, 0x2ad6f000, 0xe3bb2800, 0x371a3400, 0x750ffa00, 0xa012ab00,
+	0x26196180, 0x898cf240, 0xb854fba0, 0x96f9a970, 0x4d793238, 0x50be2f24, 0x989dd3be, 0x52ce9d69,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x28000000, 0xa4000000, 0x7e000000, 0xe5000000,
+	0x8d800000, 0x8ec00000, 0x12600000, 0x1bf00000, 0x14880000, 0xa6bc0000, 0xdad20000, 0x0bdf0000,
+	0x17a68000, 0xd914c000, 0xd03d6000, 0xac915000, 0x62fb9800, 0x6cf36400, 0x360e6a00, 0x46ff8d00,
+	0xd2f08080, 0xf309bdc0, 0xbb798aa0, 0x743460f0, 0x456e1228, 0xde89792c, 0x85b81282, 0x6e5404f5,
+	0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x28000000, 0x3c000000, 0x6e000000, 0x07000000,
+	0x81800000, 0x0f400000, 0x03600000, 0x59500000, 0xaff80000, 0xd06c0000, 0x8fb20000, 0x4bef0000,
+	0x85f08000, 0x180ac000, 0xf165a000, 0x40511000, 0x217b0800, 0xd2ac5400, 0xc5944600, 0x2adeb900,
+	0x9cdd2d80, 0x6fd93740, 0x2c5c4ba0, 0xd21c5e70, 0x43ffce28, 0xc6682d1c, 0x0cb4cb82, 0x006a9e63,
+	0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x18000000, 0xd4000000, 0x66000000, 0xfd000000,
+	0x4d800000, 0x8a400000, 0xa1a00000, 0xe9700000, 0xcd380000, 0xe78c0000, 0x9f560000, 0xa90f0000,
+	0x31918000, 0x096a4000, 0x1e076000, 0xd9071000, 0x83811800, 0xab43a400, 0x4625ce00, 0x2c301700,
+	0xba1b1a80, 0x343e9840, 0x340834a0, 0x8c13df50, 0x2b2d5608, 0x63a5f314, 0x9a77b4ae, 0x01ba9f71,
+	0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x28000000, 0xa4000000, 0x2a000000, 0x9f000000,
+	0x32800000, 0xc4400000, 0xf7a00000, 0xed700000, 0xf0680000, 0xffdc0000, 0x6e520000, 0x385b0000,
+	0x67958000, 0x093bc000, 0x01056000, 0x6f86f000, 0x6dc1e800, 0xbb64cc00, 0x6997a600, 0x7c384700,
+	0x0c841280, 0x094432c0, 0x762354a0, 0x05b145f0, 0x5e8bce08, 0xec8b4b14, 0xaf8cd4a2, 0x9b0d85cd,
+	0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x48000000, 0x0c000000, 0xbe000000, 0x69000000,
+	0x40800000, 0x35400000, 0x97e00000, 0x40300000, 0xb2180000, 0xa3ec0000, 0xb1520000, 0xba690000,
+	0xac908000, 0x84cfc000, 0xfd412000, 0x5be01000, 0x1e33f800, 0xab1aac00, 0xab681e00, 0x88143d00,
+	0x93884a80, 0x85a5f340, 0x7651f4a0, 0x6bee1e70, 0x7d536618, 0xe46d512c, 0xb59374aa, 0x8c48de5f,
+	0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xe8000000, 0x34000000, 0x12000000, 0xfd000000,
+	0xe0800000, 0x50400000, 0x2aa00000, 0xb3f00000, 0x05580000, 0x4a6c0000, 0xebd60000, 0x5be90000,
+	0xe5168000, 0x720cc000, 0x77c1e000, 0x7362b000, 0x6b933800, 0xe948cc00, 0xeae65600, 0x61579f00,
+	0x3aa85e80, 0xb1355f40, 0x92b968a0, 0x8bbcb050, 0xe13bee38, 0xf07f931c, 0x2c59e8a2, 0xc8e97041,
+	0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0x2c000000, 0x96000000, 0x23000000,
+	0x15800000, 0xf1400000, 0x54600000, 0x8a900000, 0xe0380000, 0xf06c0000, 0x9a720000, 0x67690000,
+	0x5df68000, 0xef2ec000, 0x19172000, 0x0a7e5000, 0x658be800, 0x43a75400, 0xe237d600, 0xab8fd100,
+	0xc4a62b80, 0x1db7e740, 0xf7c85da0, 0x2244a670, 0xc9e0be18, 0x07d3451c, 0x3a5a5d92, 0xddfda667,
+	0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xf8000000, 0x14000000, 0x3a000000, 0x89000000,
+	0x9b800000, 0xbbc00000, 0x05e00000, 0x55700000, 0xb9080000, 0x7e3c0000, 0x5c160000, 0x673f0000,
+	0x2f968000, 0x60fa4000, 0x0c766000, 0x6a8cf000, 0x89fb5800, 0x87f1b400, 0x79481200, 0x901f9900,
+	0x0481c880, 0x674695c0, 0xc6a13aa0, 0xf1d3bcd0, 0x25dbca08, 0x02676d2c, 0x78b73a96, 0xbbecbcf9,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x88000000, 0x04000000, 0x5a000000, 0x45000000,
+	0x1b800000, 0xa2400000, 0x68600000, 0x23900000, 0xedf80000, 0xe9ac0000, 0xf1760000, 0x9da90000,
+	0x63708000, 0xbca9c000, 0xd2f36000, 0xd3ef7000, 0xa513b800, 0x083f5400, 0x658c5e00, 0xd985d900,
+	0xdb451380, 0xc5e5e940, 0x6ad2ada0, 0x091a8050, 0x32f96638, 0x972a4d2c, 0xd8b2adba, 0x2f8a807d,
+	0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xf8000000, 0x1c000000, 0x2e000000, 0x0f000000,
+	0xc3800000, 0x24400000, 0xe6a00000, 0x72100000, 0x2bd80000, 0x2c0c0000, 0xf4320000, 0x580f0000,
+	0xde338000, 0x950f4000, 0x14b22000, 0x99c91000, 0x27d3c800, 0x083e0400, 0x543c8e00, 0x9a3a0f00,
+	0x653f0980, 0x8ebef440, 0x4efa27a0, 0x9a5eab70, 0xc94ec628, 0x2e144b04, 0xe5da27b6, 0xd30eab73,
+	0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x28000000, 0x24000000, 0x9e000000, 0x4d000000,
+	0x34800000, 0x63c00000, 0xf1a00000, 0x9c700000, 0x95680000, 0xb45c0000, 0x98560000, 0xa4590000,
+	0x00508000, 0xc85cc000, 0x4a576000, 0x33585000, 0x17d0d800, 0xfa1f6c00, 0xc8b00a00, 0xa34a5b00,
+	0xa2687a80, 0x73d99ec0, 0x121790a0, 0xdabb55d0, 0x02465238, 0x8ae0f72c, 0x24179092, 0xf3bb55f5,
+	0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x88000000, 0xbc000000, 0x26000000, 0x0d000000,
+	0x35800000, 0x76c00000, 0x5ee00000, 0xb7500000, 0x75880000, 0x139c0000, 0x19320000, 0xdd9f0000,
+	0x78348000, 0x561bc000, 0x07f4a000, 0x2f7b5000, 0x51601800, 0x1a93a400, 0xbbee6a00, 0x6b894900,
+	0xea999180, 0x96b328c0, 0xb05fdba0, 0x9656f1f0, 0x1e08f228, 0x7c5e2d3c, 0xd857dbaa, 0xbf0af1e3,
+	0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x18000000, 0x1c000000, 0xf2000000, 0xd1000000,
+	0xc6800000, 0xdb400000, 0x24a00000, 0x34f00000, 0xdbf80000, 0x24cc0000, 0x2fd60000, 0xb6cd0000,
+	0x0ed68000, 0x884f4000, 0x79932000, 0x46e8f000, 0x8062d800, 0xa997dc00, 0xaee8be00, 0x64601700,
+	0xf793e680, 0x95e8ca40, 0x6fe6f8a0, 0x18536d50, 0xbb0ae618, 0xb9358b3c, 0x2c1ef8be, 0x609f6d6b,
+	0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xe8000000, 0xb4000000, 0x0a000000, 0x6d000000,
+	0xa7800000, 0x73400000, 0x11e00000, 0x3a300000, 0x7e680000, 0xcd9c0000, 0xfed60000, 0x0fdb0000,
+	0xb6b28000, 0x01aac000, 0xe3bfe000, 0xcac47000, 0xb5a77800, 0x29557400, 0xd49e3600, 0x33569d00,
+	0xc19b9280, 0x18d780c0, 0x14dec4a0, 0x3234add0, 0x5a6f4e28, 0xff98e92c, 0x3fd724b2, 0xfe5bddd1,
+	0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x58000000, 0xe4000000, 0x92000000, 0x59000000,
+	0x64800000, 0x2b400000, 0x64600000, 0xf7100000, 0xa2a80000, 0xeb7c0000, 0x1e720000, 0x1b3f0000,
+	0x8f968000, 0x4fef4000, 0x3c18e000, 0x40e23000, 0x3c539800, 0x96cc4c00, 0x346bae00, 0x00df5100,
+	0x86470f80, 0x5ae12fc0, 0x6950c1a0, 0xfc4c0ef0, 0x402a3628, 0x933c1d2c, 0x8392219e, 0x41ed3ee5,
+	0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x58000000, 0x84000000, 0x4a000000, 0x1d000000,
+	0x83800000, 0xfec00000, 0x52200000, 0x5ad00000, 0xf3f80000, 0x6d6c0000, 0x0bf60000, 0x75af0000,
+	0x32d48000, 0x6ffd4000, 0x036fe000, 0xecf5f000, 0xb32f7800, 0xcb945400, 0x891cfa00, 0x169a6f00,
+	0xc659ab80, 0xd379c740, 0xff2831a0, 0xad941850, 0xa21d8208, 0xf61d3b3c, 0xb41fd1be, 0x651de84d,
+};
+
+RENDER_END
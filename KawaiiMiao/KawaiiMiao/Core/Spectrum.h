@@ -20,6 +20,35 @@ inline void RGBToXYZ(const Float rgb[3], Float xyz[3])
 
 enum class SpectrumType { Reflectance, Illuminant };
 
+// CIE 1931 color matching functions, sampled every nm from 360 to 830 nm
+static constexpr int nCIESamples = 471;
+extern const Float CIE_X[nCIESamples];
+extern const Float CIE_Y[nCIESamples];
+extern const Float CIE_Z[nCIESamples];
+static constexpr Float CIE_Y_integral = 106.856895;
+
+// Spectra of the white, cyan, magenta, yellow, red, green and blue basis of
+// Smits' RGB to spectrum conversion, for reflectances and illuminants
+static constexpr int nRGB2SpectSamples = 32;
+extern const Float RGB2SpectLambda[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectWhite[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectCyan[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectMagenta[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectYellow[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectRed[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectGreen[nRGB2SpectSamples];
+extern const Float RGBRefl2SpectBlue[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectWhite[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectCyan[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectMagenta[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectYellow[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectRed[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectGreen[nRGB2SpectSamples];
+extern const Float RGBIllum2SpectBlue[nRGB2SpectSamples];
+
+// Value at wavelength _l_ of the piecewise linear spectrum through (lambda[i], vals[i])
+Float interpolateSpectrumSamples(const Float* lambda, const Float* vals, int n, Float l);
+
 template <int nSpectrumSamples>
 class CoefficientSpectrum
 {
@@ -218,6 +247,14 @@ public:
 		return m;
 	}
 
+	Float minComponentValue() const
+	{
+		Float m = c[0];
+		for (int i = 1; i < nSpectrumSamples; ++i)
+			m = glm::min(m, c[i]);
+		return m;
+	}
+
 	bool hasNaNs() const
 	{
 		for (int i = 0; i < nSpectrumSamples; ++i)
@@ -303,4 +340,52 @@ inline CoefficientSpectrum<nSpectrumSamples> pow(
 	return ret;
 }
 
+// Wavelength range of the spectral mode, the range of the CIE tables, in nm
+static constexpr Float LambdaMin = 360, LambdaMax = 830;
+
+// Number of wavelengths carried along a path in the spectral mode
+static constexpr int NSpectrumSamples = 4;
+
+// The wavelengths of a path: a hero wavelength drawn uniformly in [LambdaMin, LambdaMax]
+// and NSpectrumSamples - 1 more at even offsets from it, wrapped around the range.
+// The path is traced for all of them at once, sharing every direction sampled.
+class SampledWavelengths
+{
+public:
+	static SampledWavelengths sampleUniform(Float u);
+
+	Float operator[](int i) const { return m_lambda[i]; }
+
+	Float pdf(int i) const { return m_pdf[i]; }
+
+	// Keep only the hero wavelength, for events whose outcome depends on the
+	// wavelength such as refraction with a wavelength-dependent index
+	void terminateSecondary();
+
+	bool secondaryTerminated() const;
+
+private:
+	Float m_lambda[NSpectrumSamples], m_pdf[NSpectrumSamples];
+};
+
+// Spectral values at the wavelengths of a SampledWavelengths, no more
+// arithmetic than an RGBSpectrum
+class SampledSpectrum : public CoefficientSpectrum<NSpectrumSamples>
+{
+	using CoefficientSpectrum<NSpectrumSamples>::c;
+
+public:
+	SampledSpectrum(Float v = 0.f) : CoefficientSpectrum<NSpectrumSamples>(v) {}
+	SampledSpectrum(const CoefficientSpectrum<NSpectrumSamples>& v) : CoefficientSpectrum<NSpectrumSamples>(v) {}
+
+	// Smits' spectrum for _rgb_, evaluated at _lambda_
+	static SampledSpectrum fromRGB(const RGBSpectrum& rgb, const SampledWavelengths& lambda,
+		SpectrumType type = SpectrumType::Reflectance);
+
+	// Monte Carlo estimate of the XYZ color of the spectrum from its values at _lambda_
+	void toXYZ(const SampledWavelengths& lambda, Float xyz[3]) const;
+
+	RGBSpectrum toRGBSpectrum(const SampledWavelengths& lambda) const;
+};
+
 RENDER_END
\ No newline at end of file
@@ -12,6 +12,10 @@ public:
 
 	virtual Float evaluate(const Vector2f& p) const override;
 
+	virtual bool isSeparable() const override { return true; }
+	virtual Float evaluate1D(Float d, int axis) const override { return 1.0f; }
+	virtual bool isConstant() const override { return true; }
+
 	virtual std::string toString() const override { return "BoxFilter[]"; }
 };
 
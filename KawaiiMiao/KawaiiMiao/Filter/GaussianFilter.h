@@ -15,6 +15,9 @@ public:
 
 	Float evaluate(const Vector2f& p) const override;
 
+	virtual bool isSeparable() const override { return true; }
+	virtual Float evaluate1D(Float d, int axis) const override { return Gaussian(d, axis == 0 ? expX : expY); }
+
 	virtual std::string toString() const override { return "GaussianFilter[]"; }
 private:
 	Float Gaussian(Float d, Float expv) const
@@ -9,7 +9,8 @@ RENDER_REGISTER_CLASS(PathIntegrator, "Path")
 
 PathIntegrator::PathIntegrator(const APropertyTreeNode& node)
 	: SamplerIntegrator(nullptr, nullptr), m_maxDepth(node.getPropertyList().getInteger("Depth", 2))
-	, m_rrThreshold(1.f), m_lightSampleStrategy("spatial")
+	, m_rrThreshold(1.f), m_lightSampleStrategy(node.getPropertyList().getString("LightSampleStrategy", "bvh"))
+	, m_spectral(node.getPropertyList().getBoolean("Spectral", false))
 {
 	//Sampler
 	const auto& samplerNode = node.getPropertyChild("Sampler");
@@ -21,13 +22,15 @@ PathIntegrator::PathIntegrator(const APropertyTreeNode& node)
 	m_camera = Camera::ptr(static_cast<Camera*>(AObjectFactory::createInstance(
 		cameraNode.getTypeName(), cameraNode)));
 
+	parseRenderSettings(node);
+
 	activate();
 }
 
 PathIntegrator::PathIntegrator(int maxDepth, Camera::ptr camera, Sampler::ptr sampler,
-	Float rrThreshold, const std::string& lightSampleStrategy)
+	Float rrThreshold, const std::string& lightSampleStrategy, bool spectral)
 	: SamplerIntegrator(camera, sampler), m_maxDepth(maxDepth),
-	m_rrThreshold(rrThreshold), m_lightSampleStrategy(lightSampleStrategy) {}
+	m_rrThreshold(rrThreshold), m_lightSampleStrategy(lightSampleStrategy), m_spectral(spectral) {}
 
 void PathIntegrator::preprocess(const Scene& scene)
 {
@@ -37,7 +40,33 @@ void PathIntegrator::preprocess(const Scene& scene)
 Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 	MemoryArena& arena, int depth) const
 {
-	Spectrum L(0.f), beta(1.f);
+	if (m_spectral)
+	{
+		SpectralConversion conversion(SampledWavelengths::sampleUniform(sampler.get1D()));
+		return tracePath(r, nullptr, scene, sampler, arena, conversion);
+	}
+	return tracePath(r, nullptr, scene, sampler, arena, RGBConversion());
+}
+
+Spectrum PathIntegrator::primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena) const
+{
+	if (m_spectral)
+	{
+		SpectralConversion conversion(SampledWavelengths::sampleUniform(sampler.get1D()));
+		return tracePath(ray, &primaryHit, scene, sampler, arena, conversion);
+	}
+	return tracePath(ray, &primaryHit, scene, sampler, arena, RGBConversion());
+}
+
+template <typename Conversion>
+Spectrum PathIntegrator::tracePath(const Ray& r, const HitRecord* primaryHit, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena, const Conversion& conversion) const
+{
+	// Note: the RGB values of materials and lights are converted as they are met,
+	//       the radiance is only turned back into RGB once the path is done
+	typedef typename Conversion::Radiance Radiance;
+	Radiance L(0.f), beta(1.f);
 	Ray ray(r);
 
 	bool specularBounce = false;
@@ -57,7 +86,19 @@ Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 
 		// Intersect _ray_ with scene and store intersection in _isect_
 		SurfaceInteraction isect;
-		bool hit = scene.hit(ray, isect);
+		bool hit;
+		if (primaryHit != nullptr)
+		{
+			// The camera ray was already traced with its packet
+			hit = primaryHit->m_primitive != nullptr;
+			if (hit)
+				scene.fillSurfaceInteraction(ray, *primaryHit, isect);
+			primaryHit = nullptr;
+		}
+		else
+		{
+			hit = scene.hit(ray, isect);
+		}
 
 		// Possibly add emitted light at intersection
 		if (bounces == 0 || specularBounce)
@@ -65,12 +106,12 @@ Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 			// Add emitted light at path vertex or from the environment
 			if (hit)
 			{
-				L += beta * isect.Le(-ray.direction());
+				L += beta * conversion.illuminant(isect.Le(-ray.direction()));
 			}
 			else
 			{
 				for (const auto& light : scene.m_infiniteLights)
-					L += beta * light->Le(ray);
+					L += beta * conversion.illuminant(light->Le(ray));
 			}
 		}
 
@@ -91,18 +132,18 @@ Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 			continue;
 		}
 
-		const Distribution1D* distrib = m_lightDistribution->lookup(isect.p);
-
 		// Sample illumination from lights to find path contribution.
 		// (But skip this for perfectly specular BSDFs.)
 		if (isect.bsdf->numComponents(BxDFType(BSDF_ALL & ~BSDF_SPECULAR)) > 0)
 		{
-			//++totalPaths;
-			Spectrum Ld = beta * uniformSampleOneLight(isect, scene, arena, sampler, distrib);
-			//if (Ld.isBlack()) 
-			//	++zeroRadiancePaths;
-			CHECK_GE(Ld.y(), 0.f);
-			L += Ld;
+			DirectLightingQuery query;
+			Float lightPdf;
+			if (sampleOneLight(isect, scene, sampler, m_lightDistribution.get(), query, lightPdf))
+			{
+				Radiance Ld = beta * (resolveDirect(query, scene, conversion) / lightPdf);
+				CHECK_GE(Ld.minComponentValue(), 0.f);
+				L += Ld;
+			}
 		}
 
 		// Sample BSDF to get new path direction
@@ -113,11 +154,13 @@ Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 
 		if (f.isBlack() || pdf == 0.f)
 			break;
-		beta *= f * absDot(wi, isect.normal) / pdf;
+		beta *= conversion.reflectance(f) * (absDot(wi, isect.normal) / pdf);
 
-		CHECK_GE(beta.y(), 0.f);
-		DCHECK(!glm::isinf(beta.y()));
+		CHECK_GE(beta.minComponentValue(), 0.f);
+		DCHECK(!beta.hasNaNs() && !glm::isinf(beta.maxComponentValue()));
 
+		// Note: every BSDF in the tree refracts all wavelengths alike. One with a
+		//       wavelength-dependent index has to terminate the secondary wavelengths here.
 		specularBounce = (flags & BSDF_SPECULAR) != 0;
 		if ((flags & BSDF_SPECULAR) && (flags & BSDF_TRANSMISSION))
 		{
@@ -132,20 +175,19 @@ Spectrum PathIntegrator::Li(const Ray& r, const Scene& scene, Sampler& sampler,
 
 		// Possibly terminate the path with Russian roulette.
 		// Factor out radiance scaling due to refraction in rrBeta.
-		Spectrum rrBeta = beta * etaScale;
+		Radiance rrBeta = beta * etaScale;
 		if (rrBeta.maxComponentValue() < m_rrThreshold && bounces > 3)
 		{
 			Float q = glm::max((Float).05f, 1 - rrBeta.maxComponentValue());
 			if (sampler.get1D() < q)
 				break;
 			beta /= 1 - q;
-			DCHECK(!glm::isinf(beta.y()));
+			DCHECK(!glm::isinf(beta.maxComponentValue()));
 		}
 	}
 
 	//ReportValue(pathLength, bounces);
-	return L;
+	return conversion.toRGB(L);
 }
 
-
 RENDER_END
\ No newline at end of file
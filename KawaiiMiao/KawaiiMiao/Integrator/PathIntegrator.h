@@ -5,6 +5,9 @@
 
 RENDER_BEGIN
 
+// Unidirectional path tracer. With "Spectral" set, every path is traced for
+// NSpectrumSamples wavelengths sampled around a hero wavelength instead of RGB,
+// and converted to RGB once its radiance is known.
 class PathIntegrator : public SamplerIntegrator
 {
 public:
@@ -12,20 +15,30 @@ public:
 	PathIntegrator(const APropertyTreeNode& props);
 
 	PathIntegrator(int maxDepth, Camera::ptr camera, Sampler::ptr sampler,
-		Float rrThreshold = 1, const std::string& lightSampleStrategy = "spatial");
+		Float rrThreshold = 1, const std::string& lightSampleStrategy = "bvh", bool spectral = false);
 
 	virtual void preprocess(const Scene& scene) override;
 
 	virtual Spectrum Li(const Ray& ray, const Scene& scene, Sampler& sampler,
 		MemoryArena& arena, int depth) const override;
 
+	virtual Spectrum primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena) const override;
+
 	virtual std::string toString() const override { return "PathIntegrator[]"; }
 
 private:
+	// Trace the path starting with _r_, the first hit is taken from _primaryHit_ unless it is nullptr.
+	// The radiance is carried as RGBConversion or SpectralConversion makes it.
+	template <typename Conversion>
+	Spectrum tracePath(const Ray& r, const HitRecord* primaryHit, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena, const Conversion& conversion) const;
+
 	// PathIntegrator Private Data
 	int m_maxDepth;
 	Float m_rrThreshold;
 	std::string m_lightSampleStrategy;
+	bool m_spectral;
 	std::unique_ptr<LightDistribution> m_lightDistribution;
 };
 
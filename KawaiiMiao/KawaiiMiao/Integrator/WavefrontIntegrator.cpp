@@ -0,0 +1,384 @@
+#include "WavefrontIntegrator.h"
+
+#include "../Core/BSDF.h"
+#include "../Core/Scene.h"
+#include "../Tool/Memory.h"
+#include "../Samplers/RandomSampler.h"
+
+#include <algorithm>
+#include <functional>
+
+RENDER_BEGIN
+
+RENDER_REGISTER_CLASS(WavefrontIntegrator, "Wavefront")
+
+WavefrontIntegrator::WavefrontIntegrator(const APropertyTreeNode& node)
+	: SamplerIntegrator(nullptr, nullptr), m_maxDepth(node.getPropertyList().getInteger("Depth", 2))
+	, m_rrThreshold(1.f), m_lightSampleStrategy(node.getPropertyList().getString("LightSampleStrategy", "bvh"))
+	, m_queueSize(glm::max(1, node.getPropertyList().getInteger("QueueSize", 1 << 14)))
+{
+	//Sampler
+	const auto& samplerNode = node.getPropertyChild("Sampler");
+	m_sampler = Sampler::ptr(static_cast<Sampler*>(AObjectFactory::createInstance(
+		samplerNode.getTypeName(), samplerNode)));
+
+	//Camera
+	const auto& cameraNode = node.getPropertyChild("Camera");
+	m_camera = Camera::ptr(static_cast<Camera*>(AObjectFactory::createInstance(
+		cameraNode.getTypeName(), cameraNode)));
+
+	// Note: the bounces of a tile draw from one stream, so tiles split at run time would change
+	//       the image. Adaptive splitting is only on when asked for.
+	m_adaptiveTiles = false;
+	parseRenderSettings(node);
+	if (m_adaptiveSampling)
+	{
+		K_WARN("Adaptive sampling is not supported by the wavefront integrator, sampling uniformly");
+		m_adaptiveSampling = false;
+	}
+
+	activate();
+}
+
+WavefrontIntegrator::WavefrontIntegrator(int maxDepth, Camera::ptr camera, Sampler::ptr sampler,
+	Float rrThreshold, const std::string& lightSampleStrategy, int queueSize)
+	: SamplerIntegrator(camera, sampler), m_maxDepth(maxDepth), m_rrThreshold(rrThreshold),
+	m_lightSampleStrategy(lightSampleStrategy), m_queueSize(glm::max(1, queueSize)) {}
+
+void WavefrontIntegrator::preprocess(const Scene& scene)
+{
+	m_lightDistribution = createLightSampleDistribution(m_lightSampleStrategy, scene);
+}
+
+void WavefrontIntegrator::PathQueue::clear()
+{
+	m_rays.clear();
+	m_L.clear();
+	m_beta.clear();
+	m_etaScale.clear();
+	m_bounces.clear();
+	m_specularBounce.clear();
+}
+
+void WavefrontIntegrator::PathQueue::push(const Ray& ray)
+{
+	m_rays.push_back(ray);
+	m_L.push_back(Spectrum(0.f));
+	m_beta.push_back(Spectrum(1.f));
+	m_etaScale.push_back(1.f);
+	m_bounces.push_back(0);
+	m_specularBounce.push_back(false);
+}
+
+Spectrum WavefrontIntegrator::Li(const Ray& ray, const Scene& scene, Sampler& sampler,
+	MemoryArena& arena, int depth) const
+{
+	PathQueue queue;
+	queue.push(ray);
+	trace(queue, scene, sampler, arena);
+	return queue.m_L[0];
+}
+
+int64_t WavefrontIntegrator::renderTile(const Scene& scene, const Bounds2i& tileBounds, Sampler& tileSampler,
+	FilmTile& filmTile, MemoryArena& arena, int64_t firstSample, int64_t endSample) const
+{
+	// Camera sample of the wave, only rays with a weight get a path
+	struct FilmSample
+	{
+		Vector2f m_pFilm;
+		Float m_rayWeight;
+		Vector2i m_pixel;
+		int64_t m_sampleNumber;
+		int m_path;
+	};
+
+	// Whole pixels go into a wave so that each pixel's samples come from one run of the sampler
+	const int64_t samplesPerPixel = glm::max((int64_t)1, endSample - firstSample);
+	const int pixelsPerWave = (int)glm::max((int64_t)1, m_queueSize / samplesPerPixel);
+
+	// The bounces of all paths of a queue draw from one stream in queue order, which only a random
+	// sampler supports; low discrepancy samplers are used for the camera samples alone.
+	// Note: the seed is the complement of the tile sampler's, so the two streams never coincide
+	RandomSampler bounceSampler(endSample, ~(int)firstSample);
+	bounceSampler.startPixel(tileBounds.m_pMin);
+
+	std::vector<Vector2i> pixels;
+	pixels.reserve(tileBounds.area());
+	for (Vector2i pixel : tileBounds)
+	{
+		pixels.push_back(pixel);
+	}
+
+	std::vector<FilmSample> samples;
+	PathQueue queue;
+	std::vector<Ray> cameraRays;
+	HitBatch primaryHits;
+	int64_t tileSamples = 0;
+	for (size_t waveBegin = 0; waveBegin < pixels.size(); waveBegin += pixelsPerWave)
+	{
+		const size_t waveEnd = glm::min(pixels.size(), waveBegin + pixelsPerWave);
+		samples.clear();
+		queue.clear();
+
+		// Generate: camera rays of every sample of the wave
+		for (size_t p = waveBegin; p < waveEnd; ++p)
+		{
+			const Vector2i& pixel = pixels[p];
+			tileSampler.startPixel(pixel);
+			tileSampler.setSampleNumber(firstSample);
+			do
+			{
+				CameraSample cameraSample = tileSampler.getCameraSample(pixel);
+				Ray ray;
+				Float rayWeight = m_camera->castingRay(cameraSample, ray);
+
+				FilmSample sample = { cameraSample.pFilm, rayWeight, pixel, tileSampler.currentSampleNumber(), -1 };
+				if (rayWeight > 0)
+				{
+					sample.m_path = queue.size();
+					queue.push(ray);
+				}
+				samples.push_back(sample);
+			} while (tileSampler.startNextSample() && tileSampler.currentSampleNumber() < endSample);
+		}
+
+		// The camera rays are overwritten by the bounces, the AOVs need them afterwards
+		if (filmTile.hasAOVs())
+			cameraRays = queue.m_rays;
+
+		// Bounces draw their samples in queue order, keep the sampler on a valid sample number
+		bounceSampler.setSampleNumber(firstSample);
+		trace(queue, scene, bounceSampler, arena, filmTile.hasAOVs() ? &primaryHits : nullptr);
+
+		// Accumulate: add the radiance of every sample to the film tile
+		for (const FilmSample& sample : samples)
+		{
+			Spectrum L = sample.m_path >= 0 ? queue.m_L[sample.m_path] : Spectrum(0.f);
+			checkRadiance(L, sample.m_pixel, sample.m_sampleNumber);
+			filmTile.addSample(sample.m_pFilm, L, sample.m_rayWeight);
+		}
+
+		// Record the first visible surfaces for the AOVs of the film from the hits of the
+		// first intersect stage. The tile sampler replays the camera dimensions of each sample,
+		// so the AOVs draw the values they would have drawn right after the camera sample.
+		if (filmTile.hasAOVs())
+		{
+			Vector2i current(-1, -1);
+			for (const FilmSample& sample : samples)
+			{
+				if (sample.m_path < 0)
+					continue;
+				if (sample.m_pixel != current)
+				{
+					current = sample.m_pixel;
+					tileSampler.startPixel(current);
+				}
+				tileSampler.setSampleNumber(sample.m_sampleNumber);
+				tileSampler.getCameraSample(current);
+				addAOVSample(cameraRays[sample.m_path], primaryHits.m_found[sample.m_path],
+					primaryHits.m_records[sample.m_path], scene, tileSampler, arena, sample.m_pFilm, filmTile);
+				arena.Reset();
+			}
+		}
+		tileSamples += (int64_t)samples.size();
+	}
+	return tileSamples;
+}
+
+void WavefrontIntegrator::trace(PathQueue& queue, const Scene& scene, Sampler& sampler, MemoryArena& arena,
+	HitBatch* primaryHits) const
+{
+	const int nPaths = queue.size();
+
+	// Per path state of the current bounce
+	std::vector<HitRecord> hits(nPaths), bsdfHits(nPaths);
+	std::vector<DirectLightingQuery> queries(nPaths);
+	std::vector<Float> lightPdfs(nPaths);
+	std::vector<Spectrum> directBeta(nPaths);
+	std::vector<uint8_t> found(nPaths), hasQuery(nPaths), unoccluded(nPaths), bsdfHitFound(nPaths);
+
+	std::vector<std::pair<const Material*, int>> shadeOrder;
+	shadeOrder.reserve(nPaths);
+	std::vector<int> active(nPaths), next, batchPaths;
+	next.reserve(nPaths);
+	batchPaths.reserve(nPaths);
+	RayBatch batch;
+	HitBatch batchHits;
+	for (int i = 0; i < nPaths; ++i)
+	{
+		active[i] = i;
+	}
+
+	while (!active.empty())
+	{
+		// Intersect: closest hits of all active rays, surfaces are only completed when shaded.
+		// The queue is in pixel order, so the camera rays form coherent packets.
+		batch.clear();
+		for (int i : active)
+			batch.push(queue.m_rays[i]);
+		scene.hitN(batch, batchHits);
+		for (size_t k = 0; k < active.size(); ++k)
+		{
+			hits[active[k]] = batchHits.m_records[k];
+			found[active[k]] = batchHits.m_found[k];
+		}
+		// The first round intersects the initial rays
+		if (primaryHits != nullptr)
+		{
+			*primaryHits = batchHits;
+			primaryHits = nullptr;
+		}
+
+		// Sort the hits by material so that the shading runs in coherent batches,
+		// escaped paths pick up the environment and are done
+		shadeOrder.clear();
+		for (int i : active)
+		{
+			if (found[i])
+			{
+				shadeOrder.push_back({ hits[i].m_primitive->getMaterial(), i });
+			}
+			else if (queue.m_bounces[i] == 0 || queue.m_specularBounce[i])
+			{
+				for (const auto& light : scene.m_infiniteLights)
+					queue.m_L[i] += queue.m_beta[i] * light->Le(queue.m_rays[i]);
+			}
+		}
+		std::sort(shadeOrder.begin(), shadeOrder.end(),
+			[](const std::pair<const Material*, int>& a, const std::pair<const Material*, int>& b)
+		{
+			return std::less<const Material*>()(a.first, b.first) || (a.first == b.first && a.second < b.second);
+		});
+
+		// Shade: emission, scattering functions, light selection and the next path direction
+		next.clear();
+		for (const auto& entry : shadeOrder)
+		{
+			const int i = entry.second;
+			Ray& ray = queue.m_rays[i];
+			Spectrum& beta = queue.m_beta[i];
+			SurfaceInteraction isect;
+			scene.fillSurfaceInteraction(ray, hits[i], isect);
+			hasQuery[i] = false;
+
+			// Possibly add emitted light at intersection
+			if (queue.m_bounces[i] == 0 || queue.m_specularBounce[i])
+			{
+				queue.m_L[i] += beta * isect.Le(-ray.direction());
+			}
+
+			// Terminate path if _maxDepth_ was reached
+			if (queue.m_bounces[i] >= m_maxDepth)
+				continue;
+
+			// Compute scattering functions and skip over medium boundaries
+			isect.computeScatteringFunctions(ray, arena, true);
+			if (!isect.bsdf)
+			{
+				ray = isect.spawnRay(ray.direction());
+				next.push_back(i);
+				continue;
+			}
+
+			// Choose a light, its rays are traced in bulk below.
+			// (But skip this for perfectly specular BSDFs.)
+			if (isect.bsdf->numComponents(BxDFType(BSDF_ALL & ~BSDF_SPECULAR)) > 0)
+			{
+				queries[i] = DirectLightingQuery();
+				hasQuery[i] = sampleOneLight(isect, scene, sampler, m_lightDistribution.get(), queries[i], lightPdfs[i]);
+				directBeta[i] = beta;
+			}
+
+			// Sample BSDF to get new path direction
+			Vector3f wo = -ray.direction(), wi;
+			Float pdf;
+			BxDFType flags;
+			Spectrum f = isect.bsdf->sample_f(wo, wi, sampler.get2D(), pdf, flags, BSDF_ALL);
+
+			if (f.isBlack() || pdf == 0.f)
+				continue;
+			beta *= f * absDot(wi, isect.normal) / pdf;
+
+			CHECK_GE(beta.y(), 0.f);
+			DCHECK(!glm::isinf(beta.y()));
+
+			queue.m_specularBounce[i] = (flags & BSDF_SPECULAR) != 0;
+			if ((flags & BSDF_SPECULAR) && (flags & BSDF_TRANSMISSION))
+			{
+				Float eta = isect.bsdf->m_eta;
+				queue.m_etaScale[i] *= (dot(wo, isect.normal) > 0) ? (eta * eta) : 1 / (eta * eta);
+			}
+
+			ray = isect.spawnRay(wi);
+
+			// Possibly terminate the path with Russian roulette.
+			// Factor out radiance scaling due to refraction in rrBeta.
+			Spectrum rrBeta = beta * queue.m_etaScale[i];
+			if (rrBeta.maxComponentValue() < m_rrThreshold && queue.m_bounces[i] > 3)
+			{
+				Float q = glm::max((Float).05f, 1 - rrBeta.maxComponentValue());
+				if (sampler.get1D() < q)
+					continue;
+				beta /= 1 - q;
+				DCHECK(!glm::isinf(beta.y()));
+			}
+
+			++queue.m_bounces[i];
+			next.push_back(i);
+		}
+
+		// Shadow: visibility of the sampled light points, the shadow rays of a material
+		// tend to head for the same light
+		batch.clear();
+		batchPaths.clear();
+		for (const auto& entry : shadeOrder)
+		{
+			const int i = entry.second;
+			if (hasQuery[i] && queries[i].m_testVisibility)
+			{
+				const VisibilityTester& visibility = queries[i].m_visibility;
+				batch.push(visibility.P0().spawnRayTo(visibility.P1()));
+				batchPaths.push_back(i);
+			}
+		}
+		scene.occludedN(batch, batchHits);
+		for (size_t k = 0; k < batchPaths.size(); ++k)
+			unoccluded[batchPaths[k]] = !batchHits.m_found[k];
+
+		// BSDF rays of the direct lighting, looking for the sampled light
+		batch.clear();
+		batchPaths.clear();
+		for (const auto& entry : shadeOrder)
+		{
+			const int i = entry.second;
+			if (hasQuery[i] && queries[i].m_traceBsdfRay)
+			{
+				batch.push(queries[i].m_bsdfRay);
+				batchPaths.push_back(i);
+			}
+		}
+		scene.hitN(batch, batchHits);
+		for (size_t k = 0; k < batchPaths.size(); ++k)
+		{
+			bsdfHits[batchPaths[k]] = batchHits.m_records[k];
+			bsdfHitFound[batchPaths[k]] = batchHits.m_found[k];
+		}
+
+		// Accumulate: direct lighting weighted by the path throughput at the vertex
+		for (const auto& entry : shadeOrder)
+		{
+			const int i = entry.second;
+			if (!hasQuery[i])
+				continue;
+			Spectrum Ld = directBeta[i] * (resolveDirect(queries[i], scene,
+				unoccluded[i] != 0, bsdfHitFound[i] != 0, bsdfHits[i]) / lightPdfs[i]);
+			CHECK_GE(Ld.y(), 0.f);
+			queue.m_L[i] += Ld;
+		}
+
+		arena.Reset();
+		active.swap(next);
+	}
+}
+
+RENDER_END
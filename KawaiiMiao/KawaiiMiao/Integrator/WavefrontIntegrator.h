@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../Core/Integrator.h"
+#include "../Core/LightDistrib.h"
+
+RENDER_BEGIN
+
+// Breadth-first path tracer, computes the same estimate as PathIntegrator.
+// The camera rays of a tile are generated up front into queues of at most "QueueSize" paths,
+// then every bounce runs as a sequence of stages over the whole queue:
+// intersect -> sort by material -> shade and sample -> shadow and BSDF rays -> accumulate.
+// Note: the random numbers are drawn in queue order, so the image matches PathIntegrator
+//       in expectation rather than sample for sample.
+class WavefrontIntegrator : public SamplerIntegrator
+{
+public:
+
+	WavefrontIntegrator(const APropertyTreeNode& props);
+
+	WavefrontIntegrator(int maxDepth, Camera::ptr camera, Sampler::ptr sampler,
+		Float rrThreshold = 1, const std::string& lightSampleStrategy = "bvh", int queueSize = 1 << 14);
+
+	virtual void preprocess(const Scene& scene) override;
+
+	// Trace a single path, a queue of one
+	virtual Spectrum Li(const Ray& ray, const Scene& scene, Sampler& sampler,
+		MemoryArena& arena, int depth) const override;
+
+	virtual std::string toString() const override { return "WavefrontIntegrator[]"; }
+
+protected:
+	virtual int64_t renderTile(const Scene& scene, const Bounds2i& tileBounds, Sampler& tileSampler,
+		FilmTile& filmTile, MemoryArena& arena, int64_t firstSample, int64_t endSample) const override;
+
+private:
+	// Path state, one entry per path in structure of arrays layout
+	struct PathQueue
+	{
+		std::vector<Ray> m_rays;
+		std::vector<Spectrum> m_L, m_beta;
+		std::vector<Float> m_etaScale;
+		std::vector<int> m_bounces;
+		std::vector<uint8_t> m_specularBounce;
+
+		int size() const { return (int)m_rays.size(); }
+		void clear();
+		void push(const Ray& ray);
+	};
+
+	// Run all paths of _queue_ to completion, radiance ends up in _queue.m_L_.
+	// The closest hits of the initial rays are kept in _primaryHits_ if given.
+	void trace(PathQueue& queue, const Scene& scene, Sampler& sampler, MemoryArena& arena,
+		HitBatch* primaryHits = nullptr) const;
+
+	// WavefrontIntegrator Private Data
+	int m_maxDepth;
+	Float m_rrThreshold;
+	std::string m_lightSampleStrategy;
+	int m_queueSize;
+	std::unique_ptr<LightDistribution> m_lightDistribution;
+};
+
+RENDER_END
@@ -22,6 +22,8 @@ WhittedIntegrator::WhittedIntegrator(const APropertyTreeNode& node)
 	m_camera = Camera::ptr(static_cast<Camera*>(AObjectFactory::createInstance(
 		cameraNode.getTypeName(), cameraNode)));
 
+	parseRenderSettings(node);
+
 	activate();
 
 }
@@ -29,18 +31,33 @@ WhittedIntegrator::WhittedIntegrator(const APropertyTreeNode& node)
 Spectrum WhittedIntegrator::Li(const Ray& ray, const Scene& scene,
 	Sampler& sampler, MemoryArena& arena, int depth) const
 {
-	Spectrum L(0.);
+	HitRecord record;
+	scene.hit(ray, record);
+	return shade(ray, record, scene, sampler, arena, depth);
+}
 
-	SurfaceInteraction isect;
+Spectrum WhittedIntegrator::primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena) const
+{
+	return shade(ray, primaryHit, scene, sampler, arena, 0);
+}
+
+Spectrum WhittedIntegrator::shade(const Ray& ray, const HitRecord& record, const Scene& scene,
+	Sampler& sampler, MemoryArena& arena, int depth) const
+{
+	Spectrum L(0.);
 
 	// No intersection found, just return lights emission
-	if (!scene.hit(ray, isect))
+	if (record.m_primitive == nullptr)
 	{
 		for (const auto& light : scene.m_lights)
 			L += light->Le(ray);
 		return L;
 	}
 
+	SurfaceInteraction isect;
+	scene.fillSurfaceInteraction(ray, record, isect);
+
 	// Compute emitted and reflected light at ray intersection point
 
 	// Initialize common variables for Whitted integrator
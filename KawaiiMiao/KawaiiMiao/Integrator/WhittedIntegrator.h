@@ -16,8 +16,15 @@ public:
 	virtual Spectrum Li(const Ray& ray, const Scene& scene,
 		Sampler& sampler, MemoryArena& arena, int depth) const override;
 
+	virtual Spectrum primaryLi(const Ray& ray, const HitRecord& primaryHit, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena) const override;
+
 	virtual std::string toString() const override { return "WhittedIntegrator[]"; }
 private:
+	// Radiance along _ray_ given its closest hit _record_
+	Spectrum shade(const Ray& ray, const HitRecord& record, const Scene& scene,
+		Sampler& sampler, MemoryArena& arena, int depth) const;
+
 	const int m_maxDepth;
 };
 
@@ -49,6 +49,15 @@ Spectrum DiffuseAreaLight::power() const
 	return (m_twoSided ? 2 : 1) * m_Lemit * m_area * Pi;
 }
 
+bool DiffuseAreaLight::bounds(LightBounds& lb) const
+{
+	// Emits over the whole hemisphere around each normal
+	DirectionCone normals = m_shape->normalBounds();
+	lb = LightBounds(m_shape->worldBound(), normals.m_w, power().maxComponentValue(),
+		normals.m_cosTheta, 0, m_twoSided);
+	return true;
+}
+
 Spectrum DiffuseAreaLight::sample_Li(const Interaction& ref, const Vector2f& u, Vector3f& wi,
 	Float& pdf, VisibilityTester& vis) const
 {
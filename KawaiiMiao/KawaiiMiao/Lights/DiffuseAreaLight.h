@@ -31,6 +31,8 @@ public:
 
 	virtual void pdf_Le(const Ray&, const Vector3f&, Float& pdfPos, Float& pdfDir) const override;
 
+	virtual bool bounds(LightBounds& lb) const override;
+
 	virtual std::string toString() const override { return "DiffuseAreaLight[]"; }
 
 	virtual void setParent(AObject* parent) override;
@@ -5,6 +5,10 @@
 #include <glm/glm/common.hpp>
 #include <glm/glm/gtc/quaternion.hpp>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 RENDER_BEGIN
 
 template <typename T>
@@ -225,8 +229,8 @@ public:
 
 	void boundingSphere(Vector3<T>* center, Float* radius) const
 	{
-		*center = (m_pMin + m_pMax) / 2;
-		*radius = Inside(*center, *this) ? Distance(*center, m_pMax) : 0;
+		*center = (m_pMin + m_pMax) / T(2);
+		*radius = inside(*center, *this) ? distance(*center, m_pMax) : 0;
 	}
 
 	template <typename U>
@@ -731,4 +735,108 @@ inline bool refract(const Vector3f& wi, const Vector3f& n, Float eta, Vector3f&
 	return true;
 }
 
+inline int countTrailingZeros(uint32_t v)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, v);
+	return (int)index;
+#else
+	return __builtin_ctz(v);
+#endif
+}
+
+inline int popCount(uint32_t v)
+{
+#if defined(_MSC_VER)
+	return (int)__popcnt(v);
+#else
+	return __builtin_popcount(v);
+#endif
+}
+
+template <typename T>
+inline bool isPowerOf2(T v) { return v && !(v & (v - 1)); }
+
+inline int32_t roundUpPow2(int32_t v)
+{
+	v--;
+	v |= v >> 1;
+	v |= v >> 2;
+	v |= v >> 4;
+	v |= v >> 8;
+	v |= v >> 16;
+	return v + 1;
+}
+
+inline int64_t roundUpPow2(int64_t v)
+{
+	v--;
+	v |= v >> 1;
+	v |= v >> 2;
+	v |= v >> 4;
+	v |= v >> 8;
+	v |= v >> 16;
+	v |= v >> 32;
+	return v + 1;
+}
+
+// Set of directions within angle acos(m_cosTheta) of the axis m_w
+struct DirectionCone
+{
+	DirectionCone() = default;
+	DirectionCone(const Vector3f& w, Float cosTheta) : m_w(normalize(w)), m_cosTheta(cosTheta) {}
+	explicit DirectionCone(const Vector3f& w) : DirectionCone(w, 1) {}
+
+	static DirectionCone entireSphere() { return DirectionCone(Vector3f(0, 0, 1), -1); }
+
+	bool isEmpty() const { return m_cosTheta == Infinity; }
+
+	Vector3f m_w = Vector3f(0, 0, 1);
+	Float m_cosTheta = Infinity;
+};
+
+// Directions from _p_ towards the bounding sphere of _b_
+inline DirectionCone boundSubtendedDirections(const Bounds3f& b, const Vector3f& p)
+{
+	Vector3f center;
+	Float radius;
+	b.boundingSphere(&center, &radius);
+	Float dist2 = distanceSquared(p, center);
+	if (dist2 < radius * radius)
+		return DirectionCone::entireSphere();
+
+	Float sin2ThetaMax = radius * radius / dist2;
+	return DirectionCone(center - p, glm::sqrt(glm::max(Float(0), 1 - sin2ThetaMax)));
+}
+
+// Smallest cone that holds both _a_ and _b_
+inline DirectionCone unionCones(const DirectionCone& a, const DirectionCone& b)
+{
+	if (a.isEmpty())
+		return b;
+	if (b.isEmpty())
+		return a;
+
+	// Return the wider cone if it already holds the other one
+	Float thetaA = glm::acos(glm::clamp(a.m_cosTheta, Float(-1), Float(1)));
+	Float thetaB = glm::acos(glm::clamp(b.m_cosTheta, Float(-1), Float(1)));
+	Float thetaD = glm::acos(glm::clamp(dot(a.m_w, b.m_w), Float(-1), Float(1)));
+	if (glm::min(thetaD + thetaB, Float(Pi)) <= thetaA)
+		return a;
+	if (glm::min(thetaD + thetaA, Float(Pi)) <= thetaB)
+		return b;
+
+	// Rotate the axis of _a_ towards _b_ until the cone spans both
+	Float thetaO = (thetaA + thetaD + thetaB) / 2;
+	if (thetaO >= Pi)
+		return DirectionCone::entireSphere();
+	Vector3f wr = cross(a.m_w, b.m_w);
+	if (lengthSquared(wr) == 0)
+		return DirectionCone::entireSphere();
+	Float thetaR = thetaO - thetaA;
+	Vector3f w = a.m_w * glm::cos(thetaR) + cross(normalize(wr), a.m_w) * glm::sin(thetaR);
+	return DirectionCone(w, glm::cos(thetaO));
+}
+
 RENDER_END
\ No newline at end of file
@@ -116,4 +116,15 @@ inline uint32_t Rng::uniformUInt32()
 	return (xorshifted >> rot) | (xorshifted << ((~rot + 1u) & 31));
 }
 
+// 64 bit finalizer of MurmurHash3
+inline uint64_t mixBits(uint64_t v)
+{
+	v ^= (v >> 31);
+	v *= 0x7fb5d329728ea185ULL;
+	v ^= (v >> 27);
+	v *= 0x81dadef4bc2dd44dULL;
+	v ^= (v >> 33);
+	return v;
+}
+
 RENDER_END
\ No newline at end of file
@@ -102,7 +102,7 @@ SurfaceInteraction Transform::operator()(const SurfaceInteraction& si) const
 
 	// Transform remaining members of _SurfaceInteraction_
 	const Transform& trans = *this;
-	ret.normal = normalize(trans(si.normal, 0.0f));
+	ret.normal = normalize(trans.normal(si.normal));
 	ret.wo = normalize(trans(si.wo, 0.0f));
 	ret.time = si.time;
 	ret.mediumInterface = si.mediumInterface;
@@ -110,14 +110,14 @@ SurfaceInteraction Transform::operator()(const SurfaceInteraction& si) const
 	ret.shape = si.shape;
 	ret.dpdu = trans(si.dpdu, 0.0f);
 	ret.dpdv = trans(si.dpdv, 0.0f);
-	ret.dndu = trans(si.dndu, 0.0f);
-	ret.dndv = trans(si.dndv, 0.0f);
+	ret.dndu = trans.normal(si.dndu);
+	ret.dndv = trans.normal(si.dndv);
 	ret.primitive = si.primitive;
-	ret.shading.n = normalize(trans(si.shading.n, 0.0f));
+	ret.shading.n = normalize(trans.normal(si.shading.n));
 	ret.shading.dpdu = trans(si.shading.dpdu, 0.0f);
 	ret.shading.dpdv = trans(si.shading.dpdv, 0.0f);
-	ret.shading.dndu = trans(si.shading.dndu, 0.0f);
-	ret.shading.dndv = trans(si.shading.dndv, 0.0f);
+	ret.shading.dndu = trans.normal(si.shading.dndu);
+	ret.shading.dndv = trans.normal(si.shading.dndv);
 	ret.dudx = si.dudx;
 	ret.dvdx = si.dvdx;
 	ret.dudy = si.dudy;
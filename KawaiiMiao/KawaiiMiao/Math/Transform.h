@@ -50,6 +50,10 @@ public:
 
 	inline Ray operator()(const Ray& r, Vector3f* oError, Vector3f* dError) const;
 
+	//Normal, transformed by the inverse transpose so that it stays perpendicular under non-uniform scale
+	template <typename T>
+	inline Vector3<T> normal(const Vector3<T>& n) const;
+
 	bool isIdentity() const
 	{
 		return (
@@ -103,6 +107,13 @@ inline Vector3<T> Transform::operator()(const Vector3<T>& p, const Float& w) con
 		return Vector3<T>(ret.x, ret.y, ret.z) / ret.w;
 }
 
+template <typename T>
+inline Vector3<T> Transform::normal(const Vector3<T>& n) const
+{
+	glm::vec<4, Float> ret = glm::transpose(m_transInv) * glm::vec<4, Float>(n.x, n.y, n.z, 0.0f);
+	return Vector3<T>(ret.x, ret.y, ret.z);
+}
+
 template <typename T>
 inline Vector3<T> Transform::operator()(const Vector3<T>& v, Vector3<T>* absError) const
 {
@@ -0,0 +1,129 @@
+#include "HaltonSampler.h"
+
+#include "../Core/LowDiscrepancy.h"
+
+RENDER_BEGIN
+
+RENDER_REGISTER_CLASS(HaltonSampler, "Halton");
+
+static const std::vector<uint16_t>& radicalInversePermutations()
+{
+	static const std::vector<uint16_t> perms = []()
+	{
+		Rng rng;
+		return computeRadicalInversePermutations(rng);
+	}();
+	return perms;
+}
+
+static void extendedGCD(int64_t a, int64_t b, int64_t& x, int64_t& y)
+{
+	if (b == 0)
+	{
+		x = 1;
+		y = 0;
+		return;
+	}
+	int64_t d = a / b, xp, yp;
+	extendedGCD(b, a % b, xp, yp);
+	x = yp;
+	y = xp - (d * yp);
+}
+
+static int64_t mod(int64_t a, int64_t b)
+{
+	int64_t result = a - (a / b) * b;
+	return result < 0 ? result + b : result;
+}
+
+static int64_t multiplicativeInverse(int64_t a, int64_t n)
+{
+	int64_t x, y;
+	extendedGCD(a, n, x, y);
+	return mod(x, n);
+}
+
+HaltonSampler::HaltonSampler(const APropertyTreeNode& node)
+	: GlobalSampler(node.getPropertyList().getInteger("SPP", 1))
+{
+	initialize();
+	activate();
+}
+
+HaltonSampler::HaltonSampler(int64_t samplesPerPixel)
+	: GlobalSampler(samplesPerPixel)
+{
+	initialize();
+}
+
+void HaltonSampler::initialize()
+{
+	m_permutations = radicalInversePermutations().data();
+
+	// Find radical inverse base scales and exponents that cover the pixel block
+	for (int i = 0; i < 2; ++i)
+	{
+		int base = (i == 0) ? 2 : 3;
+		int scale = 1, exp = 0;
+		while (scale < maxResolution)
+		{
+			scale *= base;
+			++exp;
+		}
+		m_baseScales[i] = scale;
+		m_baseExponents[i] = exp;
+	}
+
+	// Compute stride in samples for visiting each pixel area
+	m_sampleStride = (int64_t)m_baseScales[0] * m_baseScales[1];
+
+	// Compute multiplicative inverses for _m_baseScales_
+	m_multInverse[0] = multiplicativeInverse(m_baseScales[1], m_baseScales[0]);
+	m_multInverse[1] = multiplicativeInverse(m_baseScales[0], m_baseScales[1]);
+}
+
+int64_t HaltonSampler::getIndexForSample(int64_t sampleNum)
+{
+	Vector2i pixel(m_currentPixel);
+	if (pixel != m_pixelForOffset)
+	{
+		// Compute Halton sample offset for the current pixel, the index of its first sample
+		// follows from the Chinese remainder theorem on the two scaled dimensions
+		m_offsetForCurrentPixel = 0;
+		Vector2i pm(mod(pixel.x, maxResolution), mod(pixel.y, maxResolution));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t dimOffset = (i == 0) ? inverseRadicalInverse<2>(pm[i], m_baseExponents[i])
+				: inverseRadicalInverse<3>(pm[i], m_baseExponents[i]);
+			m_offsetForCurrentPixel += dimOffset * (m_sampleStride / m_baseScales[i]) * m_multInverse[i];
+		}
+		m_offsetForCurrentPixel %= m_sampleStride;
+		m_pixelForOffset = pixel;
+	}
+	return m_offsetForCurrentPixel + sampleNum * m_sampleStride;
+}
+
+Float HaltonSampler::sampleDimension(int64_t index, int dim) const
+{
+	if (dim == 0)
+		return radicalInverse(dim, index >> m_baseExponents[0]);
+	else if (dim == 1)
+		return radicalInverse(dim, index / m_baseScales[1]);
+
+	// Past the prime table the higher dimensions are reused
+	if (dim >= PrimeTableSize)
+		dim = 2 + (dim - 2) % (PrimeTableSize - 2);
+	return scrambledRadicalInverse(dim, index, permutationForDimension(dim));
+}
+
+const uint16_t* HaltonSampler::permutationForDimension(int dim) const
+{
+	return &m_permutations[PrimeSums[dim]];
+}
+
+std::unique_ptr<Sampler> HaltonSampler::clone(int seed)
+{
+	return std::unique_ptr<Sampler>(new HaltonSampler(*this));
+}
+
+RENDER_END
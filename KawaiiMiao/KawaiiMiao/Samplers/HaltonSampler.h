@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../Core/Sampler.h"
+
+RENDER_BEGIN
+
+// Scrambled Halton sequence over the image plane. The first two dimensions are scaled so that
+// every pixel of a 128 x 128 block gets its own interleaved subsequence, larger images repeat the block.
+class HaltonSampler final : public GlobalSampler
+{
+public:
+	typedef std::shared_ptr<HaltonSampler> ptr;
+
+	HaltonSampler(const APropertyTreeNode& node);
+	HaltonSampler(int64_t samplesPerPixel);
+
+	virtual int64_t getIndexForSample(int64_t sampleNum) override;
+	virtual Float sampleDimension(int64_t index, int dimension) const override;
+
+	virtual std::unique_ptr<Sampler> clone(int seed) override;
+
+	virtual std::string toString() const override { return "HaltonSampler[]"; }
+
+private:
+	void initialize();
+
+	const uint16_t* permutationForDimension(int dim) const;
+
+	static constexpr int maxResolution = 128;
+
+	const uint16_t* m_permutations; // Digit permutations shared by all instances
+	Vector2i m_baseScales, m_baseExponents;
+	int64_t m_sampleStride;
+	int64_t m_multInverse[2];
+	Vector2i m_pixelForOffset = Vector2i(std::numeric_limits<int>::max());
+	int64_t m_offsetForCurrentPixel = 0;
+};
+
+RENDER_END
@@ -12,7 +12,7 @@ RandomSampler::RandomSampler(const APropertyTreeNode& node)
 
 
 RandomSampler::RandomSampler(int ns, int seed)
-	: Sampler(ns), m_rng(seed)
+	: Sampler(ns), m_rng(seed), m_seed(seed)
 {
 
 }
@@ -32,12 +32,15 @@ Vector2f RandomSampler::get2D()
 std::unique_ptr<Sampler> RandomSampler::clone(int seed)
 {
 	RandomSampler* rs = new RandomSampler(*this);
-	rs->m_rng.setSequence(seed);
+	rs->m_seed = seed;
 	return std::unique_ptr<Sampler>(rs);
 }
 
 void RandomSampler::startPixel(const Vector2i& p)
 {
+	// Every pixel and pass gets its own stream, however the tiles were split
+	m_rng.setSequence(pixelHash(p) ^ mixBits((uint64_t)m_seed));
+
 	for (size_t i = 0; i < m_sampleArray1D.size(); ++i)
 		for (size_t j = 0; j < m_sampleArray1D[i].size(); ++j)
 			m_sampleArray1D[i][j] = m_rng.uniformFloat();
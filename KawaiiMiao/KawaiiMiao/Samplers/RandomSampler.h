@@ -24,5 +24,6 @@ public:
 
 private:
 	Rng m_rng; //Random number generator
+	int m_seed = 0;
 };
 RENDER_END
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "SobolSampler.h"
+
+#include "../Core/LowDiscrepancy.h"
+#include "../Math/Rng.h"
+
+RENDER_BEGIN
+
+RENDER_REGISTER_CLASS(SobolSampler, "Sobol");
+
+SobolSampler::SobolSampler(const APropertyTreeNode& node)
+	: GlobalSampler(roundUpSampleCount(node.getPropertyList().getInteger("SPP", 1), "SobolSampler"))
+{
+	activate();
+}
+
+SobolSampler::SobolSampler(int64_t samplesPerPixel)
+	: GlobalSampler(roundUpSampleCount(samplesPerPixel, "SobolSampler"))
+{
+
+}
+
+void SobolSampler::startPixel(const Vector2i& p)
+{
+	// The scramble only depends on the pixel, so that the passes of a progressive render
+	// continue the same sequence
+	m_pixelHash = pixelHash(p);
+	GlobalSampler::startPixel(p);
+}
+
+Float SobolSampler::sampleDimension(int64_t index, int dim) const
+{
+	// Past the generator matrices the higher dimensions are reused
+	if (dim >= NumSobolDimensions)
+		dim = 2 + (dim - 2) % (NumSobolDimensions - 2);
+	uint32_t scramble = (uint32_t)mixBits(m_pixelHash ^ ((uint64_t)dim * 0x9e3779b97f4a7c15ULL));
+	return sobolSample(index, dim, scramble);
+}
+
+std::unique_ptr<Sampler> SobolSampler::clone(int seed)
+{
+	return std::unique_ptr<Sampler>(new SobolSampler(*this));
+}
+
+RENDER_END
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../Core/Sampler.h"
+
+RENDER_BEGIN
+
+// Sobol sequence inside every pixel. The points of a pixel are decorrelated from its neighbours
+// by a random digital shift per pixel and dimension, which keeps the (0,2)-net structure of the
+// first two dimensions. Sample counts are rounded up to powers of two.
+class SobolSampler final : public GlobalSampler
+{
+public:
+	typedef std::shared_ptr<SobolSampler> ptr;
+
+	SobolSampler(const APropertyTreeNode& node);
+	SobolSampler(int64_t samplesPerPixel);
+
+	virtual void startPixel(const Vector2i& p) override;
+
+	virtual int64_t getIndexForSample(int64_t sampleNum) override { return sampleNum; }
+	virtual Float sampleDimension(int64_t index, int dimension) const override;
+
+	virtual int roundCount(int n) const override { return roundUpPow2(n); }
+
+	virtual std::unique_ptr<Sampler> clone(int seed) override;
+
+	virtual std::string toString() const override { return "SobolSampler[]"; }
+
+private:
+	uint64_t m_pixelHash = 0;
+};
+
+RENDER_END
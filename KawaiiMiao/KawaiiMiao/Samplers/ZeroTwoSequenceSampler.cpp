@@ -0,0 +1,92 @@
+#include "ZeroTwoSequenceSampler.h"
+
+#include "../Core/LowDiscrepancy.h"
+
+RENDER_BEGIN
+
+RENDER_REGISTER_CLASS(ZeroTwoSequenceSampler, "ZeroTwoSequence");
+
+ZeroTwoSequenceSampler::ZeroTwoSequenceSampler(const APropertyTreeNode& node)
+	: Sampler(roundUpSampleCount(node.getPropertyList().getInteger("SPP", 1), "ZeroTwoSequenceSampler")),
+	m_rng(0)
+{
+	initialize(node.getPropertyList().getInteger("Dimensions", 4));
+	activate();
+}
+
+ZeroTwoSequenceSampler::ZeroTwoSequenceSampler(int64_t samplesPerPixel, int nSampledDimensions, int seed)
+	: Sampler(roundUpSampleCount(samplesPerPixel, "ZeroTwoSequenceSampler")), m_rng(seed), m_seed(seed)
+{
+	initialize(nSampledDimensions);
+}
+
+void ZeroTwoSequenceSampler::initialize(int nSampledDimensions)
+{
+	for (int i = 0; i < nSampledDimensions; ++i)
+	{
+		m_samples1D.push_back(std::vector<Float>(samplesPerPixel));
+		m_samples2D.push_back(std::vector<Vector2f>(samplesPerPixel));
+	}
+}
+
+void ZeroTwoSequenceSampler::startPixel(const Vector2i& p)
+{
+	// Note: the scramble depends on the pixel only, so every pass of a progressive
+	//       render takes its samples from the same (0,2)-sequence
+	m_rng.setSequence(pixelHash(p));
+
+	// Generate 1D and 2D pixel sample components using (0,2)-sequence
+	for (size_t i = 0; i < m_samples1D.size(); ++i)
+		vanDerCorput(1, (int)samplesPerPixel, &m_samples1D[i][0], m_rng);
+	for (size_t i = 0; i < m_samples2D.size(); ++i)
+		sobol2D(1, (int)samplesPerPixel, &m_samples2D[i][0], m_rng);
+
+	// Generate 1D and 2D array samples using (0,2)-sequence
+	for (size_t i = 0; i < m_samples1DArraySizes.size(); ++i)
+		vanDerCorput(m_samples1DArraySizes[i], (int)samplesPerPixel, &m_sampleArray1D[i][0], m_rng);
+	for (size_t i = 0; i < m_samples2DArraySizes.size(); ++i)
+		sobol2D(m_samples2DArraySizes[i], (int)samplesPerPixel, &m_sampleArray2D[i][0], m_rng);
+
+	// Dimensions beyond the sequence fall back to uniform random numbers, which differ per pass
+	m_rng.setSequence(pixelHash(p) ^ mixBits((uint64_t)m_seed));
+
+	m_current1DDimension = m_current2DDimension = 0;
+	Sampler::startPixel(p);
+}
+
+bool ZeroTwoSequenceSampler::startNextSample()
+{
+	m_current1DDimension = m_current2DDimension = 0;
+	return Sampler::startNextSample();
+}
+
+bool ZeroTwoSequenceSampler::setSampleNumber(int64_t sampleNum)
+{
+	m_current1DDimension = m_current2DDimension = 0;
+	return Sampler::setSampleNumber(sampleNum);
+}
+
+Float ZeroTwoSequenceSampler::get1D()
+{
+	CHECK_LT(m_currentPixelSampleIndex, samplesPerPixel);
+	if (m_current1DDimension < (int)m_samples1D.size())
+		return m_samples1D[m_current1DDimension++][m_currentPixelSampleIndex];
+	return m_rng.uniformFloat();
+}
+
+Vector2f ZeroTwoSequenceSampler::get2D()
+{
+	CHECK_LT(m_currentPixelSampleIndex, samplesPerPixel);
+	if (m_current2DDimension < (int)m_samples2D.size())
+		return m_samples2D[m_current2DDimension++][m_currentPixelSampleIndex];
+	return { m_rng.uniformFloat(), m_rng.uniformFloat() };
+}
+
+std::unique_ptr<Sampler> ZeroTwoSequenceSampler::clone(int seed)
+{
+	ZeroTwoSequenceSampler* zs = new ZeroTwoSequenceSampler(*this);
+	zs->m_seed = seed;
+	return std::unique_ptr<Sampler>(zs);
+}
+
+RENDER_END
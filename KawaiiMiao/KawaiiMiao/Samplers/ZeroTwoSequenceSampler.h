@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../Core/Sampler.h"
+#include "../Math/Rng.h"
+
+RENDER_BEGIN
+
+// Scrambled (0,2)-sequence per pixel. The first "Dimensions" 1D and 2D dimensions of every
+// pixel are precomputed as shuffled, stratified sets, dimensions past them fall back to
+// uniform random numbers. Sample counts are rounded up to powers of two.
+class ZeroTwoSequenceSampler final : public Sampler
+{
+public:
+	typedef std::shared_ptr<ZeroTwoSequenceSampler> ptr;
+
+	ZeroTwoSequenceSampler(const APropertyTreeNode& node);
+	ZeroTwoSequenceSampler(int64_t samplesPerPixel, int nSampledDimensions = 4, int seed = 0);
+
+	virtual void startPixel(const Vector2i& p) override;
+	virtual bool startNextSample() override;
+	virtual bool setSampleNumber(int64_t sampleNum) override;
+
+	virtual Float get1D() override;
+	virtual Vector2f get2D() override;
+
+	virtual int roundCount(int n) const override { return roundUpPow2(n); }
+
+	virtual std::unique_ptr<Sampler> clone(int seed) override;
+
+	virtual std::string toString() const override { return "ZeroTwoSequenceSampler[]"; }
+
+private:
+	void initialize(int nSampledDimensions);
+
+	std::vector<std::vector<Float>> m_samples1D;
+	std::vector<std::vector<Vector2f>> m_samples2D;
+	int m_current1DDimension = 0, m_current2DDimension = 0;
+	Rng m_rng;
+	int m_seed = 0;
+};
+
+RENDER_END
@@ -167,11 +167,8 @@ bool SphereShape::hit(const Ray& r) const
 	return true;
 }
 
-bool SphereShape::hit(const Ray& r, Float& tHit, SurfaceInteraction& isect) const
+bool SphereShape::hit(const Ray& r, Float& tHit, Vector3f& barycentric) const
 {
-	Float phi;
-	Vector3f pHit;
-
 	// Transform Ray to object space
 	Ray ray = (*m_worldToObject)(r);
 
@@ -202,7 +199,19 @@ bool SphereShape::hit(const Ray& r, Float& tHit, SurfaceInteraction& isect) cons
 			return false;
 	}
 
-	pHit = ray((Float)tShapeHit);
+	tHit = tShapeHit;
+	return true;
+}
+
+void SphereShape::fillSurfaceInteraction(const Ray& r, Float tHit, const Vector3f& barycentric,
+	SurfaceInteraction& isect) const
+{
+	Float phi;
+	Vector3f pHit;
+
+	// Transform Ray to object space
+	Ray ray = (*m_worldToObject)(r);
+	pHit = ray(tHit);
 
 	// Refine sphere intersection point
 	pHit *= m_radius / distance(pHit, Vector3f(0, 0, 0));
@@ -231,10 +240,6 @@ bool SphereShape::hit(const Ray& r, Float& tHit, SurfaceInteraction& isect) cons
 		dpdu, dpdv, this));
 
 	isect.normal = faceforward(isect.normal, isect.wo);
-
-	tHit = tShapeHit;
-
-	return true;
 }
 
 Float SphereShape::solidAngle(const Vector3f& p, int nSamples) const
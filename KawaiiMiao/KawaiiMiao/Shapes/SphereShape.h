@@ -23,8 +23,11 @@ public:
 
 	virtual Bounds3f objectBound() const override;
 
+	using Shape::hit;
 	virtual bool hit(const Ray& ray) const override;
-	virtual bool hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const override;
+	virtual bool hit(const Ray& ray, Float& tHit, Vector3f& barycentric) const override;
+	virtual void fillSurfaceInteraction(const Ray& ray, Float tHit, const Vector3f& barycentric,
+		SurfaceInteraction& isect) const override;
 
 	virtual Float solidAngle(const Vector3f& p, int nSamples = 512) const override;
 
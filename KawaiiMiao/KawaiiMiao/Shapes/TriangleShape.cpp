@@ -106,7 +106,7 @@ TriangleMesh::TriangleMesh(Transform* objectToWorld, const std::string& filename
 		m_position[i] = (*objectToWorld)(gPosition[i], 1.0f);
 		if (m_normal != nullptr)
 		{
-			m_normal[i] = (*objectToWorld)(gNormal[i], 0.0f);
+			m_normal[i] = normalize(objectToWorld->normal(gNormal[i]));
 		}
 		if (m_uv != nullptr)
 		{
@@ -118,72 +118,28 @@ TriangleMesh::TriangleMesh(Transform* objectToWorld, const std::string& filename
 	m_indices.assign(gIndices.begin(), gIndices.end());
 }
 
-//-------------------------------------------TriangleShape-------------------------------------
-
-RENDER_REGISTER_CLASS(TriangleShape, "Triangle");
-
-TriangleShape::TriangleShape(const APropertyTreeNode& node)
-	:Shape(node.getPropertyList())
-{
-
-}
-
-TriangleShape::TriangleShape(Transform* objectToWorld, Transform* worldToObject,
-	std::array<int, 3> indices, TriangleMesh* mesh) 
-	: Shape(objectToWorld, worldToObject), m_indices(indices), m_mesh(mesh) 
-{
-
-}
-
-Bounds3f TriangleShape::objectBound() const
+Bounds3f TriangleMesh::triangleBound(int triangle) const
 {
-	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
-	return unionBounds(Bounds3f((*m_worldToObject)(p0, 1.0f), (*m_worldToObject)(p1, 1.0f)), (*m_worldToObject)(p2, 1.0f));
+	return unionBounds(Bounds3f(getTriangleVertex(triangle, 0), getTriangleVertex(triangle, 1)),
+		getTriangleVertex(triangle, 2));
 }
 
-Bounds3f TriangleShape::worldBound() const
+size_t TriangleMesh::memoryBytes() const
 {
-	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
-	return unionBounds(Bounds3f(p0, p1), p2);
+	size_t bytes = sizeof(TriangleMesh) + m_nVertices * sizeof(Vector3f) + m_indices.capacity() * sizeof(int);
+	if (hasNormal())
+		bytes += m_nVertices * sizeof(Vector3f);
+	if (hasUV())
+		bytes += m_nVertices * sizeof(Vector2f);
+	return bytes;
 }
 
-Float TriangleShape::area() const
+bool TriangleMesh::hitTriangle(int triangle, const Ray& ray) const
 {
 	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
-	return 0.5 * length(cross(p1 - p0, p2 - p0));
-}
-
-Interaction TriangleShape::sample(const Vector2f& u, Float& pdf) const
-{
-	Vector2f b = uniformSampleTriangle(u);
-	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
-	Interaction it;
-	it.p = b[0] * p0 + b[1] * p1 + (1 - b[0] - b[1]) * p2;
-	// Compute surface normal for sampled point on triangle
-	it.normal = normalize(Vector3f(cross(p1 - p0, p2 - p0)));
-
-	pdf = 1 / area();
-	return it;
-}
-
-bool TriangleShape::hit(const Ray& ray) const
-{
-	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
+	const auto& p0 = getTriangleVertex(triangle, 0);
+	const auto& p1 = getTriangleVertex(triangle, 1);
+	const auto& p2 = getTriangleVertex(triangle, 2);
 
 	// Perform ray--triangle intersection test
 
@@ -284,12 +240,12 @@ bool TriangleShape::hit(const Ray& ray) const
 	return true;
 }
 
-bool TriangleShape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const
+bool TriangleMesh::hitTriangle(int triangle, const Ray& ray, Float& tHit, Vector3f& barycentric) const
 {
 	// Get triangle vertices in _p0_, _p1_, and _p2_
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
+	const auto& p0 = getTriangleVertex(triangle, 0);
+	const auto& p1 = getTriangleVertex(triangle, 1);
+	const auto& p2 = getTriangleVertex(triangle, 2);
 
 	// Perform ray--triangle intersection test
 
@@ -387,14 +343,31 @@ bool TriangleShape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect)
 	if (t <= deltaT)
 		return false;
 
+	// The triangle is actually degenerate; the intersection is bogus.
+	if (lengthSquared(cross(p2 - p0, p1 - p0)) == 0)
+		return false;
+
+	tHit = t;
+	barycentric = Vector3f(b0, b1, b2);
+	return true;
+}
+
+void TriangleMesh::fillTriangleInteraction(int triangle, const Ray& ray, const Vector3f& barycentric,
+	const Shape* shape, SurfaceInteraction& isect) const
+{
+	const auto& p0 = getTriangleVertex(triangle, 0);
+	const auto& p1 = getTriangleVertex(triangle, 1);
+	const auto& p2 = getTriangleVertex(triangle, 2);
+	Float b0 = barycentric[0], b1 = barycentric[1], b2 = barycentric[2];
+
 	// Compute triangle partial derivatives
 	Vector3f dpdu, dpdv;
 	Vector2f uv[3];
-	if (m_mesh->hasUV())
+	if (hasUV())
 	{
-		uv[0] = m_mesh->getUV(m_indices[0]);
-		uv[1] = m_mesh->getUV(m_indices[1]);
-		uv[2] = m_mesh->getUV(m_indices[2]);
+		uv[0] = m_uv[m_indices[3 * triangle + 0]];
+		uv[1] = m_uv[m_indices[3 * triangle + 1]];
+		uv[2] = m_uv[m_indices[3 * triangle + 2]];
 	}
 	else
 	{
@@ -417,11 +390,8 @@ bool TriangleShape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect)
 	if (degenerateUV || lengthSquared(cross(dpdu, dpdv)) == 0)
 	{
 		// Handle zero determinant for triangle partial derivative matrix
+		// Note: degenerate triangles are already rejected by the hit test
 		Vector3f ng = cross(p2 - p0, p1 - p0);
-		// The triangle is actually degenerate; the intersection is bogus.
-		if (lengthSquared(ng) == 0)
-			return false;
-
 		coordinateSystem(normalize(ng), dpdu, dpdv);
 	}
 
@@ -430,17 +400,16 @@ bool TriangleShape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect)
 	Vector2f uvHit = b0 * uv[0] + b1 * uv[1] + b2 * uv[2];
 
 	// Fill in _SurfaceInteraction_ from triangle hit
-	isect = SurfaceInteraction(pHit, uvHit, -ray.direction(), dpdu, dpdv, this);
+	isect = SurfaceInteraction(pHit, uvHit, -ray.direction(), dpdu, dpdv, shape);
 
 	// Override surface normal in _isect_ for triangle
 	isect.normal = Vector3f(normalize(cross(dp02, dp12)));
-	tHit = t;
 
-	if (m_mesh->hasNormal())
+	if (hasNormal())
 	{
 		Vector3f ns;
-		ns = b0 * m_mesh->getNormal(m_indices[0]) + b1 * m_mesh->getNormal(m_indices[1])
-			+ b2 * m_mesh->getNormal(m_indices[2]);
+		ns = b0 * m_normal[m_indices[3 * triangle + 0]] + b1 * m_normal[m_indices[3 * triangle + 1]]
+			+ b2 * m_normal[m_indices[3 * triangle + 2]];
 		if (lengthSquared(ns) > 0)
 		{
 			ns = normalize(ns);
@@ -451,16 +420,99 @@ bool TriangleShape::hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect)
 		}
 		isect.normal = ns;
 	}
+}
 
-	return true;
+//-------------------------------------------TriangleShape-------------------------------------
+
+RENDER_REGISTER_CLASS(TriangleShape, "Triangle");
+
+TriangleShape::TriangleShape(const APropertyTreeNode& node)
+	:Shape(node.getPropertyList())
+{
+
+}
+
+TriangleShape::TriangleShape(Transform* objectToWorld, Transform* worldToObject,
+	int triangle, TriangleMesh* mesh)
+	: Shape(objectToWorld, worldToObject), m_mesh(mesh), m_triangle(triangle)
+{
+
+}
+
+Bounds3f TriangleShape::objectBound() const
+{
+	// Get triangle vertices in _p0_, _p1_, and _p2_
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
+	return unionBounds(Bounds3f((*m_worldToObject)(p0, 1.0f), (*m_worldToObject)(p1, 1.0f)), (*m_worldToObject)(p2, 1.0f));
+}
+
+Bounds3f TriangleShape::worldBound() const
+{
+	// Get triangle vertices in _p0_, _p1_, and _p2_
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
+	return unionBounds(Bounds3f(p0, p1), p2);
+}
+
+Float TriangleShape::area() const
+{
+	// Get triangle vertices in _p0_, _p1_, and _p2_
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
+	return 0.5 * length(cross(p1 - p0, p2 - p0));
+}
+
+Interaction TriangleShape::sample(const Vector2f& u, Float& pdf) const
+{
+	Vector2f b = uniformSampleTriangle(u);
+	// Get triangle vertices in _p0_, _p1_, and _p2_
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
+	Interaction it;
+	it.p = b[0] * p0 + b[1] * p1 + (1 - b[0] - b[1]) * p2;
+	// Compute surface normal for sampled point on triangle
+	it.normal = normalize(Vector3f(cross(p1 - p0, p2 - p0)));
+
+	pdf = 1 / area();
+	return it;
+}
+
+DirectionCone TriangleShape::normalBounds() const
+{
+	// Same normal as sample()
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
+	return DirectionCone(cross(p1 - p0, p2 - p0));
+}
+
+bool TriangleShape::hit(const Ray& ray) const
+{
+	return m_mesh->hitTriangle(m_triangle, ray);
+}
+
+bool TriangleShape::hit(const Ray& ray, Float& tHit, Vector3f& barycentric) const
+{
+	return m_mesh->hitTriangle(m_triangle, ray, tHit, barycentric);
+}
+
+void TriangleShape::fillSurfaceInteraction(const Ray& ray, Float tHit, const Vector3f& barycentric,
+	SurfaceInteraction& isect) const
+{
+	m_mesh->fillTriangleInteraction(m_triangle, ray, barycentric, this, isect);
 }
 
 Float TriangleShape::solidAngle(const Vector3f& p, int nSamples) const
 {
 	// Project the vertices into the unit sphere around p.
-	const auto& p0 = m_mesh->getPosition(m_indices[0]);
-	const auto& p1 = m_mesh->getPosition(m_indices[1]);
-	const auto& p2 = m_mesh->getPosition(m_indices[2]);
+	const auto& p0 = m_mesh->getTriangleVertex(m_triangle, 0);
+	const auto& p1 = m_mesh->getTriangleVertex(m_triangle, 1);
+	const auto& p2 = m_mesh->getTriangleVertex(m_triangle, 2);
 	std::array<Vector3f, 3> pSphere = { normalize(p0 - p), normalize(p1 - p), normalize(p2 - p) };
 
 	// http://math.stackexchange.com/questions/9819/area-of-a-spherical-triangle
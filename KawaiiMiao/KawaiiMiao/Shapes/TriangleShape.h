@@ -24,6 +24,21 @@ public:
 
 	const std::vector<int>& getIndices() const { return m_indices; }
 
+	// World space position of vertex 0, 1 or 2 of _triangle_
+	const Vector3f& getTriangleVertex(int triangle, int vertex) const { return m_position[m_indices[3 * triangle + vertex]]; }
+	Bounds3f triangleBound(int triangle) const;
+
+	// Watertight ray-triangle tests, shared by TriangleShape and the triangles of a MeshPrimitive.
+	// Degenerate triangles are only rejected by the closest-hit test.
+	bool hitTriangle(int triangle, const Ray& ray) const;
+	bool hitTriangle(int triangle, const Ray& ray, Float& tHit, Vector3f& barycentric) const;
+	// Differentials, normals and uv of a hit, _shape_ is recorded in _isect_ and may be nullptr
+	void fillTriangleInteraction(int triangle, const Ray& ray, const Vector3f& barycentric,
+		const Shape* shape, SurfaceInteraction& isect) const;
+
+	// Bytes taken by the vertex and index data
+	size_t memoryBytes() const;
+
 private:
 
 	// TriangleMesh Data
@@ -41,7 +56,7 @@ public:
 
 	TriangleShape(const APropertyTreeNode& node);
 	TriangleShape(Transform* objectToWorld, Transform* worldToObject,
-		std::array<int, 3> indices, TriangleMesh* mesh);
+		int triangle, TriangleMesh* mesh);
 
 	virtual ~TriangleShape() = default;
 
@@ -52,16 +67,24 @@ public:
 	virtual Bounds3f objectBound() const override;
 	virtual Bounds3f worldBound() const override;
 
+	using Shape::hit;
 	virtual bool hit(const Ray& ray) const override;
-	virtual bool hit(const Ray& ray, Float& tHit, SurfaceInteraction& isect) const override;
+	virtual bool hit(const Ray& ray, Float& tHit, Vector3f& barycentric) const override;
+	virtual void fillSurfaceInteraction(const Ray& ray, Float tHit, const Vector3f& barycentric,
+		SurfaceInteraction& isect) const override;
 
 	virtual Float solidAngle(const Vector3f& p, int nSamples = 512) const override;
 
+	virtual DirectionCone normalBounds() const override;
+
+	// World space position of vertex 0, 1 or 2
+	const Vector3f& getVertex(int vertex) const { return m_mesh->getTriangleVertex(m_triangle, vertex); }
+
 	virtual std::string toString() const override { return "TriangleShape[]"; }
 
 private:
 	TriangleMesh* m_mesh;
-	std::array<int, 3> m_indices;
+	int m_triangle;
 };
 
 RENDER_END
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "ImageIO.h"
+
+#include "Parallel.h"
+#include "Logger.h"
+#include "../extern/stb_image_write.h"
+
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+RENDER_BEGIN
+
+//Note: all writers assume a little endian host, as PFM with a negative scale and EXR require
+
+bool writeImagePFM(const std::string& filename, const float* data, int width, int height, int nChannels)
+{
+	DCHECK(nChannels == 1 || nChannels == 3);
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		K_ERROR("Could not open the image file: {0}", filename);
+		return false;
+	}
+
+	// "PF" for RGB, "Pf" for grey, a negative scale marks little endian data
+	out << (nChannels == 3 ? "PF" : "Pf") << "\n" << width << " " << height << "\n-1\n";
+
+	// Scanlines are stored from the bottom to the top
+	const size_t rowSize = (size_t)width * nChannels;
+	for (int y = height - 1; y >= 0; --y)
+	{
+		out.write(reinterpret_cast<const char*>(data + y * rowSize), rowSize * sizeof(float));
+	}
+
+	if (!out)
+	{
+		K_ERROR("Failed to write the image file: {0}", filename);
+		return false;
+	}
+	return true;
+}
+
+bool writeImageHDR(const std::string& filename, const float* data, int width, int height, int nChannels)
+{
+	DCHECK(nChannels == 1 || nChannels == 3);
+	if (stbi_write_hdr(filename.c_str(), width, height, nChannels, data) == 0)
+	{
+		K_ERROR("Failed to write the image file: {0}", filename);
+		return false;
+	}
+	return true;
+}
+
+namespace
+{
+	class EXRHeaderWriter
+	{
+	public:
+		void attribute(const char* name, const char* type, const void* value, int32_t size)
+		{
+			append(name, std::strlen(name) + 1);
+			append(type, std::strlen(type) + 1);
+			append(&size, sizeof(size));
+			append(value, size);
+		}
+
+		void append(const void* data, size_t size)
+		{
+			const char* bytes = static_cast<const char*>(data);
+			m_bytes.insert(m_bytes.end(), bytes, bytes + size);
+		}
+
+		std::vector<char> m_bytes;
+	};
+}
+
+bool writeImageEXR(const std::string& filename, std::vector<ImageChannel> channels, int width, int height)
+{
+	DCHECK(!channels.empty());
+	std::sort(channels.begin(), channels.end(),
+		[](const ImageChannel& a, const ImageChannel& b) { return a.m_name < b.m_name; });
+
+	EXRHeaderWriter header;
+	const uint8_t magic[4] = { 0x76, 0x2f, 0x31, 0x01 };
+	const int32_t version = 2; // Single-part scanline file
+	header.append(magic, sizeof(magic));
+	header.append(&version, sizeof(version));
+
+	// Channel list: name, pixel type (2 = FLOAT), pLinear, 3 reserved bytes, x and y sampling
+	{
+		EXRHeaderWriter chlist;
+		for (const auto& channel : channels)
+		{
+			const int32_t pixelType = 2, sampling = 1;
+			const uint8_t linearAndReserved[4] = { 0, 0, 0, 0 };
+			chlist.append(channel.m_name.c_str(), channel.m_name.size() + 1);
+			chlist.append(&pixelType, sizeof(pixelType));
+			chlist.append(linearAndReserved, sizeof(linearAndReserved));
+			chlist.append(&sampling, sizeof(sampling));
+			chlist.append(&sampling, sizeof(sampling));
+		}
+		chlist.append("", 1);
+		header.attribute("channels", "chlist", chlist.m_bytes.data(), (int32_t)chlist.m_bytes.size());
+	}
+
+	const uint8_t noCompression = 0, increasingY = 0;
+	const int32_t window[4] = { 0, 0, width - 1, height - 1 };
+	const float pixelAspectRatio = 1.0f, screenWindowWidth = 1.0f;
+	const float screenWindowCenter[2] = { 0.0f, 0.0f };
+	header.attribute("compression", "compression", &noCompression, 1);
+	header.attribute("dataWindow", "box2i", window, sizeof(window));
+	header.attribute("displayWindow", "box2i", window, sizeof(window));
+	header.attribute("lineOrder", "lineOrder", &increasingY, 1);
+	header.attribute("pixelAspectRatio", "float", &pixelAspectRatio, sizeof(float));
+	header.attribute("screenWindowCenter", "v2f", screenWindowCenter, sizeof(screenWindowCenter));
+	header.attribute("screenWindowWidth", "float", &screenWindowWidth, sizeof(float));
+	header.append("", 1);
+
+	// One block per scanline: y, data size, then the row of every channel in turn.
+	// Blocks have a fixed size, so they are filled in parallel straight into the file image.
+	const size_t rowBytes = (size_t)width * sizeof(float);
+	const size_t blockBytes = 2 * sizeof(int32_t) + channels.size() * rowBytes;
+	const size_t firstBlock = header.m_bytes.size() + (size_t)height * sizeof(uint64_t);
+	std::vector<char> file(firstBlock + (size_t)height * blockBytes);
+	std::memcpy(file.data(), header.m_bytes.data(), header.m_bytes.size());
+
+	parallelFor((size_t)0, (size_t)height, [&](size_t y)
+	{
+		uint64_t blockOffset = firstBlock + y * blockBytes;
+		std::memcpy(&file[header.m_bytes.size() + y * sizeof(uint64_t)], &blockOffset, sizeof(uint64_t));
+
+		char* block = &file[blockOffset];
+		const int32_t lineY = (int32_t)y, dataSize = (int32_t)(blockBytes - 2 * sizeof(int32_t));
+		std::memcpy(block, &lineY, sizeof(int32_t));
+		std::memcpy(block + sizeof(int32_t), &dataSize, sizeof(int32_t));
+		block += 2 * sizeof(int32_t);
+		for (const auto& channel : channels)
+		{
+			std::memcpy(block, channel.m_data + y * width, rowBytes);
+			block += rowBytes;
+		}
+	});
+
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	out.write(file.data(), file.size());
+	if (!out)
+	{
+		K_ERROR("Failed to write the image file: {0}", filename);
+		return false;
+	}
+	return true;
+}
+
+RENDER_END
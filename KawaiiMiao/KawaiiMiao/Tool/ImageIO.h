@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+
+#include <string>
+#include <vector>
+
+RENDER_BEGIN
+
+// Float image writers. Pixel data is row major with the top row first and _nChannels_
+// interleaved floats per pixel, 1 (grey) or 3 (RGB).
+
+// Portable float map, little endian
+bool writeImagePFM(const std::string& filename, const float* data, int width, int height, int nChannels);
+
+// Radiance RGBE
+bool writeImageHDR(const std::string& filename, const float* data, int width, int height, int nChannels);
+
+// One channel of an EXR image, _data_ holds width * height floats
+struct ImageChannel
+{
+	std::string m_name;
+	const float* m_data;
+};
+
+// Single-part scanline OpenEXR with uncompressed 32-bit float channels, no external dependency.
+// Note: layers follow the EXR naming, e.g. "albedo.R", channels are sorted by name as required.
+bool writeImageEXR(const std::string& filename, std::vector<ImageChannel> channels, int width, int height);
+
+RENDER_END
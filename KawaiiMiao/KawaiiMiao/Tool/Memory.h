@@ -1,9 +1,10 @@
 #ifndef RMEMORY_H
 #define MEMORY_H
 
-#include <list>
+#include <vector>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 namespace Render
 {
@@ -31,9 +32,7 @@ namespace Render
 		MemoryArena(size_t blockSize = 262144) : blockSize(blockSize) {}
 		~MemoryArena()
 		{
-			FreeAligned(currentBlock);
-			for (auto& block : usedBlocks) FreeAligned(block.second);
-			for (auto& block : availableBlocks) FreeAligned(block.second);
+			for (auto& block : blocks) FreeAligned(block.second);
 		}
 		void* Alloc(size_t nBytes) {
 			// Round up _nBytes_ to minimum machine alignment
@@ -51,37 +50,26 @@ namespace Render
 			nBytes = (nBytes + align - 1) & ~(align - 1);
 			if (currentBlockPos + nBytes > currentAllocSize)
 			{
-				// Add current block to _usedBlocks_ list
-				if (currentBlock)
-				{
-					usedBlocks.push_back(std::make_pair(currentAllocSize, currentBlock));
-					currentBlock = nullptr;
-					currentAllocSize = 0;
-				}
-
 				// Get new block of memory for _MemoryArena_
 
-				// Try to get memory block from _availableBlocks_
-				for (auto iter = availableBlocks.begin();
-					iter != availableBlocks.end(); ++iter)
+				// Take the first unused block that is large enough, blocks before
+				// _nextBlock_ are in use since the last _Reset()_
+				size_t i = nextBlock;
+				while (i < blocks.size() && blocks[i].first < nBytes) ++i;
+				if (i == blocks.size())
 				{
-					if (iter->first >= nBytes)
-					{
-						currentAllocSize = iter->first;
-						currentBlock = iter->second;
-						availableBlocks.erase(iter);
-						break;
-					}
-				}
-				if (!currentBlock)
-				{
-					currentAllocSize = std::max(nBytes, blockSize);
-					currentBlock = AllocAligned<uint8_t>(currentAllocSize);
+					size_t size = std::max(nBytes, blockSize);
+					blocks.push_back(std::make_pair(size, AllocAligned<uint8_t>(size)));
 				}
+				std::swap(blocks[nextBlock], blocks[i]);
+				currentAllocSize = blocks[nextBlock].first;
+				currentBlock = blocks[nextBlock].second;
 				currentBlockPos = 0;
+				++nextBlock;
 			}
 			void* ret = currentBlock + currentBlockPos;
 			currentBlockPos += nBytes;
+			bytesInUse += nBytes;
 			return ret;
 		}
 
@@ -94,20 +82,26 @@ namespace Render
 			return ret;
 		}
 
+		// Make all blocks available again, the memory is kept for reuse
 		void Reset()
 		{
-			currentBlockPos = 0;
-			availableBlocks.splice(availableBlocks.begin(), usedBlocks);
+			highWater = std::max(highWater, bytesInUse);
+			bytesInUse = 0;
+			currentBlockPos = currentAllocSize = 0;
+			currentBlock = nullptr;
+			nextBlock = 0;
 		}
 
 		size_t TotalAllocated() const
 		{
-			size_t total = currentAllocSize;
-			for (const auto& alloc : usedBlocks) total += alloc.first;
-			for (const auto& alloc : availableBlocks) total += alloc.first;
+			size_t total = 0;
+			for (const auto& alloc : blocks) total += alloc.first;
 			return total;
 		}
 
+		// Most bytes handed out between two calls to _Reset()_
+		size_t HighWater() const { return std::max(highWater, bytesInUse); }
+
 	private:
 		MemoryArena(const MemoryArena&) = delete;
 		MemoryArena& operator=(const MemoryArena&) = delete;
@@ -115,7 +109,9 @@ namespace Render
 		const size_t blockSize;
 		size_t currentBlockPos = 0, currentAllocSize = 0;
 		uint8_t* currentBlock = nullptr;
-		std::list<std::pair<size_t, uint8_t*>> usedBlocks, availableBlocks;
+		size_t nextBlock = 0;
+		size_t bytesInUse = 0, highWater = 0;
+		std::vector<std::pair<size_t, uint8_t*>> blocks;
 	};
 }
 
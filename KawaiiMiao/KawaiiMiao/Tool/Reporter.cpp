@@ -15,6 +15,7 @@ Reporter::Reporter(int64_t totalWork, const std::string& title)
 	m_startTime(std::chrono::system_clock::now())
 {
 	m_workDone = 0;
+	m_waitNS = 0;
 	m_exitThread = false;
 	// Launch thread to periodically update progress bar
 	// We need to temporarily disable the profiler before launching
@@ -105,6 +106,8 @@ void Reporter::printBar()
 			printf(" (%.1fs|%.1fs)  ", seconds, std::max((Float)0., estRemaining));
 		else
 			printf(" (%.1fs|?s)  ", seconds);
+		if (m_waitNS > 0)
+			printf("[lock wait %.1fms]  ", waitMS());
 		fflush(stdout);
 	}
 }
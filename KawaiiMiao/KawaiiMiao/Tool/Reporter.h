@@ -22,6 +22,15 @@ public:
 		m_workDone += num;
 	}
 
+	// Accumulate time the workers spent blocked on locks, summed over threads
+	void addWaitTime(int64_t nanoseconds)
+	{
+		if (nanoseconds != 0)
+			m_waitNS += nanoseconds;
+	}
+
+	Float waitMS() const { return (Float)(m_waitNS.load() / 1e6); }
+
 	Float elapsedMS() const
 	{
 		std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
@@ -40,6 +49,7 @@ private:
 	const std::string m_title;
 	const std::chrono::system_clock::time_point m_startTime;
 	std::atomic<int64_t> m_workDone;
+	std::atomic<int64_t> m_waitNS;
 	std::atomic<bool> m_exitThread;
 	std::thread m_updateThread;
 };
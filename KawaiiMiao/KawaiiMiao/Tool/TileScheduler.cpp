@@ -0,0 +1,302 @@
+#include "TileScheduler.h"
+
+#include "Parallel.h"
+#include "Logger.h"
+
+#include <deque>
+#include <chrono>
+#include <algorithm>
+
+RENDER_BEGIN
+
+//-------------------------------------------ThreadPool-------------------------------------
+
+ThreadPool& ThreadPool::instance()
+{
+	static ThreadPool pool(numSystemCores());
+	return pool;
+}
+
+ThreadPool::ThreadPool(int nThreads)
+{
+	for (int i = 1; i < nThreads; ++i)
+	{
+		m_workers.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shutdown = true;
+	}
+	m_wakeup.notify_all();
+	for (auto& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::run(const std::function<void(int)>& job)
+{
+	std::lock_guard<std::mutex> runLock(m_runMutex);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_job = &job;
+		m_running = (int)m_workers.size();
+		++m_generation;
+	}
+	m_wakeup.notify_all();
+
+	job(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_finished.wait(lock, [this] { return m_running == 0; });
+	m_job = nullptr;
+}
+
+void ThreadPool::workerLoop(int threadIndex)
+{
+	uint64_t generation = 0;
+	while (true)
+	{
+		const std::function<void(int)>* job = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wakeup.wait(lock, [&] { return m_shutdown || m_generation != generation; });
+			if (m_shutdown)
+				return;
+			generation = m_generation;
+			job = m_job;
+		}
+
+		(*job)(threadIndex);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_running == 0)
+		{
+			m_finished.notify_one();
+		}
+	}
+}
+
+//-------------------------------------------TileScheduler-------------------------------------
+
+// Position of (x, y) along the Hilbert curve filling a n x n grid, n a power of two
+static uint64_t hilbertIndex(int n, int x, int y)
+{
+	uint64_t d = 0;
+	for (int s = n / 2; s > 0; s /= 2)
+	{
+		int rx = (x & s) > 0;
+		int ry = (y & s) > 0;
+		d += (uint64_t)s * s * ((3 * rx) ^ ry);
+		// Rotate the quadrant
+		if (ry == 0)
+		{
+			if (rx == 1)
+			{
+				x = s - 1 - x;
+				y = s - 1 - y;
+			}
+			std::swap(x, y);
+		}
+	}
+	return d;
+}
+
+TileScheduler::TileScheduler(const Bounds2i& sampleBounds, int tileSize, TileOrder order,
+	bool adaptive, int minTileSize)
+	: m_sampleBounds(sampleBounds), m_order(order), m_adaptive(adaptive), m_minTileSize(glm::max(1, minTileSize))
+{
+	tileSize = glm::max(tileSize, 1);
+	Vector2i sampleExtent = sampleBounds.diagonal();
+	Vector2i nTiles((sampleExtent.x + tileSize - 1) / tileSize, (sampleExtent.y + tileSize - 1) / tileSize);
+
+	struct OrderedTile
+	{
+		Bounds2i m_bounds;
+		double m_key;
+	};
+	std::vector<OrderedTile> tiles;
+	tiles.reserve(nTiles.x * nTiles.y);
+
+	int hilbertSize = 1;
+	while (hilbertSize < glm::max(nTiles.x, nTiles.y))
+		hilbertSize *= 2;
+	const Float centerX = (nTiles.x - 1) * 0.5f, centerY = (nTiles.y - 1) * 0.5f;
+
+	for (int y = 0; y < nTiles.y; ++y)
+	{
+		for (int x = 0; x < nTiles.x; ++x)
+		{
+			int x0 = sampleBounds.m_pMin.x + x * tileSize;
+			int x1 = glm::min(x0 + tileSize, sampleBounds.m_pMax.x);
+			int y0 = sampleBounds.m_pMin.y + y * tileSize;
+			int y1 = glm::min(y0 + tileSize, sampleBounds.m_pMax.y);
+
+			double key = y * nTiles.x + x;
+			if (order == TileOrder::Hilbert)
+			{
+				key = (double)hilbertIndex(hilbertSize, x, y);
+			}
+			else if (order == TileOrder::Spiral)
+			{
+				// Ring around the center first, then the angle within the ring
+				Float dx = x - centerX, dy = y - centerY;
+				Float ring = glm::max(std::abs(dx), std::abs(dy));
+				key = std::floor(ring) * 8.0 + (std::atan2(dy, dx) + Pi) / (2 * Pi);
+			}
+			tiles.push_back({ Bounds2i(Vector2i(x0, y0), Vector2i(x1, y1)), key });
+		}
+	}
+
+	std::stable_sort(tiles.begin(), tiles.end(),
+		[](const OrderedTile& a, const OrderedTile& b) { return a.m_key < b.m_key; });
+	for (const auto& tile : tiles)
+	{
+		m_tiles.push_back(tile.m_bounds);
+	}
+}
+
+namespace
+{
+	// Tiles of one thread, the owner works from the front, thieves take from the back
+	struct alignas(64) TileDeque
+	{
+		bool popFront(Bounds2i& tile)
+		{
+			tbb::spin_mutex::scoped_lock lock(m_mutex);
+			if (m_tiles.empty())
+				return false;
+			tile = m_tiles.front();
+			m_tiles.pop_front();
+			return true;
+		}
+
+		bool stealBack(Bounds2i& tile)
+		{
+			tbb::spin_mutex::scoped_lock lock(m_mutex);
+			if (m_tiles.empty())
+				return false;
+			tile = m_tiles.back();
+			m_tiles.pop_back();
+			return true;
+		}
+
+		void pushFront(const Bounds2i& tile)
+		{
+			tbb::spin_mutex::scoped_lock lock(m_mutex);
+			m_tiles.push_front(tile);
+		}
+
+		void pushBack(const Bounds2i& tile)
+		{
+			tbb::spin_mutex::scoped_lock lock(m_mutex);
+			m_tiles.push_back(tile);
+		}
+
+		tbb::spin_mutex m_mutex;
+		std::deque<Bounds2i> m_tiles;
+	};
+}
+
+void TileScheduler::run(const std::function<void(const Bounds2i&, int)>& renderTile)
+{
+	ThreadPool& pool = ThreadPool::instance();
+	const int nThreads = pool.numThreads();
+	const int nTiles = (int)m_tiles.size();
+
+	// Deal out the tiles, Hilbert order keeps neighbouring tiles on one thread
+	// while the other orders interleave so that every thread follows the order
+	std::unique_ptr<TileDeque[]> deques(new TileDeque[nThreads]);
+	for (int i = 0; i < nTiles; ++i)
+	{
+		int owner = (m_order == TileOrder::Hilbert) ? (int)((int64_t)i * nThreads / nTiles) : i % nThreads;
+		deques[owner].pushBack(m_tiles[i]);
+	}
+
+	// Tiles queued or being rendered, threads leave once it drops to zero
+	std::atomic<int> pendingTiles(nTiles);
+	std::atomic<int64_t> remainingPixels(m_sampleBounds.area());
+	std::atomic<int> nSplits(0);
+	// Measured cost of a pixel, racy updates only blur the estimate
+	std::atomic<double> secondsPerPixel(0.0);
+
+	ThreadPool::instance().run([&](int threadIndex)
+	{
+		Bounds2i tile;
+		while (pendingTiles.load() > 0)
+		{
+			bool found = deques[threadIndex].popFront(tile);
+			for (int i = 1; i < nThreads && !found; ++i)
+			{
+				found = deques[(threadIndex + i) % nThreads].stealBack(tile);
+			}
+			if (!found)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Split the tile while it would take much longer than this thread's share of the rest
+			Vector2i extent = tile.diagonal();
+			while (m_adaptive && glm::max(extent.x, extent.y) >= 2 * m_minTileSize)
+			{
+				double tilePredicted = secondsPerPixel.load() * tile.area();
+				double sharePredicted = secondsPerPixel.load() * remainingPixels.load() / nThreads;
+				if (tilePredicted == 0.0 || tilePredicted * 2 < sharePredicted)
+					break;
+
+				Vector2i mid = tile.m_pMin + Vector2i(extent.x >= 2 * m_minTileSize ? extent.x / 2 : extent.x,
+					extent.y >= 2 * m_minTileSize ? extent.y / 2 : extent.y);
+				Bounds2i quarters[4] =
+				{
+					Bounds2i(tile.m_pMin, mid),
+					Bounds2i(Vector2i(mid.x, tile.m_pMin.y), Vector2i(tile.m_pMax.x, mid.y)),
+					Bounds2i(Vector2i(tile.m_pMin.x, mid.y), Vector2i(mid.x, tile.m_pMax.y)),
+					Bounds2i(mid, tile.m_pMax)
+				};
+				for (int q = 3; q > 0; --q)
+				{
+					if (quarters[q].area() > 0)
+					{
+						pendingTiles.fetch_add(1);
+						deques[threadIndex].pushFront(quarters[q]);
+					}
+				}
+				nSplits.fetch_add(1);
+				tile = quarters[0];
+				extent = tile.diagonal();
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			renderTile(tile, threadIndex);
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			int64_t pixels = tile.area();
+			double measured = seconds / glm::max((int64_t)1, pixels);
+			double estimate = secondsPerPixel.load();
+			secondsPerPixel.store(estimate == 0.0 ? measured : 0.9 * estimate + 0.1 * measured);
+			remainingPixels.fetch_sub(pixels);
+			pendingTiles.fetch_sub(1);
+		}
+	});
+
+	m_nSplits = nSplits;
+}
+
+TileOrder TileScheduler::toTileOrder(const std::string& name)
+{
+	if (name == "Hilbert")
+		return TileOrder::Hilbert;
+	else if (name == "Spiral")
+		return TileOrder::Spiral;
+	else if (name == "Scanline")
+		return TileOrder::Scanline;
+	K_WARN("Tile order \"{0}\" unknown. Using \"Hilbert\".", name);
+	return TileOrder::Hilbert;
+}
+
+RENDER_END
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../Core/Rendering.h"
+#include "../Math/KMathUtil.h"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+RENDER_BEGIN
+
+// Persistent worker threads, created once and reused by every render pass instead of
+// spawning fresh std::threads per parallel loop.
+class ThreadPool
+{
+public:
+	static ThreadPool& instance();
+
+	// Number of threads a job runs on, the calling thread included
+	int numThreads() const { return (int)m_workers.size() + 1; }
+
+	// Run _job_(threadIndex) once on every thread and return when all of them are done.
+	// The calling thread takes index 0. Note: not reentrant, a job must not call run again.
+	void run(const std::function<void(int)>& job);
+
+private:
+	explicit ThreadPool(int nThreads);
+	~ThreadPool();
+
+	void workerLoop(int threadIndex);
+
+	std::vector<std::thread> m_workers;
+	std::mutex m_runMutex;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wakeup, m_finished;
+	const std::function<void(int)>* m_job = nullptr;
+	uint64_t m_generation = 0;
+	int m_running = 0;
+	bool m_shutdown = false;
+};
+
+// Order in which the tiles of the image are handed out
+enum class TileOrder { Scanline, Hilbert, Spiral };
+
+// Splits the sample bounds of the film into tiles and renders them on the thread pool.
+// Every thread owns a deque of tiles, takes work from its front and steals from the back
+// of the others once it runs dry.
+// With Hilbert order each thread gets a contiguous stretch of the curve for cache locality,
+// with Spiral order tiles are dealt out center first so that the preview fills in from the middle.
+// With _adaptive_ a tile is split in four when its predicted time, from the measured time
+// per pixel so far, is large compared to the work that remains, so the last tiles of a frame
+// don't leave cores idle.
+class TileScheduler
+{
+public:
+	TileScheduler(const Bounds2i& sampleBounds, int tileSize = 16, TileOrder order = TileOrder::Hilbert,
+		bool adaptive = true, int minTileSize = 4);
+
+	// Call _renderTile_(tileBounds, threadIndex) for every tile, the tiles cover the sample bounds exactly
+	void run(const std::function<void(const Bounds2i&, int)>& renderTile);
+
+	int numTiles() const { return (int)m_tiles.size(); }
+	// Number of tiles that were split during the last run
+	int numSplits() const { return m_nSplits; }
+
+	static TileOrder toTileOrder(const std::string& name);
+
+private:
+	Bounds2i m_sampleBounds;
+	std::vector<Bounds2i> m_tiles; // In the requested order
+	const TileOrder m_order;
+	const bool m_adaptive;
+	const int m_minTileSize;
+	int m_nSplits = 0;
+};
+
+RENDER_END